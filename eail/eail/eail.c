@@ -25,11 +25,18 @@
 #include <Elementary.h>
 
 #include <gmodule.h>
-#include <atk-bridge.h>
 #include "eail.h"
 #include "eail_app.h"
+#include "eail_bridge.h"
 #include "eail_priv.h"
 #include "eail_clipboard.h"
+#include "eail_factory.h"
+#include "eail_hit_grid.h"
+#include "eail_journal.h"
+#include "eail_mirror.h"
+#include "eail_property_cache.h"
+#include "eail_shared_tree.h"
+#include "eail_subscription.h"
 
 /** @brief Struct definition for listener info*/
 typedef struct _EailUtilListenerInfo EailUtilListenerInfo;
@@ -42,6 +49,7 @@ struct _EailUtilListenerInfo
    gint key; /**< @brief key of entry */
    guint signal_id;/**< @brief id of the signal */
    gulong hook_id;/**< @brief emit hook value returned on signal registration*/
+   guint subscriptions;/**< @brief EailSubscription mask taken for the signal */
 };
 
 /** @brief Struct definition for event info*/
@@ -55,6 +63,11 @@ struct _EailKeyEventInfo
 static GHashTable *listener_list = NULL;
 /** @brief Last added id of a listener */
 static gint listener_idx = 1;
+/** @brief Lock guarding listener_list and listener_idx */
+static Eina_Lock listener_lock;
+
+/** @brief Whether module was initialized and not shut down since */
+static gboolean initialized = FALSE;
 
 /**
  * @brief Domain index that will be used as the DOMAIN parameter on EINA log macros
@@ -144,6 +157,9 @@ eail_app_focus_listener_init()
 /**
  * @brief Creates and adds a listener for the given object type
  *
+ * Can be called from any thread, listener registry is guarded by
+ * listener_lock.
+ *
  * @param listener GObject Emission Hook (a simple function pointer to get
  * invoked when the signal is emitted)
  * @param object_type name string representing object's type
@@ -170,18 +186,21 @@ add_listener (GSignalEmissionHook listener,
         {
           EailUtilListenerInfo *listener_info;
 
-          rc = listener_idx;
-
           listener_info = g_malloc(sizeof(EailUtilListenerInfo));
-          listener_info->key = listener_idx;
           listener_info->hook_id =
                           g_signal_add_emission_hook (signal_id, 0, listener,
                                                       g_strdup (hook_data),
                                                       (GDestroyNotify) g_free);
           listener_info->signal_id = signal_id;
+          listener_info->subscriptions = eail_subscription_for_signal(signal);
 
+          eina_lock_take(&listener_lock);
+          rc = listener_info->key = listener_idx++;
           g_hash_table_insert(listener_list, &(listener_info->key), listener_info);
-          listener_idx++;
+          eina_lock_release(&listener_lock);
+
+          /* widgets start emitting the signal */
+          eail_subscription_add(listener_info->subscriptions);
         }
       else
         {
@@ -198,6 +217,8 @@ add_listener (GSignalEmissionHook listener,
 /**
  * @brief Removes a listener for given object type
  *
+ * Can be called from any thread.
+ *
  * @param remove_listener id of the listener to remove
  */
 static void
@@ -208,8 +229,12 @@ eail_remove_global_event_listener (guint remove_listener)
     EailUtilListenerInfo *listener_info;
     gint tmp_idx = remove_listener;
 
+    eina_lock_take(&listener_lock);
     listener_info = (EailUtilListenerInfo *)
                                  g_hash_table_lookup(listener_list, &tmp_idx);
+    if (listener_info)
+      g_hash_table_steal(listener_list, &tmp_idx);
+    eina_lock_release(&listener_lock);
 
     if (listener_info != NULL)
       {
@@ -219,15 +244,15 @@ eail_remove_global_event_listener (guint remove_listener)
             /* Remove the emission hook */
             g_signal_remove_emission_hook(listener_info->signal_id,
                                                 listener_info->hook_id);
-
-            /* Remove the element from the hash */
-            g_hash_table_remove(listener_list, &tmp_idx);
           }
         else
           {
              DBG("Invalid listener hook_id %ld or signal_id %d\n",
                             listener_info->hook_id, listener_info->signal_id);
           }
+
+        eail_subscription_remove(listener_info->subscriptions);
+        g_free(listener_info);
       }
     else
       {
@@ -303,6 +328,26 @@ static void atk_util_install(void)
    uclass->remove_key_event_listener = NULL;
 }
 
+/**
+ * @brief Sets up services used by assistive technologies
+ *
+ * Called right before ATK bridge starts, so in lazy mode nothing of it runs
+ * until accessibility is enabled. AtkMisc is used by the bridge only, the
+ * journal installs emission hooks on every state, property and bounds
+ * change, and the property cache and mirror serve AT clients. In-process
+ * consumers of the journal and property cache start them on first use.
+ */
+static void
+_eail_services_init(void)
+{
+   if (!atk_misc_instance)
+     atk_misc_instance = g_object_new(ATK_TYPE_MISC, NULL);
+
+   eail_journal_init();
+   eail_property_cache_init();
+   eail_mirror_init();
+}
+
 /**
  * @brief Function to be executed by Elementary when EAIL module is loaded
  *
@@ -312,7 +357,6 @@ static void atk_util_install(void)
 int
 elm_modapi_init(void *m)
 {
-   static gboolean initialized = FALSE;
    if (initialized) return 1;
 
    _eail_log_dom = eina_log_domain_register("eail", EAIL_LOG_COLOR);
@@ -334,14 +378,15 @@ elm_modapi_init(void *m)
    g_type_init();
 #endif
 
+   eail_factory_init();
+
+   eina_lock_new(&listener_lock);
    listener_list = g_hash_table_new_full
                   (g_int_hash, g_int_equal, NULL, eail_listener_info_destroy);
 
    atk_util_install();
 
-   atk_misc_instance = g_object_new(ATK_TYPE_MISC, NULL);
-
-   atk_bridge_adaptor_init(NULL, NULL);
+   eail_bridge_init(_eail_services_init);
 
    return 1;
 }
@@ -355,7 +400,24 @@ elm_modapi_init(void *m)
 int
 elm_modapi_shutdown(void *m)
 {
+   eail_bridge_shutdown();
    eail_clipboard_free();
+   eail_shared_tree_shutdown();
+   eail_mirror_shutdown();
+   eail_property_cache_shutdown();
+   eail_journal_shutdown();
+   eail_hit_grid_shutdown();
+
+   if (listener_list)
+     {
+        g_hash_table_destroy(listener_list);
+        listener_list = NULL;
+        eina_lock_free(&listener_lock);
+     }
+
+   eail_subscription_shutdown();
+   eail_factory_shutdown();
+   initialized = FALSE;
 
    if ((_eail_log_dom > -1) && (_eail_log_dom != EINA_LOG_DOMAIN_GLOBAL))
      {
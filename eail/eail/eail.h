@@ -63,6 +63,27 @@
  * launched and accessible content for target application should be visible
  * when using accessibility clients (eg. ORCA, TADEK, accerciser...).</p>
  * </p>
+ * <p>ATK bridge is started together with the application by default. Setting
+ * 'EAIL_BRIDGE' environmental variable to 'lazy' defers it until
+ * accessibility or a screen reader gets enabled on the accessibility bus,
+ * so applications start without any accessibility overhead when no AT
+ * client is running:
+ * @code
+ * export EAIL_BRIDGE=lazy
+ * @endcode
+ * </p>
+ * <p>Local tools can also read the accessible tree without D-Bus. When
+ * 'EAIL_MIRROR' environmental variable holds a file path, EAIL publishes the
+ * tree and its changes into that file mapped in memory, to be read with
+ * eail_mirror_reader.h:
+ * @code
+ * export EAIL_MIRROR=/dev/shm/eail-myapp
+ * @endcode
+ * With lazy bridge start-up the file is created when the bridge starts.
+ * </p>
+ * <p>Code running in other threads of the application can query an
+ * immutable copy of the tree without stalling the main loop, see
+ * eail_shared_tree.h.</p>
  *
  * @section Architecture
  * <p>EAIL is implemented as a module of Enlightenment (it is located in Elementary
@@ -111,6 +132,11 @@
  * widget hierarchy tree). Without that event listener for widget won't be
  * registered and ATK events won't be propagated.
  * \n
+ * Visibility "state-change", "bounds-changed" and "text-caret-moved" are
+ * emitted only while a global event listener for them or a reader of the
+ * journal exists (see eail_subscription.h and eail_journal.h), so these
+ * events are not emitted before a client registers for them.
+ * \n
  * To be sure that client always
  * has the correct widget tree, it needs to refresh the widget's descendants every time
  * it receives "visible-data-changed" event from ATK.
@@ -128,6 +154,22 @@
  *
  * @endcode
  *
+ * @section Threads Threads
+ * <p>EAIL reads Evas and Elementary directly, so AtkObject methods and ATK
+ * interface implementations have to be called from the Ecore main loop.
+ * A bridge servicing D-Bus in another thread has to marshal them there, eg.
+ * with ecore_main_loop_thread_safe_call_sync.</p>
+ * <p>Following entry points can be called from any thread:</p>
+ * -# adding and removing global event listeners
+ * (atk_add_global_event_listener, atk_remove_global_event_listener)
+ * -# looking up accessibles that are already created
+ * (eail_factory_ref_accessible, eail_factory_ref_item_accessible,
+ * eail_factory_find_objects_with_role); these return references of their
+ * own, which keep returned objects alive but they still have to be used on
+ * the main loop
+ * -# queries of shared tree (eail_shared_tree_get and the rest of
+ * eail_shared_tree.h except init, shutdown and refresh)
+ *
  * @section Examples
  * <p>Below are some examples on how to use C API for ATK with EAIL.
  * </p>
@@ -22,25 +22,16 @@
  * @brief EailActionWidget implementation
  */
 
+#include <string.h>
+
 #include <Elementary.h>
 
 #include "eail_action_widget.h"
 #include "eail_priv.h"
 
 static void atk_action_interface_init(AtkActionIface *iface);
-
-/** @brief ActionObject structure for objects stored in actions list */
-typedef struct _EailActionObj EailActionObj;
-
-/** @brief ActionObject structure for objects stored in actions list
- */
-struct _EailActionObj
-{
-   const gchar * name;/*!< \brief action name */
-   const gchar * keybinding;/*!< \brief action keybinding */
-   gchar * description;/*!< \brief action description */
-   Eail_Do_Action_Cb action;/*!< \brief action callback */
-};
+static const gchar *eail_action_widget_action_name_get(AtkAction *action,
+                                                      int i);
 
 /**
  * @brief Definition of EailActionWidget as GObject
@@ -51,22 +42,6 @@ G_DEFINE_TYPE_WITH_CODE(EailActionWidget,
                         G_IMPLEMENT_INTERFACE(ATK_TYPE_ACTION,
                                               atk_action_interface_init));
 
-/**
- * @brief Initializer for AtkObjectClass
- *
- * @param obj AtkObject(EailActionWidget) instance to be initialized
- * @param data additional initialization data
- */
-static void
-eail_action_widget_initialize(AtkObject *obj, gpointer data)
-{
-   ATK_OBJECT_CLASS(eail_action_widget_parent_class)->initialize(obj, data);
-
-   EailActionWidget *widget = EAIL_ACTION_WIDGET(obj);
-
-   widget->action_objs = NULL;
-}
-
 /**
  * @brief Initializer for GObject class
  *
@@ -75,22 +50,7 @@ eail_action_widget_initialize(AtkObject *obj, gpointer data)
 static void
 eail_action_widget_init(EailActionWidget *action_widget)
 {
-}
-
-/**
- * @brief Deallocates memory for EailActionObj
- *
- * @param action_obj EailActionObj instance to be freed
- */
-static void
-eail_action_obj_free(EailActionObj *action_obj)
-{
-   g_return_if_fail(action_obj);
-
-   if (action_obj->description)
-     g_free(action_obj->description);
-
-   g_free(action_obj);
+   action_widget->descriptions = NULL;
 }
 
 /**
@@ -102,8 +62,6 @@ static void
 eail_action_widget_finalize(GObject *object)
 {
    EailActionWidget *widget = NULL;
-   const Eina_List *l = NULL;
-   EailActionObj *action_obj = NULL;
 
    widget = EAIL_ACTION_WIDGET(object);
    if (!widget)
@@ -112,10 +70,8 @@ eail_action_widget_finalize(GObject *object)
         return;
      }
 
-   EINA_LIST_FOREACH(widget->action_objs, l, action_obj)
-     eail_action_obj_free(action_obj);
-
-   eina_list_free(widget->action_objs);
+   if (widget->descriptions)
+     g_hash_table_destroy(widget->descriptions);
 
    G_OBJECT_CLASS(eail_action_widget_parent_class)->finalize(object);
 }
@@ -128,39 +84,91 @@ eail_action_widget_finalize(GObject *object)
 static void
 eail_action_widget_class_init(EailActionWidgetClass *klass)
 {
-   AtkObjectClass *atk_class = ATK_OBJECT_CLASS(klass);
    GObjectClass *gobject_class = G_OBJECT_CLASS(klass);
-   atk_class->initialize = eail_action_widget_initialize;
    gobject_class->finalize = eail_action_widget_finalize;
+
+   klass->actions = NULL;
+   klass->n_actions = 0;
+   klass->action_indexes = NULL;
 }
 
 /**
- * @param action_widget ActionWidget instance that holds actions
- * @param action_name action name
- * @param keybinding keybinding
- * @param action_cb callback for action, launched when action is triggered
+ * Subclass inherits actions of its parent class, this function is meant to
+ * be called from class_init of subclass. Array and name index of class are
+ * allocated once and live as long as the class.
+ *
+ * @param klass EailActionWidgetClass instance
+ * @param actions array of action descriptors
+ * @param n_actions number of descriptors in actions
  */
 void
-eail_action_widget_action_append(EailActionWidget *action_widget,
-                                 const gchar *action_name,
-                                 const gchar *keybinding,
-                                 Eail_Do_Action_Cb action_cb)
+eail_action_widget_class_add_actions(EailActionWidgetClass *klass,
+                                     const EailActionDesc *actions,
+                                     guint n_actions)
 {
-   if (!action_widget)
-     {
-         ERR("action widget should NOT be NULL");
-         return;
-     }
+   EailActionDesc *all;
+   guint i;
 
-   EailActionObj *action_def_obj = g_new0(EailActionObj, 1);
+   g_return_if_fail(klass);
+   if (!actions || !n_actions) return;
 
-   action_def_obj->name = action_name;
-   action_def_obj->keybinding = keybinding;
-   action_def_obj->action = action_cb;
+   all = g_new(EailActionDesc, klass->n_actions + n_actions);
+   if (klass->n_actions)
+     memcpy(all, klass->actions, klass->n_actions * sizeof(EailActionDesc));
+   memcpy(all + klass->n_actions, actions, n_actions * sizeof(EailActionDesc));
 
-   action_widget->action_objs = eina_list_append
-                              (action_widget->action_objs, action_def_obj);
+   klass->actions = all;
+   klass->n_actions += n_actions;
 
+   /* table inherited from parent class is left to the parent */
+   klass->action_indexes = g_hash_table_new(g_str_hash, g_str_equal);
+   for (i = klass->n_actions; i > 0; --i)
+     g_hash_table_insert(klass->action_indexes, (gpointer)all[i - 1].name,
+                         GUINT_TO_POINTER(i));
+}
+
+/**
+ * If several actions share a name, the first one is taken.
+ *
+ * Class table is used only if the instance gets its AtkAction
+ * implementation from EailActionWidget. Subclasses implementing AtkAction
+ * on their own (like EailRadioButton) inherit the table of their parent
+ * class, which does not describe their actions, so those are scanned.
+ *
+ * @param action_widget EailActionWidget instance
+ * @param action_name name of the action
+ *
+ * @returns index of the action or -1 if there is no such action
+ */
+gint
+eail_action_widget_action_index_get(EailActionWidget *action_widget,
+                                    const gchar *action_name)
+{
+   EailActionWidgetClass *klass;
+   AtkAction *action = ATK_ACTION(action_widget);
+   gint i, n;
+
+   g_return_val_if_fail(EAIL_IS_ACTION_WIDGET(action_widget), -1);
+   if (!action_name) return -1;
+
+   if (ATK_ACTION_GET_IFACE(action)->get_name !=
+       eail_action_widget_action_name_get)
+     {
+        n = atk_action_get_n_actions(action);
+        for (i = 0; i < n; ++i)
+          {
+             if (!g_strcmp0(atk_action_get_name(action, i), action_name))
+               return i;
+          }
+
+        return -1;
+     }
+
+   klass = EAIL_ACTION_WIDGET_GET_CLASS(action_widget);
+   if (!klass->action_indexes) return -1;
+
+   return (gint)GPOINTER_TO_UINT(g_hash_table_lookup(klass->action_indexes,
+                                                     action_name)) - 1;
 }
 
 /**
@@ -175,49 +183,43 @@ eail_action_widget_action_append(EailActionWidget *action_widget,
 static int
 eail_action_widget_n_actions_get(AtkAction *action)
 {
-   EailActionWidget *widget =  EAIL_ACTION_WIDGET(action);
-   if (!widget)
-     {
-        ERR("Could not get action widget from action");
-        return 0;
-     }
+   g_return_val_if_fail(EAIL_IS_ACTION_WIDGET(action), 0);
 
-   return eina_list_count(widget->action_objs);
+   return EAIL_ACTION_WIDGET_GET_CLASS(action)->n_actions;
 }
 
 /**
- * @brief Returns EailActionObj of an action with the specified index
+ * @brief Returns EailActionDesc of an action with the specified index
  *
  * @param action AtkAction instance
  * @param i index (number) of action
  *
- * @returns EailActionObj representing the specified action
+ * @returns EailActionDesc representing the specified action
  */
-static EailActionObj *
-eail_get_action_obj_i(AtkAction *action,
-                      int i)
+static const EailActionDesc *
+eail_get_action_desc_i(AtkAction *action,
+                       int i)
 {
-   EailActionWidget *widget =  EAIL_ACTION_WIDGET(action);
-   if (!widget)
+   EailActionWidgetClass *klass;
+
+   if (!EAIL_IS_ACTION_WIDGET(action))
      {
         ERR("Could not get action widget from action");
         return NULL;
      }
 
-
-   if (i >= eina_list_count(widget->action_objs))
+   klass = EAIL_ACTION_WIDGET_GET_CLASS(action);
+   if (i < 0 || i >= klass->n_actions)
      {
         DBG("Passed index value %d is invalid", i);
         return NULL;
      }
 
-   EailActionObj *actionObj = eina_list_nth(widget->action_objs, i);
-
-   return actionObj;
+   return &klass->actions[i];
 }
 
 /**
- * @brief Returns EailActionObj of an action with the specified index
+ * @brief Returns the name of an action with the specified index
  *
  * @param action AtkAction instance
  * @param i index (number) of action
@@ -228,10 +230,10 @@ static const gchar*
 eail_action_widget_action_name_get(AtkAction *action,
                                    int i)
 {
-   EailActionObj *actionObj = eail_get_action_obj_i(action, i);
-   if(!actionObj) return NULL;
+   const EailActionDesc *desc = eail_get_action_desc_i(action, i);
+   if(!desc) return NULL;
 
-   return actionObj->name;
+   return desc->name;
 }
 
 /**
@@ -246,10 +248,10 @@ static gboolean
 eail_action_widget_do_action(AtkAction *action,
                              int i)
 {
-   EailActionObj *actionObj = eail_get_action_obj_i(action, i);
-   if(!actionObj) return FALSE;
+   const EailActionDesc *desc = eail_get_action_desc_i(action, i);
+   if(!desc) return FALSE;
 
-   return (actionObj->action)(action, NULL);
+   return (desc->action)(action, NULL);
 }
 
 /**
@@ -266,10 +268,14 @@ static const gchar*
 eail_action_widget_description_get(AtkAction *action,
                                    int i)
 {
-   EailActionObj *actionObj = eail_get_action_obj_i(action, i);
-   if(!actionObj) return NULL;
+   EailActionWidget *widget;
+
+   if (!eail_get_action_desc_i(action, i)) return NULL;
 
-   return actionObj->description;
+   widget = EAIL_ACTION_WIDGET(action);
+   if (!widget->descriptions) return NULL;
+
+   return g_hash_table_lookup(widget->descriptions, GINT_TO_POINTER(i));
 }
 
 /**
@@ -288,13 +294,22 @@ eail_action_widget_description_set(AtkAction *action,
                                    int i,
                                    const char *description)
 {
-   EailActionObj *actionObj = eail_get_action_obj_i(action, i);
-   if(!actionObj) return FALSE;
+   EailActionWidget *widget;
+
+   if (!eail_get_action_desc_i(action, i)) return FALSE;
+
+   widget = EAIL_ACTION_WIDGET(action);
+   if (!widget->descriptions)
+     widget->descriptions = g_hash_table_new_full(g_direct_hash,
+                                                  g_direct_equal,
+                                                  NULL, g_free);
 
-   if (actionObj->description)
-     g_free(actionObj->description);
+   if (description)
+     g_hash_table_insert(widget->descriptions, GINT_TO_POINTER(i),
+                         g_strdup(description));
+   else
+     g_hash_table_remove(widget->descriptions, GINT_TO_POINTER(i));
 
-   actionObj->description = g_strdup(description);
    return TRUE;
 }
 
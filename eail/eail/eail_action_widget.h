@@ -47,7 +47,7 @@
  * @param klass subclass object
  */
 
-#define EAIL_ACTION_WIDGET_CLASS(klass)     (G_TYPE_ACTION_WIDGET_CLASS_CAST((klass), \
+#define EAIL_ACTION_WIDGET_CLASS(klass)     (G_TYPE_CHECK_CLASS_CAST((klass), \
                                              EAIL_TYPE_ACTION_WIDGET, EailActionWidgetClass))
 /**
  * @brief Tests whether object (obj) is an instance of EailActionWidget class
@@ -85,12 +85,16 @@ typedef struct _EailActionWidgetClass EailActionWidgetClass;
  */
 typedef gboolean (* Eail_Do_Action_Cb) (AtkAction *obj, void *data);
 
-/*! \brief Appends given action to action list used by EailActionWidget
- */
-void eail_action_widget_action_append(EailActionWidget *action_widget,
-                                      const gchar *action_name,
-                                      const gchar *keybinding,
-                                      Eail_Do_Action_Cb action_cb);
+/** @brief Action descriptor shared by all instances of a class */
+typedef struct _EailActionDesc EailActionDesc;
+
+/** @brief Action descriptor shared by all instances of a class */
+struct _EailActionDesc
+{
+   const gchar *name;/*!< \brief action name */
+   const gchar *keybinding;/*!< \brief action keybinding */
+   Eail_Do_Action_Cb action;/*!< \brief action callback */
+};
 
 /** @brief Definition of object structure for Atk EailActionWidget
  * */
@@ -98,8 +102,9 @@ struct _EailActionWidget
 {
    /** @brief Parent widget whose functionality is being extended */
    EailWidget parent;
-   /** @brief List of action objects (EailActionObj*) */
-   Eina_List *action_objs;
+   /** @brief Descriptions set by user, action index to string, NULL until
+    * first description is set */
+   GHashTable *descriptions;
 };
 
 /** @brief Definition of class structure for Atk EailActionWidget
@@ -107,8 +112,22 @@ struct _EailActionWidget
 struct _EailActionWidgetClass
 {
    EailWidgetClass parent_class;/**< class whose functionality is being extended*/
+   const EailActionDesc *actions;/**< actions of class, inherited ones first */
+   guint n_actions;/**< number of actions in actions array */
+   GHashTable *action_indexes;/**< action names to their indexes + 1 */
 };
 
+/*! \brief Appends given actions to actions of EailActionWidget class
+ */
+void eail_action_widget_class_add_actions(EailActionWidgetClass *klass,
+                                          const EailActionDesc *actions,
+                                          guint n_actions);
+
+/*! \brief Gets index of action with given name
+ */
+gint eail_action_widget_action_index_get(EailActionWidget *action_widget,
+                                         const gchar *action_name);
+
 /** @brief Getter for EailActionWidget GType
  * @returns GType for EailActionWidget implementation
  * */
@@ -20,6 +20,13 @@
 /**
  * @file eail_app.c
  * @brief Elementary application implementation
+ *
+ * Children of the application are Elementary windows. They are kept in an
+ * array mirroring Elementary's window list, so a child is fetched by index
+ * without walking the list. Windows drop out of the array as soon as their
+ * deletion starts, so a window added while another one is being deleted
+ * still changes the count; the array is rebuilt only when the number of
+ * windows in the list no longer matches it.
  */
 
 #include <Elementary.h>
@@ -67,9 +74,83 @@ eail_app_initialize(AtkObject *obj, gpointer data)
    obj->accessible_parent = NULL;
 
    /* storing last numbers of children to be for checking if children-changed
-     * signal has to be propagated */
+     * signal has to be propagated; window array is filled on first access */
    eail_app = EAIL_APP(obj);
-   eail_app->child_count_last = atk_object_get_n_accessible_children(obj);
+   eail_app->child_count_last = eina_list_count(_elm_win_list);
+}
+
+/**
+ * @brief Drops deleted window from window array
+ *
+ * Called on deletion, or when the window is freed if the array has been
+ * rebuilt while the window was being deleted and still listed by
+ * Elementary.
+ *
+ * @param data EailApp instance
+ * @param e Evas of window
+ * @param obj window that is being deleted or freed
+ * @param event_info unused
+ */
+static void
+_eail_app_on_window_del(void *data, Evas *e, Evas_Object *obj,
+                        void *event_info)
+{
+   EailApp *app = EAIL_APP(data);
+
+   evas_object_event_callback_del_full(obj, EVAS_CALLBACK_DEL,
+                                       _eail_app_on_window_del, app);
+   evas_object_event_callback_del_full(obj, EVAS_CALLBACK_FREE,
+                                       _eail_app_on_window_del, app);
+   g_ptr_array_remove(app->windows, obj);
+}
+
+/**
+ * @brief Empties window array
+ *
+ * @param app EailApp instance
+ */
+static void
+_eail_app_windows_clear(EailApp *app)
+{
+   guint i;
+
+   for (i = 0; i < app->windows->len; ++i)
+     {
+        Evas_Object *win = g_ptr_array_index(app->windows, i);
+
+        evas_object_event_callback_del_full(win, EVAS_CALLBACK_DEL,
+                                            _eail_app_on_window_del, app);
+        evas_object_event_callback_del_full(win, EVAS_CALLBACK_FREE,
+                                            _eail_app_on_window_del, app);
+     }
+   g_ptr_array_set_size(app->windows, 0);
+}
+
+/**
+ * @brief Brings window array in line with Elementary window list
+ *
+ * Elementary counts list elements, so the check is O(1); the list is walked
+ * only if the number of windows has changed.
+ *
+ * @param app EailApp instance
+ */
+static void
+_eail_app_windows_sync(EailApp *app)
+{
+   Eina_List *l;
+   Evas_Object *win;
+
+   if (app->windows->len == eina_list_count(_elm_win_list)) return;
+
+   _eail_app_windows_clear(app);
+   EINA_LIST_FOREACH(_elm_win_list, l, win)
+     {
+        evas_object_event_callback_add(win, EVAS_CALLBACK_DEL,
+                                       _eail_app_on_window_del, app);
+        evas_object_event_callback_add(win, EVAS_CALLBACK_FREE,
+                                       _eail_app_on_window_del, app);
+        g_ptr_array_add(app->windows, win);
+     }
 }
 
 /**
@@ -79,6 +160,11 @@ eail_app_initialize(AtkObject *obj, gpointer data)
 static void
 eail_app_class_finalize(GObject *obj)
 {
+   EailApp *app = EAIL_APP(obj);
+
+   _eail_app_windows_clear(app);
+   g_ptr_array_free(app->windows, TRUE);
+
    G_OBJECT_CLASS(eail_app_parent_class)->finalize(obj);
 }
 
@@ -115,13 +201,15 @@ eail_app_get_n_children(AtkObject *obj)
 static AtkObject *
 eail_app_ref_child(AtkObject *obj, gint i)
 {
+   EailApp *app = EAIL_APP(obj);
    AtkObject *child = NULL;
 
-   if (eina_list_count(_elm_win_list) > i)
+   _eail_app_windows_sync(app);
+
+   if (i >= 0 && (guint)i < app->windows->len)
      {
-        Evas_Object *tmp = eina_list_nth(_elm_win_list, i);
-        child = eail_factory_get_accessible(tmp);
-        g_object_ref(child);
+        child = eail_factory_get_accessible(g_ptr_array_index(app->windows, i));
+        if (child) g_object_ref(child);
      }
 
    return child;
@@ -134,6 +222,7 @@ eail_app_ref_child(AtkObject *obj, gint i)
 static void
 eail_app_init(EailApp *app)
 {
+   app->windows = g_ptr_array_new();
 }
 
 /**
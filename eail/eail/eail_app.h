@@ -88,6 +88,7 @@ struct _EailApp
    /** @brief Parent AtkObject whose functionality is being extended */
    AtkObject parent;
    gint child_count_last;/**< @brief last reported count of children */
+   GPtrArray *windows;/**< @brief windows in order of Elementary window list */
 };
 
 /** @brief Definition of class structure for Atk EailBackground*/
@@ -0,0 +1,352 @@
+/*
+ * Copyright (c) 2013 Samsung Electronics Co., Ltd.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/**
+ * @file eail_attributes.c
+ * @brief Implementation of interned attribute sets
+ *
+ * Every distinct list of name/value pairs is stored once and shared by all
+ * accessibles (or text runs) reporting it. Sets are refcounted and removed
+ * from the table with their last reference. The table is locked and
+ * references are atomic, accessibles may be finalized from any thread
+ * holding a factory reference.
+ *
+ * ATK hands ownership of returned AtkAttributeSet to the caller, who frees
+ * it with atk_attribute_set_free(), so shared sets are never returned
+ * directly - eail_attributes_add() copies the pairs into caller's set.
+ * Internal consumers (e.g. tree snapshot) read the pairs in place with
+ * eail_attributes_get_name() and eail_attributes_get_value().
+ */
+
+#include <stdarg.h>
+#include <string.h>
+
+#include <atk/atk.h>
+
+#include "eail_attributes.h"
+
+/** @brief Separator of names and values in set keys */
+#define EAIL_ATTRIBUTES_SEPARATOR '\x1f'
+
+/** @brief Size of stack buffer used for lookup keys */
+#define EAIL_ATTRIBUTES_KEY_SIZE 256
+
+/** @brief Maximal number of pairs passed to eail_attributes_intern */
+#define EAIL_ATTRIBUTES_MAX_PAIRS 16
+
+/** @brief Definition of shared immutable attribute set */
+struct _EailAttributes
+{
+   gint ref_count;/**< @brief number of references, changed atomically */
+   gchar *key;/**< @brief all names and values joined, key in the table */
+   guint n_pairs;/**< @brief number of name/value pairs */
+   const gchar **pairs;/**< @brief interned names and values, interleaved */
+};
+
+/** @brief Table of shared sets by key */
+static GHashTable *eail_attributes_table = NULL;
+
+/** @brief Lock of eail_attributes_table */
+G_LOCK_DEFINE_STATIC(eail_attributes);
+
+/**
+ * @brief Joins names and values with non-NULL value into key
+ *
+ * @param pairs interleaved names and values
+ * @param n_pairs number of name/value pairs
+ * @param buffer buffer for the key
+ * @param size size of buffer
+ *
+ * @returns length of the key, key is complete only if it is less than size
+ */
+static gsize
+_eail_attributes_key_join(const gchar * const *pairs,
+                          guint n_pairs,
+                          gchar *buffer,
+                          gsize size)
+{
+   gsize length = 0;
+   guint i, j;
+
+   for (i = 0; i < n_pairs; ++i)
+     {
+        if (!pairs[2 * i + 1]) continue;
+
+        for (j = 0; j < 2; ++j)
+          {
+             gsize len = strlen(pairs[2 * i + j]);
+
+             if (length + len + 1 < size)
+               {
+                  memcpy(buffer + length, pairs[2 * i + j], len);
+                  buffer[length + len] = EAIL_ATTRIBUTES_SEPARATOR;
+               }
+             length += len + 1;
+          }
+     }
+
+   if (length < size)
+     buffer[length] = '\0';
+
+   return length;
+}
+
+/**
+ * @brief Creates set for key and adds it to the table
+ *
+ * Must be called with the table locked.
+ *
+ * @param key key of the set, taken over by the set
+ * @param pairs interleaved names and values
+ * @param n_pairs number of name/value pairs
+ *
+ * @returns new EailAttributes with one reference
+ */
+static EailAttributes *
+_eail_attributes_insert(gchar *key, const gchar * const *pairs, guint n_pairs)
+{
+   EailAttributes *attrs;
+   guint i, n;
+
+   attrs = g_new0(EailAttributes, 1);
+   attrs->ref_count = 1;
+   attrs->key = key;
+   attrs->pairs = g_new(const gchar *, 2 * n_pairs);
+
+   for (i = 0, n = 0; i < n_pairs; ++i)
+     {
+        if (!pairs[2 * i + 1]) continue;
+
+        attrs->pairs[2 * n] = g_intern_string(pairs[2 * i]);
+        attrs->pairs[2 * n + 1] = g_intern_string(pairs[2 * i + 1]);
+        n++;
+     }
+   attrs->n_pairs = n;
+
+   g_hash_table_insert(eail_attributes_table, attrs->key, attrs);
+
+   return attrs;
+}
+
+/**
+ * Looking up an existing set does not allocate memory unless its key is
+ * longer than EAIL_ATTRIBUTES_KEY_SIZE.
+ *
+ * @param pairs interleaved names and values, pairs with NULL value are
+ * skipped
+ * @param n_pairs number of name/value pairs
+ *
+ * @returns shared EailAttributes with a new reference, release it with
+ * eail_attributes_unref
+ */
+EailAttributes *
+eail_attributes_intern_pairs(const gchar * const *pairs, guint n_pairs)
+{
+   EailAttributes *attrs;
+   gchar buffer[EAIL_ATTRIBUTES_KEY_SIZE];
+   gchar *key = buffer;
+   gsize length;
+
+   length = _eail_attributes_key_join(pairs, n_pairs, buffer, sizeof(buffer));
+   if (length >= sizeof(buffer))
+     {
+        key = g_malloc(length + 1);
+        _eail_attributes_key_join(pairs, n_pairs, key, length + 1);
+     }
+
+   G_LOCK(eail_attributes);
+
+   if (!eail_attributes_table)
+     eail_attributes_table = g_hash_table_new(g_str_hash, g_str_equal);
+
+   attrs = g_hash_table_lookup(eail_attributes_table, key);
+   if (attrs)
+     g_atomic_int_inc(&attrs->ref_count);
+   else
+     attrs = _eail_attributes_insert(key == buffer ? g_strdup(key) : key,
+                                     pairs, n_pairs);
+
+   G_UNLOCK(eail_attributes);
+
+   if (attrs->key != key && key != buffer)
+     g_free(key);
+
+   return attrs;
+}
+
+/**
+ * At most EAIL_ATTRIBUTES_MAX_PAIRS pairs are taken.
+ *
+ * @param first_name name of the first attribute, followed by its value and
+ * further name/value pairs, terminated with NULL name
+ *
+ * @returns shared EailAttributes with a new reference, release it with
+ * eail_attributes_unref
+ */
+EailAttributes *
+eail_attributes_intern(const gchar *first_name, ...)
+{
+   const gchar *pairs[2 * EAIL_ATTRIBUTES_MAX_PAIRS];
+   const gchar *name;
+   guint n_pairs = 0;
+   va_list args;
+
+   va_start(args, first_name);
+   for (name = first_name; name; name = va_arg(args, const gchar *))
+     {
+        g_return_val_if_fail(n_pairs < EAIL_ATTRIBUTES_MAX_PAIRS, NULL);
+
+        pairs[2 * n_pairs] = name;
+        pairs[2 * n_pairs + 1] = va_arg(args, const gchar *);
+        n_pairs++;
+     }
+   va_end(args);
+
+   return eail_attributes_intern_pairs(pairs, n_pairs);
+}
+
+/**
+ * @param attrs EailAttributes instance
+ *
+ * @returns attrs
+ */
+EailAttributes *
+eail_attributes_ref(EailAttributes *attrs)
+{
+   g_return_val_if_fail(attrs, NULL);
+
+   g_atomic_int_inc(&attrs->ref_count);
+
+   return attrs;
+}
+
+/**
+ * Set is removed from the table when its last reference is released. The
+ * table is locked before dropping the reference, so a concurrent lookup
+ * cannot revive a set being freed.
+ *
+ * @param attrs EailAttributes instance
+ */
+void
+eail_attributes_unref(EailAttributes *attrs)
+{
+   gboolean last;
+
+   if (!attrs) return;
+
+   G_LOCK(eail_attributes);
+   last = g_atomic_int_dec_and_test(&attrs->ref_count);
+   if (last)
+     g_hash_table_remove(eail_attributes_table, attrs->key);
+   G_UNLOCK(eail_attributes);
+
+   if (!last) return;
+
+   g_free(attrs->pairs);
+   g_free(attrs->key);
+   g_free(attrs);
+}
+
+/**
+ * Pairs keep their order and are appended after attributes already in
+ * attrib_set.
+ *
+ * @param attrs EailAttributes instance
+ * @param attrib_set AtkAttributeSet to add attributes to
+ *
+ * @returns AtkAttributeSet with copies of shared attributes, caller owns it
+ * and frees it with atk_attribute_set_free()
+ */
+AtkAttributeSet *
+eail_attributes_add(const EailAttributes *attrs, AtkAttributeSet *attrib_set)
+{
+   AtkAttributeSet *copies = NULL;
+   guint i;
+
+   if (!attrs) return attrib_set;
+
+   for (i = attrs->n_pairs; i > 0; --i)
+     {
+        AtkAttribute *attr = g_new(AtkAttribute, 1);
+
+        attr->name = g_strdup(attrs->pairs[2 * (i - 1)]);
+        attr->value = g_strdup(attrs->pairs[2 * (i - 1) + 1]);
+        copies = g_slist_prepend(copies, attr);
+     }
+
+   return g_slist_concat(attrib_set, copies);
+}
+
+/**
+ * @param attrs EailAttributes instance, may be NULL
+ *
+ * @returns number of name/value pairs
+ */
+guint
+eail_attributes_get_n_pairs(const EailAttributes *attrs)
+{
+   return attrs ? attrs->n_pairs : 0;
+}
+
+/**
+ * Returned string is interned and stays valid for the process lifetime.
+ *
+ * @param attrs EailAttributes instance
+ * @param i index of the pair
+ *
+ * @returns name of the attribute
+ */
+const gchar *
+eail_attributes_get_name(const EailAttributes *attrs, guint i)
+{
+   g_return_val_if_fail(attrs && i < attrs->n_pairs, NULL);
+
+   return attrs->pairs[2 * i];
+}
+
+/**
+ * Returned string is interned and stays valid for the process lifetime.
+ *
+ * @param attrs EailAttributes instance
+ * @param i index of the pair
+ *
+ * @returns value of the attribute
+ */
+const gchar *
+eail_attributes_get_value(const EailAttributes *attrs, guint i)
+{
+   g_return_val_if_fail(attrs && i < attrs->n_pairs, NULL);
+
+   return attrs->pairs[2 * i + 1];
+}
+
+/**
+ * @returns number of distinct attribute sets currently referenced
+ */
+guint
+eail_attributes_get_count(void)
+{
+   guint count;
+
+   G_LOCK(eail_attributes);
+   count = eail_attributes_table ? g_hash_table_size(eail_attributes_table) : 0;
+   G_UNLOCK(eail_attributes);
+
+   return count;
+}
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2013 Samsung Electronics Co., Ltd.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/**
+ * @file eail_attributes.h
+ *
+ * @brief Header for interned attribute sets
+ */
+
+#ifndef EAIL_ATTRIBUTES_H
+#define EAIL_ATTRIBUTES_H
+
+#include <atk/atk.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief Definition of shared immutable attribute set */
+typedef struct _EailAttributes EailAttributes;
+
+/**
+ * @brief Gets shared attribute set holding given name/value pairs
+ */
+EailAttributes *eail_attributes_intern(const gchar *first_name, ...)
+   G_GNUC_NULL_TERMINATED;
+
+/**
+ * @brief Gets shared attribute set holding pairs from array
+ */
+EailAttributes *eail_attributes_intern_pairs(const gchar * const *pairs,
+                                             guint n_pairs);
+
+/**
+ * @brief Takes a reference to shared attribute set
+ */
+EailAttributes *eail_attributes_ref(EailAttributes *attrs);
+
+/**
+ * @brief Releases a reference to shared attribute set
+ */
+void eail_attributes_unref(EailAttributes *attrs);
+
+/**
+ * @brief Appends copies of shared attributes to caller owned AtkAttributeSet
+ */
+AtkAttributeSet *eail_attributes_add(const EailAttributes *attrs,
+                                     AtkAttributeSet *attrib_set);
+
+/**
+ * @brief Gets number of name/value pairs in shared attribute set
+ */
+guint eail_attributes_get_n_pairs(const EailAttributes *attrs);
+
+/**
+ * @brief Gets interned name of attribute at given index
+ */
+const gchar *eail_attributes_get_name(const EailAttributes *attrs, guint i);
+
+/**
+ * @brief Gets interned value of attribute at given index
+ */
+const gchar *eail_attributes_get_value(const EailAttributes *attrs, guint i);
+
+/**
+ * @brief Gets number of shared attribute sets alive, for tests
+ */
+guint eail_attributes_get_count(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -40,7 +40,7 @@ G_DEFINE_TYPE_WITH_CODE(EailBackground,
 /* AtkObject */
 static void eail_background_initialize(AtkObject *obj, gpointer data);
 static void eail_background_finalize(GObject *object);
-static AtkAttributeSet *eail_background_get_attributes(AtkObject *obj);
+static EailAttributes *eail_background_ref_attributes(EailWidget *widget);
 
 /* AtkImage */
 static void eail_background_get_image_position (AtkImage *image,
@@ -69,10 +69,11 @@ static void
 eail_background_class_init(EailBackgroundClass *klass)
 {
    AtkObjectClass *atk_class = ATK_OBJECT_CLASS(klass);
+   EailWidgetClass *widget_class = EAIL_WIDGET_CLASS(klass);
    GObjectClass *object_class = G_OBJECT_CLASS(klass);
 
    atk_class->initialize = eail_background_initialize;
-   atk_class->get_attributes = eail_background_get_attributes;
+   widget_class->ref_attributes = eail_background_ref_attributes;
 
    object_class->finalize = eail_background_finalize;
 }
@@ -120,47 +121,29 @@ eail_background_init(EailBackground *background)
 }
 
 /**
- * @brief Gets obj's attributes set
+ * @brief Gets shared attribute set of background
  *
- * The caller must unreference it when it is no longer needed.
+ * Backgrounds with the same color or file and display mode share one set.
  *
- * @param obj AtkObject instance
- * @return AtkAttributeSet containing obj's attributes
+ * @param widget EailWidget instance
+ * @return EailAttributes with a new reference
  */
-static AtkAttributeSet *
-eail_background_get_attributes(AtkObject *obj)
+static EailAttributes *
+eail_background_ref_attributes(EailWidget *widget)
 {
-   AtkAttribute *attr;
-   AtkAttributeSet *attributes;
-   Evas_Object *widget;
+   Evas_Object *bg = eail_widget_get_widget(widget);
    int r, g, b;
    gchar color[8];
    const char *mode, *file;
 
-   attributes = ATK_OBJECT_CLASS(eail_background_parent_class)->get_attributes(obj);
-
-   widget = eail_widget_get_widget(EAIL_WIDGET(obj));
-   if (!widget) return attributes;
-
-   elm_bg_file_get(widget, &file, NULL);
+   elm_bg_file_get(bg, &file, NULL);
    if (!file)
      {
-        elm_bg_color_get(widget, &r, &g, &b);
+        elm_bg_color_get(bg, &r, &g, &b);
         g_snprintf(color, sizeof(color), "#%02x%02x%02x", r, g, b);
-        attr = g_new(AtkAttribute, 1);
-        attr->name = g_strdup("color");
-        attr->value = g_strdup(color);
-        attributes = g_slist_append(attributes, attr);
-     }
-   else
-     {
-        attr = g_new(AtkAttribute, 1);
-        attr->name = g_strdup("file");
-        attr->value = g_strdup(file);
-        attributes = g_slist_append(attributes, attr);
      }
 
-   switch (elm_bg_option_get(widget))
+   switch (elm_bg_option_get(bg))
      {
        case ELM_BG_OPTION_CENTER:
            mode = "center";
@@ -179,12 +162,12 @@ eail_background_get_attributes(AtkObject *obj)
            break;
      }
 
-   attr = g_new(AtkAttribute, 1);
-   attr->name = g_strdup("display mode");
-   attr->value = g_strdup(mode);
-   attributes = g_slist_append(attributes, attr);
-
-   return attributes;
+   /* NULL values are skipped, only one of "color" and "file" is added */
+   return eail_attributes_intern("type", elm_object_widget_type_get(bg),
+                                 "color", file ? NULL : color,
+                                 "file", file,
+                                 "display mode", mode,
+                                 NULL);
 }
 
 
@@ -0,0 +1,260 @@
+/*
+ * Copyright (c) 2013 Samsung Electronics Co., Ltd.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/**
+ * @file eail_bridge.c
+ * @brief Implementation of start-up of ATK bridge
+ *
+ * atk_bridge_adaptor_init connects to the accessibility bus, registers the
+ * application and walks its root, creating accessibles of all windows. In
+ * lazy mode that is postponed: a proxy of org.a11y.Status is created
+ * asynchronously, without auto-starting the accessibility bus, and the
+ * bridge is started once "IsEnabled" or "ScreenReaderEnabled" is true.
+ * Accessibles, and callbacks they attach to widgets, are created on demand,
+ * so none of them exist until the bridge or another client asks for them.
+ */
+
+#include <gio/gio.h>
+#include <atk-bridge.h>
+
+#include "eail_bridge.h"
+#include "eail_priv.h"
+
+/** @brief Bus name of accessibility bus launcher */
+#define EAIL_BRIDGE_A11Y_BUS_NAME "org.a11y.Bus"
+
+/** @brief Object path of accessibility bus launcher */
+#define EAIL_BRIDGE_A11Y_BUS_PATH "/org/a11y/bus"
+
+/** @brief Interface holding accessibility enablement flags */
+#define EAIL_BRIDGE_A11Y_STATUS "org.a11y.Status"
+
+/** @brief Whether atk_bridge_adaptor_init was called */
+static gboolean eail_bridge_started = FALSE;
+
+/** @brief Sets up services the bridge needs, called before it starts */
+static EailBridgeStartFunc eail_bridge_start_func = NULL;
+
+/** @brief Cancels pending proxy creation in lazy mode */
+static GCancellable *eail_bridge_cancellable = NULL;
+
+/** @brief Proxy of org.a11y.Status watched in lazy mode */
+static GDBusProxy *eail_bridge_status = NULL;
+
+/**
+ * @brief Starts ATK bridge once
+ */
+static void
+_eail_bridge_start(void)
+{
+   if (eail_bridge_started) return;
+
+   eail_bridge_started = TRUE;
+
+   if (eail_bridge_start_func) eail_bridge_start_func();
+   atk_bridge_adaptor_init(NULL, NULL);
+}
+
+/**
+ * @brief Drops org.a11y.Status watcher
+ */
+static void
+_eail_bridge_unwatch(void)
+{
+   if (eail_bridge_cancellable)
+     {
+        g_cancellable_cancel(eail_bridge_cancellable);
+        g_object_unref(eail_bridge_cancellable);
+        eail_bridge_cancellable = NULL;
+     }
+
+   if (eail_bridge_status)
+     {
+        g_signal_handlers_disconnect_by_data(eail_bridge_status, NULL);
+        g_object_unref(eail_bridge_status);
+        eail_bridge_status = NULL;
+     }
+}
+
+/**
+ * @brief Gets boolean property cached by org.a11y.Status proxy
+ *
+ * @param proxy GDBusProxy instance
+ * @param name property name
+ *
+ * @returns property value, FALSE if it is not known
+ */
+static gboolean
+_eail_bridge_get_flag(GDBusProxy *proxy, const gchar *name)
+{
+   GVariant *value;
+   gboolean flag = FALSE;
+
+   value = g_dbus_proxy_get_cached_property(proxy, name);
+   if (!value) return FALSE;
+
+   if (g_variant_is_of_type(value, G_VARIANT_TYPE_BOOLEAN))
+     flag = g_variant_get_boolean(value);
+   g_variant_unref(value);
+
+   return flag;
+}
+
+/**
+ * @brief Starts bridge if accessibility is enabled
+ *
+ * @param proxy GDBusProxy of org.a11y.Status
+ */
+static void
+_eail_bridge_check(GDBusProxy *proxy)
+{
+   if (!_eail_bridge_get_flag(proxy, "IsEnabled") &&
+       !_eail_bridge_get_flag(proxy, "ScreenReaderEnabled"))
+     return;
+
+   DBG("Accessibility enabled, starting ATK bridge");
+
+   /* proxy is emitting signal, keep it alive until it returns */
+   g_object_ref(proxy);
+   _eail_bridge_unwatch();
+   _eail_bridge_start();
+   g_object_unref(proxy);
+}
+
+/**
+ * @brief Handles change of org.a11y.Status properties
+ *
+ * @param proxy GDBusProxy instance
+ * @param changed changed properties
+ * @param invalidated names of invalidated properties
+ * @param data unused
+ */
+static void
+_eail_bridge_on_properties_changed(GDBusProxy *proxy,
+                                   GVariant *changed,
+                                   const gchar * const *invalidated,
+                                   gpointer data)
+{
+   _eail_bridge_check(proxy);
+}
+
+/**
+ * @brief Handles appearance of accessibility bus launcher
+ *
+ * @param object GDBusProxy instance
+ * @param pspec "g-name-owner" property
+ * @param data unused
+ */
+static void
+_eail_bridge_on_name_owner(GObject *object, GParamSpec *pspec, gpointer data)
+{
+   _eail_bridge_check(G_DBUS_PROXY(object));
+}
+
+/**
+ * @brief Finishes creation of org.a11y.Status proxy
+ *
+ * @param source unused
+ * @param result GAsyncResult of proxy creation
+ * @param data unused
+ */
+static void
+_eail_bridge_on_proxy(GObject *source, GAsyncResult *result, gpointer data)
+{
+   GDBusProxy *proxy;
+   GError *error = NULL;
+
+   proxy = g_dbus_proxy_new_for_bus_finish(result, &error);
+   if (!proxy)
+     {
+        /* without session bus no AT client can reach the application */
+        if (!g_error_matches(error, G_IO_ERROR, G_IO_ERROR_CANCELLED))
+          {
+             DBG("Cannot watch accessibility status: %s", error->message);
+             g_object_unref(eail_bridge_cancellable);
+             eail_bridge_cancellable = NULL;
+          }
+        g_error_free(error);
+        return;
+     }
+
+   g_object_unref(eail_bridge_cancellable);
+   eail_bridge_cancellable = NULL;
+   eail_bridge_status = proxy;
+
+   g_signal_connect(proxy, "g-properties-changed",
+                    G_CALLBACK(_eail_bridge_on_properties_changed), NULL);
+   g_signal_connect(proxy, "notify::g-name-owner",
+                    G_CALLBACK(_eail_bridge_on_name_owner), NULL);
+
+   _eail_bridge_check(proxy);
+}
+
+/**
+ * In lazy mode (EAIL_BRIDGE set to EAIL_BRIDGE_LAZY) only an asynchronous
+ * watcher of org.a11y.Status is set up, the bridge is started from its
+ * callbacks. Otherwise the bridge is started right away.
+ *
+ * @param start_func function setting up services used by the bridge, called
+ * right before the bridge starts, may be NULL
+ */
+void
+eail_bridge_init(EailBridgeStartFunc start_func)
+{
+   if (eail_bridge_started || eail_bridge_cancellable || eail_bridge_status)
+     return;
+
+   eail_bridge_start_func = start_func;
+
+   if (g_strcmp0(g_getenv(EAIL_BRIDGE_ENV), EAIL_BRIDGE_LAZY))
+     {
+        _eail_bridge_start();
+        return;
+     }
+
+   eail_bridge_cancellable = g_cancellable_new();
+   g_dbus_proxy_new_for_bus(G_BUS_TYPE_SESSION,
+                            G_DBUS_PROXY_FLAGS_DO_NOT_AUTO_START,
+                            NULL,
+                            EAIL_BRIDGE_A11Y_BUS_NAME,
+                            EAIL_BRIDGE_A11Y_BUS_PATH,
+                            EAIL_BRIDGE_A11Y_STATUS,
+                            eail_bridge_cancellable,
+                            _eail_bridge_on_proxy,
+                            NULL);
+}
+
+/**
+ * Started bridge is left running.
+ */
+void
+eail_bridge_shutdown(void)
+{
+   _eail_bridge_unwatch();
+}
+
+/**
+ * @returns TRUE if bridge is started, FALSE if it is still waiting for
+ * accessibility to be enabled
+ */
+gboolean
+eail_bridge_is_started(void)
+{
+   return eail_bridge_started;
+}
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2013 Samsung Electronics Co., Ltd.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/**
+ * @file eail_bridge.h
+ *
+ * @brief Header for start-up of ATK bridge
+ *
+ * By default ATK bridge is started together with EAIL module. When
+ * EAIL_BRIDGE environment variable is set to "lazy", EAIL only watches
+ * org.a11y.Status on the session bus and starts the bridge once
+ * accessibility or a screen reader gets enabled there.
+ */
+
+#ifndef EAIL_BRIDGE_H
+#define EAIL_BRIDGE_H
+
+#include <glib.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief Environment variable selecting start-up mode of bridge */
+#define EAIL_BRIDGE_ENV "EAIL_BRIDGE"
+
+/** @brief Value of EAIL_BRIDGE_ENV deferring bridge start-up */
+#define EAIL_BRIDGE_LAZY "lazy"
+
+/**
+ * @brief Function called right before ATK bridge is started
+ */
+typedef void (*EailBridgeStartFunc)(void);
+
+/**
+ * @brief Starts ATK bridge, or watcher starting it later in lazy mode
+ */
+void eail_bridge_init(EailBridgeStartFunc start_func);
+
+/**
+ * @brief Stops watching for accessibility enablement
+ */
+void eail_bridge_shutdown(void);
+
+/**
+ * @brief Checks whether ATK bridge is started
+ */
+gboolean eail_bridge_is_started(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -26,6 +26,7 @@
 
 #include "eail_bubble.h"
 #include "eail_utils.h"
+#include "eail_window.h"
 
 static void atk_action_interface_init(AtkActionIface *iface);
 static void atk_text_interface_init(AtkTextIface *iface);
@@ -70,6 +71,7 @@ eail_bubble_finalize(GObject *object)
    EailBubble *bubble = EAIL_BUBBLE(object);
 
    if (bubble->click_description) free(bubble->click_description);
+   eail_subobject_clear(&bubble->textblock);
 
    G_OBJECT_CLASS(eail_bubble_parent_class)->finalize(object);
 }
@@ -312,12 +314,16 @@ atk_action_interface_init(AtkActionIface *iface)
 static const Evas_Object *
 _eail_get_textblock(AtkText *text)
 {
+   EailBubble *bubble = EAIL_BUBBLE(text);
    Evas_Object *widget= NULL;
-   const Evas_Object *textblock = NULL;
+   Evas_Object *textblock = NULL;
    Evas_Object *label = NULL;
    Evas_Object *label_edje_layer = NULL;
    Evas_Object *bubble_edje_layer = NULL;
 
+   /* resolved once, edje lookups are not repeated for every character */
+   if (bubble->textblock.obj) return bubble->textblock.obj;
+
    widget = eail_widget_get_widget(EAIL_WIDGET(text));
    if (!widget) return NULL;
 
@@ -330,9 +336,12 @@ _eail_get_textblock(AtkText *text)
    label_edje_layer = elm_layout_edje_get(label);
    if (!label_edje_layer) return NULL;
 
-   textblock = edje_object_part_object_get(label_edje_layer, "elm.text");
+   textblock = (Evas_Object *)edje_object_part_object_get(label_edje_layer,
+                                                          "elm.text");
    if (!textblock) return NULL;
 
+   eail_subobject_set(&bubble->textblock, widget, textblock);
+
    return textblock;
 }
 
@@ -470,9 +479,8 @@ eail_bubble_get_character_extents(AtkText *text,
    if (coords == ATK_XY_SCREEN)
    {
       int ee_x, ee_y;
-      Ecore_Evas *ee= ecore_evas_ecore_evas_get(evas_object_evas_get(widget));
 
-      ecore_evas_geometry_get(ee, &ee_x, &ee_y, NULL, NULL);
+      eail_window_screen_origin_get(widget, &ee_x, &ee_y);
       *x += ee_x;
       *y += ee_y;
     }
@@ -603,8 +611,8 @@ eail_bubble_get_offset_at_point(AtkText *text,
    if (coords == ATK_XY_SCREEN)
    {
       int ee_x, ee_y;
-      Ecore_Evas *ee= ecore_evas_ecore_evas_get(evas_object_evas_get(widget));
-      ecore_evas_geometry_get(ee, &ee_x, &ee_y, NULL, NULL);
+
+      eail_window_screen_origin_get(widget, &ee_x, &ee_y);
       x -= ee_x;
       y -= ee_y;
     }
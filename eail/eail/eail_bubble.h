@@ -84,6 +84,8 @@ struct _EailBubble
    EailText parent;
    /** @brief "click" action description*/
    char *click_description;
+   /** @brief cached textblock of bubble text */
+   EailSubobject textblock;
 };
 
 /** @brief Definition of class structure for Atk EailBubble*/
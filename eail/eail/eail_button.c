@@ -228,20 +228,20 @@ eail_button_action_release_cb(AtkAction *action, void *data)
 /**
  * @brief Sets EailButton actions
  *
- * @param action_widget EailActionWidget instance
+ * @param klass EailActionWidgetClass instance
  */
 static void
-eail_button_actions_init(EailActionWidget *action_widget)
+eail_button_actions_init(EailActionWidgetClass *klass)
 {
-   eail_action_widget_action_append(action_widget,
-                                    "click", NULL,
-                                    eail_button_action_click_cb);
-   eail_action_widget_action_append(action_widget,
-                                    "press", NULL,
-                                    eail_button_action_press_cb);
-   eail_action_widget_action_append(action_widget,
-                                    "release", NULL,
-                                    eail_button_action_release_cb);
+   static const EailActionDesc eail_button_actions[] =
+     {
+        { "click", NULL, eail_button_action_click_cb },
+        { "press", NULL, eail_button_action_press_cb },
+        { "release", NULL, eail_button_action_release_cb },
+     };
+
+   eail_action_widget_class_add_actions(klass, eail_button_actions,
+                                        G_N_ELEMENTS(eail_button_actions));
 }
 
 /**
@@ -260,8 +260,6 @@ eail_button_initialize(AtkObject *obj, gpointer data)
                                   eail_button_atk_notify_press, obj);
    evas_object_smart_callback_add((Evas_Object*) data, "unpressed",
                                   eail_button_atk_notify_release, obj);
-
-   eail_button_actions_init(EAIL_ACTION_WIDGET(obj));
 }
 
 /**
@@ -328,6 +326,8 @@ eail_button_class_init(EailButtonClass *klass)
    atk_class->initialize = eail_button_initialize;
    atk_class->get_name = eail_button_get_name;
    widget_class->get_widget_children = eail_button_get_widget_children;
+
+   eail_button_actions_init(EAIL_ACTION_WIDGET_CLASS(klass));
 }
 
 /**
@@ -177,13 +177,18 @@ eail_check_action_click_cb(AtkAction *action, void *data)
 /**
  * @brief Initializer for actions defined in EailCheck
  *
- * @param action_widget EailActionWidget implementation to be filled
+ * @param klass EailActionWidgetClass instance
  */
 static void
-eail_check_actions_init(EailActionWidget *action_widget)
+eail_check_actions_init(EailActionWidgetClass *klass)
 {
-   eail_action_widget_action_append(action_widget, "click", NULL,
-                                    eail_check_action_click_cb);
+   static const EailActionDesc eail_check_actions[] =
+     {
+        { "click", NULL, eail_check_action_click_cb },
+     };
+
+   eail_action_widget_class_add_actions(klass, eail_check_actions,
+                                        G_N_ELEMENTS(eail_check_actions));
 }
 
 /**
@@ -293,8 +298,6 @@ eail_check_initialize(AtkObject *obj, gpointer data)
    evas_object_smart_callback_add((Evas_Object*) data, "changed",
                                   eail_check_atk_notify_change,
                                   obj);
-
-   eail_check_actions_init(EAIL_ACTION_WIDGET(obj));
 }
 
 /**
@@ -312,4 +315,6 @@ eail_check_class_init(EailCheckClass *klass)
    atk_class->ref_state_set = eail_check_ref_state_set;
    atk_class->get_name = eail_check_get_name;
    widget_class->get_widget_children = eail_check_get_widget_children;
+
+   eail_check_actions_init(EAIL_ACTION_WIDGET_CLASS(klass));
 }
@@ -64,6 +64,7 @@ eail_ctxpopup_finalize(GObject *object)
    EailCtxpopup *ctxpopup = EAIL_CTXPOPUP(object);
 
    if (ctxpopup->dismiss_description) free(ctxpopup->dismiss_description);
+   eail_subobject_clear(&ctxpopup->content);
 
    G_OBJECT_CLASS(eail_ctxpopup_parent_class)->finalize(object);
 }
@@ -90,7 +91,11 @@ eail_ctxpopup_init(EailCtxpopup *ctxpopup)
 static Evas_Object *
 _eail_get_nested_widget(AtkObject *obj)
 {
+   EailCtxpopup *ctxpopup = EAIL_CTXPOPUP(obj);
    Evas_Object *ctxpopup_widget = NULL, *nested_widget = NULL;
+
+   if (ctxpopup->content.obj) return ctxpopup->content.obj;
+
    /* getting widget of ctxpopup class */
    ctxpopup_widget = eail_widget_get_widget(EAIL_WIDGET(obj));
    if (!ctxpopup_widget)
@@ -99,6 +104,7 @@ _eail_get_nested_widget(AtkObject *obj)
      }
 
    nested_widget = elm_object_part_content_get(ctxpopup_widget, "default");
+   eail_subobject_set(&ctxpopup->content, ctxpopup_widget, nested_widget);
 
    return nested_widget;
 }
@@ -86,6 +86,8 @@ struct _EailCtxpopup
    EailWidget parent;
    /** @brief "dismiss" action description*/
    char *dismiss_description;
+   /** @brief cached "default" content of ctxpopup widget */
+   EailSubobject content;
 };
 
 /** @brief Definition of class structure for Atk EailCtxpopup*/
@@ -35,7 +35,7 @@
 
 static void atk_selection_interface_init(AtkSelectionIface *iface);
 static void eail_item_parent_interface_init(EailItemParentIface *iface);
-static void eail_diskselector_actions_table_init(EailDiskselector *widget);
+static void eail_diskselector_actions_table_init(EailActionWidgetClass *klass);
 /**
  * @brief Definition of EailDiskselector as GObject
  *
@@ -63,9 +63,6 @@ eail_diskselector_initialize(AtkObject *obj, gpointer data)
    ATK_OBJECT_CLASS(eail_diskselector_parent_class)->initialize(obj, data);
    obj->role = ATK_ROLE_LIST;
 
-   EailDiskselector *widget = EAIL_DISKSELECTOR(obj);
-   eail_diskselector_actions_table_init(widget);
-
    nested_widget = eail_widget_get_widget(EAIL_WIDGET(obj));
    if (!nested_widget)
      {
@@ -172,6 +169,8 @@ eail_diskselector_class_init(EailDiskselectorClass *klass)
    atk_class->get_n_children = eail_diskselector_get_n_children;
    atk_class->ref_child = eail_diskselector_ref_child;
    gobject_class->finalize = eail_diskselector_finalize;
+
+   eail_diskselector_actions_table_init(EAIL_ACTION_WIDGET_CLASS(klass));
 }
 
 /*
@@ -457,19 +456,17 @@ _eail_diskselector_action_prev(AtkAction *action, void *data)
 
 /**
  * @brief Adds actions for scrolling to actions table
- * @param widget EailDiskselector instance
+ * @param klass EailActionWidgetClass instance
  */
 static void
-eail_diskselector_actions_table_init(EailDiskselector *widget)
+eail_diskselector_actions_table_init(EailActionWidgetClass *klass)
 {
-   g_return_if_fail(EAIL_IS_DISKSELECTOR(widget));
-
-   eail_action_widget_action_append(EAIL_ACTION_WIDGET(widget),
-                                    EAIL_diskselector_ACTION_PREV,
-                                    NULL,
-                                    _eail_diskselector_action_prev);
-   eail_action_widget_action_append(EAIL_ACTION_WIDGET(widget),
-                                    EAIL_diskselector_ACTION_NEXT,
-                                    NULL,
-                                    _eail_diskselector_action_next);
+   static const EailActionDesc eail_diskselector_actions[] =
+     {
+        { EAIL_diskselector_ACTION_PREV, NULL, _eail_diskselector_action_prev },
+        { EAIL_diskselector_ACTION_NEXT, NULL, _eail_diskselector_action_next },
+     };
+
+   eail_action_widget_class_add_actions(klass, eail_diskselector_actions,
+                                        G_N_ELEMENTS(eail_diskselector_actions));
 }
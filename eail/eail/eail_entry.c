@@ -26,6 +26,8 @@
 
 #include "eail_entry.h"
 #include "eail_utils.h"
+#include "eail_text_lines.h"
+#include "eail_subscription.h"
 #include "eail_priv.h"
 #include "eail_clipboard.h"
 
@@ -47,6 +49,23 @@ G_DEFINE_TYPE_WITH_CODE(EailEntry,
                         G_IMPLEMENT_INTERFACE(ATK_TYPE_EDITABLE_TEXT,
                                               atk_editable_text_interface_init));
 
+/**
+ * @brief Drops attribute runs and marks line index of entry as outdated
+ *
+ * Called from "changed", which may come before or after "changed,user"
+ * for the same edit. Line index keeps an edit already applied for it.
+ *
+ * @param entry EailEntry instance
+ * @param obj entry widget
+ */
+static void
+_eail_entry_content_changed(EailEntry *entry, Evas_Object *obj)
+{
+   eail_text_runs_free(entry->runs);
+   entry->runs = NULL;
+   eail_text_lines_invalidate(elm_entry_textblock_get(obj));
+}
+
 /**
  * @brief Handler for event which is raised when entry content has changed
  *
@@ -59,10 +78,52 @@ _eail_entry_handle_changed_event(void *data,
                                  Evas_Object *obj,
                                  void *event_info)
 {
+   _eail_entry_content_changed(EAIL_ENTRY(data), obj);
+
    eail_emit_atk_signal
                   (ATK_OBJECT(data), "visible-data-changed", ATK_TYPE_OBJECT);
 }
 
+/**
+ * @brief Handler for event which is raised when entry content has been
+ * changed by user
+ *
+ * Updates line index of the textblock for the edit described in event_info
+ * instead of marking it outdated.
+ *
+ * @param data data passed to callback
+ * @param obj Evas_Object that raised event
+ * @param event_info Elm_Entry_Change_Info describing the edit
+ */
+void
+_eail_entry_handle_changed_user_event(void *data,
+                                      Evas_Object *obj,
+                                      void *event_info)
+{
+   Elm_Entry_Change_Info *info = event_info;
+   Evas_Object *textblock = elm_entry_textblock_get(obj);
+
+   EailEntry *entry = EAIL_ENTRY(data);
+
+   eail_text_runs_free(entry->runs);
+   entry->runs = NULL;
+
+   if (!info)
+     {
+        eail_text_lines_invalidate(textblock);
+        return;
+     }
+
+   if (info->insert)
+     eail_text_lines_update(textblock, info->change.insert.pos, 0,
+                            info->change.insert.plain_length);
+   else
+     eail_text_lines_update(textblock,
+                            MIN(info->change.del.start, info->change.del.end),
+                            ABS(info->change.del.end - info->change.del.start),
+                            0);
+}
+
 /**
  * @brief handler for event which is raised when entry content is being pressed
  *
@@ -116,12 +177,45 @@ eail_entry_initialize(AtkObject *obj, gpointer data)
         return;
      }
 
+   /* cached runs and lines of text depend on these, keep them attached */
    evas_object_smart_callback_add(nested_widget, "changed",
                                   _eail_entry_handle_changed_event, obj);
-   evas_object_smart_callback_add(nested_widget, "cursor,changed",
-                                  _eail_entry_handle_cursor_changed_event, obj);
-   evas_object_smart_callback_add(nested_widget, "press",
-                                  _eail_entry_handle_pressed_event, obj);
+   evas_object_smart_callback_add(nested_widget, "changed,user",
+                                  _eail_entry_handle_changed_user_event, obj);
+}
+
+/**
+ * @brief Attaches and detaches cursor and press callbacks
+ *
+ * Implementation of EailWidget->instrument callback.
+ *
+ * @param widget EailWidget instance
+ * @param attach mask of EailSubscription values to attach
+ * @param detach mask of EailSubscription values to detach
+ */
+static void
+eail_entry_instrument(EailWidget *widget, guint attach, guint detach)
+{
+   Evas_Object *nested_widget = eail_widget_get_widget(widget);
+
+   EAIL_WIDGET_CLASS(eail_entry_parent_class)->instrument
+                                                (widget, attach, detach);
+
+   if (attach & EAIL_SUBSCRIPTION_CARET)
+     evas_object_smart_callback_add(nested_widget, "cursor,changed",
+                                    _eail_entry_handle_cursor_changed_event,
+                                    widget);
+   else if (detach & EAIL_SUBSCRIPTION_CARET)
+     evas_object_smart_callback_del_full
+        (nested_widget, "cursor,changed",
+         _eail_entry_handle_cursor_changed_event, widget);
+
+   if (attach & EAIL_SUBSCRIPTION_STATE)
+     evas_object_smart_callback_add(nested_widget, "press",
+                                    _eail_entry_handle_pressed_event, widget);
+   else if (detach & EAIL_SUBSCRIPTION_STATE)
+     evas_object_smart_callback_del_full
+        (nested_widget, "press", _eail_entry_handle_pressed_event, widget);
 }
 
 /**
@@ -132,6 +226,12 @@ eail_entry_initialize(AtkObject *obj, gpointer data)
 static void
 eail_entry_finalize(GObject *obj)
 {
+   EailEntry *entry = EAIL_ENTRY(obj);
+
+   eail_text_runs_free(entry->runs);
+   entry->runs = NULL;
+
+   G_OBJECT_CLASS(eail_entry_parent_class)->finalize(obj);
 }
 
 /**
@@ -178,6 +278,7 @@ eail_entry_init(EailEntry *entry)
 {
    entry->selection_start = 0;
    entry->selection_end = 0;
+   entry->runs = NULL;
 }
 
 /**
@@ -192,10 +293,13 @@ eail_entry_class_init(EailEntryClass *klass)
 {
    AtkObjectClass *atk_class = ATK_OBJECT_CLASS(klass);
    GObjectClass *gobject_class = G_OBJECT_CLASS(klass);
+   EailWidgetClass *widget_class = EAIL_WIDGET_CLASS(klass);
 
    atk_class->initialize = eail_entry_initialize;
    atk_class->ref_state_set = eail_entry_ref_state_set;
    gobject_class->finalize = eail_entry_finalize;
+
+   widget_class->instrument = eail_entry_instrument;
 }
 
 /**
@@ -603,6 +707,9 @@ eail_entry_get_default_attributes(AtkText *text)
  * around offset where the attributes are invariant. Note that end_offset
  * is the offset of the first character after the range.
  *
+ * Ranges are taken from the run table built from textblock format nodes.
+ * The table is built once per text revision and dropped on "changed" event.
+ *
  * The returned AtkAttributeSet should be freed by a call to
  * atk_attribute_set_free()
  *
@@ -621,9 +728,11 @@ eail_entry_get_run_attributes(AtkText *text,
                               gint *end_offset)
 {
    AtkAttributeSet *at_set = NULL;
+   EailEntry *entry = EAIL_ENTRY(text);
    Evas_Object *widget = eail_widget_get_widget(EAIL_WIDGET(text));
+   gint count = eail_entry_get_character_count(text);
 
-   if (!widget || offset >= eail_entry_get_character_count(text))
+   if (!widget || offset < 0 || offset >= count)
      {
         *start_offset = -1;
         *end_offset = -1;
@@ -631,8 +740,17 @@ eail_entry_get_run_attributes(AtkText *text,
         return NULL;
      }
 
-   *start_offset = 0;
-   *end_offset = eail_entry_get_character_count(text);
+   if (entry->runs && eail_text_runs_get_length(entry->runs) != count)
+     {
+        eail_text_runs_free(entry->runs);
+        entry->runs = NULL;
+     }
+
+   if (!entry->runs)
+     entry->runs = eail_text_runs_new(elm_entry_textblock_get(widget), count);
+
+   at_set = eail_text_runs_get_attributes
+       (entry->runs, at_set, offset, start_offset, end_offset);
 
    /* NOTE: Elm_Wrap_Type value is in 100% compatible with ATK wrap modes, so
     * no additional conversion is needed*/
@@ -675,10 +793,6 @@ eail_entry_get_character_extents(AtkText *text,
                                  gint *height,
                                  AtkCoordType coords)
 {
-   int result = -1;
-   Evas_Object *textblock = NULL;
-   Evas_Textblock_Cursor *cur = NULL;
-
    Evas_Object *widget = eail_widget_get_widget(EAIL_WIDGET(text));
 
    if (!widget)
@@ -686,25 +800,8 @@ eail_entry_get_character_extents(AtkText *text,
       return;
    }
 
-   textblock = elm_entry_textblock_get(widget);
-   cur = evas_object_textblock_cursor_new(textblock);
-   evas_textblock_cursor_pos_set(cur, offset);
-
-   result = evas_textblock_cursor_char_geometry_get(cur, x, y, width, height);
-
-   evas_textblock_cursor_free(cur);
-
-   if (-1 == result) return;
-
-   if (coords == ATK_XY_SCREEN)
-   {
-      int ee_x, ee_y;
-      Ecore_Evas *ee= ecore_evas_ecore_evas_get(evas_object_evas_get(widget));
-
-      ecore_evas_geometry_get(ee, &ee_x, &ee_y, NULL, NULL);
-      *x += ee_x;
-      *y += ee_y;
-    }
+   eail_text_get_character_extents(elm_entry_textblock_get(widget), offset,
+                                   x, y, width, height, coords);
 }
 
 /*
@@ -727,43 +824,67 @@ eail_entry_get_offset_at_point(AtkText *text,
                                gint y,
                                AtkCoordType coords)
 {
-   Eina_Bool result = EINA_FALSE;
-   Evas_Object *textblock = NULL;
-   Evas_Textblock_Cursor *cur = NULL;
-   gint offset = -1;
-
    Evas_Object *widget = eail_widget_get_widget(EAIL_WIDGET(text));
 
-   if (!widget) return offset;
+   if (!widget) return -1;
 
-   if (coords == ATK_XY_SCREEN)
-   {
-      int ee_x, ee_y;
-      Ecore_Evas *ee= ecore_evas_ecore_evas_get(evas_object_evas_get(widget));
-
-      ecore_evas_geometry_get(ee, &ee_x, &ee_y, NULL, NULL);
-      x -= ee_x;
-      y -= ee_y;
-    }
-
-   textblock = elm_entry_textblock_get(widget);
-   if (!textblock) return offset;
+   return eail_text_get_offset_at_point(elm_entry_textblock_get(widget),
+                                        x, y, coords);
+}
 
-   cur = evas_object_textblock_cursor_new(textblock);
-   if (!cur) return offset;
+/**
+ * @brief Get the bounding box for text within the specified range.
+ *
+ * @param text AtkText instance
+ * @param start_offset offset of the first text character for which boundary
+ * information is required
+ * @param end_offset offset of the text character after the last character
+ * for which boundary information is required
+ * @param coord_type specify whether coordinates are relative to the screen
+ * or widget window
+ * @param [out] rect AtkTextRectangle which is filled in by this function
+ */
+static void
+eail_entry_get_range_extents(AtkText *text,
+                             gint start_offset,
+                             gint end_offset,
+                             AtkCoordType coord_type,
+                             AtkTextRectangle *rect)
+{
+   Evas_Object *widget = eail_widget_get_widget(EAIL_WIDGET(text));
 
-   result = evas_textblock_cursor_char_coord_set(cur, x, y);
+   if (!widget) return;
 
-   if (result == EINA_FALSE)
-   {
-      evas_textblock_cursor_free(cur);
-      return offset;
-   }
+   eail_text_get_range_extents(elm_entry_textblock_get(widget), start_offset,
+                               end_offset, coord_type, rect);
+}
 
-   offset = evas_textblock_cursor_pos_get(cur);
-   evas_textblock_cursor_free(cur);
+/**
+ * @brief Gets the ranges of text inside the specified rectangle
+ *
+ * @param text AtkText instance
+ * @param rect rectangle bounding the ranges
+ * @param coord_type specify whether coordinates are relative to the screen
+ * or widget window
+ * @param x_clip_type how to treat characters partially inside rect
+ * horizontally
+ * @param y_clip_type how to treat lines partially inside rect vertically
+ *
+ * @returns NULL-terminated array of AtkTextRange, free with
+ * atk_text_free_ranges
+ */
+static AtkTextRange **
+eail_entry_get_bounded_ranges(AtkText *text,
+                              AtkTextRectangle *rect,
+                              AtkCoordType coord_type,
+                              AtkTextClipType x_clip_type,
+                              AtkTextClipType y_clip_type)
+{
+   Evas_Object *widget = eail_widget_get_widget(EAIL_WIDGET(text));
 
-   return offset;
+   return eail_text_get_bounded_ranges
+      (widget ? elm_entry_textblock_get(widget) : NULL, rect, coord_type,
+       x_clip_type, y_clip_type);
 }
 
 /**
@@ -791,6 +912,8 @@ atk_text_interface_init(AtkTextIface *iface)
    iface->get_text_before_offset = eail_entry_get_text_before_offset;
    iface->get_character_extents = eail_entry_get_character_extents;
    iface->get_offset_at_point = eail_entry_get_offset_at_point;
+   iface->get_range_extents = eail_entry_get_range_extents;
+   iface->get_bounded_ranges = eail_entry_get_bounded_ranges;
 }
 
 /*
@@ -27,6 +27,7 @@
 #define EAIL_ENTRY_H
 
 #include "eail_text.h"
+#include "eail_text_runs.h"
 /**
  * @brief Returns a value corresponding to the type of EailEntry class
  */
@@ -86,6 +87,8 @@ struct _EailEntry
    gint selection_start;
    /** @brief Selection regiond end */
    gint selection_end;
+   /** @brief Attribute runs of current text, NULL when not built yet */
+   EailTextRuns *runs;
 };
 
 /** @brief Definition of class structure for Atk EailEntry*/
@@ -20,6 +20,19 @@
 /**
  * @file eail_factory.c
  * @brief Implementation of factory of EAIL accessible widgets
+ *
+ * Accessible type of a widget is looked up by its Elementary type name in
+ * a hash table built from eail_factory_types, instead of comparing the name
+ * against every known widget type.
+ *
+ * Created accessibles are cached by their Evas_Object or Elm_Object_Item.
+ * The cache is split into EAIL_FACTORY_SHARDS hash tables, each guarded by
+ * its own lock, so lookups from bridge threads do not serialize on a single
+ * lock. Accessibles are still created and destroyed on the main loop only.
+ *
+ * Lookups from other threads resolve a GWeakRef of the entry while the
+ * shard lock is held, so they either get a reference of their own or NULL
+ * if the accessible is being finalized.
  */
 
 #include <Elementary.h>
@@ -91,50 +104,282 @@
 #include "eail_item_parent.h"
 #include "eail_priv.h"
 
-/** @brief Cache of created AtkObjects for re-using by multiple ATK clients. It holds
- * EailFactoryObj* objects inside */
-static Eina_List *eail_cached_objs = NULL;
+/** @brief Number of independently locked parts of factory cache */
+#define EAIL_FACTORY_SHARDS 16
+
+/** @brief Independently locked part of factory cache */
+typedef struct _EailFactoryShard
+{
+   Eina_Lock lock;/**< @brief lock guarding objs */
+   /** @brief EailFactoryObj keyed by Evas_Object or Elm_Object_Item */
+   GHashTable *objs;
+} EailFactoryShard;
+
+/** @brief Cache of created AtkObjects for re-using by multiple ATK clients */
+static EailFactoryShard eail_factory_shards[EAIL_FACTORY_SHARDS];
+
+/** @brief Accessible type used for Elementary widget type */
+typedef struct _EailFactoryType
+{
+   const char *widget_type;/**< @brief name from elm_object_widget_type_get */
+   GType (*get_type)(void);/**< @brief getter registering the type on first call */
+} EailFactoryType;
 
 /**
- * @brief Creates an EailFactoryObj instance for the given widget and adds it to cache
+ * @brief Accessible types of known widget types
  *
- * @param atk_obj AtkObject instance
- * @param evas_obj Evas_Object instance
+ * Only getters are referenced here, so an accessible type is registered and
+ * its class initialized when the first widget of a matching type gets its
+ * accessible.
+ */
+static const EailFactoryType eail_factory_types[] = {
+   { "Elm_Win", eail_window_get_type },
+   { "elm_win", eail_window_get_type },
+   { "Elm_Bg", eail_background_get_type },
+   { "elm_bg", eail_background_get_type },
+   { "Elm_Box", eail_box_get_type },
+   { "elm_box", eail_box_get_type },
+   { "Elm_List", eail_list_get_type },
+   { "elm_list", eail_list_get_type },
+   { "Elm_Genlist", eail_genlist_get_type },
+   { "elm_genlist", eail_genlist_get_type },
+   { "Elm_Label", eail_label_get_type },
+   { "elm_label", eail_label_get_type },
+   { "Elm_Button", eail_button_get_type },
+   { "elm_button", eail_button_get_type },
+   { "Elm_Icon", eail_icon_get_type },
+   { "elm_icon", eail_icon_get_type },
+   { "entry", eail_entry_get_type },
+   { "Elm_Entry", eail_entry_get_type },
+   { "elm_entry", eail_entry_get_type },
+   { "Elm_Frame", eail_frame_get_type },
+   { "elm_frame", eail_frame_get_type },
+   { "Elm_Scroller", eail_scroller_get_type },
+   { "elm_scroller", eail_scroller_get_type },
+   { "Elm_Inwin", eail_inwin_get_type },
+   { "elm_inwin", eail_inwin_get_type },
+   { "Elm_Slider", eail_slider_get_type },
+   { "elm_slider", eail_slider_get_type },
+   { "Elm_Actionslider", eail_action_slider_get_type },
+   { "elm_actionslider", eail_action_slider_get_type },
+   { "Elm_Image", eail_image_get_type },
+   { "elm_image", eail_image_get_type },
+   { "Elm_Check", eail_check_get_type },
+   { "elm_check", eail_check_get_type },
+   { "Elm_Radio", eail_radio_button_get_type },
+   { "elm_radio", eail_radio_button_get_type },
+   { "Elm_Menu", eail_menu_get_type },
+   { "elm_menu", eail_menu_get_type },
+   { "Elm_Photo", eail_photo_get_type },
+   { "elm_photo", eail_photo_get_type },
+   { "Elm_Photocam", eail_photocam_get_type },
+   { "elm_photocam", eail_photocam_get_type },
+   { "Elm_Separator", eail_separator_get_type },
+   { "elm_separator", eail_separator_get_type },
+   { "Elm_Spinner", eail_spinner_get_type },
+   { "elm_spinner", eail_spinner_get_type },
+   { "Elm_Clock", eail_clock_get_type },
+   { "elm_clock", eail_clock_get_type },
+   { "Elm_Calendar", eail_calendar_get_type },
+   { "elm_calendar", eail_calendar_get_type },
+   { "Elm_Grid", eail_grid_get_type },
+   { "elm_grid", eail_grid_get_type },
+   { "Elm_Route", eail_route_get_type },
+   { "elm_route", eail_route_get_type },
+   { "Elm_Dayselector", eail_dayselector_get_type },
+   { "elm_dayselector", eail_dayselector_get_type },
+   { "Elm_Gengrid", eail_gengrid_get_type },
+   { "elm_gengrid", eail_gengrid_get_type },
+   { "Elm_Progressbar", eail_progressbar_get_type },
+   { "elm_progressbar", eail_progressbar_get_type },
+   { "Elm_Diskselector", eail_diskselector_get_type },
+   { "elm_diskselector", eail_diskselector_get_type },
+   { "Elm_Segment_Control", eail_segment_control_get_type },
+   { "elm_segment_control", eail_segment_control_get_type },
+   { "Elm_Conformant", eail_conformant_get_type },
+   { "elm_conformant", eail_conformant_get_type },
+   { "Elm_Notify", eail_notify_get_type },
+   { "elm_notify", eail_notify_get_type },
+   { "popup", eail_popup_get_type },
+   { "Elm_Popup", eail_popup_get_type },
+   { "elm_popup", eail_popup_get_type },
+   { "ctxpopup", eail_ctxpopup_get_type },
+   { "Elm_Ctxpopup", eail_ctxpopup_get_type },
+   { "elm_ctxpopup", eail_ctxpopup_get_type },
+   { "toolbar", eail_toolbar_get_type },
+   { "Elm_Toolbar", eail_toolbar_get_type },
+   { "elm_toolbar", eail_toolbar_get_type },
+   { "Elm_Multibuttonentry", eail_multibuttonentry_get_type },
+   { "elm_multibuttonentry", eail_multibuttonentry_get_type },
+   { "Elm_Web", eail_web_get_type },
+   { "elm_web", eail_web_get_type },
+   { "Elm_Index", eail_index_get_type },
+   { "elm_index", eail_index_get_type },
+   { "Elm_Fileselector", eail_fileselector_get_type },
+   { "elm_fileselector", eail_fileselector_get_type },
+   { "Elm_Fileselector_Entry", eail_fileselector_entry_get_type },
+   { "elm_fileselector_entry", eail_fileselector_entry_get_type },
+   { "fileselector_entry", eail_fileselector_entry_get_type },
+   /* NOTE: file selector button from accesibility point of view is
+    * no different in handling than regular push button */
+   { "Elm_Fileselector_Button", eail_button_get_type },
+   { "elm_fileselector_button", eail_button_get_type },
+   { "Elm_Colorselector", eail_colorselector_get_type },
+   { "elm_colorselector", eail_colorselector_get_type },
+   { "Elm_Naviframe", eail_naviframe_get_type },
+   { "elm_naviframe", eail_naviframe_get_type },
+   { "Elm_Datetime", eail_datetime_get_type },
+   { "elm_datetime", eail_datetime_get_type },
+   { "Elm_Hover", eail_hover_get_type },
+   { "elm_hover", eail_hover_get_type },
+   { "Elm_Panes", eail_panes_get_type },
+   { "elm_panes", eail_panes_get_type },
+   { "panel", eail_panel_get_type },
+   { "Elm_Panel", eail_panel_get_type },
+   { "elm_panel", eail_panel_get_type },
+   { "Elm_Thumb", eail_thumb_get_type },
+   { "elm_thumb", eail_thumb_get_type },
+   { "Elm_Mapbuf", eail_mapbuf_get_type },
+   { "elm_mapbuf", eail_mapbuf_get_type },
+   { "Elm_Slideshow", eail_slideshow_get_type },
+   { "elm_slideshow", eail_slideshow_get_type },
+   { "Elm_Hoversel", eail_hoversel_get_type },
+   { "elm_hoversel", eail_hoversel_get_type },
+   { "Elm_Map", eail_map_get_type },
+   { "elm_map", eail_map_get_type },
+   { "Elm_Glview", eail_glview_get_type },
+   { "elm_glview", eail_glview_get_type },
+   { "Elm_Bubble", eail_bubble_get_type },
+   { "elm_bubble", eail_bubble_get_type },
+   { "Elm_Plug", eail_plug_get_type },
+   { "elm_plug", eail_plug_get_type },
+   { "Elm_Video", eail_video_get_type },
+   { "elm_video", eail_video_get_type },
+   { "elm_player", eail_video_get_type },
+   { "Elm_Flip", eail_flip_get_type },
+   { "elm_flip", eail_flip_get_type },
+   { "Elm_Flipselector", eail_flipselector_get_type },
+   { "elm_flipselector", eail_flipselector_get_type },
+   { "Elm_Layout", eail_layout_get_type },
+   { "elm_layout", eail_layout_get_type },
+   { "Elm_Table", eail_table_get_type },
+   { "elm_table", eail_table_get_type },
+   { "Elm_Prefs", eail_prefs_get_type },
+   { "elm_prefs", eail_prefs_get_type },
+};
+
+/** @brief EailFactoryType keyed by widget type name */
+static GHashTable *eail_factory_type_map = NULL;
+
+/**
+ * @brief Gets cache shard holding given key
+ *
+ * @param key Evas_Object or Elm_Object_Item
+ *
+ * @returns EailFactoryShard instance
+ */
+static EailFactoryShard *
+_eail_factory_shard_get(const void *key)
+{
+   gsize hash = (gsize)key;
+
+   /* low bits are the same for all allocations */
+   hash = (hash >> 4) ^ (hash >> 12);
+
+   return &eail_factory_shards[hash % EAIL_FACTORY_SHARDS];
+}
+
+/**
+ * @brief Frees EailFactoryObj dropped from cache
+ *
+ * @param data EailFactoryObj instance
  */
 static void
-_eail_factory_append_wdgt_to_cache(AtkObject *atk_obj, Evas_Object *evas_obj)
+_eail_factory_obj_free(gpointer data)
 {
-   EailFactoryObj *factory_obj = g_new0(EailFactoryObj, 1);
-   factory_obj->atk_obj = atk_obj;
-   factory_obj->evas_obj = evas_obj;
+   EailFactoryObj *factory_obj = data;
+
+   g_weak_ref_clear(&factory_obj->ref);
+   g_free(factory_obj);
+}
+
+/**
+ * @brief Adds EailFactoryObj to cache
+ *
+ * @param key Evas_Object or Elm_Object_Item
+ * @param factory_obj EailFactoryObj instance, owned by cache
+ */
+static void
+_eail_factory_cache_insert(const void *key, EailFactoryObj *factory_obj)
+{
+   EailFactoryShard *shard = _eail_factory_shard_get(key);
 
-   eail_cached_objs = eina_list_append(eail_cached_objs, factory_obj);
+   g_weak_ref_init(&factory_obj->ref, factory_obj->atk_obj);
+
+   eina_lock_take(&shard->lock);
+   g_hash_table_insert(shard->objs, (gpointer)key, factory_obj);
+   eina_lock_release(&shard->lock);
 }
 
 /**
- * @brief Tries to find an AtkObject representing the given Evas_Object* in cache
+ * @brief Gets a new reference to AtkObject cached for key
+ *
+ * Can be called from any thread.
  *
- * @param widget Evas_Object instance to find in cache
+ * @param key Evas_Object or Elm_Object_Item
+ * @param found location set to whether key is cached, may be NULL
  *
- * @returns EailFactoryObj representing the given Evas_Object
- * or NULL if the widget's representation was not found
+ * @returns new reference to cached AtkObject, NULL if key is not cached or
+ * its accessible is being finalized
  */
-static EailFactoryObj *
-_eail_factory_find_obj_for_widget(const Evas_Object *widget)
+static AtkObject *
+_eail_factory_cache_lookup_ref(const void *key, gboolean *found)
 {
-   const Eina_List *l = NULL;
-   EailFactoryObj *factory_obj = NULL;
+   EailFactoryShard *shard = _eail_factory_shard_get(key);
+   EailFactoryObj *factory_obj;
+   AtkObject *atk_obj = NULL;
 
-   EINA_LIST_FOREACH(eail_cached_objs, l, factory_obj)
-     {
-        if (widget == factory_obj->evas_obj)
-          {
-             return factory_obj;
-          }
-     }
+   eina_lock_take(&shard->lock);
+   factory_obj = g_hash_table_lookup(shard->objs, key);
+   if (factory_obj)
+     atk_obj = g_weak_ref_get(&factory_obj->ref);
+   eina_lock_release(&shard->lock);
 
-   /* no widget implementation in cache was found */
-   return NULL;
+   if (found)
+     *found = factory_obj != NULL;
+
+   return atk_obj;
+}
+
+/**
+ * @brief Removes key from cache
+ *
+ * @param key Evas_Object or Elm_Object_Item
+ */
+static void
+_eail_factory_cache_remove(const void *key)
+{
+   EailFactoryShard *shard = _eail_factory_shard_get(key);
+
+   eina_lock_take(&shard->lock);
+   g_hash_table_remove(shard->objs, key);
+   eina_lock_release(&shard->lock);
+}
+
+/**
+ * @brief Creates an EailFactoryObj instance for the given widget and adds it to cache
+ *
+ * @param atk_obj AtkObject instance
+ * @param evas_obj Evas_Object instance
+ */
+static void
+_eail_factory_append_wdgt_to_cache(AtkObject *atk_obj, Evas_Object *evas_obj)
+{
+   EailFactoryObj *factory_obj = g_new0(EailFactoryObj, 1);
+   factory_obj->atk_obj = atk_obj;
+   factory_obj->evas_obj = evas_obj;
+
+   _eail_factory_cache_insert(evas_obj, factory_obj);
 }
 
 /**
@@ -151,260 +396,17 @@ static AtkObject *
 _eail_factory_create_accessible(Evas_Object *widget)
 {
    const char *type = NULL;
+   const EailFactoryType *factory_type = NULL;
    AtkObject *accessible = NULL;
 
    type = elm_object_widget_type_get(widget);
 
-   if ((!strcmp(type, "Elm_Win")) || (!strcmp(type, "elm_win")))
-     {
-        accessible = g_object_new(EAIL_TYPE_WINDOW, NULL);
-     }
-   else if ((!strcmp(type, "Elm_Bg")) || (!strcmp(type, "elm_bg")))
-     {
-        accessible = g_object_new(EAIL_TYPE_BACKGROUND, NULL);
-     }
-   else if ((!strcmp(type, "Elm_Box")) || (!strcmp(type, "elm_box")))
-     {
-        accessible = g_object_new(EAIL_TYPE_BOX, NULL);
-     }
-   else if ((!strcmp(type, "Elm_List")) || (!strcmp(type, "elm_list")))
-     {
-        accessible = g_object_new(EAIL_TYPE_LIST, NULL);
-     }
-   else if ((!strcmp(type, "Elm_Genlist")) || (!strcmp(type, "elm_genlist")))
-     {
-        accessible = g_object_new(EAIL_TYPE_GENLIST, NULL);
-     }
-   else if ((!strcmp(type, "Elm_Label")) || (!strcmp(type, "elm_label")))
-     {
-        accessible = g_object_new(EAIL_TYPE_LABEL, NULL);
-     }
-   else if ((!strcmp(type, "Elm_Button")) || (!strcmp(type, "elm_button")))
-     {
-        accessible = g_object_new(EAIL_TYPE_BUTTON, NULL);
-     }
-   else if ((!strcmp(type, "Elm_Icon")) || (!strcmp(type, "elm_icon")))
-     {
-        accessible = g_object_new(EAIL_TYPE_ICON, NULL);
-     }
-   else if ((!strcmp(type, "entry")) || (!strcmp(type, "Elm_Entry")) || (!strcmp(type, "elm_entry")))
-     {
-        accessible = g_object_new(EAIL_TYPE_ENTRY, NULL);
-     }
-   else if ((!strcmp(type, "Elm_Frame")) || (!strcmp(type, "elm_frame")))
-     {
-        accessible = g_object_new(EAIL_TYPE_FRAME, NULL);
-     }
-   else if ((!strcmp(type, "Elm_Scroller")) || (!strcmp(type, "elm_scroller")))
-     {
-        accessible = g_object_new(EAIL_TYPE_SCROLLER, NULL);
-     }
-   else if ((!strcmp(type, "Elm_Inwin")) || (!strcmp(type, "elm_inwin")))
-     {
-        accessible = g_object_new(EAIL_TYPE_INWIN, NULL);
-     }
-   else if ((!strcmp(type, "Elm_Slider")) || (!strcmp(type, "elm_slider")))
-     {
-        accessible = g_object_new(EAIL_TYPE_SLIDER, NULL);
-     }
-   else if ((!strcmp(type, "Elm_Actionslider")) || (!strcmp(type, "elm_actionslider")))
-     {
-        accessible = g_object_new(EAIL_TYPE_ACTION_SLIDER, NULL);
-     }
-   else if ((!strcmp(type, "Elm_Imgae")) || (!strcmp(type, "elm_image")))
-     {
-        accessible = g_object_new(EAIL_TYPE_IMAGE, NULL);
-     }
-   else if ((!strcmp(type, "Elm_Check")) || (!strcmp(type, "elm_check")))
-     {
-        accessible = g_object_new(EAIL_TYPE_CHECK, NULL);
-     }
-   else if ((!strcmp(type, "Elm_Radio")) || (!strcmp(type, "elm_radio")))
-     {
-        accessible = g_object_new(EAIL_TYPE_RADIO_BUTTON, NULL);
-     }
-   else if ((!strcmp(type, "Elm_Menu")) || (!strcmp(type, "elm_menu")))
-     {
-        accessible = g_object_new(EAIL_TYPE_MENU, NULL);
-     }
-   else if ((!strcmp(type, "Elm_Photo")) || (!strcmp(type, "elm_photo")))
-     {
-        accessible = g_object_new(EAIL_TYPE_PHOTO, NULL);
-     }
-   else if ((!strcmp(type, "Elm_Photocam")) || (!strcmp(type, "elm_photocam")))
-     {
-        accessible = g_object_new(EAIL_TYPE_PHOTOCAM, NULL);
-     }
-   else if ((!strcmp(type, "Elm_Separator")) || (!strcmp(type, "elm_separator")))
-     {
-        accessible = g_object_new(EAIL_TYPE_SEPARATOR, NULL);
-     }
-   else if ((!strcmp(type, "Elm_Spinner")) || (!strcmp(type, "elm_spinner")))
-     {
-        accessible = g_object_new(EAIL_TYPE_SPINNER, NULL);
-     }
-   else if ((!strcmp(type, "Elm_Clock")) || (!strcmp(type, "elm_clock")))
-     {
-        accessible = g_object_new(EAIL_TYPE_CLOCK, NULL);
-     }
-   else if ((!strcmp(type, "Elm_Calendar")) || (!strcmp(type, "elm_calendar")))
-     {
-        accessible = g_object_new(EAIL_TYPE_CALENDAR, NULL);
-     }
-   else if ((!strcmp(type, "Elm_Grid")) || (!strcmp(type, "elm_grid")))
-     {
-        accessible = g_object_new(EAIL_TYPE_GRID, NULL);
-     }
-   else if ((!strcmp(type, "Elm_Route")) || (!strcmp(type, "elm_route")))
-     {
-        accessible = g_object_new(EAIL_TYPE_ROUTE, NULL);
-     }
-   else if ((!strcmp(type, "Elm_Dayselector")) || (!strcmp(type, "elm_dayselector")))
-     {
-        accessible = g_object_new(EAIL_TYPE_DAYSELECTOR, NULL);
-     }
-   else if ((!strcmp(type, "Elm_Gengrid")) || (!strcmp(type, "elm_gengrid")))
-     {
-        accessible = g_object_new(EAIL_TYPE_GENGRID, NULL);
-     }
-   else if ((!strcmp(type, "Elm_Progressbar")) || (!strcmp(type, "elm_progressbar")))
-     {
-        accessible = g_object_new(EAIL_TYPE_PROGRESSBAR, NULL);
-     }
-   else if ((!strcmp(type, "Elm_Diskselector")) || (!strcmp(type, "elm_diskselector")))
-     {
-        accessible = g_object_new(EAIL_TYPE_DISKSELECTOR, NULL);
-     }
-   else if ((!strcmp(type, "Elm_Segment_Control")) || (!strcmp(type, "elm_segment_control")))
-     {
-        accessible = g_object_new(EAIL_TYPE_SEGMENT_CONTROL, NULL);
-     }
-   else if ((!strcmp(type, "Elm_Conformant")) || (!strcmp(type, "elm_conformant")))
-     {
-        accessible = g_object_new(EAIL_TYPE_CONFORMANT, NULL);
-     }
-   else if ((!strcmp(type, "Elm_Notify")) || (!strcmp(type, "elm_notify")))
-     {
-        accessible = g_object_new(EAIL_TYPE_NOTIFY, NULL);
-     }
-   else if ((!strcmp(type, "popup")) || (!strcmp(type, "Elm_Popup")) || (!strcmp(type, "elm_popup")))
-     {
-        accessible = g_object_new(EAIL_TYPE_POPUP, NULL);
-     }
-   else if ((!strcmp(type, "ctxpopup")) || (!strcmp(type, "Elm_Ctxpopup")) || (!strcmp(type, "elm_ctxpopup")))
-     {
-        accessible = g_object_new(EAIL_TYPE_CTXPOPUP, NULL);
-     }
-   else if ((!strcmp(type, "toolbar")) || (!strcmp(type, "Elm_Toolbar")) || (!strcmp(type, "elm_toolbar")))
-     {
-        accessible = g_object_new(EAIL_TYPE_TOOLBAR, NULL);
-     }
-   else if ((!strcmp(type, "Elm_Multibuttonentry")) || (!strcmp(type, "elm_multibuttonentry")))
-     {
-        accessible = g_object_new(EAIL_TYPE_MULTIBUTTONENTRY, NULL);
-     }
-   else if ((!strcmp(type, "Elm_Web")) || (!strcmp(type, "elm_web")))
-     {
-        accessible = g_object_new(EAIL_TYPE_WEB, NULL);
-     }
-   else if ((!strcmp(type, "Elm_Index")) || (!strcmp(type, "elm_index")))
-     {
-        accessible = g_object_new(EAIL_TYPE_INDEX, NULL);
-     }
-   else if ((!strcmp(type, "Elm_Fileselector")) || (!strcmp(type, "elm_fileselector")))
-     {
-        accessible = g_object_new(EAIL_TYPE_FILESELECTOR, NULL);
-     }
-   else if ((!strcmp(type, "Elm_Fileselector_Entry")) || (!strcmp(type, "elm_fileselector_entry")) ||
-            (!strcmp(type, "fileselector_entry")))
-     {
-        accessible = g_object_new(EAIL_TYPE_FILESELECTOR_ENTRY, NULL);
-     }
-   else if ((!strcmp(type, "Elm_Fileselector_Button")) || (!strcmp(type, "elm_fileselector_button")))
-     {
-        /* NOTE: file selector button from accesibility point of view is
-         * no different in handling than regular push button */
-        accessible = g_object_new(EAIL_TYPE_BUTTON, NULL);
-     }
-   else if ((!strcmp(type, "Elm_Colorselector")) || (!strcmp(type, "elm_colorselector")))
-     {
-        accessible = g_object_new(EAIL_TYPE_COLORSELECTOR, NULL);
-     }
-   else if ((!strcmp(type, "Elm_Naviframe")) || (!strcmp(type, "elm_naviframe")))
-     {
-        accessible = g_object_new(EAIL_TYPE_NAVIFRAME, NULL);
-     }
-   else if ((!strcmp(type, "Elm_Datetime")) || (!strcmp(type, "elm_datetime")))
-     {
-        accessible = g_object_new(EAIL_TYPE_DATETIME, NULL);
-     }
-   else if ((!strcmp(type, "Elm_Hover")) || (!strcmp(type, "elm_hover")))
-     {
-        accessible = g_object_new(EAIL_TYPE_HOVER, NULL);
-     }
-   else if ((!strcmp(type, "Elm_Panes")) || (!strcmp(type, "elm_panes")))
-     {
-        accessible = g_object_new(EAIL_TYPE_PANES, NULL);
-     }
-   else if ((!strcmp(type, "panel")) || (!strcmp(type, "Elm_Panel")) || (!strcmp(type, "elm_panel")))
-     {
-        accessible = g_object_new(EAIL_TYPE_PANEL, NULL);
-     }
-   else if ((!strcmp(type, "Elm_Thumb")) || (!strcmp(type, "elm_thumb")))
-     {
-        accessible = g_object_new(EAIL_TYPE_THUMB, NULL);
-     }
-   else if ((!strcmp(type, "Elm_Mapbuf")) || (!strcmp(type, "elm_mapbuf")))
-     {
-        accessible = g_object_new(EAIL_TYPE_MAPBUF, NULL);
-     }
-   else if ((!strcmp(type, "Elm_Slideshow")) || (!strcmp(type, "elm_slideshow")))
-     {
-        accessible = g_object_new(EAIL_TYPE_SLIDESHOW, NULL);
-     }
-   else if ((!strcmp(type, "Elm_Hoversel")) || (!strcmp(type, "elm_hoversel")))
-     {
-        accessible = g_object_new(EAIL_TYPE_HOVERSEL, NULL);
-     }
-   else if ((!strcmp(type, "Elm_Map")) || (!strcmp(type, "elm_map")))
-     {
-        accessible = g_object_new(EAIL_TYPE_MAP, NULL);
-     }
-   else if ((!strcmp(type, "Elm_Glview")) || (!strcmp(type, "elm_glview")))
-     {
-        accessible = g_object_new(EAIL_TYPE_GLVIEW, NULL);
-     }
-   else if ((!strcmp(type, "Elm_Bubble")) || (!strcmp(type, "elm_bubble")))
-     {
-        accessible = g_object_new(EAIL_TYPE_BUBBLE, NULL);
-     }
-   else if ((!strcmp(type, "Elm_Plug")) || (!strcmp(type, "elm_plug")))
-     {
-        accessible = g_object_new(EAIL_TYPE_PLUG, NULL);
-     }
-   else if ((!strcmp(type, "Elm_Video")) || (!strcmp(type, "elm_video")) || (!strcmp(type, "elm_player")))
-     {
-        accessible = g_object_new(EAIL_TYPE_VIDEO, NULL);
-     }
-   else if ((!strcmp(type, "Elm_Flip")) || (!strcmp(type, "elm_flip")))
-     {
-        accessible = g_object_new(EAIL_TYPE_FLIP, NULL);
-     }
-   else if ((!strcmp(type, "Elm_Flipselector")) || (!strcmp(type, "elm_flipselector")))
-     {
-        accessible = g_object_new(EAIL_TYPE_FLIPSELECTOR, NULL);
-     }
-   else if ((!strcmp(type, "Elm_Layout")) || (!strcmp(type, "elm_layout")))
-     {
-        accessible = g_object_new(EAIL_TYPE_LAYOUT, NULL);
-     }
-   else if ((!strcmp(type, "Elm_Table")) || (!strcmp(type, "elm_table")))
-     {
-        accessible = g_object_new(EAIL_TYPE_TABLE, NULL);
-     }
-   else if ((!strcmp(type, "Elm_Prefs")) || (!strcmp(type, "elm_prefs")))
+   if (type && eail_factory_type_map)
+     factory_type = g_hash_table_lookup(eail_factory_type_map, type);
+
+   if (factory_type)
      {
-        accessible = g_object_new(EAIL_TYPE_PREFS, NULL);
+        accessible = g_object_new(factory_type->get_type(), NULL);
      }
    else
      {
@@ -458,30 +460,21 @@ eail_factory_append_item_to_cache(AtkObject *atk_obj, Elm_Object_Item *item)
    factory_obj->atk_obj = atk_obj;
    factory_obj->obj_item = item;
 
-   eail_cached_objs = eina_list_append(eail_cached_objs, factory_obj);
+   _eail_factory_cache_insert(item, factory_obj);
 }
 
 /**
+ * Can be called from any thread.
+ *
  * @param item Elm_Object_Item* instance to be found
- * @returns EailFactoryObj instance or NULL if item's representation was not
- * found
+ * @returns new reference to AtkObject representing the item or NULL if
+ * item's representation was not found. Should be unreferenced with
+ * g_object_unref when no longer needed
  */
-EailFactoryObj *
-eail_factory_find_obj_for_item(const Elm_Object_Item *item)
+AtkObject *
+eail_factory_ref_item_accessible(const Elm_Object_Item *item)
 {
-   const Eina_List *l = NULL;
-   EailFactoryObj *factory_obj = NULL;
-
-   EINA_LIST_FOREACH(eail_cached_objs, l, factory_obj)
-     {
-        if (item == factory_obj->obj_item)
-          {
-             return factory_obj;
-          }
-     }
-
-   /* no Atk Elm_Object_Item implementation in cache was found */
-   return NULL;
+   return _eail_factory_cache_lookup_ref(item, NULL);
 }
 
 /**
@@ -504,7 +497,7 @@ eail_factory_get_item_atk_obj(Elm_Object_Item *item,
                               AtkObject *parent)
 {
    AtkObject *atk_obj;
-   EailFactoryObj *factory_obj = NULL;
+   gboolean found;
 
    if (!EAIL_IS_ITEM_PARENT(parent))
     {
@@ -513,18 +506,20 @@ eail_factory_get_item_atk_obj(Elm_Object_Item *item,
     }
 
    /* first trying to get object from cache*/
-   factory_obj = eail_factory_find_obj_for_item(item);
-   if (factory_obj)
+   atk_obj = _eail_factory_cache_lookup_ref(item, &found);
+   if (found)
       {
          /* already found implementation, no need to create new obj, returning
           * existing one from cache */
-          if (!factory_obj->atk_obj)
+          if (!atk_obj)
             {
                ERR("No atk obj found in eail_factory_widget!");
                return NULL;
             }
 
-         return factory_obj->atk_obj;
+         /* cache keeps its own reference on the main loop */
+         g_object_unref(atk_obj);
+         return atk_obj;
       }
 
    /* if not in cache then creating and then adding to cache for future use*/
@@ -541,14 +536,7 @@ eail_factory_get_item_atk_obj(Elm_Object_Item *item,
 void
 eail_factory_unregister_item_from_cache(Elm_Object_Item *item)
 {
-   EailFactoryObj *factory_obj = NULL;
-
-   factory_obj = eail_factory_find_obj_for_item(item);
-   if (!factory_obj) return;
-
-   eail_cached_objs = eina_list_remove(eail_cached_objs, factory_obj);
-
-   g_free(factory_obj);
+   _eail_factory_cache_remove(item);
 }
 
 /**
@@ -558,21 +546,15 @@ eail_factory_unregister_item_from_cache(Elm_Object_Item *item)
 void
 eail_factory_unregister_wdgt_from_cache(Evas_Object *widget)
 {
-   EailFactoryObj *factory_obj = NULL;
-
-   factory_obj = _eail_factory_find_obj_for_widget(widget);
-   if (!factory_obj) return;
-
-   eail_cached_objs = eina_list_remove(eail_cached_objs, factory_obj);
-
-   g_free(factory_obj);
+   _eail_factory_cache_remove(widget);
 }
 
 /**
  * @param widget Evas_Object* instance
  *
- * The returned AtkObject should be unreferenced when no longer needed
- * to free memory.
+ * The returned AtkObject is owned by the cache and stays valid as long as
+ * the widget lives, so this function is meant for the main loop only.
+ * Other threads should use eail_factory_ref_accessible.
  *
  * @returns AtkObject which is the accessible representation of the specified
  * Evas_Object
@@ -580,8 +562,31 @@ eail_factory_unregister_wdgt_from_cache(Evas_Object *widget)
 AtkObject *
 eail_factory_get_accessible(Evas_Object *widget)
 {
-   EailFactoryObj *factory_widget = NULL;
+   AtkObject *atk_obj = eail_factory_ref_accessible(widget);
+
+   /* cache keeps its own reference on the main loop */
+   if (atk_obj)
+     g_object_unref(atk_obj);
+
+   return atk_obj;
+}
+
+/**
+ * @param widget Evas_Object* instance
+ *
+ * Widgets having an accessible already are looked up without touching
+ * them, which is safe from any thread; creating a new accessible is done
+ * on the main loop only, other threads get NULL for such widgets.
+ *
+ * @returns new reference to AtkObject which is the accessible representation
+ * of the specified Evas_Object. Should be unreferenced with g_object_unref
+ * when no longer needed
+ */
+AtkObject *
+eail_factory_ref_accessible(Evas_Object *widget)
+{
    AtkObject *atk_obj = NULL;
+   gboolean found;
 
    if (!widget)
      {
@@ -589,26 +594,29 @@ eail_factory_get_accessible(Evas_Object *widget)
         return NULL;
      }
 
-   if (!elm_object_widget_check(widget))
-     {
-        DBG("%s is NOT elementary object widget!",
-            evas_object_type_get(widget));
-        return NULL;
-     }
-
-   /* looking for object in cache*/
-   factory_widget = _eail_factory_find_obj_for_widget(widget);
-   if (factory_widget)
+   /* looking for object in cache, only widgets get there */
+   atk_obj = _eail_factory_cache_lookup_ref(widget, &found);
+   if (found)
      {
         /* already found implementation, no need to create new obj, returning
          * existing one from cache */
-         if (!factory_widget->atk_obj)
+         if (!atk_obj)
            {
               ERR("No atk obj found in eail_factory_widget!");
               return NULL;
            }
 
-         return factory_widget->atk_obj;
+         return atk_obj;
+     }
+
+   if (!eina_main_loop_is())
+     return NULL;
+
+   if (!elm_object_widget_check(widget))
+     {
+        DBG("%s is NOT elementary object widget!",
+            evas_object_type_get(widget));
+        return NULL;
      }
 
    /* not found in cache, need to create new instance for atk obj
@@ -623,27 +631,134 @@ eail_factory_get_accessible(Evas_Object *widget)
    /* appending obj for future re-using*/
    _eail_factory_append_wdgt_to_cache(atk_obj, widget);
 
-   return atk_obj;
+   return g_object_ref(atk_obj);
 }
 
 /**
+ * Objects are returned in no particular order. Role is read under the
+ * shard lock, which keeps accessibles from being unregistered and freed
+ * meanwhile.
+ *
  * @param role an AtkRole for objects that have to be found
  *
- * @returns an Eina_List filled with AtkObject * objects
+ * @returns an Eina_List filled with new references to AtkObject * objects
  */
 Eina_List *
 eail_factory_find_objects_with_role(AtkRole role)
 {
-   const Eina_List *l = NULL;
    Eina_List *results_list = NULL;
    EailFactoryObj *factory_obj = NULL;
+   GHashTableIter iter;
+   guint i;
+
+   for (i = 0; i < EAIL_FACTORY_SHARDS; ++i)
+     {
+        EailFactoryShard *shard = &eail_factory_shards[i];
+
+        eina_lock_take(&shard->lock);
+        g_hash_table_iter_init(&iter, shard->objs);
+        while (g_hash_table_iter_next(&iter, NULL, (gpointer *)&factory_obj))
+          {
+             AtkObject *atk_obj = factory_obj->atk_obj;
+             if (!atk_obj || role != atk_obj->role) continue;
+
+             atk_obj = g_weak_ref_get(&factory_obj->ref);
+             if (atk_obj)
+               results_list = eina_list_append(results_list, atk_obj);
+          }
+        eina_lock_release(&shard->lock);
+     }
+
+   return results_list;
+}
+
+/**
+ * Objects are returned in no particular order.
+ *
+ * @returns an Eina_List filled with new references to AtkObject * objects
+ */
+Eina_List *
+eail_factory_get_accessibles(void)
+{
+   Eina_List *results_list = NULL;
+   EailFactoryObj *factory_obj = NULL;
+   GHashTableIter iter;
+   guint i;
 
-   EINA_LIST_FOREACH(eail_cached_objs, l, factory_obj)
+   for (i = 0; i < EAIL_FACTORY_SHARDS; ++i)
      {
-        AtkObject *atk_obj = factory_obj->atk_obj;
-        if (atk_obj && role == atk_obj->role)
-          results_list = eina_list_append(results_list, atk_obj);
+        EailFactoryShard *shard = &eail_factory_shards[i];
+
+        if (!shard->objs) continue;
+
+        eina_lock_take(&shard->lock);
+        g_hash_table_iter_init(&iter, shard->objs);
+        while (g_hash_table_iter_next(&iter, NULL, (gpointer *)&factory_obj))
+          {
+             AtkObject *atk_obj = g_weak_ref_get(&factory_obj->ref);
+
+             if (atk_obj)
+               results_list = eina_list_append(results_list, atk_obj);
+          }
+        eina_lock_release(&shard->lock);
      }
 
    return results_list;
 }
+
+/**
+ * Has to be called before any accessible is created. Does nothing if the
+ * cache is already set up.
+ */
+void
+eail_factory_init(void)
+{
+   guint i;
+
+   for (i = 0; i < EAIL_FACTORY_SHARDS; ++i)
+     {
+        EailFactoryShard *shard = &eail_factory_shards[i];
+
+        if (shard->objs) continue;
+
+        eina_lock_new(&shard->lock);
+        shard->objs = g_hash_table_new_full(g_direct_hash, g_direct_equal,
+                                            NULL,
+                                            _eail_factory_obj_free);
+     }
+
+   if (!eail_factory_type_map)
+     {
+        eail_factory_type_map = g_hash_table_new(g_str_hash, g_str_equal);
+        for (i = 0; i < G_N_ELEMENTS(eail_factory_types); ++i)
+          g_hash_table_insert(eail_factory_type_map,
+                              (gpointer)eail_factory_types[i].widget_type,
+                              (gpointer)&eail_factory_types[i]);
+     }
+}
+
+/**
+ * Accessibles stay alive, only their cache entries are dropped.
+ */
+void
+eail_factory_shutdown(void)
+{
+   guint i;
+
+   for (i = 0; i < EAIL_FACTORY_SHARDS; ++i)
+     {
+        EailFactoryShard *shard = &eail_factory_shards[i];
+
+        if (!shard->objs) continue;
+
+        g_hash_table_destroy(shard->objs);
+        shard->objs = NULL;
+        eina_lock_free(&shard->lock);
+     }
+
+   if (eail_factory_type_map)
+     {
+        g_hash_table_destroy(eail_factory_type_map);
+        eail_factory_type_map = NULL;
+     }
+}
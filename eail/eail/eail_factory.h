@@ -43,6 +43,7 @@ struct _EailFactoryObj
    AtkObject *atk_obj;/**< @brief AtkObject representation*/
    Evas_Object *evas_obj;/**< @brief Evas_Object that needs atk representation*/
    Elm_Object_Item *obj_item;/**< @brief Elm_Object_Item that needs atk representation*/
+   GWeakRef ref;/**< @brief atk_obj, resolved to a new reference from any thread */
 };
 
 /**
@@ -50,6 +51,11 @@ struct _EailFactoryObj
  */
 AtkObject * eail_factory_get_accessible    (Evas_Object *widget);
 
+/**
+ * @brief Gets a new reference to accessible of the given Evas_Object*
+ */
+AtkObject * eail_factory_ref_accessible    (Evas_Object *widget);
+
 /**
  * @brief Returns an instance of AtkObject for the given item
  */
@@ -63,9 +69,10 @@ AtkObject * eail_factory_get_item_atk_obj  (Elm_Object_Item *item,
 void eail_factory_append_item_to_cache     (AtkObject *atk_obj,
                                             Elm_Object_Item *item);
 /**
- * @brief Tries to find an AtkObject representing the given Elm_Object_Item * in cache
+ * @brief Gets a new reference to AtkObject cached for the given
+ * Elm_Object_Item
  */
-EailFactoryObj *eail_factory_find_obj_for_item (const Elm_Object_Item *item);
+AtkObject * eail_factory_ref_item_accessible(const Elm_Object_Item *item);
 
 /**
  * @brief Unregisters a widget and associated AtkObject* representation from
@@ -78,8 +85,27 @@ void eail_factory_unregister_wdgt_from_cache(Evas_Object *widget);
  * factory cache
  */
 void eail_factory_unregister_item_from_cache(Elm_Object_Item *item);
+
+/**
+ * @brief Gets all cached AtkObjects with given role
+ */
 Eina_List * eail_factory_find_objects_with_role(AtkRole role);
 
+/**
+ * @brief Gets all cached AtkObjects
+ */
+Eina_List * eail_factory_get_accessibles(void);
+
+/**
+ * @brief Sets up factory cache
+ */
+void eail_factory_init(void);
+
+/**
+ * @brief Frees factory cache
+ */
+void eail_factory_shutdown(void);
+
 #ifdef __cplusplus
 }
 #endif
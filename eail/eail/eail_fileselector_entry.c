@@ -27,10 +27,11 @@
 #include "eail_fileselector_entry.h"
 #include "eail_factory.h"
 #include "eail_utils.h"
+#include "eail_window.h"
 #include "eail_priv.h"
 
 static void atk_text_interface_init(AtkTextIface *iface);
-static void eail_fileselector_entry_actions_init(EailActionWidget *widget);
+static void eail_fileselector_entry_actions_init(EailActionWidgetClass *klass);
 
 #define ICON_CONTENT_NAME "button icon" /**< @brief content name for icon */
 #define EAIL_FSE_ACTION_CLICK "click"/**< @brief 'click' action name */
@@ -61,11 +62,6 @@ eail_fileselector_entry_initialize(AtkObject *obj, gpointer data)
 {
    ATK_OBJECT_CLASS(eail_fileselector_entry_parent_class) ->initialize(obj, data);
    obj->role = ATK_ROLE_GROUPING;
-
-   EailActionWidget *action_widget = EAIL_ACTION_WIDGET(obj);
-
-   /* Initializing possible widget actions table*/
-   eail_fileselector_entry_actions_init(action_widget);
 }
 
 /**
@@ -119,8 +115,11 @@ eail_fileselector_entry_get_name(AtkObject *obj)
 static Evas_Object *
 _eail_fileselector_entry_get_nested_button(AtkObject *obj)
 {
+   EailFileselectorEntry *fse = EAIL_FILESELECTOR_ENTRY(obj);
    Evas_Object *button_widget = NULL, *fse_widget = NULL;
 
+   if (fse->button.obj) return fse->button.obj;
+
    fse_widget = eail_widget_get_widget(EAIL_WIDGET(obj));
    if (!fse_widget) return NULL;
 
@@ -128,6 +127,8 @@ _eail_fileselector_entry_get_nested_button(AtkObject *obj)
    if (!button_widget)
      DBG("Button widget NOT found!");
 
+   eail_subobject_set(&fse->button, fse_widget, button_widget);
+
    return button_widget;
 }
 
@@ -219,6 +220,8 @@ eail_fileselector_entry_ref_child(AtkObject *obj, gint i)
 static void
 eail_fileselector_entry_finalize(GObject *object)
 {
+   eail_subobject_clear(&EAIL_FILESELECTOR_ENTRY(object)->button);
+
    G_OBJECT_CLASS(eail_fileselector_entry_parent_class)->finalize(object);
 }
 
@@ -239,6 +242,8 @@ eail_fileselector_entry_class_init(EailFileselectorEntryClass *klass)
    atk_class->get_n_children = eail_fileselector_entry_get_n_children;
    atk_class->ref_child = eail_fileselector_entry_ref_child;
    gobject_class->finalize = eail_fileselector_entry_finalize;
+
+   eail_fileselector_entry_actions_init(EAIL_ACTION_WIDGET_CLASS(klass));
 }
 
 /*
@@ -517,9 +522,8 @@ eail_fileselector_entry_get_character_extents(AtkText *text,
    if (coords == ATK_XY_SCREEN)
    {
       int ee_x, ee_y;
-      Ecore_Evas *ee= ecore_evas_ecore_evas_get(evas_object_evas_get(widget));
 
-      ecore_evas_geometry_get(ee, &ee_x, &ee_y, NULL, NULL);
+      eail_window_screen_origin_get(widget, &ee_x, &ee_y);
       *x += ee_x;
       *y += ee_y;
     }
@@ -926,9 +930,8 @@ eail_fileselector_entry_get_offset_at_point(AtkText *text,
    if (coords == ATK_XY_SCREEN)
    {
       int ee_x, ee_y;
-      Ecore_Evas *ee= ecore_evas_ecore_evas_get(evas_object_evas_get(widget));
 
-      ecore_evas_geometry_get(ee, &ee_x, &ee_y, NULL, NULL);
+      eail_window_screen_origin_get(widget, &ee_x, &ee_y);
       x -= ee_x;
       y -= ee_y;
     }
@@ -1107,21 +1110,19 @@ eail_action_release(AtkAction *action, void *data)
 /**
  * @brief Adds fileselector actions to actions table
  *
- * @param action_widget widget that implements EailActionWidget interface
+ * @param klass EailActionWidgetClass instance
  */
 static void
-eail_fileselector_entry_actions_init(EailActionWidget *action_widget)
+eail_fileselector_entry_actions_init(EailActionWidgetClass *klass)
 {
-   eail_action_widget_action_append(action_widget,
-                                    EAIL_FSE_ACTION_CLICK, NULL,
-                                    eail_action_click);
-   eail_action_widget_action_append(action_widget,
-                                    EAIL_FSE_ACTION_LONGPRESS, NULL,
-                                    eail_action_longpress);
-   eail_action_widget_action_append(action_widget,
-                                    EAIL_FSE_ACTION_PRESS, NULL,
-                                    eail_action_press);
-   eail_action_widget_action_append(action_widget,
-                                    EAIL_FSE_ACTION_RELEASE, NULL,
-                                    eail_action_release);
+   static const EailActionDesc eail_fileselector_entry_actions[] =
+     {
+        { EAIL_FSE_ACTION_CLICK, NULL, eail_action_click },
+        { EAIL_FSE_ACTION_LONGPRESS, NULL, eail_action_longpress },
+        { EAIL_FSE_ACTION_PRESS, NULL, eail_action_press },
+        { EAIL_FSE_ACTION_RELEASE, NULL, eail_action_release },
+     };
+
+   eail_action_widget_class_add_actions(klass, eail_fileselector_entry_actions,
+                                        G_N_ELEMENTS(eail_fileselector_entry_actions));
 }
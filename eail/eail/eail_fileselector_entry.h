@@ -85,6 +85,8 @@ struct _EailFileselectorEntry
    gint selection_start;
    /** @brief Selection region end */
    gint selection_end;
+   /** @brief cached file selector button */
+   EailSubobject button;
 };
 
 /** @brief Definition of object structure for Atk EailEntry*/
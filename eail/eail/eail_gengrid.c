@@ -25,9 +25,11 @@
 #include <Elementary.h>
 
 #include "eail_gengrid.h"
+#include "eail_item.h"
 #include "eail_item_parent.h"
 #include "eail_factory.h"
 #include "eail_utils.h"
+#include "eail_window.h"
 #include "eail_priv.h"
 
 static void eail_item_parent_interface_init(EailItemParentIface *iface);
@@ -73,6 +75,13 @@ eail_gengrid_item_handle_realized_event(void *data,
 
    if (!atk_item) return;
 
+   /* realized again after item update, text and content may have changed */
+   if (EAIL_IS_ITEM(atk_item))
+     {
+        eail_item_text_invalidate(EAIL_ITEM(atk_item));
+        eail_item_parts_invalidate(EAIL_ITEM(atk_item));
+     }
+
    eail_emit_children_changed_obj(TRUE, atk_parent, atk_item);
 }
 
@@ -379,10 +388,8 @@ eail_gengrid_item_extents_get(EailItemParent *parent,
 
    if (coord_type == ATK_XY_SCREEN) {
         int ee_x, ee_y;
-        Ecore_Evas *ee =
-           ecore_evas_ecore_evas_get(evas_object_evas_get(it_widget));
 
-        ecore_evas_geometry_get(ee, &ee_x, &ee_y, NULL, NULL);
+        eail_window_screen_origin_get(it_widget, &ee_x, &ee_y);
         *x += ee_x;
         *y += ee_y;
    }
@@ -27,6 +27,7 @@
 #include <Elementary.h>
 
 #include "eail_genlist.h"
+#include "eail_item.h"
 #include "eail_item_parent.h"
 #include "eail_factory.h"
 #include "eail_utils.h"
@@ -81,6 +82,13 @@ eail_list_item_handle_realized_event(void *data,
 
    if (!atk_item) return;
 
+   /* realized again after item update, text and content may have changed */
+   if (EAIL_IS_ITEM(atk_item))
+     {
+        eail_item_text_invalidate(EAIL_ITEM(atk_item));
+        eail_item_parts_invalidate(EAIL_ITEM(atk_item));
+     }
+
    eail_emit_children_changed_obj(TRUE, atk_parent, atk_item);
 }
 
@@ -0,0 +1,425 @@
+/*
+ * Copyright (c) 2013 Samsung Electronics Co., Ltd.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/**
+ * @file eail_hit_grid.c
+ * @brief Implementation of per-window spatial index of accessible extents
+ *
+ * Canvas of every window is divided into square cells. Each cell lists the
+ * widget accessibles whose extents overlap it, so a point query only looks
+ * at the accessibles of a single cell. Entries are refreshed from the
+ * show, hide, move and resize callbacks of EailWidget. Those are attached
+ * on demand, so the index subscribes to them with the first lookup and
+ * widgets are indexed from then on.
+ *
+ * Subscription is released when no lookup was done for
+ * EAIL_HIT_GRID_IDLE_TIME seconds or when the last window with a grid is
+ * deleted. Widgets then leave the index as their callbacks are detached,
+ * and the next lookup subscribes again, which indexes them anew.
+ *
+ * Grid is kept on the window object and freed together with it.
+ */
+
+#include <Elementary.h>
+
+#include "eail_hit_grid.h"
+#include "eail_subscription.h"
+#include "eail_priv.h"
+
+/** @brief Key under which grid is stored on window */
+#define EAIL_HIT_GRID_KEY "eail_hit_grid"
+
+/** @brief Cell size in canvas pixels */
+#define EAIL_HIT_GRID_CELL 64
+
+/**
+ * @brief Gets cell key for cell coordinates
+ *
+ * @param cx cell column
+ * @param cy cell row
+ */
+#define EAIL_HIT_GRID_CELL_KEY(cx, cy) \
+   GUINT_TO_POINTER((((guint)(cx) & 0xFFFF) << 16) | ((guint)(cy) & 0xFFFF))
+
+/** @brief Seconds without lookups after which subscription is released */
+#define EAIL_HIT_GRID_IDLE_TIME 2.0
+
+/** @brief Whether EAIL_SUBSCRIPTION_GEOMETRY is taken by the index */
+static gboolean eail_hit_grid_subscribed = FALSE;
+
+/** @brief Checks for lookups while subscribed, NULL if not subscribed */
+static Ecore_Timer *eail_hit_grid_idle_timer = NULL;
+
+/** @brief Loop time of the last lookup */
+static double eail_hit_grid_last_lookup = 0.0;
+
+/** @brief Number of windows having a grid */
+static guint eail_hit_grid_n_grids = 0;
+
+/** @brief Per-window index */
+typedef struct _EailHitGrid
+{
+   Evas_Object *window;/**< @brief window the grid belongs to */
+   GHashTable *cells;/**< @brief cell key to GPtrArray of EailHitEntry */
+} EailHitGrid;
+
+/** @brief Indexed widget */
+typedef struct _EailHitEntry
+{
+   AtkObject *accessible;/**< @brief accessible of widget, not referenced */
+   Evas_Object *widget;/**< @brief indexed widget */
+   EailHitGrid *grid;/**< @brief grid holding the entry, NULL if none */
+   Evas_Coord x;/**< @brief x coordinate of widget in canvas */
+   Evas_Coord y;/**< @brief y coordinate of widget in canvas */
+   Evas_Coord w;/**< @brief widget width */
+   Evas_Coord h;/**< @brief widget height */
+   gint depth;/**< @brief number of parent widgets up to window */
+} EailHitEntry;
+
+/** @brief All indexed widgets, Evas_Object to EailHitEntry */
+static GHashTable *eail_hit_entries = NULL;
+
+/**
+ * @brief Calls func for every cell key covered by entry extents
+ *
+ * @param entry EailHitEntry instance
+ * @param func callback taking grid, cell key and entry
+ */
+static void
+_eail_hit_grid_foreach_cell(EailHitEntry *entry,
+                            void (*func)(EailHitGrid *grid,
+                                         gpointer key,
+                                         EailHitEntry *entry))
+{
+   gint cx, cy, cx0, cy0, cx1, cy1;
+
+   if (entry->w <= 0 || entry->h <= 0) return;
+
+   cx0 = entry->x / EAIL_HIT_GRID_CELL - (entry->x < 0);
+   cy0 = entry->y / EAIL_HIT_GRID_CELL - (entry->y < 0);
+   cx1 = (entry->x + entry->w - 1) / EAIL_HIT_GRID_CELL;
+   cy1 = (entry->y + entry->h - 1) / EAIL_HIT_GRID_CELL;
+
+   for (cy = cy0; cy <= cy1; ++cy)
+     for (cx = cx0; cx <= cx1; ++cx)
+       func(entry->grid, EAIL_HIT_GRID_CELL_KEY(cx, cy), entry);
+}
+
+/**
+ * @brief Adds entry to a cell
+ *
+ * @param grid EailHitGrid instance
+ * @param key cell key
+ * @param entry EailHitEntry instance
+ */
+static void
+_eail_hit_grid_cell_add(EailHitGrid *grid, gpointer key, EailHitEntry *entry)
+{
+   GPtrArray *cell = g_hash_table_lookup(grid->cells, key);
+
+   if (!cell)
+     {
+        cell = g_ptr_array_new();
+        g_hash_table_insert(grid->cells, key, cell);
+     }
+
+   g_ptr_array_add(cell, entry);
+}
+
+/**
+ * @brief Removes entry from a cell
+ *
+ * @param grid EailHitGrid instance
+ * @param key cell key
+ * @param entry EailHitEntry instance
+ */
+static void
+_eail_hit_grid_cell_del(EailHitGrid *grid, gpointer key, EailHitEntry *entry)
+{
+   GPtrArray *cell = g_hash_table_lookup(grid->cells, key);
+
+   if (!cell) return;
+
+   g_ptr_array_remove_fast(cell, entry);
+   if (cell->len == 0)
+     g_hash_table_remove(grid->cells, key);
+}
+
+/**
+ * @brief Takes entry out of its grid
+ *
+ * @param entry EailHitEntry instance
+ */
+static void
+_eail_hit_entry_detach(EailHitEntry *entry)
+{
+   if (!entry->grid) return;
+
+   _eail_hit_grid_foreach_cell(entry, _eail_hit_grid_cell_del);
+   entry->grid = NULL;
+}
+
+/**
+ * @brief Releases EAIL_SUBSCRIPTION_GEOMETRY taken by the index
+ */
+static void
+_eail_hit_grid_unsubscribe(void)
+{
+   if (!eail_hit_grid_subscribed) return;
+
+   DBG("Spatial index not in use, releasing geometry subscription");
+
+   if (eail_hit_grid_idle_timer)
+     {
+        ecore_timer_del(eail_hit_grid_idle_timer);
+        eail_hit_grid_idle_timer = NULL;
+     }
+
+   eail_hit_grid_subscribed = FALSE;
+   eail_subscription_remove(EAIL_SUBSCRIPTION_GEOMETRY);
+}
+
+/**
+ * @brief Releases subscription if no lookup was done recently
+ *
+ * @param data unused
+ *
+ * @returns ECORE_CALLBACK_RENEW while index is in use
+ */
+static Eina_Bool
+_eail_hit_grid_on_idle_check(void *data)
+{
+   if (ecore_loop_time_get() - eail_hit_grid_last_lookup <
+       EAIL_HIT_GRID_IDLE_TIME)
+     return ECORE_CALLBACK_RENEW;
+
+   /* returning cancel deletes the timer */
+   eail_hit_grid_idle_timer = NULL;
+   _eail_hit_grid_unsubscribe();
+
+   return ECORE_CALLBACK_CANCEL;
+}
+
+/**
+ * @brief Frees grid when window is deleted
+ *
+ * @param data EailHitGrid instance
+ * @param e Evas instance
+ * @param obj window object
+ * @param event_info additional event info
+ */
+static void
+_eail_hit_grid_on_del(void *data, Evas *e, Evas_Object *obj, void *event_info)
+{
+   EailHitGrid *grid = data;
+   GHashTableIter iter;
+   EailHitEntry *entry;
+
+   evas_object_data_del(obj, EAIL_HIT_GRID_KEY);
+
+   /* entries stay in the table, they are put into a new grid on update */
+   g_hash_table_iter_init(&iter, eail_hit_entries);
+   while (g_hash_table_iter_next(&iter, NULL, (gpointer *)&entry))
+     {
+        if (entry->grid == grid)
+          entry->grid = NULL;
+     }
+
+   g_hash_table_destroy(grid->cells);
+   g_free(grid);
+
+   if (--eail_hit_grid_n_grids == 0)
+     _eail_hit_grid_unsubscribe();
+}
+
+/**
+ * @brief Gets grid of window, creating it if needed
+ *
+ * @param window window object
+ * @returns EailHitGrid instance
+ */
+static EailHitGrid *
+_eail_hit_grid_get(Evas_Object *window)
+{
+   EailHitGrid *grid = evas_object_data_get(window, EAIL_HIT_GRID_KEY);
+
+   if (grid) return grid;
+
+   grid = g_new0(EailHitGrid, 1);
+   grid->window = window;
+   grid->cells = g_hash_table_new_full(g_direct_hash, g_direct_equal, NULL,
+                                       (GDestroyNotify)g_ptr_array_unref);
+
+   evas_object_data_set(window, EAIL_HIT_GRID_KEY, grid);
+   evas_object_event_callback_add(window, EVAS_CALLBACK_DEL,
+                                  _eail_hit_grid_on_del, grid);
+   eail_hit_grid_n_grids++;
+
+   return grid;
+}
+
+/**
+ * Window itself is not indexed, point queries return its descendants only.
+ *
+ * @param accessible accessible representing widget
+ * @param widget widget object
+ */
+void
+eail_hit_grid_update(AtkObject *accessible, Evas_Object *widget)
+{
+   EailHitEntry *entry;
+   Evas_Object *window, *parent;
+
+   if (!widget) return;
+
+   window = elm_object_top_widget_get(widget);
+   if (!window || window == widget) return;
+
+   if (!eail_hit_entries)
+     eail_hit_entries = g_hash_table_new_full(g_direct_hash, g_direct_equal,
+                                              NULL, g_free);
+
+   entry = g_hash_table_lookup(eail_hit_entries, widget);
+   if (!entry)
+     {
+        entry = g_new0(EailHitEntry, 1);
+        entry->widget = widget;
+        g_hash_table_insert(eail_hit_entries, widget, entry);
+     }
+
+   _eail_hit_entry_detach(entry);
+
+   entry->accessible = accessible;
+   evas_object_geometry_get(widget, &entry->x, &entry->y,
+                            &entry->w, &entry->h);
+
+   entry->depth = 0;
+   for (parent = elm_object_parent_widget_get(widget); parent;
+        parent = elm_object_parent_widget_get(parent))
+     entry->depth++;
+
+   entry->grid = _eail_hit_grid_get(window);
+   _eail_hit_grid_foreach_cell(entry, _eail_hit_grid_cell_add);
+}
+
+/**
+ * @param widget widget object
+ */
+void
+eail_hit_grid_remove(Evas_Object *widget)
+{
+   EailHitEntry *entry;
+
+   if (!widget || !eail_hit_entries) return;
+
+   entry = g_hash_table_lookup(eail_hit_entries, widget);
+   if (!entry) return;
+
+   _eail_hit_entry_detach(entry);
+   g_hash_table_remove(eail_hit_entries, widget);
+}
+
+/**
+ * @brief Checks whether widget and all its parent widgets are visible
+ *
+ * @param widget widget object
+ * @returns TRUE if widget is visible on screen, FALSE otherwise
+ */
+static gboolean
+_eail_hit_grid_is_visible(Evas_Object *widget)
+{
+   for (; widget; widget = elm_object_parent_widget_get(widget))
+     {
+        if (!evas_object_visible_get(widget)) return FALSE;
+     }
+
+   return TRUE;
+}
+
+/**
+ * Among widgets covering the point the one with most parent widgets wins;
+ * if two are equally deep, the one on higher evas layer is taken.
+ *
+ * @param window window object
+ * @param x x coordinate in canvas
+ * @param y y coordinate in canvas
+ *
+ * @returns AtkObject (not referenced) or NULL if no indexed accessible
+ * covers the point
+ */
+AtkObject *
+eail_hit_grid_lookup(Evas_Object *window, gint x, gint y)
+{
+   EailHitGrid *grid;
+   EailHitEntry *best = NULL;
+   GPtrArray *cell;
+   gint cx, cy;
+   guint i;
+
+   if (!window) return NULL;
+
+   eail_hit_grid_last_lookup = ecore_loop_time_get();
+
+   /* indexes every widget with accessible, before looking at the grid */
+   if (!eail_hit_grid_subscribed)
+     {
+        eail_hit_grid_subscribed = TRUE;
+        eail_subscription_add(EAIL_SUBSCRIPTION_GEOMETRY);
+        eail_hit_grid_idle_timer = ecore_timer_add
+           (EAIL_HIT_GRID_IDLE_TIME, _eail_hit_grid_on_idle_check, NULL);
+     }
+
+   grid = evas_object_data_get(window, EAIL_HIT_GRID_KEY);
+   if (!grid) return NULL;
+
+   cx = x / EAIL_HIT_GRID_CELL - (x < 0);
+   cy = y / EAIL_HIT_GRID_CELL - (y < 0);
+   cell = g_hash_table_lookup(grid->cells, EAIL_HIT_GRID_CELL_KEY(cx, cy));
+   if (!cell) return NULL;
+
+   for (i = 0; i < cell->len; ++i)
+     {
+        EailHitEntry *entry = g_ptr_array_index(cell, i);
+
+        if (x < entry->x || y < entry->y ||
+            x >= entry->x + entry->w || y >= entry->y + entry->h)
+          continue;
+
+        if (best && (entry->depth < best->depth ||
+                     (entry->depth == best->depth &&
+                      evas_object_layer_get(entry->widget) <=
+                      evas_object_layer_get(best->widget))))
+          continue;
+
+        if (!_eail_hit_grid_is_visible(entry->widget)) continue;
+
+        best = entry;
+     }
+
+   return best ? best->accessible : NULL;
+}
+
+/**
+ * Indexes already built stay on their windows.
+ */
+void
+eail_hit_grid_shutdown(void)
+{
+   _eail_hit_grid_unsubscribe();
+}
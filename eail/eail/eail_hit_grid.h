@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2013 Samsung Electronics Co., Ltd.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/**
+ * @file eail_hit_grid.h
+ *
+ * @brief Header for per-window spatial index of accessible extents
+ */
+
+#ifndef EAIL_HIT_GRID_H
+#define EAIL_HIT_GRID_H
+
+#include <atk/atk.h>
+#include <Evas.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Stores or refreshes extents of widget accessible in the index of
+ * its window
+ */
+void eail_hit_grid_update(AtkObject *accessible, Evas_Object *widget);
+
+/**
+ * @brief Removes widget from the index of its window
+ */
+void eail_hit_grid_remove(Evas_Object *widget);
+
+/**
+ * @brief Finds the deepest accessible at given canvas coordinates
+ */
+AtkObject *eail_hit_grid_lookup(Evas_Object *window, gint x, gint y);
+
+/**
+ * @brief Stops keeping index up to date
+ */
+void eail_hit_grid_shutdown(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
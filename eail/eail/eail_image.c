@@ -66,6 +66,12 @@ _eail_image_action_click(AtkAction *action, void *data)
     return TRUE;
 }
 
+/** @brief Actions of EailImage */
+static const EailActionDesc eail_image_actions[] =
+  {
+     { EAIL_IMAGE_ACTION_CLICK, NULL, _eail_image_action_click },
+  };
+
 /*
  * Implementation of the *AtkObject* interface
  */
@@ -83,11 +89,6 @@ eail_image_initialize(AtkObject *obj, gpointer data)
    ATK_OBJECT_CLASS(eail_image_parent_class)->initialize(obj, data);
 
    obj->role = ATK_ROLE_IMAGE;
-
-   eail_action_widget_action_append(EAIL_ACTION_WIDGET(obj),
-                                    EAIL_IMAGE_ACTION_CLICK,
-                                    NULL,
-                                    _eail_image_action_click);
 }
 
 /**
@@ -173,6 +174,10 @@ eail_image_class_init(EailImageClass *klass)
    atk_class->ref_state_set = eail_image_ref_state_set;
 
    g_object_class->finalize = eail_image_finalize;
+
+   eail_action_widget_class_add_actions(EAIL_ACTION_WIDGET_CLASS(klass),
+                                        eail_image_actions,
+                                        G_N_ELEMENTS(eail_image_actions));
 }
 
 /*
@@ -0,0 +1,372 @@
+/*
+ * Copyright (c) 2013 Samsung Electronics Co., Ltd.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/**
+ * @file eail_input_script.c
+ * @brief Implementation of scripted synthetic input
+ *
+ * Every queued event carries a delay in milliseconds relative to the
+ * previous one. Events following each other without delay are fed to the
+ * canvas in one go, without returning to the main loop, so the whole batch
+ * is rendered once. Events separated by a delay are fed from a single Ecore
+ * timer whose interval follows the delays, which keeps gestures like long
+ * press working.
+ *
+ * Event timestamps advance by the queued delays, so gesture recognizers
+ * relying on them see the intended timing.
+ */
+
+#include <Ecore.h>
+#include <Evas.h>
+
+#include "eail_input_script.h"
+#include "eail_priv.h"
+
+/** @brief Kinds of scripted events */
+typedef enum
+{
+   EAIL_INPUT_MOVE,/**< @brief pointer move */
+   EAIL_INPUT_PRESS,/**< @brief mouse button press */
+   EAIL_INPUT_RELEASE,/**< @brief mouse button release */
+   EAIL_INPUT_KEY/**< @brief key press and release */
+} EailInputType;
+
+/** @brief Single scripted event */
+typedef struct _EailInputEvent
+{
+   EailInputType type;/**< @brief kind of event */
+   guint delay;/**< @brief milliseconds after previous event */
+   gint x;/**< @brief x coordinate of move in canvas */
+   gint y;/**< @brief y coordinate of move in canvas */
+   gint button;/**< @brief mouse button of press or release */
+   gchar *keyname;/**< @brief key name of key event */
+} EailInputEvent;
+
+/** @brief Definition of input script */
+struct _EailInputScript
+{
+   Evas_Object *target;/**< @brief object whose canvas receives events */
+   GArray *events;/**< @brief queued EailInputEvent structures */
+   guint next;/**< @brief index of first event not fed yet */
+   unsigned int timestamp;/**< @brief timestamp of last fed event */
+   Ecore_Timer *timer;/**< @brief timer feeding delayed batches, NULL if none */
+   gboolean feeding;/**< @brief batch is being fed, feeder frees the script */
+};
+
+static void _eail_input_script_on_target_del(void *data,
+                                             Evas *e,
+                                             Evas_Object *obj,
+                                             void *event_info);
+
+/**
+ * @param target object whose canvas will receive events
+ *
+ * @returns new EailInputScript, run it with eail_input_script_run or free
+ * it with eail_input_script_free
+ */
+EailInputScript *
+eail_input_script_new(Evas_Object *target)
+{
+   EailInputScript *script;
+
+   g_return_val_if_fail(target, NULL);
+
+   script = g_new0(EailInputScript, 1);
+   script->target = target;
+   script->events = g_array_new(FALSE, FALSE, sizeof(EailInputEvent));
+
+   evas_object_event_callback_add(target, EVAS_CALLBACK_DEL,
+                                  _eail_input_script_on_target_del, script);
+
+   return script;
+}
+
+/**
+ * @param script EailInputScript instance
+ */
+void
+eail_input_script_free(EailInputScript *script)
+{
+   guint i;
+
+   if (!script) return;
+
+   if (script->timer)
+     ecore_timer_del(script->timer);
+
+   if (script->target)
+     evas_object_event_callback_del_full(script->target, EVAS_CALLBACK_DEL,
+                                         _eail_input_script_on_target_del,
+                                         script);
+
+   for (i = 0; i < script->events->len; ++i)
+     g_free(g_array_index(script->events, EailInputEvent, i).keyname);
+
+   g_array_free(script->events, TRUE);
+   g_free(script);
+}
+
+/**
+ * @brief Drops script when its target is deleted
+ *
+ * @param data EailInputScript instance
+ * @param e Evas instance
+ * @param obj deleted target
+ * @param event_info additional event info
+ */
+static void
+_eail_input_script_on_target_del(void *data,
+                                 Evas *e,
+                                 Evas_Object *obj,
+                                 void *event_info)
+{
+   EailInputScript *script = data;
+
+   script->target = NULL;
+
+   /* script still being filled or fed is freed by its owner */
+   if (script->timer && !script->feeding)
+     eail_input_script_free(script);
+}
+
+/**
+ * @brief Appends event to script
+ *
+ * @param script EailInputScript instance
+ * @param type kind of event
+ * @param delay milliseconds after previous event
+ *
+ * @returns appended event to fill
+ */
+static EailInputEvent *
+_eail_input_script_append(EailInputScript *script,
+                          EailInputType type,
+                          guint delay)
+{
+   EailInputEvent event = { 0 };
+
+   event.type = type;
+   event.delay = delay;
+   g_array_append_val(script->events, event);
+
+   return &g_array_index(script->events, EailInputEvent,
+                         script->events->len - 1);
+}
+
+/**
+ * @param script EailInputScript instance
+ * @param delay milliseconds after previous event
+ * @param x x coordinate in canvas
+ * @param y y coordinate in canvas
+ */
+void
+eail_input_script_move(EailInputScript *script, guint delay, gint x, gint y)
+{
+   EailInputEvent *event;
+
+   g_return_if_fail(script);
+
+   event = _eail_input_script_append(script, EAIL_INPUT_MOVE, delay);
+   event->x = x;
+   event->y = y;
+}
+
+/**
+ * @param script EailInputScript instance
+ * @param delay milliseconds after previous event
+ * @param button mouse button, 1 being the left one
+ */
+void
+eail_input_script_press(EailInputScript *script, guint delay, gint button)
+{
+   g_return_if_fail(script);
+
+   _eail_input_script_append(script, EAIL_INPUT_PRESS, delay)->button = button;
+}
+
+/**
+ * @param script EailInputScript instance
+ * @param delay milliseconds after previous event
+ * @param button mouse button, 1 being the left one
+ */
+void
+eail_input_script_release(EailInputScript *script, guint delay, gint button)
+{
+   g_return_if_fail(script);
+
+   _eail_input_script_append(script, EAIL_INPUT_RELEASE, delay)->button =
+      button;
+}
+
+/**
+ * @param script EailInputScript instance
+ * @param delay milliseconds after previous event
+ * @param keyname name of key, eg. "Return"
+ */
+void
+eail_input_script_key(EailInputScript *script,
+                      guint delay,
+                      const gchar *keyname)
+{
+   g_return_if_fail(script);
+   g_return_if_fail(keyname);
+
+   _eail_input_script_append(script, EAIL_INPUT_KEY, delay)->keyname =
+      g_strdup(keyname);
+}
+
+/**
+ * @brief Feeds single event to canvas
+ *
+ * @param evas Evas instance
+ * @param event EailInputEvent to feed
+ * @param timestamp event timestamp
+ */
+static void
+_eail_input_script_feed(Evas *evas,
+                        const EailInputEvent *event,
+                        unsigned int timestamp)
+{
+   switch (event->type)
+     {
+      case EAIL_INPUT_MOVE:
+         evas_event_feed_mouse_move(evas, event->x, event->y, timestamp, NULL);
+         break;
+      case EAIL_INPUT_PRESS:
+         evas_event_feed_mouse_down(evas, event->button, EVAS_BUTTON_NONE,
+                                    timestamp, NULL);
+         break;
+      case EAIL_INPUT_RELEASE:
+         evas_event_feed_mouse_up(evas, event->button, EVAS_BUTTON_NONE,
+                                  timestamp, NULL);
+         break;
+      case EAIL_INPUT_KEY:
+         evas_event_feed_key_down(evas, event->keyname, event->keyname,
+                                  NULL, NULL, timestamp, NULL);
+         evas_event_feed_key_up(evas, event->keyname, event->keyname,
+                                NULL, NULL, timestamp, NULL);
+         break;
+     }
+}
+
+/**
+ * @brief Feeds events up to the next delayed one
+ *
+ * @param script EailInputScript instance
+ *
+ * @returns TRUE if some events are still waiting, FALSE if script is done
+ */
+static gboolean
+_eail_input_script_flush(EailInputScript *script)
+{
+   Evas *evas = evas_object_evas_get(script->target);
+
+   script->feeding = TRUE;
+   do
+     {
+        const EailInputEvent *event =
+           &g_array_index(script->events, EailInputEvent, script->next);
+
+        script->timestamp += event->delay;
+        _eail_input_script_feed(evas, event, script->timestamp);
+        script->next++;
+     }
+   while (script->target && script->next < script->events->len &&
+          !g_array_index(script->events, EailInputEvent, script->next).delay);
+   script->feeding = FALSE;
+
+   return script->next < script->events->len;
+}
+
+/**
+ * @brief Gets delay before the next batch in seconds
+ *
+ * @param script EailInputScript instance with events waiting
+ *
+ * @returns delay of the first event not fed yet
+ */
+static double
+_eail_input_script_next_delay(const EailInputScript *script)
+{
+   return g_array_index(script->events, EailInputEvent,
+                        script->next).delay / 1000.0;
+}
+
+/**
+ * @brief Feeds next batch of delayed events
+ *
+ * @param data EailInputScript instance
+ *
+ * @returns EINA_TRUE while events are waiting, with timer interval set to
+ * the next delay, EINA_FALSE once the script is done
+ */
+static Eina_Bool
+_eail_input_script_on_timer(void *data)
+{
+   EailInputScript *script = data;
+
+   /* feeding events may delete the target as well */
+   if (script->target && _eail_input_script_flush(script) && script->target)
+     {
+        ecore_timer_interval_set(script->timer,
+                                 _eail_input_script_next_delay(script));
+        return EINA_TRUE;
+     }
+
+   /* returning EINA_FALSE deletes the timer */
+   script->timer = NULL;
+   eail_input_script_free(script);
+
+   return EINA_FALSE;
+}
+
+/**
+ * Events queued without delay are fed before the function returns, the rest
+ * is fed from the main loop. Script is freed when its last event has been
+ * fed or when its target is deleted.
+ *
+ * @param script EailInputScript instance
+ */
+void
+eail_input_script_run(EailInputScript *script)
+{
+   g_return_if_fail(script);
+
+   if (!script->target || !script->events->len)
+     {
+        eail_input_script_free(script);
+        return;
+     }
+
+   script->timestamp = (unsigned int)(ecore_loop_time_get() * 1000.0);
+
+   /* leading delay is waited for as well */
+   if (!_eail_input_script_next_delay(script))
+     {
+        /* feeding events may delete the target as well */
+        if (!_eail_input_script_flush(script) || !script->target)
+          {
+             eail_input_script_free(script);
+             return;
+          }
+     }
+
+   script->timer = ecore_timer_add(_eail_input_script_next_delay(script),
+                                   _eail_input_script_on_timer, script);
+}
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2013 Samsung Electronics Co., Ltd.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/**
+ * @file eail_input_script.h
+ *
+ * @brief Header for scripted synthetic input
+ */
+
+#ifndef EAIL_INPUT_SCRIPT_H
+#define EAIL_INPUT_SCRIPT_H
+
+#include <glib.h>
+#include <Evas.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief Sequence of synthetic input events fed to canvas of an object */
+typedef struct _EailInputScript EailInputScript;
+
+/**
+ * @brief Creates empty input script for canvas of given object
+ */
+EailInputScript *eail_input_script_new(Evas_Object *target);
+
+/**
+ * @brief Frees input script that has not been run
+ */
+void eail_input_script_free(EailInputScript *script);
+
+/**
+ * @brief Queues pointer move
+ */
+void eail_input_script_move(EailInputScript *script,
+                            guint delay,
+                            gint x,
+                            gint y);
+
+/**
+ * @brief Queues mouse button press
+ */
+void eail_input_script_press(EailInputScript *script,
+                             guint delay,
+                             gint button);
+
+/**
+ * @brief Queues mouse button release
+ */
+void eail_input_script_release(EailInputScript *script,
+                               guint delay,
+                               gint button);
+
+/**
+ * @brief Queues key press and release
+ */
+void eail_input_script_key(EailInputScript *script,
+                           guint delay,
+                           const gchar *keyname);
+
+/**
+ * @brief Feeds queued events to canvas and frees the script
+ */
+void eail_input_script_run(EailInputScript *script);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -27,6 +27,8 @@
  * extending EailWidget.
 */
 
+#include <Elementary.h>
+
 #include "eail_item.h"
 #include "eail_item_parent.h"
 #include "eail_factory.h"
@@ -46,8 +48,18 @@ static void atk_text_interface_init(AtkTextIface *iface);
 #define EAIL_ITEM_PART_SECOND "end" /**< @brief 'end' action name*/
 #define EAIL_ITEM_PART_ICON "elm.swallow.icon" /**< @brief icon item part*/
 #define EAIL_ITEM_PART_END "elm.swallow.end" /**< @brief end item part*/
+#define EAIL_ITEM_CONTENTS_KEY "contents" /**< @brief edje data listing swallow parts*/
 #define EAIL_TXT_SEPARATOR " " /**< @brief separator for text content*/
 
+/** @brief Well documented content parts, asked before swallows of item style */
+static const gchar * const eail_item_basic_parts[] =
+{
+   EAIL_ITEM_PART_FIRST,
+   EAIL_ITEM_PART_SECOND,
+   EAIL_ITEM_PART_ICON,
+   EAIL_ITEM_PART_END
+};
+
 /**
  * @brief EailItem GObject definition
  *
@@ -253,6 +265,15 @@ eail_item_init(EailItem *item)
    item->release_description = NULL;
    item->expand_description = NULL;
    item->shrink_description = NULL;
+   item->text = NULL;
+   item->text_index = NULL;
+   item->text_length = 0;
+   item->text_edjes = NULL;
+   item->parts = NULL;
+   item->parts_view = NULL;
+   item->parts_map = NULL;
+   item->actions_supported = -1;
+   item->attributes = NULL;
 }
 
 /**
@@ -274,6 +295,10 @@ eail_item_class_finalize(GObject *obj)
    if (eail_item->expand_description) free(eail_item->expand_description);
    if (eail_item->shrink_description) free(eail_item->shrink_description);
 
+   eail_item_text_invalidate(eail_item);
+   eail_item_parts_invalidate(eail_item);
+   eail_attributes_unref(eail_item->attributes);
+
    G_OBJECT_CLASS(eail_item_parent_class)->finalize(obj);
 }
 
@@ -334,6 +359,7 @@ _eail_item_get_basic_parts(EailItem *eail_item)
 {
    Eina_List *items = NULL;
    Elm_Object_Item *obj_item = NULL;
+   guint i;
 
    /* if content_get is not supported then content from basic parts will be
     * always empty. This checking is being done, because elementary library
@@ -342,14 +368,9 @@ _eail_item_get_basic_parts(EailItem *eail_item)
      return items;
 
    obj_item = eail_item_get_item(EAIL_ITEM(eail_item));
-   items = _eail_item_append_part_if_exist
-                                       (obj_item, items, EAIL_ITEM_PART_FIRST);
-   items = _eail_item_append_part_if_exist
-                                       (obj_item, items, EAIL_ITEM_PART_SECOND);
-   items = _eail_item_append_part_if_exist
-                                       (obj_item, items, EAIL_ITEM_PART_ICON);
-   items = _eail_item_append_part_if_exist
-                                       (obj_item, items, EAIL_ITEM_PART_END);
+   for (i = 0; i < G_N_ELEMENTS(eail_item_basic_parts); ++i)
+     items = _eail_item_append_part_if_exist
+                          (obj_item, items, (gchar *)eail_item_basic_parts[i]);
 
    return items;
 }
@@ -378,38 +399,280 @@ _eail_add_unique_listsparts(Eina_List *item_list,
    return item_list;
 }
 
+/** @brief Swallow parts of an item style */
+typedef struct _EailItemPartMap
+{
+   gchar **swallows;/**< @brief swallow part names, NULL if not listed */
+} EailItemPartMap;
+
+/** @brief Item style (edje file and group of item view) to EailItemPartMap */
+static GHashTable *eail_item_part_maps = NULL;
+
+/**
+ * @brief Frees EailItemPartMap
+ *
+ * @param data EailItemPartMap instance
+ */
+static void
+_eail_item_part_map_free(gpointer data)
+{
+   EailItemPartMap *map = data;
+
+   g_strfreev(map->swallows);
+   g_free(map);
+}
+
+/**
+ * @brief Gets swallow parts of item style, reading them on first use
+ *
+ * Item styles list their swallow parts in "contents" edje data item, which
+ * is read once per style. Styles that do not list them get a map without
+ * swallows, content of their items is then found among edje members.
+ *
+ * @param view item view (edje object)
+ *
+ * @returns EailItemPartMap or NULL if view is not an edje object
+ */
+static const EailItemPartMap *
+_eail_item_part_map_get(Evas_Object *view)
+{
+   const char *file = NULL, *group = NULL, *contents;
+   EailItemPartMap *map;
+   gchar *key;
+
+   edje_object_file_get(view, &file, &group);
+   if (!group) return NULL;
+
+   if (!eail_item_part_maps)
+     eail_item_part_maps = g_hash_table_new_full(g_str_hash, g_str_equal,
+                                                 g_free,
+                                                 _eail_item_part_map_free);
+
+   key = g_strconcat(file ? file : "", ":", group, NULL);
+   map = g_hash_table_lookup(eail_item_part_maps, key);
+   if (map)
+     {
+        g_free(key);
+        return map;
+     }
+
+   map = g_new0(EailItemPartMap, 1);
+   contents = edje_object_data_get(view, EAIL_ITEM_CONTENTS_KEY);
+   if (contents)
+     map->swallows = g_strsplit(contents, " ", -1);
+
+   g_hash_table_insert(eail_item_part_maps, key, map);
+
+   return map;
+}
+
+/**
+ * @brief Gets widgets swallowed in parts listed by the part map
+ *
+ * @param view item view (edje object)
+ * @param map EailItemPartMap of item style
+ *
+ * @returns Eina_List of Evas_Object* widgets, has to be freed
+ */
+static Eina_List *
+_eail_item_get_swallowed_parts(Evas_Object *view, const EailItemPartMap *map)
+{
+   Eina_List *items = NULL;
+   gchar **part;
+
+   for (part = map->swallows; *part; ++part)
+     {
+        Evas_Object *content;
+
+        if (!**part) continue;
+
+        content = edje_object_part_swallow_get(view, *part);
+        if (content && elm_object_widget_check(content))
+          items = eina_list_append(items, content);
+     }
+
+   return items;
+}
+
+/**
+ * @brief Drops content cache when one of content widgets is deleted
+ *
+ * @param data EailItem instance
+ * @param e Evas instance
+ * @param obj deleted content widget
+ * @param event_info additional event info
+ */
+static void
+_eail_item_on_part_del(void *data, Evas *e, Evas_Object *obj, void *event_info)
+{
+   eail_item_parts_invalidate(EAIL_ITEM(data));
+}
+
+/**
+ * Has to be called when content of item changes, e.g. when item is
+ * realized again after an update.
+ *
+ * @param item EailItem instance
+ */
+void
+eail_item_parts_invalidate(EailItem *item)
+{
+   Evas_Object *content;
+
+   g_return_if_fail(EAIL_IS_ITEM(item));
+
+   EINA_LIST_FREE(item->parts, content)
+     evas_object_event_callback_del_full(content, EVAS_CALLBACK_DEL,
+                                         _eail_item_on_part_del, item);
+
+   item->parts_view = NULL;
+   item->parts_map = NULL;
+}
+
+/**
+ * @brief Matches content of one part against the next cached content widget
+ *
+ * @param eail_item EailItem instance
+ * @param next position in cached content list, advanced on match
+ * @param content content of the part, NULL if part is empty
+ *
+ * @returns TRUE if content is the next cached widget, was matched by an
+ * earlier part or part is empty, FALSE otherwise
+ */
+static gboolean
+_eail_item_part_matches(EailItem *eail_item,
+                        const Eina_List **next,
+                        Evas_Object *content)
+{
+   const Eina_List *l;
+
+   if (!content) return TRUE;
+
+   if (*next && eina_list_data_get(*next) == content)
+     {
+        *next = eina_list_next(*next);
+        return TRUE;
+     }
+
+   /* the same widget may be reported by a basic part and a swallow */
+   for (l = eail_item->parts; l != *next; l = eina_list_next(l))
+     if (eina_list_data_get(l) == content) return TRUE;
+
+   return FALSE;
+}
+
+/**
+ * @brief Checks whether cached content still matches content parts of item
+ *
+ * Every basic part and every swallow of the part map is asked once, so the
+ * check takes O(parts) and does not allocate. It catches content set into
+ * an empty part or unset without being deleted, which raise no event on
+ * the item; deleted content drops the cache in _eail_item_on_part_del.
+ * Content of styles without part map, found among edje members, is kept
+ * until the view changes.
+ *
+ * @param eail_item EailItem instance with cached content
+ *
+ * @returns TRUE if cached content is up to date, FALSE otherwise
+ */
+static gboolean
+_eail_item_parts_valid(EailItem *eail_item)
+{
+   const EailItemPartMap *map = eail_item->parts_map;
+   const Eina_List *next = eail_item->parts;
+   gchar **part;
+   guint i;
+
+   if (_eail_item_is_content_get_supported(ATK_OBJECT(eail_item)))
+     {
+        for (i = 0; i < G_N_ELEMENTS(eail_item_basic_parts); ++i)
+          {
+             Evas_Object *content = elm_object_item_part_content_get
+                (eail_item->item, eail_item_basic_parts[i]);
+
+             if (!_eail_item_part_matches(eail_item, &next, content))
+               return FALSE;
+          }
+     }
+
+   if (!map || !map->swallows) return TRUE;
+
+   for (part = map->swallows; *part; ++part)
+     {
+        Evas_Object *content;
+
+        if (!**part) continue;
+
+        content = edje_object_part_swallow_get(eail_item->parts_view, *part);
+        if (!content || !elm_object_widget_check(content)) continue;
+
+        if (!_eail_item_part_matches(eail_item, &next, content))
+          return FALSE;
+     }
+
+   return next == NULL;
+}
+
 /**
  * @brief Gets content part items from the given EailItem object
  *
- * List should be freed when results will be processed.
+ * Content is resolved through the part map of item style and kept while
+ * item keeps its view and its parts hold the same widgets, see
+ * _eail_item_parts_valid. It is dropped as well when item is realized
+ * again or one of content widgets is deleted.
+ * Returned list is owned by item and must not be freed.
  *
  * @param eail_item EailItem object used to get content from
  *
  * @returns Eina_List containing content parts for the given item.
  */
-static Eina_List *
+static const Eina_List *
 _eail_item_get_part_items(EailItem *eail_item)
 {
-   Eina_List *items = NULL, *edje_items = NULL;
+   Eina_List *items = NULL, *edje_items = NULL, *l;
    Elm_Object_Item *obj_item = NULL;
+   const EailItemPartMap *map = NULL;
+   Evas_Object *view, *content;
 
    obj_item = eail_item_get_item(eail_item);
    g_return_val_if_fail(obj_item, NULL);
 
+   view = eail_get_edje_obj_from_item(obj_item);
+   if (eail_item->parts_view && eail_item->parts_view == view &&
+       _eail_item_parts_valid(eail_item))
+     return eail_item->parts;
+
+   eail_item_parts_invalidate(eail_item);
+
    /* parts from well documented default content parts - there are being used
     * mostly by desktop applications. Some of these parts are not listed in
     * edje objects (used below), so results from both list need to be merged
     * to list full item content */
    items = _eail_item_get_basic_parts(eail_item);
 
-   /* content parts from taken from edje object*/
-   edje_items = eail_get_edje_parts_for_item(obj_item);
+   /* content parts taken from swallows of item style, or from edje object
+    * members if the style does not list them */
+   if (view)
+     map = _eail_item_part_map_get(view);
+
+   if (map && map->swallows)
+     edje_items = _eail_item_get_swallowed_parts(view, map);
+   else
+     edje_items = eail_get_edje_parts_for_item(obj_item);
 
    /* adding unique edje items to content list*/
    items = _eail_add_unique_listsparts(items, edje_items);
 
    eina_list_free(edje_items);
 
+   EINA_LIST_FOREACH(items, l, content)
+     evas_object_event_callback_add(content, EVAS_CALLBACK_DEL,
+                                    _eail_item_on_part_del, eail_item);
+
+   eail_item->parts = items;
+   eail_item->parts_view = view;
+   eail_item->parts_map = map;
+
    return items;
 }
 
@@ -427,7 +690,7 @@ static gint
 eail_item_get_n_children(AtkObject *obj)
 {
    gint n_items, parent_n_items;
-   Eina_List *items;
+   const Eina_List *items;
    AtkObject *parent = atk_object_get_parent(obj);
 
    if (!parent) return 0;
@@ -440,8 +703,6 @@ eail_item_get_n_children(AtkObject *obj)
    items = _eail_item_get_part_items(EAIL_ITEM(obj));
    n_items = eina_list_count(items);
 
-   eina_list_free(items);
-
    return n_items;
 }
 
@@ -462,7 +723,7 @@ eail_item_get_n_children(AtkObject *obj)
 static AtkObject *
 eail_item_ref_child(AtkObject *obj, gint i)
 {
-   Eina_List *items;
+   const Eina_List *items;
    AtkObject *child = NULL;
    AtkObject *parent = atk_object_get_parent(obj);
    AtkObject *ref_child_from_parent = NULL;
@@ -486,8 +747,6 @@ eail_item_ref_child(AtkObject *obj, gint i)
    else
       ERR("Tried to ref child with index %d out of bounds!", i);
 
-   eina_list_free(items);
-
    if (child)
      g_object_ref(child);
    else
@@ -496,6 +755,43 @@ eail_item_ref_child(AtkObject *obj, gint i)
    return child;
 }
 
+/**
+ * Items of widgets of one type share one set, see eail_attributes_intern.
+ * Internal consumers read the set in place instead of copying it with
+ * atk_object_get_attributes.
+ *
+ * @param item EailItem instance
+ * @return EailAttributes with a new reference, release it with
+ * eail_attributes_unref, or NULL if item has no attributes
+ */
+EailAttributes *
+eail_item_ref_attributes(EailItem *item)
+{
+   Elm_Object_Item *obj_item = NULL;
+   Evas_Object *widget;
+
+   g_return_val_if_fail(EAIL_IS_ITEM(item), NULL);
+
+   /* parent widget of an item never changes */
+   if (item->attributes)
+     return eail_attributes_ref(item->attributes);
+
+   obj_item = eail_item_get_item(item);
+   if (!obj_item) {
+      return NULL;
+   }
+
+   widget = elm_object_item_widget_get(obj_item);
+   if (!widget) {
+      return NULL;
+   }
+
+   item->attributes = eail_attributes_intern
+      ("parent-type", elm_object_widget_type_get(widget), NULL);
+
+   return eail_attributes_ref(item->attributes);
+}
+
 /**
  * @brief Gets obj's attributes set
  *
@@ -507,26 +803,16 @@ eail_item_ref_child(AtkObject *obj, gint i)
 static AtkAttributeSet *
 eail_item_get_attributes(AtkObject *obj)
 {
-   AtkAttribute *attr;
    AtkAttributeSet *attributes;
-   Elm_Object_Item *obj_item = NULL;
+   EailAttributes *attrs = eail_item_ref_attributes(EAIL_ITEM(obj));
 
-   obj_item = eail_item_get_item(EAIL_ITEM(obj));
-   if (!obj_item) {
-      return NULL;
-   }
-
-   Evas_Object *widget = elm_object_item_widget_get(obj_item);
-
-   if (!widget) {
+   if (!attrs) {
       return NULL;
    }
 
-   attr = g_new(AtkAttribute, 1);
-   attr->name = g_strdup("parent-type");
-   attr->value = g_strdup(elm_object_widget_type_get(widget));
-
-   attributes = g_slist_append(NULL, attr);
+   /* the caller frees the set, shared pairs have to be copied */
+   attributes = eail_attributes_add(attrs, NULL);
+   eail_attributes_unref(attrs);
 
    return attributes;
 }
@@ -629,9 +915,29 @@ atk_component_interface_init(AtkComponentIface *iface)
  * AtkAction interface init
  */
 
+/**
+ * @brief Names of item actions in index order
+ *
+ * Item supporting n actions exposes the first n of them.
+ */
+static const gchar * const eail_item_action_names[] =
+{
+   EAIL_ITEM_CLICK_NAME,
+   EAIL_ITEM_PRESS_NAME,
+   EAIL_ITEM_RELEASE_NAME,
+   EAIL_ITEM_EXPAND_NAME,
+   EAIL_ITEM_SHRINK_NAME
+};
+
+/** @brief Item action names to their indexes + 1 */
+static GHashTable *eail_item_action_indexes = NULL;
+
 /**
  * @brief Gets actions supported by given EailItem object
  *
+ * Parent is asked once per item, see get_actions_supported of
+ * EailItemParentIface.
+ *
  * @param action AtkAction instance
  *
  * @returns EailActionSupported enum entry that shows what kind of actions are
@@ -640,14 +946,18 @@ atk_component_interface_init(AtkComponentIface *iface)
 static gint
 _eail_item_get_actions_supported(AtkAction *action)
 {
+   EailItem *item = EAIL_ITEM(action);
    AtkObject *parent = NULL;
 
+   if (item->actions_supported >= 0) return item->actions_supported;
+
    parent = atk_object_get_parent(ATK_OBJECT(action));
    g_return_val_if_fail(parent, FALSE);
 
-   return eail_item_parent_get_actions_supported
-                                 (EAIL_ITEM_PARENT(parent),EAIL_ITEM(action));
+   item->actions_supported = eail_item_parent_get_actions_supported
+      (EAIL_ITEM_PARENT(parent), item);
 
+   return item->actions_supported;
 }
 
 /**
@@ -662,23 +972,25 @@ static int
 eail_item_n_actions_get(AtkAction *action)
 {
    int actions_num = 0;
+   gint supported = _eail_item_get_actions_supported(action);
+
    /* if parent item does not support click action, then return no action */
-   if (_eail_item_get_actions_supported(action) == EAIL_ACTION_SUPPORTED_NONE)
+   if (supported == EAIL_ACTION_SUPPORTED_NONE)
      return 0;
 
-   if (_eail_item_get_actions_supported(action) & EAIL_ACTION_SUPPORTED_CLICK)
+   if (supported & EAIL_ACTION_SUPPORTED_CLICK)
      actions_num++;
 
-   if (_eail_item_get_actions_supported(action) & EAIL_ACTION_SUPPORTED_PRESS)
+   if (supported & EAIL_ACTION_SUPPORTED_PRESS)
      actions_num++;
 
-   if (_eail_item_get_actions_supported(action) & EAIL_ACTION_SUPPORTED_RELEASE)
+   if (supported & EAIL_ACTION_SUPPORTED_RELEASE)
      actions_num++;
 
-   if (_eail_item_get_actions_supported(action) & EAIL_ACTION_SUPPORTED_EXPAND)
+   if (supported & EAIL_ACTION_SUPPORTED_EXPAND)
      actions_num++;
 
-   if (_eail_item_get_actions_supported(action) & EAIL_ACTION_SUPPORTED_SHRINK)
+   if (supported & EAIL_ACTION_SUPPORTED_SHRINK)
      actions_num++;
 
    return actions_num;
@@ -694,44 +1006,39 @@ eail_item_n_actions_get(AtkAction *action)
 static const char*
 eail_item_action_name_get(AtkAction *action, int i)
 {
-   const char* action_name;
-   gint actions_num;
+   if (i < 0 || i >= eail_item_n_actions_get(action)) return NULL;
 
-   /* if parent item does not support click action, then return no action */
-   if (_eail_item_get_actions_supported(action) == EAIL_ACTION_SUPPORTED_NONE)
-     return NULL;
+   return eail_item_action_names[i];
+}
 
-   actions_num = atk_action_get_n_actions(action);
-   if (i >= actions_num) return NULL;
+/**
+ * @param item EailItem instance
+ * @param action_name name of the action
+ *
+ * @returns index of the action or -1 if item does not support it
+ */
+gint
+eail_item_action_index_get(EailItem *item, const gchar *action_name)
+{
+   gint i;
 
-   switch (i)
+   g_return_val_if_fail(EAIL_IS_ITEM(item), -1);
+   if (!action_name) return -1;
+
+   if (!eail_item_action_indexes)
      {
-      case 0:
-         /*"click": the user clicked the item*/
-         action_name = EAIL_ITEM_CLICK_NAME;
-         break;
-      case 1:
-         /*"press": the user pressed the item*/
-         action_name = EAIL_ITEM_PRESS_NAME;
-         break;
-      case 2:
-         /*"release": the user pressed the item*/
-         action_name = EAIL_ITEM_RELEASE_NAME;
-         break;
-      case 3:
-         /*"expand": the user expand the item*/
-         action_name = EAIL_ITEM_EXPAND_NAME;
-         break;
-      case 4:
-         /*"shrink": the user shrink the item*/
-         action_name = EAIL_ITEM_SHRINK_NAME;
-         break;
-      default:
-         action_name = NULL;
-         break;
+        eail_item_action_indexes = g_hash_table_new(g_str_hash, g_str_equal);
+        for (i = 0; i < G_N_ELEMENTS(eail_item_action_names); ++i)
+          g_hash_table_insert(eail_item_action_indexes,
+                              (gpointer)eail_item_action_names[i],
+                              GINT_TO_POINTER(i + 1));
      }
 
-   return action_name;
+   i = GPOINTER_TO_INT(g_hash_table_lookup(eail_item_action_indexes,
+                                           action_name)) - 1;
+   if (i < 0 || i >= eail_item_n_actions_get(ATK_ACTION(item))) return -1;
+
+   return i;
 }
 
 /**
@@ -746,7 +1053,7 @@ _eail_item_get_clickable_evas_obj(AtkObject *atk_item)
 {
    AtkObject *parent = NULL;
    Evas_Object *widget = NULL;
-   Eina_List *parts = NULL;
+   const Eina_List *parts = NULL;
 
    parent = atk_object_get_parent(atk_item);
    g_return_val_if_fail(parent, FALSE);
@@ -758,12 +1065,11 @@ _eail_item_get_clickable_evas_obj(AtkObject *atk_item)
    /* if not supported from parent, then trying to get content widget nested
     * in item */
    parts = _eail_item_get_part_items(EAIL_ITEM(atk_item));
-   if (parts && eina_list_count(parts) > 0)
+   if (parts)
      {
         /* getting first widget from content */
-        widget = eina_list_nth(parts, 0);
+        widget = eina_list_data_get(parts);
      }
-   eina_list_free(parts);
    if (widget) return widget;
 
    /* if no nested widget, then getting evas clickable area */
@@ -793,15 +1099,15 @@ static gboolean _eail_item_expand(AtkObject *atk_item, Eina_Bool expand)
 }
 
 /**
- * @brief Performs an action with the given name on given item
+ * @brief Performs an action with the given index on given item
  *
  * @param atk_item item object to perform the action on
- * @param action_name name of the action (eg. 'click', 'press'...)
+ * @param i index of the action in eail_item_action_names
  *
  * @returns TRUE if operation was successful, FALSE otherwise
  */
 static gboolean
-_eail_item_perform_action(AtkObject *atk_item, const gchar *action_name)
+_eail_item_perform_action(AtkObject *atk_item, gint i)
 {
    AtkObject *parent = NULL;
    Evas_Object *widget = NULL;
@@ -818,38 +1124,32 @@ _eail_item_perform_action(AtkObject *atk_item, const gchar *action_name)
         return FALSE;
      }
 
-   if (0 == g_strcmp0(action_name, EAIL_ITEM_CLICK_NAME))
-     {
-        DBG("Calling 'click' on item");
-        eail_get_coords_widget_center(widget, &x, &y);
-        eail_mouse_click_on_coords(widget, x, y);
-     }
-   else if (0 == g_strcmp0(action_name, EAIL_ITEM_PRESS_NAME))
-     {
-        DBG("Calling 'press' on item");
-        eail_get_coords_widget_center(widget, &x, &y);
-        eail_mouse_press_on_coords(widget, x, y);
-     }
-   else if (0 == g_strcmp0(action_name, EAIL_ITEM_RELEASE_NAME))
-     {
-        DBG("Calling 'release' on item");
-        eail_get_coords_widget_center(widget, &x, &y);
-        eail_mouse_release_on_coords(widget, x, y);
-     }
-   else if (0 == g_strcmp0(action_name, EAIL_ITEM_EXPAND_NAME))
-     {
-        DBG("Calling 'expand' on item");
-        return _eail_item_expand(atk_item, EINA_TRUE);
-     }
-   else if (0 == g_strcmp0(action_name, EAIL_ITEM_SHRINK_NAME))
-     {
-        DBG("Calling 'shrink' on item");
-        return _eail_item_expand(atk_item, EINA_FALSE);
-     }
-   else
+   switch (i)
      {
-        DBG("Action name not found: %s", action_name);
-        return FALSE;
+      case 0:
+         DBG("Calling 'click' on item");
+         eail_get_coords_widget_center(widget, &x, &y);
+         eail_mouse_click_on_coords(widget, x, y);
+         break;
+      case 1:
+         DBG("Calling 'press' on item");
+         eail_get_coords_widget_center(widget, &x, &y);
+         eail_mouse_press_on_coords(widget, x, y);
+         break;
+      case 2:
+         DBG("Calling 'release' on item");
+         eail_get_coords_widget_center(widget, &x, &y);
+         eail_mouse_release_on_coords(widget, x, y);
+         break;
+      case 3:
+         DBG("Calling 'expand' on item");
+         return _eail_item_expand(atk_item, EINA_TRUE);
+      case 4:
+         DBG("Calling 'shrink' on item");
+         return _eail_item_expand(atk_item, EINA_FALSE);
+      default:
+         DBG("Action not found: %d", i);
+         return FALSE;
      }
 
    return TRUE;
@@ -866,15 +1166,10 @@ _eail_item_perform_action(AtkObject *atk_item, const gchar *action_name)
 static gboolean
 eail_item_do_action(AtkAction *action, int i)
 {
-   const char *action_name = atk_action_get_name(action, i);
-
-   /* if parent item does not support click action, then return immediately */
-   if (_eail_item_get_actions_supported(action) == EAIL_ACTION_SUPPORTED_NONE)
-     return FALSE;
+   /* if parent item does not support the action, then return immediately */
+   if (i < 0 || i >= eail_item_n_actions_get(action)) return FALSE;
 
-   if (action_name == NULL) return FALSE;
-
-   return _eail_item_perform_action(ATK_OBJECT(action), action_name);;
+   return _eail_item_perform_action(ATK_OBJECT(action), i);
 }
 
 /**
@@ -1008,6 +1303,156 @@ atk_action_interface_init(AtkActionIface *iface)
    iface->set_description = eail_item_description_set;
 }
 
+/**
+ * @brief Drops text cache when one of text objects is deleted
+ *
+ * @param data EailItem instance
+ * @param e Evas instance
+ * @param obj deleted text object
+ * @param event_info additional event info
+ */
+static void
+_eail_item_on_text_part_del(void *data,
+                            Evas *e,
+                            Evas_Object *obj,
+                            void *event_info)
+{
+   eail_item_text_invalidate(EAIL_ITEM(data));
+}
+
+/**
+ * @brief Drops text cache when text of a part of item view is set
+ *
+ * Called for elm_object_item_part_text_set and for texts set when item is
+ * realized.
+ *
+ * @param data EailItem instance
+ * @param obj edje object owning the part
+ * @param part name of part whose text was set
+ */
+static void
+_eail_item_on_text_set(void *data, Evas_Object *obj, const char *part)
+{
+   eail_item_text_invalidate(EAIL_ITEM(data));
+}
+
+/**
+ * Text set on parts of item view and deletion of text objects are tracked
+ * by the item, this has to be called when text parts of item change in
+ * other ways, e.g. when item is realized again after an update.
+ *
+ * @param item EailItem instance
+ */
+void
+eail_item_text_invalidate(EailItem *item)
+{
+   Evas_Object *part, *edje;
+
+   g_return_if_fail(EAIL_IS_ITEM(item));
+
+   EINA_LIST_FREE(item->text_parts, part)
+     evas_object_event_callback_del_full(part, EVAS_CALLBACK_DEL,
+                                         _eail_item_on_text_part_del, item);
+   EINA_LIST_FREE(item->text_edjes, edje)
+     eail_edje_text_change_callback_del(edje, _eail_item_on_text_set, item);
+
+   g_free(item->text);
+   g_free(item->text_index);
+   item->text = NULL;
+   item->text_index = NULL;
+   item->text_length = 0;
+}
+
+/**
+ * @brief Starts tracking text object of item view
+ *
+ * @param item EailItem instance
+ * @param part text object
+ */
+static void
+_eail_item_text_part_watch(EailItem *item, Evas_Object *part)
+{
+   Evas_Object *edje = evas_object_smart_parent_get(part);
+
+   evas_object_event_callback_add(part, EVAS_CALLBACK_DEL,
+                                  _eail_item_on_text_part_del, item);
+   item->text_parts = eina_list_append(item->text_parts, part);
+
+   if (!edje || eina_list_data_find(item->text_edjes, edje)) return;
+
+   eail_edje_text_change_callback_add(edje, _eail_item_on_text_set, item);
+   item->text_edjes = eina_list_append(item->text_edjes, edje);
+}
+
+/**
+ * @brief Gets text content of item, composing it if not cached
+ *
+ * Text parts are joined with EAIL_TXT_SEPARATOR once and kept together
+ * with byte offsets of every character, so character access does not
+ * compose the text again. Cached text is returned without looking at the
+ * view; it is dropped by eail_item_text_invalidate when text of the view is
+ * set, its text objects are deleted or the item is realized again.
+ *
+ * @param item EailItem instance
+ *
+ * @returns composed text or NULL if item has no text parts
+ */
+static const gchar *
+_eail_item_text_get(EailItem *item)
+{
+   Elm_Object_Item *obj_item = eail_item_get_item(item);
+   Evas_Object *part;
+   Eina_Strbuf *buf;
+   Eina_List *raw_parts;
+   const gchar *text;
+   gchar *p;
+   gboolean first_part = TRUE;
+   gint i;
+
+   if (item->text) return item->text;
+   if (!obj_item) return NULL;
+
+   eail_item_text_invalidate(item);
+
+   buf = eina_strbuf_new();
+   raw_parts = eail_get_raw_evas_obj_list_from_item(obj_item);
+   EINA_LIST_FREE(raw_parts, part)
+    {
+      if (strcmp(evas_object_type_get(part), "text")) continue;
+
+      _eail_item_text_part_watch(item, part);
+
+      text = evas_object_text_text_get(part);
+      if (!text) continue;
+
+      if (!first_part)
+        eina_strbuf_append(buf, EAIL_TXT_SEPARATOR);
+
+      eina_strbuf_append(buf, text);
+      first_part = FALSE;
+    }
+
+   if (first_part)
+     {
+        eina_strbuf_free(buf);
+        eail_item_text_invalidate(item);
+        return NULL;
+     }
+
+   item->text = g_strdup(eina_strbuf_string_get(buf));
+   item->text_length = g_utf8_strlen(item->text, -1);
+   item->text_index = g_new(gint, item->text_length + 1);
+
+   for (i = 0, p = item->text; i < item->text_length;
+        ++i, p = g_utf8_next_char(p))
+     item->text_index[i] = p - item->text;
+   item->text_index[i] = p - item->text;
+
+   eina_strbuf_free(buf);
+
+   return item->text;
+}
+
 /**
  * @brief Gets text content from item
  *
@@ -1028,37 +1473,23 @@ eail_item_get_text(AtkText   *text,
                    gint       start_offset,
                    gint       end_offset)
 {
-   Eina_Strbuf *buf = NULL;
-   Elm_Object_Item *obj_item = NULL;
-   Eina_List *string_parts = NULL, *l = NULL;
-   gchar *string_part = NULL;
-   gchar *ret_str = NULL;
-   gboolean first_part = TRUE;
+   EailItem *item = EAIL_ITEM(text);
 
-   obj_item = eail_item_get_item(EAIL_ITEM(text));
-   g_return_val_if_fail(obj_item, NULL);
-
-   string_parts = eail_item_get_content_strings(obj_item);
-   if (!string_parts) return NULL;
+   g_return_val_if_fail(eail_item_get_item(item), NULL);
 
-   buf = eina_strbuf_new();
-   EINA_LIST_FOREACH(string_parts, l, string_part)
-    {
-      if (!first_part)
-        eina_strbuf_append(buf, EAIL_TXT_SEPARATOR);
-
-      eina_strbuf_append(buf, string_part);
-      first_part = FALSE;
-    }
+   if (!_eail_item_text_get(item)) return NULL;
 
-   /* ret_str is newly allocated */
-   ret_str = eail_get_substring
-                     (eina_strbuf_string_get(buf), start_offset, end_offset);
+   if (start_offset < 0 || start_offset >= item->text_length ||
+       end_offset < -1)
+     return NULL;
 
-   eina_list_free(string_parts);
-   eina_strbuf_free(buf);
+   if (end_offset == -1 || end_offset > item->text_length)
+     end_offset = item->text_length;
+   if (start_offset > end_offset) return NULL;
 
-   return ret_str;
+   return g_strndup(item->text + item->text_index[start_offset],
+                    item->text_index[end_offset] -
+                    item->text_index[start_offset]);
 }
 
 /**
@@ -1074,19 +1505,13 @@ eail_item_get_text(AtkText   *text,
 static gunichar
 eail_item_get_character_at_offset(AtkText *text, gint offset)
 {
-   gunichar character = '\0';
-   gchar* time_str = NULL;
+   EailItem *item = EAIL_ITEM(text);
 
-   time_str = eail_item_get_text(text, 0, -1);
+   if (!_eail_item_text_get(item) || offset < 0 ||
+       offset >= item->text_length)
+     return '\0';
 
-   if (time_str)
-     {
-         character = g_utf8_get_char
-                              (g_utf8_offset_to_pointer(time_str, offset));
-         g_free(time_str);
-     }
-
-   return character;
+   return g_utf8_get_char(item->text + item->text_index[offset]);
 }
 
 /**
@@ -1101,18 +1526,11 @@ eail_item_get_character_at_offset(AtkText *text, gint offset)
 static gint
 eail_item_get_character_count(AtkText *text)
 {
-   gint count = 0;
-   gchar* str = NULL;
-
-   str = eail_item_get_text(text, 0, -1);
+   EailItem *item = EAIL_ITEM(text);
 
-   if (str)
-      {
-         count = g_utf8_strlen(str, -1);
-         g_free(str);
-      }
+   if (!_eail_item_text_get(item)) return 0;
 
-   return count;
+   return item->text_length;
 }
 
 /*
@@ -28,6 +28,9 @@
 
 #include <atk/atk.h>
 #include <Elementary.h>
+
+#include "eail_attributes.h"
+
 /**
  * @brief Returns a value corresponding to the type of EailItem class
  */
@@ -102,6 +105,36 @@ struct _EailItem
 
    /** @brief "shrink" action description*/
    char *shrink_description;
+
+   /** @brief composed text content, NULL if not cached */
+   gchar *text;
+
+   /** @brief byte offsets of characters in text, text_length + 1 items */
+   gint *text_index;
+
+   /** @brief number of characters in text */
+   gint text_length;
+
+   /** @brief edje objects owning text_parts, watched for text changes */
+   Eina_List *text_edjes;
+
+   /** @brief text objects of item view the text was composed from */
+   Eina_List *text_parts;
+
+   /** @brief content widgets of item, checked against parts on use */
+   Eina_List *parts;
+
+   /** @brief item view the content was resolved from, NULL if not cached */
+   Evas_Object *parts_view;
+
+   /** @brief part map of item style the content was resolved with */
+   const void *parts_map;
+
+   /** @brief EailActionSupported mask asked from parent, -1 if not asked */
+   gint actions_supported;
+
+   /** @brief shared "parent-type" attribute set, NULL until requested */
+   EailAttributes *attributes;
 };
 
 /** @brief Definition of class structure for Atk EailItem*/
@@ -119,6 +152,18 @@ GType eail_item_get_type(void);
 /** @brief Gets nested Elm_Object_Item * object*/
 Elm_Object_Item *eail_item_get_item(EailItem *item);
 
+/** @brief Drops cached text content of item*/
+void eail_item_text_invalidate(EailItem *item);
+
+/** @brief Drops cached content widgets of item*/
+void eail_item_parts_invalidate(EailItem *item);
+
+/** @brief Gets shared attribute set of item*/
+EailAttributes *eail_item_ref_attributes(EailItem *item);
+
+/** @brief Gets index of item action with given name*/
+gint eail_item_action_index_get(EailItem *item, const gchar *action_name);
+
 #ifdef __cplusplus
 }
 #endif
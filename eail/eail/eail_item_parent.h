@@ -114,7 +114,7 @@ struct _EailItemParentIface
                                             EailItem         *item);
 
    /**@brief Callback definition for eail_item_parent_get_actions_supported
-    * function*/
+    * function, result is asked once per item and kept for its lifetime*/
    gboolean    (*get_actions_supported)       (EailItemParent   *parent,
                                                EailItem         *item);
 
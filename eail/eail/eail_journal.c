@@ -0,0 +1,444 @@
+/*
+ * Copyright (c) 2013 Samsung Electronics Co., Ltd.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/**
+ * @file eail_journal.c
+ * @brief Implementation of journal of accessible tree changes
+ *
+ * Changes are taken from emission hooks of "children-changed",
+ * "state-change", "property-change" and "bounds-changed" signals, so every
+ * place emitting them (eail_emit_children_changed_obj,
+ * atk_object_notify_state_change, bounds tracking of EailWidget...) feeds
+ * the journal without being changed.
+ *
+ * Deltas are kept in a fixed ring buffer. A consumer holding a snapshot
+ * taken at sequence N (see eail_tree_snapshot) reads deltas after N to stay
+ * in sync. If the journal has wrapped past N, the consumer has to take a
+ * new snapshot.
+ *
+ * Visibility states and extents are emitted by widgets only while
+ * somebody subscribes to them (see eail_subscription.h). The journal holds
+ * EAIL_SUBSCRIPTION_GEOMETRY while it has readers, so consumers register
+ * with eail_journal_reader_add before taking their snapshot.
+ */
+
+#include <string.h>
+
+#include <atk/atk.h>
+
+#include "eail_journal.h"
+#include "eail_subscription.h"
+#include "eail_priv.h"
+
+/** @brief Recorded deltas, delta with sequence s is at s % EAIL_JOURNAL_SIZE */
+static EailDelta eail_journal[EAIL_JOURNAL_SIZE];
+
+/** @brief Sequence number of the next recorded delta */
+static guint64 eail_journal_next = 1;
+
+/** @brief Number of registered readers */
+static gint eail_journal_readers = 0;
+
+/** @brief Callback notified about recorded deltas */
+typedef struct _EailJournalListener
+{
+   EailJournalFunc func;/**< @brief callback */
+   gpointer data;/**< @brief data passed to func */
+} EailJournalListener;
+
+/** @brief Registered listeners, array of EailJournalListener */
+static GArray *eail_journal_listeners = NULL;
+
+/** @brief Emission hook of a journaled signal */
+typedef struct _EailJournalHook
+{
+   const gchar *signal;/**< @brief signal name */
+   GType (*get_type)(void);/**< @brief getter of type defining signal */
+   GSignalEmissionHook func;/**< @brief hook recording deltas */
+   guint signal_id;/**< @brief signal id, 0 if hook is not installed */
+   gulong hook_id;/**< @brief emission hook id */
+} EailJournalHook;
+
+/**
+ * @brief Notifies listeners about recorded delta
+ *
+ * @param delta recorded delta
+ */
+static void
+_eail_journal_notify(const EailDelta *delta)
+{
+   guint i;
+
+   if (!eail_journal_listeners) return;
+
+   for (i = 0; i < eail_journal_listeners->len; ++i)
+     {
+        EailJournalListener *listener =
+           &g_array_index(eail_journal_listeners, EailJournalListener, i);
+
+        listener->func(delta, listener->data);
+     }
+}
+
+/**
+ * @brief Appends new delta to journal
+ *
+ * @param obj changed object
+ * @param type EailDeltaType
+ *
+ * @returns delta to fill, sequence, id and type are already set
+ */
+static EailDelta *
+_eail_journal_append(GObject *obj, EailDeltaType type)
+{
+   EailDelta *delta = &eail_journal[eail_journal_next % EAIL_JOURNAL_SIZE];
+
+   memset(delta, 0, sizeof(*delta));
+   delta->sequence = eail_journal_next++;
+   delta->id = (guint64)(gsize)obj;
+   delta->type = type;
+
+   return delta;
+}
+
+/**
+ * @brief Records "children-changed" emission
+ *
+ * @param ihint signal invocation hint, detail tells add or remove
+ * @param n_param_values number of parameters
+ * @param param_values emitting object, child index and child object
+ * @param data hook data
+ *
+ * @returns TRUE to keep the hook
+ */
+static gboolean
+_eail_journal_children_changed(GSignalInvocationHint *ihint,
+                               guint n_param_values,
+                               const GValue *param_values,
+                               gpointer data)
+{
+   EailDelta *delta;
+   const gchar *detail = g_quark_to_string(ihint->detail);
+   EailDeltaType type;
+
+   if (!g_strcmp0(detail, "add"))
+     type = EAIL_DELTA_CHILD_ADDED;
+   else if (!g_strcmp0(detail, "remove"))
+     type = EAIL_DELTA_CHILD_REMOVED;
+   else
+     return TRUE;
+
+   delta = _eail_journal_append(g_value_get_object(&param_values[0]), type);
+   delta->index = g_value_get_uint(&param_values[1]);
+   delta->child = (guint64)(gsize)g_value_get_pointer(&param_values[2]);
+   _eail_journal_notify(delta);
+
+   return TRUE;
+}
+
+/**
+ * @brief Records "state-change" emission
+ *
+ * @param ihint signal invocation hint
+ * @param n_param_values number of parameters
+ * @param param_values emitting object, state name and its new value
+ * @param data hook data
+ *
+ * @returns TRUE to keep the hook
+ */
+static gboolean
+_eail_journal_state_change(GSignalInvocationHint *ihint,
+                           guint n_param_values,
+                           const GValue *param_values,
+                           gpointer data)
+{
+   EailDelta *delta;
+
+   delta = _eail_journal_append(g_value_get_object(&param_values[0]),
+                                EAIL_DELTA_STATE);
+   delta->detail = atk_state_type_for_name
+                              (g_value_get_string(&param_values[1]));
+   delta->value = g_value_get_boolean(&param_values[2]);
+   _eail_journal_notify(delta);
+
+   return TRUE;
+}
+
+/**
+ * @brief Records "property-change" emission
+ *
+ * @param ihint signal invocation hint
+ * @param n_param_values number of parameters
+ * @param param_values emitting object and AtkPropertyValues
+ * @param data hook data
+ *
+ * @returns TRUE to keep the hook
+ */
+static gboolean
+_eail_journal_property_change(GSignalInvocationHint *ihint,
+                              guint n_param_values,
+                              const GValue *param_values,
+                              gpointer data)
+{
+   static const gchar * const names[] =
+   {
+      [EAIL_DELTA_PROPERTY_NAME] = "accessible-name",
+      [EAIL_DELTA_PROPERTY_DESCRIPTION] = "accessible-description",
+      [EAIL_DELTA_PROPERTY_PARENT] = "accessible-parent",
+      [EAIL_DELTA_PROPERTY_ROLE] = "accessible-role",
+      [EAIL_DELTA_PROPERTY_VALUE] = "accessible-value"
+   };
+   AtkPropertyValues *values = g_value_get_pointer(&param_values[1]);
+   EailDelta *delta;
+   guint i;
+
+   delta = _eail_journal_append(g_value_get_object(&param_values[0]),
+                                EAIL_DELTA_PROPERTY);
+
+   for (i = EAIL_DELTA_PROPERTY_NAME; values && i < G_N_ELEMENTS(names); ++i)
+     {
+        if (!g_strcmp0(values->property_name, names[i]))
+          {
+             delta->detail = i;
+             break;
+          }
+     }
+   _eail_journal_notify(delta);
+
+   return TRUE;
+}
+
+/**
+ * @brief Records "bounds-changed" emission
+ *
+ * @param ihint signal invocation hint
+ * @param n_param_values number of parameters
+ * @param param_values emitting object and new AtkRectangle
+ * @param data hook data
+ *
+ * @returns TRUE to keep the hook
+ */
+static gboolean
+_eail_journal_bounds_changed(GSignalInvocationHint *ihint,
+                             guint n_param_values,
+                             const GValue *param_values,
+                             gpointer data)
+{
+   AtkRectangle *rect = g_value_get_boxed(&param_values[1]);
+   EailDelta *delta;
+
+   delta = _eail_journal_append(g_value_get_object(&param_values[0]),
+                                EAIL_DELTA_BOUNDS);
+   if (rect)
+     {
+        delta->x = rect->x;
+        delta->y = rect->y;
+        delta->width = rect->width;
+        delta->height = rect->height;
+     }
+   _eail_journal_notify(delta);
+
+   return TRUE;
+}
+
+/** @brief Journaled signals */
+static EailJournalHook eail_journal_hooks[] =
+{
+   { "children-changed", atk_object_get_type,
+     _eail_journal_children_changed, 0, 0 },
+   { "state-change", atk_object_get_type, _eail_journal_state_change, 0, 0 },
+   { "property-change", atk_object_get_type,
+     _eail_journal_property_change, 0, 0 },
+   { "bounds-changed", atk_component_get_type,
+     _eail_journal_bounds_changed, 0, 0 }
+};
+
+/**
+ * Installs emission hooks on journaled signals. Does nothing if journal
+ * is already recording.
+ */
+void
+eail_journal_init(void)
+{
+   gpointer iface;
+   guint i;
+
+   iface = g_type_default_interface_ref(ATK_TYPE_COMPONENT);
+
+   for (i = 0; i < G_N_ELEMENTS(eail_journal_hooks); ++i)
+     {
+        EailJournalHook *hook = &eail_journal_hooks[i];
+
+        if (hook->signal_id) continue;
+
+        hook->signal_id = g_signal_lookup(hook->signal, hook->get_type());
+        if (!hook->signal_id)
+          {
+             ERR("Signal %s not found, not journaled", hook->signal);
+             continue;
+          }
+
+        hook->hook_id = g_signal_add_emission_hook(hook->signal_id, 0,
+                                                   hook->func, NULL, NULL);
+     }
+
+   g_type_default_interface_unref(iface);
+}
+
+/**
+ * Recorded deltas stay available for reading.
+ */
+void
+eail_journal_shutdown(void)
+{
+   guint i;
+
+   for (i = 0; i < G_N_ELEMENTS(eail_journal_hooks); ++i)
+     {
+        EailJournalHook *hook = &eail_journal_hooks[i];
+
+        if (!hook->signal_id) continue;
+
+        g_signal_remove_emission_hook(hook->signal_id, hook->hook_id);
+        hook->signal_id = 0;
+        hook->hook_id = 0;
+     }
+}
+
+/**
+ * Listeners are called from signal emission in order of registration, they
+ * should only update their own state or schedule their work.
+ *
+ * @param func callback
+ * @param data data passed to func
+ */
+void
+eail_journal_listener_add(EailJournalFunc func, gpointer data)
+{
+   EailJournalListener listener = { func, data };
+
+   g_return_if_fail(func);
+
+   /* deltas are recorded from the first consumer on */
+   eail_journal_init();
+
+   if (!eail_journal_listeners)
+     eail_journal_listeners = g_array_new(FALSE, FALSE,
+                                          sizeof(EailJournalListener));
+
+   g_array_append_val(eail_journal_listeners, listener);
+}
+
+/**
+ * @param func callback passed to eail_journal_listener_add
+ * @param data data passed to eail_journal_listener_add
+ */
+void
+eail_journal_listener_remove(EailJournalFunc func, gpointer data)
+{
+   guint i;
+
+   if (!eail_journal_listeners) return;
+
+   for (i = 0; i < eail_journal_listeners->len; ++i)
+     {
+        EailJournalListener *listener =
+           &g_array_index(eail_journal_listeners, EailJournalListener, i);
+
+        if (listener->func == func && listener->data == data)
+          {
+             g_array_remove_index(eail_journal_listeners, i);
+             break;
+          }
+     }
+
+   if (!eail_journal_listeners->len)
+     {
+        g_array_free(eail_journal_listeners, TRUE);
+        eail_journal_listeners = NULL;
+     }
+}
+
+/**
+ * Widgets emit visibility states and extents from now on, so deltas
+ * recorded after this call are complete.
+ */
+void
+eail_journal_reader_add(void)
+{
+   eail_journal_init();
+
+   if (eail_journal_readers++ == 0)
+     eail_subscription_add(EAIL_SUBSCRIPTION_GEOMETRY);
+}
+
+/**
+ * Has to be called once for every eail_journal_reader_add.
+ */
+void
+eail_journal_reader_remove(void)
+{
+   g_return_if_fail(eail_journal_readers > 0);
+
+   if (--eail_journal_readers == 0)
+     eail_subscription_remove(EAIL_SUBSCRIPTION_GEOMETRY);
+}
+
+/**
+ * @returns sequence number of the last recorded delta, 0 if none
+ */
+guint64
+eail_journal_sequence_get(void)
+{
+   return eail_journal_next - 1;
+}
+
+/**
+ * Deltas are copied in recording order. Pass sequence of the last delta
+ * already seen (or of the snapshot) as since, then repeat with sequence of
+ * the last returned delta until 0 is returned. Caller has to be registered
+ * with eail_journal_reader_add, otherwise deltas are not complete.
+ *
+ * @param since sequence number of the last delta known to the caller
+ * @param deltas array to fill
+ * @param max_deltas size of deltas array
+ *
+ * @returns number of copied deltas, or -1 if deltas following since are no
+ * longer kept and the caller has to take a new snapshot
+ */
+gint
+eail_journal_read(guint64 since, EailDelta *deltas, gint max_deltas)
+{
+   guint64 oldest, sequence;
+   gint n = 0;
+
+   g_return_val_if_fail(deltas || max_deltas <= 0, -1);
+   g_return_val_if_fail(eail_journal_readers > 0, -1);
+
+   oldest = eail_journal_next > EAIL_JOURNAL_SIZE ?
+      eail_journal_next - EAIL_JOURNAL_SIZE : 1;
+
+   if (since + 1 < oldest) return -1;
+
+   for (sequence = since + 1;
+        sequence < eail_journal_next && n < max_deltas; ++sequence)
+     deltas[n++] = eail_journal[sequence % EAIL_JOURNAL_SIZE];
+
+   return n;
+}
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2013 Samsung Electronics Co., Ltd.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/**
+ * @file eail_journal.h
+ *
+ * @brief Header for journal of accessible tree changes
+ */
+
+#ifndef EAIL_JOURNAL_H
+#define EAIL_JOURNAL_H
+
+#include <glib.h>
+
+#include "eail_tree_format.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief Number of deltas kept in journal */
+#define EAIL_JOURNAL_SIZE 4096
+
+/**
+ * @brief Callback notified after a delta is recorded
+ *
+ * @param delta recorded delta
+ * @param data data passed to eail_journal_listener_add
+ */
+typedef void (*EailJournalFunc)(const EailDelta *delta, gpointer data);
+
+/**
+ * @brief Starts recording changes of accessible tree
+ */
+void eail_journal_init(void);
+
+/**
+ * @brief Stops recording changes of accessible tree
+ */
+void eail_journal_shutdown(void);
+
+/**
+ * @brief Adds callback notified about recorded deltas
+ */
+void eail_journal_listener_add(EailJournalFunc func, gpointer data);
+
+/**
+ * @brief Removes callback added with eail_journal_listener_add
+ */
+void eail_journal_listener_remove(EailJournalFunc func, gpointer data);
+
+/**
+ * @brief Registers consumer of deltas, keeping state and bounds deltas
+ * recorded
+ */
+void eail_journal_reader_add(void);
+
+/**
+ * @brief Unregisters consumer registered with eail_journal_reader_add
+ */
+void eail_journal_reader_remove(void);
+
+/**
+ * @brief Gets sequence number of the last recorded delta
+ */
+guint64 eail_journal_sequence_get(void);
+
+/**
+ * @brief Copies deltas recorded after given sequence number
+ */
+gint eail_journal_read(guint64 since, EailDelta *deltas, gint max_deltas);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -78,7 +78,7 @@ G_DEFINE_TYPE_WITH_CODE(EailMap,
                         G_IMPLEMENT_INTERFACE(ATK_TYPE_IMAGE,
                                               akt_image_interface_init)) ;
 
-static void eail_map_set_actions(AtkObject *obj);
+static void eail_map_set_actions(EailActionWidgetClass *klass);
 
 /**
  * @brief EailMap initializer
@@ -91,8 +91,6 @@ eail_map_initialize(AtkObject *object, gpointer data)
 {
    ATK_OBJECT_CLASS(eail_map_parent_class)->initialize(object, data);
    object->role = ATK_ROLE_IMAGE_MAP;
-
-   eail_map_set_actions(object);
 }
 
 /**
@@ -168,6 +166,8 @@ eail_map_class_init(EailMapClass *klass)
    atk_class->get_name = eail_map_name_get;
 
    g_object_class->finalize = eail_map_finalize;
+
+   eail_map_set_actions(EAIL_ACTION_WIDGET_CLASS(klass));
 }
 
 /**
@@ -346,37 +346,22 @@ _eail_map_action_press(AtkAction *action, void *data)
 /**
  * @brief Sets EailMap actions
  *
- * @param obj AtkObject instance
+ * @param klass EailActionWidgetClass instance
  */
 static void
-eail_map_set_actions(AtkObject *obj)
+eail_map_set_actions(EailActionWidgetClass *klass)
 {
-   eail_action_widget_action_append(EAIL_ACTION_WIDGET(obj),
-                                    EAIL_MAP_ACTION_PRESS,
-                                    NULL,
-                                    _eail_map_action_press);
-   eail_action_widget_action_append(EAIL_ACTION_WIDGET(obj),
-                                    EAIL_MAP_ACTION_SCROLL_UP,
-                                    NULL,
-                                    _eail_map_action_scroll_up);
-   eail_action_widget_action_append(EAIL_ACTION_WIDGET(obj),
-                                    EAIL_MAP_ACTION_SCROLL_DOWN,
-                                    NULL,
-                                    _eail_map_action_scroll_down);
-   eail_action_widget_action_append(EAIL_ACTION_WIDGET(obj),
-                                    EAIL_MAP_ACTION_SCROLL_LEFT,
-                                    NULL,
-                                    _eail_map_action_scroll_left);
-   eail_action_widget_action_append(EAIL_ACTION_WIDGET(obj),
-                                    EAIL_MAP_ACTION_SCROLL_RIGHT,
-                                    NULL,
-                                    _eail_map_action_scroll_right);
-   eail_action_widget_action_append(EAIL_ACTION_WIDGET(obj),
-                                    EAIL_MAP_ACTION_ZOOM_IN,
-                                    NULL,
-                                    _eail_map_action_zoom_in);
-   eail_action_widget_action_append(EAIL_ACTION_WIDGET(obj),
-                                    EAIL_MAP_ACTION_ZOOM_OUT,
-                                    NULL,
-                                    _eail_map_action_zoom_out);
+   static const EailActionDesc eail_map_actions[] =
+     {
+        { EAIL_MAP_ACTION_PRESS, NULL, _eail_map_action_press },
+        { EAIL_MAP_ACTION_SCROLL_UP, NULL, _eail_map_action_scroll_up },
+        { EAIL_MAP_ACTION_SCROLL_DOWN, NULL, _eail_map_action_scroll_down },
+        { EAIL_MAP_ACTION_SCROLL_LEFT, NULL, _eail_map_action_scroll_left },
+        { EAIL_MAP_ACTION_SCROLL_RIGHT, NULL, _eail_map_action_scroll_right },
+        { EAIL_MAP_ACTION_ZOOM_IN, NULL, _eail_map_action_zoom_in },
+        { EAIL_MAP_ACTION_ZOOM_OUT, NULL, _eail_map_action_zoom_out },
+     };
+
+   eail_action_widget_class_add_actions(klass, eail_map_actions,
+                                        G_N_ELEMENTS(eail_map_actions));
 }
@@ -0,0 +1,287 @@
+/*
+ * Copyright (c) 2013 Samsung Electronics Co., Ltd.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/**
+ * @file eail_mirror.c
+ * @brief Implementation of shared-memory mirror of accessible tree
+ *
+ * Recorded journal deltas schedule a single idler, which copies new deltas
+ * to the ring in mirror file. A full snapshot is published at start, when
+ * the journal wraps before deltas are copied, and when half of the ring has
+ * been filled since the last snapshot, so readers can always catch up from
+ * the current snapshot.
+ */
+
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <Ecore.h>
+
+#include "eail_journal.h"
+#include "eail_mirror.h"
+#include "eail_priv.h"
+#include "eail_tree_snapshot.h"
+
+/** @brief Default size of each snapshot buffer */
+#define EAIL_MIRROR_DEFAULT_SIZE (4 * 1024 * 1024)
+
+/** @brief Number of deltas copied at once */
+#define EAIL_MIRROR_BATCH 64
+
+/** @brief Publishing state */
+typedef struct _EailMirror
+{
+   gchar *path;/**< @brief path of mirror file */
+   guint8 *map;/**< @brief mapped mirror file */
+   gsize size;/**< @brief size of mapped file */
+   EailMirrorHeader *header;/**< @brief header at the start of map */
+   EailDelta *ring;/**< @brief delta ring in map */
+   guint64 snapshot_sequence;/**< @brief journal sequence of last snapshot */
+   Ecore_Idler *idler;/**< @brief pending flush, NULL if none */
+} EailMirror;
+
+/** @brief Mirror being published, NULL if publishing is disabled */
+static EailMirror *eail_mirror = NULL;
+
+/**
+ * @brief Writes new tree snapshot to inactive buffer and activates it
+ *
+ * If the snapshot does not fit, an empty buffer is activated and
+ * EAIL_MIRROR_OVERFLOW is set until a later snapshot fits.
+ *
+ * @param mirror EailMirror instance
+ */
+static void
+_eail_mirror_publish_snapshot(EailMirror *mirror)
+{
+   EailMirrorHeader *header = mirror->header;
+   gint target = !header->active;
+   guint32 flags = 0;
+   gsize length;
+
+   g_atomic_int_inc(&header->generation[target]);
+   length = eail_tree_snapshot(EAIL_TREE_SNAPSHOT_BINARY, ATK_XY_SCREEN,
+                               mirror->map + header->snapshot_offset[target],
+                               header->snapshot_capacity);
+   g_atomic_int_inc(&header->generation[target]);
+
+   if (length > header->snapshot_capacity)
+     {
+        ERR("Tree snapshot of %" G_GSIZE_FORMAT " bytes does not fit in "
+            "mirror, raise %s", length, EAIL_MIRROR_SIZE_ENV);
+        flags |= EAIL_MIRROR_OVERFLOW;
+        length = 0;
+     }
+
+   mirror->snapshot_sequence = eail_journal_sequence_get();
+
+   g_atomic_int_inc(&header->lock);
+   header->snapshot_length[target] = length;
+   header->journal_head = mirror->snapshot_sequence;
+   header->active = target;
+   header->flags = flags;
+   g_atomic_int_inc(&header->lock);
+}
+
+/**
+ * @brief Copies deltas recorded since the last flush to the ring
+ *
+ * @param mirror EailMirror instance
+ *
+ * @returns FALSE if journal has wrapped and deltas are lost
+ */
+static gboolean
+_eail_mirror_copy_deltas(EailMirror *mirror)
+{
+   EailMirrorHeader *header = mirror->header;
+   EailDelta deltas[EAIL_MIRROR_BATCH];
+   guint64 head = header->journal_head;
+   gint i, n;
+
+   while ((n = eail_journal_read(head, deltas, EAIL_MIRROR_BATCH)) > 0)
+     {
+        head = deltas[n - 1].sequence;
+
+        /* slots being filled may still be copied by readers of the oldest
+         * deltas, who retry when lock has changed meanwhile */
+        g_atomic_int_inc(&header->lock);
+        for (i = 0; i < n; ++i)
+          mirror->ring[deltas[i].sequence % header->journal_capacity] =
+             deltas[i];
+        header->journal_head = head;
+        g_atomic_int_inc(&header->lock);
+     }
+
+   return n == 0;
+}
+
+/**
+ * @brief Publishes changes recorded in journal
+ *
+ * @param data EailMirror instance
+ *
+ * @returns ECORE_CALLBACK_CANCEL, idler is added again on next change
+ */
+static Eina_Bool
+_eail_mirror_flush(void *data)
+{
+   EailMirror *mirror = data;
+
+   mirror->idler = NULL;
+
+   if (!_eail_mirror_copy_deltas(mirror) ||
+       mirror->header->journal_head - mirror->snapshot_sequence >
+       mirror->header->journal_capacity / 2)
+     _eail_mirror_publish_snapshot(mirror);
+
+   return ECORE_CALLBACK_CANCEL;
+}
+
+/**
+ * @brief Schedules flush after delta is recorded
+ *
+ * @param delta recorded delta
+ * @param data EailMirror instance
+ */
+static void
+_eail_mirror_on_delta(const EailDelta *delta, gpointer data)
+{
+   EailMirror *mirror = data;
+
+   if (!mirror->idler)
+     mirror->idler = ecore_idler_add(_eail_mirror_flush, mirror);
+}
+
+/**
+ * @brief Publishes first snapshot once the main loop runs
+ *
+ * @param data EailMirror instance
+ *
+ * @returns ECORE_CALLBACK_CANCEL
+ */
+static Eina_Bool
+_eail_mirror_start(void *data)
+{
+   EailMirror *mirror = data;
+
+   mirror->idler = NULL;
+   _eail_mirror_publish_snapshot(mirror);
+   eail_journal_listener_add(_eail_mirror_on_delta, mirror);
+
+   return ECORE_CALLBACK_CANCEL;
+}
+
+/**
+ * Mirror file is created with owner-only permissions. Snapshot buffers
+ * have EAIL_MIRROR_SIZE bytes each, EAIL_MIRROR_DEFAULT_SIZE if unset.
+ */
+void
+eail_mirror_init(void)
+{
+   EailMirrorHeader *header;
+   const gchar *path, *size_str;
+   gsize capacity = EAIL_MIRROR_DEFAULT_SIZE, size;
+   guint8 *map;
+   int fd;
+
+   if (eail_mirror) return;
+
+   path = g_getenv(EAIL_MIRROR_ENV);
+   if (!path || !*path) return;
+
+   size_str = g_getenv(EAIL_MIRROR_SIZE_ENV);
+   if (size_str && g_ascii_strtoull(size_str, NULL, 10) > 0)
+     capacity = g_ascii_strtoull(size_str, NULL, 10);
+   capacity = (capacity + 7) & ~(gsize)7;
+
+   size = sizeof(EailMirrorHeader) + 2 * capacity +
+      EAIL_JOURNAL_SIZE * sizeof(EailDelta);
+
+   fd = open(path, O_RDWR | O_CREAT | O_TRUNC, S_IRUSR | S_IWUSR);
+   if (fd < 0)
+     {
+        ERR("Cannot create mirror file %s", path);
+        return;
+     }
+
+   if (ftruncate(fd, size) < 0)
+     {
+        ERR("Cannot resize mirror file %s", path);
+        close(fd);
+        unlink(path);
+        return;
+     }
+
+   map = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+   close(fd);
+   if (map == MAP_FAILED)
+     {
+        ERR("Cannot map mirror file %s", path);
+        unlink(path);
+        return;
+     }
+
+   eail_mirror = g_new0(EailMirror, 1);
+   eail_mirror->path = g_strdup(path);
+   eail_mirror->map = map;
+   eail_mirror->size = size;
+   eail_mirror->header = header = (EailMirrorHeader *)map;
+
+   header->size = size;
+   header->snapshot_offset[0] = sizeof(EailMirrorHeader);
+   header->snapshot_offset[1] = sizeof(EailMirrorHeader) + capacity;
+   header->snapshot_capacity = capacity;
+   header->journal_offset = sizeof(EailMirrorHeader) + 2 * capacity;
+   header->journal_capacity = EAIL_JOURNAL_SIZE;
+   header->pid = getpid();
+   header->version = EAIL_MIRROR_VERSION;
+   eail_mirror->ring = (EailDelta *)(map + header->journal_offset);
+
+   /* magic goes last, readers ignore the file until it is set */
+   g_atomic_int_set((gint *)&header->magic, EAIL_MIRROR_MAGIC);
+
+   eail_mirror->idler = ecore_idler_add(_eail_mirror_start, eail_mirror);
+
+   eail_journal_reader_add();
+}
+
+/**
+ * Readers still holding the file mapped keep the last published state.
+ */
+void
+eail_mirror_shutdown(void)
+{
+   if (!eail_mirror) return;
+
+   eail_journal_listener_remove(_eail_mirror_on_delta, eail_mirror);
+   eail_journal_reader_remove();
+   if (eail_mirror->idler)
+     ecore_idler_del(eail_mirror->idler);
+
+   munmap(eail_mirror->map, eail_mirror->size);
+   unlink(eail_mirror->path);
+
+   g_free(eail_mirror->path);
+   g_free(eail_mirror);
+   eail_mirror = NULL;
+}
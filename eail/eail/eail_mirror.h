@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2013 Samsung Electronics Co., Ltd.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/**
+ * @file eail_mirror.h
+ *
+ * @brief Header for shared-memory mirror of accessible tree
+ *
+ * When EAIL_MIRROR environment variable holds a file path (e.g.
+ * /dev/shm/eail-app), eail publishes binary tree snapshots and journal
+ * deltas into that file mapped in memory. Local readers map the same file
+ * and read the tree without any IPC, see eail_mirror_reader.h.
+ *
+ * File starts with EailMirrorHeader, followed by two snapshot buffers of
+ * snapshot_capacity bytes and by a ring of journal_capacity EailDelta
+ * records.
+ */
+
+#ifndef EAIL_MIRROR_H
+#define EAIL_MIRROR_H
+
+#include <glib.h>
+
+#include "eail_tree_format.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief Environment variable holding path of mirror file */
+#define EAIL_MIRROR_ENV "EAIL_MIRROR"
+
+/** @brief Environment variable holding size of snapshot buffer in bytes */
+#define EAIL_MIRROR_SIZE_ENV "EAIL_MIRROR_SIZE"
+
+/**
+ * @brief Starts publishing the tree if EAIL_MIRROR is set
+ */
+void eail_mirror_init(void);
+
+/**
+ * @brief Stops publishing the tree and removes mirror file
+ */
+void eail_mirror_shutdown(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
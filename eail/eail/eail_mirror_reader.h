@@ -0,0 +1,286 @@
+/*
+ * Copyright (c) 2013 Samsung Electronics Co., Ltd.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/**
+ * @file eail_mirror_reader.h
+ *
+ * @brief Header-only reader of shared-memory tree mirror
+ *
+ * Reader maps the file published by an application started with
+ * EAIL_MIRROR set and reads the tree without calling into the application.
+ * It needs only the C library and a compiler providing __atomic builtins
+ * (GCC 4.7, Clang 3.1):
+ * @code
+ * EailMirrorReader reader;
+ * size_t size = 4 * 1024 * 1024;
+ * uint8_t *buf = malloc(size);
+ * EailDelta deltas[64];
+ * uint64_t sequence;
+ * int n;
+ *
+ * eail_mirror_reader_open(&reader, "/dev/shm/eail-app");
+ * eail_mirror_reader_snapshot(&reader, buf, size);
+ * sequence = ((EailTreeSnapshotHeader *)buf)->sequence;
+ * n = eail_mirror_reader_deltas(&reader, sequence, deltas, 64);
+ * @endcode
+ * If reading deltas returns -1, the snapshot has to be read again.
+ */
+
+#ifndef EAIL_MIRROR_READER_H
+#define EAIL_MIRROR_READER_H
+
+#include <fcntl.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "eail_tree_format.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Returned by eail_mirror_reader_snapshot when the application could
+ * not fit its tree in the mirror, EAIL_MIRROR_SIZE has to be raised
+ */
+#define EAIL_MIRROR_READER_OVERFLOW ((size_t)-1)
+
+/** @brief Mapped mirror file */
+typedef struct _EailMirrorReader
+{
+   const uint8_t *map;/**< @brief mapped mirror file */
+   size_t size;/**< @brief size of mapping */
+} EailMirrorReader;
+
+/**
+ * @brief Loads value written by the publishing process
+ *
+ * @param value pointer to value in mapped file
+ *
+ * @returns loaded value
+ */
+static inline int32_t
+_eail_mirror_reader_load(const int32_t *value)
+{
+   return __atomic_load_n(value, __ATOMIC_ACQUIRE);
+}
+
+/**
+ * @brief Loads seqlock again after data protected by it has been copied
+ *
+ * @param value pointer to seqlock in mapped file
+ *
+ * @returns loaded value
+ */
+static inline int32_t
+_eail_mirror_reader_reload(const int32_t *value)
+{
+   /* copies made before must not be reordered after the load */
+   __atomic_thread_fence(__ATOMIC_ACQUIRE);
+
+   return __atomic_load_n(value, __ATOMIC_RELAXED);
+}
+
+/**
+ * @brief Maps mirror file
+ *
+ * @param reader EailMirrorReader to fill
+ * @param path path of mirror file
+ *
+ * @returns 0 on success, -1 if file is missing or not published yet
+ */
+static inline int
+eail_mirror_reader_open(EailMirrorReader *reader, const char *path)
+{
+   const EailMirrorHeader *header;
+   struct stat st;
+   void *map;
+   int fd;
+
+   reader->map = NULL;
+   reader->size = 0;
+
+   fd = open(path, O_RDONLY);
+   if (fd < 0) return -1;
+
+   if (fstat(fd, &st) < 0 || (size_t)st.st_size < sizeof(EailMirrorHeader))
+     {
+        close(fd);
+        return -1;
+     }
+
+   map = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+   close(fd);
+   if (map == MAP_FAILED) return -1;
+
+   header = (const EailMirrorHeader *)map;
+   if ((uint32_t)_eail_mirror_reader_load((const int32_t *)&header->magic) !=
+       EAIL_MIRROR_MAGIC || header->version != EAIL_MIRROR_VERSION ||
+       header->size > (uint64_t)st.st_size)
+     {
+        munmap(map, st.st_size);
+        return -1;
+     }
+
+   reader->map = (const uint8_t *)map;
+   reader->size = st.st_size;
+
+   return 0;
+}
+
+/**
+ * @brief Unmaps mirror file
+ *
+ * @param reader EailMirrorReader instance
+ */
+static inline void
+eail_mirror_reader_close(EailMirrorReader *reader)
+{
+   if (reader->map)
+     munmap((void *)reader->map, reader->size);
+
+   reader->map = NULL;
+   reader->size = 0;
+}
+
+/**
+ * @brief Copies consistent state of mirror header
+ *
+ * @param reader EailMirrorReader instance
+ * @param state EailMirrorHeader to fill
+ */
+static inline void
+_eail_mirror_reader_state(const EailMirrorReader *reader,
+                          EailMirrorHeader *state)
+{
+   const EailMirrorHeader *header = (const EailMirrorHeader *)reader->map;
+   int32_t lock;
+
+   do
+     {
+        lock = _eail_mirror_reader_load(&header->lock);
+        memcpy(state, header, sizeof(*state));
+     }
+   while ((lock & 1) || lock != _eail_mirror_reader_reload(&header->lock));
+}
+
+/**
+ * @brief Copies current binary tree snapshot
+ *
+ * Snapshot layout is described in eail_tree_format.h, its header holds
+ * the journal sequence the snapshot is taken at.
+ *
+ * @param reader EailMirrorReader instance
+ * @param buffer output buffer
+ * @param size size of output buffer
+ *
+ * @returns snapshot length, 0 if none is published yet; if it is bigger
+ * than size nothing is copied. EAIL_MIRROR_READER_OVERFLOW if the last
+ * snapshot did not fit in the mirror.
+ */
+static inline size_t
+eail_mirror_reader_snapshot(const EailMirrorReader *reader,
+                            uint8_t *buffer,
+                            size_t size)
+{
+   const EailMirrorHeader *header = (const EailMirrorHeader *)reader->map;
+   EailMirrorHeader state;
+   int32_t generation;
+   size_t length;
+   int i;
+
+   for (;;)
+     {
+        _eail_mirror_reader_state(reader, &state);
+        if (state.flags & EAIL_MIRROR_OVERFLOW)
+          return EAIL_MIRROR_READER_OVERFLOW;
+
+        i = state.active;
+
+        generation = _eail_mirror_reader_load(&header->generation[i]);
+        if (generation & 1) continue;
+
+        length = state.snapshot_length[i];
+        if (length > size) return length;
+
+        memcpy(buffer, reader->map + state.snapshot_offset[i], length);
+
+        if (generation == _eail_mirror_reader_reload(&header->generation[i]))
+          return length;
+     }
+}
+
+/**
+ * @brief Copies deltas published after given sequence number
+ *
+ * @param reader EailMirrorReader instance
+ * @param since sequence of snapshot or of the last delta already seen
+ * @param deltas array to fill
+ * @param max_deltas size of deltas array
+ *
+ * @returns number of copied deltas, or -1 if deltas following since are no
+ * longer kept and the snapshot has to be read again
+ */
+static inline int
+eail_mirror_reader_deltas(const EailMirrorReader *reader,
+                          uint64_t since,
+                          EailDelta *deltas,
+                          int max_deltas)
+{
+   const EailMirrorHeader *header = (const EailMirrorHeader *)reader->map;
+   const EailDelta *ring;
+   EailMirrorHeader state;
+   uint64_t sequence;
+   int32_t lock;
+   int n, lost;
+
+   for (;;)
+     {
+        lock = _eail_mirror_reader_load(&header->lock);
+        if (lock & 1) continue;
+
+        memcpy(&state, header, sizeof(state));
+        ring = (const EailDelta *)(reader->map + state.journal_offset);
+
+        lost = state.journal_head >= state.journal_capacity &&
+           since + state.journal_capacity < state.journal_head;
+
+        for (n = 0, sequence = since + 1; !lost &&
+             sequence <= state.journal_head && n < max_deltas;
+             ++sequence, ++n)
+          {
+             deltas[n] = ring[sequence % state.journal_capacity];
+             lost = deltas[n].sequence != sequence;
+          }
+
+        /* slots are rewritten only while lock is odd */
+        if (lock == _eail_mirror_reader_reload(&header->lock))
+          return lost ? -1 : n;
+     }
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
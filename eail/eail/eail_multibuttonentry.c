@@ -29,6 +29,7 @@
 #include "eail_item_parent.h"
 #include "eail_priv.h"
 #include "eail_utils.h"
+#include "eail_window.h"
 #include "eail_clipboard.h"
 
 static void eail_item_parent_interface_init(EailItemParentIface *iface);
@@ -296,9 +297,8 @@ eail_multibuttonentry_get_character_extents(AtkText *text,
    if (coords == ATK_XY_SCREEN)
    {
       int ee_x, ee_y;
-      Ecore_Evas *ee= ecore_evas_ecore_evas_get(evas_object_evas_get(widget));
 
-      ecore_evas_geometry_get(ee, &ee_x, &ee_y, NULL, NULL);
+      eail_window_screen_origin_get(widget, &ee_x, &ee_y);
       *x += ee_x;
       *y += ee_y;
     }
@@ -341,9 +341,8 @@ eail_multibuttonentry_get_offset_at_point(AtkText *text,
    if (coords == ATK_XY_SCREEN)
    {
       int ee_x, ee_y;
-      Ecore_Evas *ee= ecore_evas_ecore_evas_get(evas_object_evas_get(entry));
 
-      ecore_evas_geometry_get(ee, &ee_x, &ee_y, NULL, NULL);
+      eail_window_screen_origin_get(entry, &ee_x, &ee_y);
       x -= ee_x;
       y -= ee_y;
     }
@@ -1021,14 +1020,18 @@ eail_multibuttonentry_action_shrink_cb(AtkAction *action, void *data)
 /**
  * @brief Registers multibuttonentry's actions
  *
- * @param action_widget EailActionWidget instance
+ * @param klass EailActionWidgetClass instance
  */
-static void eail_multibuttonentry_actions_init(EailActionWidget *action_widget)
+static void eail_multibuttonentry_actions_init(EailActionWidgetClass *klass)
 {
-   eail_action_widget_action_append(action_widget, "expand", NULL,
-                                    eail_multibuttonentry_action_expand_cb);
-   eail_action_widget_action_append(action_widget, "shrink", NULL,
-                                    eail_multibuttonentry_action_shrink_cb);
+   static const EailActionDesc eail_multibuttonentry_actions[] =
+     {
+        { "expand", NULL, eail_multibuttonentry_action_expand_cb },
+        { "shrink", NULL, eail_multibuttonentry_action_shrink_cb },
+     };
+
+   eail_action_widget_class_add_actions(klass, eail_multibuttonentry_actions,
+                                        G_N_ELEMENTS(eail_multibuttonentry_actions));
 }
 
 /**
@@ -1117,8 +1120,6 @@ eail_multibuttonentry_initialize(AtkObject *obj, gpointer data)
    ATK_OBJECT_CLASS(eail_multibuttonentry_parent_class)->initialize(obj, data);
    obj->role = ATK_ROLE_ENTRY;
 
-   eail_multibuttonentry_actions_init(EAIL_ACTION_WIDGET(obj));
-
    nested_widget = eail_widget_get_widget(EAIL_WIDGET(obj));
    if (!nested_widget)
      {
@@ -1259,4 +1260,6 @@ eail_multibuttonentry_class_init(EailMultibuttonentryClass *klass)
    atk_class->get_n_children = eail_multibuttonentry_get_n_children;
    atk_class->ref_child = eail_multibuttonentry_ref_child;
    atk_class->ref_state_set = eail_multibuttonentry_ref_state_set;
+
+   eail_multibuttonentry_actions_init(EAIL_ACTION_WIDGET_CLASS(klass));
 }
@@ -100,13 +100,17 @@ eail_naviframe_action_click(AtkAction *action, void *data)
 /**
  * @brief Initializes Action interface for Naviframe
  *
- * @param action_widget EailActionWidget instance
+ * @param klass EailActionWidgetClass instance
  */
-static void eail_naviframe_actions_init(EailActionWidget *action_widget)
+static void eail_naviframe_actions_init(EailActionWidgetClass *klass)
 {
-   eail_action_widget_action_append(action_widget,
-                                    EAIL_NAVIFRAME_CLICK_ACTION, NULL,
-                                    eail_naviframe_action_click);
+   static const EailActionDesc eail_naviframe_actions[] =
+     {
+        { EAIL_NAVIFRAME_CLICK_ACTION, NULL, eail_naviframe_action_click },
+     };
+
+   eail_action_widget_class_add_actions(klass, eail_naviframe_actions,
+                                        G_N_ELEMENTS(eail_naviframe_actions));
 }
 
 /**
@@ -131,16 +135,14 @@ static AtkObject *
 _eail_naviframe_get_naviframe_page_for_item(AtkObject *naviframe,
                                             Elm_Object_Item *item)
 {
-   EailFactoryObj *factory_obj = NULL;
    AtkObject *naviframe_page = NULL;
 
-   factory_obj = eail_factory_find_obj_for_item(item);
-   if (factory_obj)
+   naviframe_page = eail_factory_ref_item_accessible(item);
+   if (naviframe_page)
      {
-        if (!factory_obj->atk_obj)
-          ERR("No atk obj created for factory item object");
-
-        return factory_obj->atk_obj;
+        /* cache keeps its own reference */
+        g_object_unref(naviframe_page);
+        return naviframe_page;
      }
 
    naviframe_page = eail_naviframe_page_new(naviframe, item);
@@ -321,7 +323,6 @@ eail_naviframe_initialize(AtkObject *obj, gpointer data)
    evas_object_smart_callback_add(nested_widget, "transition,finished",
                                 _eail_naviframe_handle_page_changed_event, obj);
 
-   eail_naviframe_actions_init(EAIL_ACTION_WIDGET(obj));
 
    naviframe_obj = EAIL_NAVIFRAME(obj);
    /* storing last numbers of children to be for checking if children-changed
@@ -347,5 +348,7 @@ eail_naviframe_class_init(EailNaviframeClass *klass)
    class->ref_child = eail_naviframe_ref_child;
 
    gobject_class->finalize = eail_naviframe_finalize;
+
+   eail_naviframe_actions_init(EAIL_ACTION_WIDGET_CLASS(klass));
 }
 
@@ -26,6 +26,7 @@
 #include "eail_naviframe.h"
 #include "eail_factory.h"
 #include "eail_widget.h"
+#include "eail_window.h"
 #include "eail_priv.h"
 
 static void atk_component_interface_init(AtkComponentIface *iface);
@@ -359,9 +360,7 @@ eail_naviframe_page_get_extents(AtkComponent *component,
      {
         int ee_x, ee_y;
 
-        Ecore_Evas *ee = ecore_evas_ecore_evas_get(
-           evas_object_evas_get(widget));
-        ecore_evas_geometry_get(ee, &ee_x, &ee_y, NULL, NULL);
+        eail_window_screen_origin_get(widget, &ee_x, &ee_y);
         *x += ee_x;
         *y += ee_y;
      }
@@ -71,7 +71,11 @@ eail_notify_init(EailNotify *button)
 static Evas_Object *
 _eail_get_nested_widget(AtkObject *obj)
 {
+   EailNotify *notify = EAIL_NOTIFY(obj);
    Evas_Object *notify_widget = NULL, *nested_widget = NULL;
+
+   if (notify->content.obj) return notify->content.obj;
+
    /* getting widget of notify class */
    notify_widget = eail_widget_get_widget(EAIL_WIDGET(obj));
    if (!notify_widget)
@@ -80,6 +84,7 @@ _eail_get_nested_widget(AtkObject *obj)
      }
 
    nested_widget = elm_object_part_content_get(notify_widget, "default");
+   eail_subobject_set(&notify->content, notify_widget, nested_widget);
 
    return nested_widget;
 }
@@ -143,6 +148,8 @@ eail_notify_ref_child(AtkObject *obj, gint i)
 static void
 eail_notify_finalize(GObject *object)
 {
+   eail_subobject_clear(&EAIL_NOTIFY(object)->content);
+
    G_OBJECT_CLASS(eail_notify_parent_class)->finalize(object);
 }
 
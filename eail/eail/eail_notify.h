@@ -37,14 +37,14 @@
  *
  * @param obj AtkObject instance
  */
-#define EAIL_NOTIFY(obj)             (G_TYPE_NOTIFY_INSTANCE_CAST((obj), \
+#define EAIL_NOTIFY(obj)             (G_TYPE_CHECK_INSTANCE_CAST((obj), \
                                             EAIL_TYPE_NOTIFY, EailNotify))
 /**
  * @brief Macro upcasts a subclass (klass) to the EailNotify class
  *
  * @param klass subclass object
  */
-#define EAIL_NOTIFY_CLASS(klass)     (G_TYPE_NOTIFY_CLASS_CAST((klass), \
+#define EAIL_NOTIFY_CLASS(klass)     (G_TYPE_CHECK_CLASS_CAST((klass), \
                                             EAIL_TYPE_NOTIFY, EailNotifyClass))
 /**
  * @brief Tests whether object (obj) is an instance of EailNotify class
@@ -58,7 +58,7 @@
  *
  * @param klass klass object
  */
-#define EAIL_IS_NOTIFY_CLASS(klass)  (G_TYPE_NOTIFY_CLASS_TYPE((klass), \
+#define EAIL_IS_NOTIFY_CLASS(klass)  (G_TYPE_CHECK_CLASS_TYPE((klass), \
                                             EAIL_TYPE_NOTIFY))
 /**
  * @brief Gets EailNotify class structure from an obj (class instance)
@@ -82,6 +82,8 @@ struct _EailNotify
 {
    /** @brief Parent widget whose functionality is being extended*/
    EailWidget parent;
+   /** @brief cached "default" content of notify widget */
+   EailSubobject content;
 };
 
 /** @brief Definition of object class for Atk EailNotify*/
@@ -123,14 +123,18 @@ eail_panel_action_toggle(AtkAction *action, void *data)
 /**
  * @brief Hooks EailPanel actions callbacks
  *
- * @param action_widget EailActionWidget instance
+ * @param klass EailActionWidgetClass instance
  */
 static void
-eail_panel_actions_init(EailActionWidget *action_widget)
+eail_panel_actions_init(EailActionWidgetClass *klass)
 {
-   eail_action_widget_action_append(action_widget,
-                                    EAIL_PANEL_TOGGLE_ACTION, NULL,
-                                    eail_panel_action_toggle);
+   static const EailActionDesc eail_panel_actions[] =
+     {
+        { EAIL_PANEL_TOGGLE_ACTION, NULL, eail_panel_action_toggle },
+     };
+
+   eail_action_widget_class_add_actions(klass, eail_panel_actions,
+                                        G_N_ELEMENTS(eail_panel_actions));
 }
 
 /**
@@ -144,8 +148,6 @@ eail_panel_initialize(AtkObject *obj, gpointer data)
 {
    ATK_OBJECT_CLASS(eail_panel_parent_class)->initialize(obj, data);
    obj->role = ATK_ROLE_PANEL;
-
-   eail_panel_actions_init(EAIL_ACTION_WIDGET(obj));
 }
 
 /**
@@ -195,4 +197,6 @@ eail_panel_class_init(EailPanelClass *klass)
 
    class->initialize = eail_panel_initialize;
    class->ref_state_set = eail_panel_ref_state_set;
+
+   eail_panel_actions_init(EAIL_ACTION_WIDGET_CLASS(klass));
 }
@@ -126,6 +126,14 @@ _eail_photocam_action_click(AtkAction *action, void *data)
    return TRUE;
 }
 
+/** @brief Actions of EailPhotocam, added after scrolling actions */
+static const EailActionDesc eail_photocam_actions[] =
+  {
+     { EAIL_PHOTOCAM_ACTION_ZOOM_IN, NULL, _eail_photocam_action_zoom_in },
+     { EAIL_PHOTOCAM_ACTION_ZOOM_OUT, NULL, _eail_photocam_action_zoom_out },
+     { EAIL_PHOTOCAM_ACTION_CLICK, NULL, _eail_photocam_action_click },
+  };
+
 /**
  * @brief EailPhotocam initializer
  *
@@ -138,19 +146,6 @@ eail_photocam_initialize(AtkObject *obj, gpointer data)
    ATK_OBJECT_CLASS(eail_photocam_parent_class)->initialize(obj, data);
 
    obj->role = ATK_ROLE_IMAGE;
-
-   eail_action_widget_action_append(EAIL_ACTION_WIDGET(obj),
-                                    EAIL_PHOTOCAM_ACTION_ZOOM_IN,
-                                    NULL,
-                                    _eail_photocam_action_zoom_in);
-   eail_action_widget_action_append(EAIL_ACTION_WIDGET(obj),
-                                    EAIL_PHOTOCAM_ACTION_ZOOM_OUT,
-                                    NULL,
-                                    _eail_photocam_action_zoom_out);
-   eail_action_widget_action_append(EAIL_ACTION_WIDGET(obj),
-                                    EAIL_PHOTOCAM_ACTION_CLICK,
-                                    NULL,
-                                    _eail_photocam_action_click);
 }
 
 /**
@@ -202,6 +197,10 @@ eail_photocam_class_init(EailPhotocamClass *klass)
    atk_class->ref_state_set = eail_photocam_ref_state_set;
 
    g_object_class->finalize = eail_photocam_finalize;
+
+   eail_action_widget_class_add_actions(EAIL_ACTION_WIDGET_CLASS(klass),
+                                        eail_photocam_actions,
+                                        G_N_ELEMENTS(eail_photocam_actions));
 }
 
 /**
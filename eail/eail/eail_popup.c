@@ -29,6 +29,7 @@
 #include "eail_notify.h"
 #include "eail_factory.h"
 #include "eail_utils.h"
+#include "eail_window.h"
 #include "eail_priv.h"
 #include "eail_text.h"
 
@@ -110,14 +111,18 @@ _eail_get_popup_widget_from_atkobj(AtkObject *obj)
 static const Evas_Object *
 _eail_get_textblock(AtkText *text)
 {
+   EailPopup *popup = EAIL_POPUP(text);
    Evas_Object *widget;
-   const Evas_Object *textblock;
+   Evas_Object *textblock;
    Evas_Object *label = NULL;
    Evas_Object *layout = NULL;
    Evas_Object *layout_edje_layer = NULL;
    Evas_Object *label_edje_layer = NULL;
    Evas_Object *popup_edje_layer = NULL;
 
+   /* resolved once, edje lookups are not repeated for every character */
+   if (popup->textblock.obj) return popup->textblock.obj;
+
    widget = eail_widget_get_widget(EAIL_WIDGET(text));
    if (!widget) return NULL;
 
@@ -136,11 +141,13 @@ _eail_get_textblock(AtkText *text)
    label_edje_layer = elm_layout_edje_get(label);
    if (!label_edje_layer) return NULL;
 
-   textblock = edje_object_part_object_get(label_edje_layer, "elm.text");
+   textblock = (Evas_Object *)edje_object_part_object_get(label_edje_layer,
+                                                          "elm.text");
    if (!textblock) return NULL;
 
-   return textblock;
+   eail_subobject_set(&popup->textblock, widget, textblock);
 
+   return textblock;
 }
 
 /**
@@ -153,13 +160,17 @@ _eail_get_textblock(AtkText *text)
 static Evas_Object *
 _eail_get_nested_widget(AtkObject *obj)
 {
+   EailNotify *notify = EAIL_NOTIFY(obj);
    Evas_Object *popup_widget = NULL, *nested_widget = NULL;
 
+   if (notify->content.obj) return notify->content.obj;
+
    /* getting widget of popup class */
    popup_widget = _eail_get_popup_widget_from_atkobj(obj);
    if (!popup_widget) return NULL;
 
    nested_widget = elm_object_part_content_get(popup_widget, "default");
+   eail_subobject_set(&notify->content, popup_widget, nested_widget);
 
    return nested_widget;
 }
@@ -315,6 +326,8 @@ eail_popup_get_name(AtkObject *obj)
 static void
 eail_popup_finalize(GObject *object)
 {
+   eail_subobject_clear(&EAIL_POPUP(object)->textblock);
+
    G_OBJECT_CLASS(eail_popup_parent_class)->finalize(object);
 }
 
@@ -512,9 +525,8 @@ eail_popup_get_character_extents(AtkText *text,
    if (coords == ATK_XY_SCREEN)
    {
       int ee_x, ee_y;
-      Ecore_Evas *ee= ecore_evas_ecore_evas_get(evas_object_evas_get(widget));
 
-      ecore_evas_geometry_get(ee, &ee_x, &ee_y, NULL, NULL);
+      eail_window_screen_origin_get(widget, &ee_x, &ee_y);
       *x += ee_x;
       *y += ee_y;
     }
@@ -735,9 +747,8 @@ eail_popup_get_offset_at_point(AtkText *text,
    if (coords == ATK_XY_SCREEN)
    {
       int ee_x, ee_y;
-      Ecore_Evas *ee= ecore_evas_ecore_evas_get(evas_object_evas_get(widget));
 
-      ecore_evas_geometry_get(ee, &ee_x, &ee_y, NULL, NULL);
+      eail_window_screen_origin_get(widget, &ee_x, &ee_y);
       x -= ee_x;
       y -= ee_y;
     }
@@ -37,7 +37,7 @@
  *
  * @param obj AtkObject instance
  */
-#define EAIL_POPUP(obj)             (G_TYPE_POPUP_INSTANCE_CAST((obj), \
+#define EAIL_POPUP(obj)             (G_TYPE_CHECK_INSTANCE_CAST((obj), \
                                             EAIL_TYPE_POPUP, \
                                             EailPopup))
 /**
@@ -45,7 +45,7 @@
  *
  * @param klass subclass object
  */
-#define EAIL_POPUP_CLASS(klass)     (G_TYPE_POPUP_CLASS_CAST((klass), \
+#define EAIL_POPUP_CLASS(klass)     (G_TYPE_CHECK_CLASS_CAST((klass), \
                                             EAIL_TYPE_POPUP, \
                                             EailPopupClass))
 /**
@@ -85,6 +85,8 @@ struct _EailPopup
 {
    /** @brief Parent widget whose functionality is being extended*/
    EailNotify parent;
+   /** @brief cached textblock of popup text */
+   EailSubobject textblock;
 };
 
 /** @brief Definition of object class for Atk EailPopup*/
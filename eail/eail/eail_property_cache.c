@@ -0,0 +1,454 @@
+/*
+ * Copyright (c) 2013 Samsung Electronics Co., Ltd.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/**
+ * @file eail_property_cache.c
+ * @brief Implementation of cache of basic accessible properties
+ *
+ * Role, name, states, child count and index in parent are kept for every
+ * accessible that has been asked for once. Entries are updated from journal
+ * deltas: state changes are applied to the cached mask, name and role
+ * changes drop the cached value and child changes drop child count of the
+ * parent and indexes of all entries, which are then filled again on the
+ * next request. State deltas are emitted only for journal readers, so
+ * the cache registers as one once it holds its first entry.
+ *
+ * Cached values are not compared with the accessible again. Widgets
+ * notify names computed from their text and the disabled flag through
+ * signals of their theme (see eail_widget.c), which end up in the journal
+ * like any other change.
+ *
+ * eail_property_cache_fetch returns records of a whole subtree at once, so
+ * a consumer walking the tree makes one call per subtree instead of one per
+ * property of every accessible. Children themselves are still walked on
+ * every fetch: several containers (table, grid...) do not report child
+ * changes, so child counts of eail_property_cache_get are refreshed by
+ * fetches and child deltas only.
+ */
+
+#include <string.h>
+
+#include <Eina.h>
+
+#include "eail_property_cache.h"
+#include "eail_journal.h"
+#include "eail_utils.h"
+#include "eail_priv.h"
+
+/** @brief Properties of EailPropertyEntry */
+typedef enum
+{
+   EAIL_PROPERTY_ROLE = 1 << 0,/**< @brief role */
+   EAIL_PROPERTY_NAME = 1 << 1,/**< @brief name */
+   EAIL_PROPERTY_STATES = 1 << 2,/**< @brief states */
+   EAIL_PROPERTY_N_CHILDREN = 1 << 3,/**< @brief child count */
+   EAIL_PROPERTY_INDEX = 1 << 4/**< @brief index in parent */
+} EailPropertyFlags;
+
+/** @brief Cached properties of single accessible */
+typedef struct _EailPropertyEntry
+{
+   EailPropertyRecord record;/**< @brief cached values, parent is unused */
+   guint valid;/**< @brief mask of EailPropertyFlags holding current values */
+   guint index_generation;/**< @brief eail_property_index_generation of index */
+} EailPropertyEntry;
+
+/** @brief Entries keyed by AtkObject, NULL if cache is not running */
+static GHashTable *eail_property_cache = NULL;
+
+/** @brief Whether cache is registered as journal reader */
+static gboolean eail_property_cache_subscribed = FALSE;
+
+/** @brief Bumped on every child change, invalidates all cached indexes */
+static guint eail_property_index_generation = 0;
+
+/** @brief State of single subtree fetch */
+typedef struct _EailPropertyFetch
+{
+   EailTreeWalk walk;/**< @brief shared walk state */
+   EailPropertyRecord *records;/**< @brief output array given by caller */
+   gint max_records;/**< @brief size of output array */
+   gint count;/**< @brief records visited so far, including not fitting */
+   gint32 parent;/**< @brief index of record of currently walked parent */
+} EailPropertyFetch;
+
+/**
+ * @brief Frees cache entry
+ *
+ * @param data EailPropertyEntry instance
+ */
+static void
+_eail_property_entry_free(gpointer data)
+{
+   EailPropertyEntry *entry = data;
+
+   eina_stringshare_del(entry->record.name);
+   g_free(entry);
+}
+
+/**
+ * @brief Removes entry of destroyed accessible
+ *
+ * @param data unused
+ * @param obj destroyed AtkObject
+ */
+static void
+_eail_property_cache_weak_notify(gpointer data, GObject *obj)
+{
+   if (eail_property_cache)
+     g_hash_table_remove(eail_property_cache, obj);
+}
+
+/**
+ * @brief Updates cached entries after journal delta
+ *
+ * @param delta recorded delta
+ * @param data unused
+ */
+static void
+_eail_property_cache_on_delta(const EailDelta *delta, gpointer data)
+{
+   EailPropertyEntry *entry;
+
+   if (delta->type == EAIL_DELTA_CHILD_ADDED ||
+       delta->type == EAIL_DELTA_CHILD_REMOVED)
+     ++eail_property_index_generation;
+
+   entry = g_hash_table_lookup(eail_property_cache,
+                               (gpointer)(gsize)delta->id);
+   if (!entry) return;
+
+   switch (delta->type)
+     {
+      case EAIL_DELTA_CHILD_ADDED:
+      case EAIL_DELTA_CHILD_REMOVED:
+         entry->valid &= ~EAIL_PROPERTY_N_CHILDREN;
+         break;
+      case EAIL_DELTA_PROPERTY:
+         if (delta->detail == EAIL_DELTA_PROPERTY_NAME)
+           entry->valid &= ~EAIL_PROPERTY_NAME;
+         else if (delta->detail == EAIL_DELTA_PROPERTY_ROLE)
+           entry->valid &= ~EAIL_PROPERTY_ROLE;
+         else if (delta->detail == EAIL_DELTA_PROPERTY_PARENT)
+           entry->valid &= ~EAIL_PROPERTY_INDEX;
+         break;
+      case EAIL_DELTA_STATE:
+         if (delta->detail >= 64)
+           entry->valid &= ~EAIL_PROPERTY_STATES;
+         else if (delta->value)
+           entry->record.states |= EAIL_STATE_BIT(delta->detail);
+         else
+           entry->record.states &= ~EAIL_STATE_BIT(delta->detail);
+         break;
+      default:
+         break;
+     }
+}
+
+/**
+ * @brief Gets entry of accessible, filling role, name and states if they
+ * are not cached
+ *
+ * @param obj AtkObject instance
+ *
+ * @returns EailPropertyEntry owned by cache
+ */
+static EailPropertyEntry *
+_eail_property_cache_lookup(AtkObject *obj)
+{
+   EailPropertyEntry *entry;
+
+   entry = g_hash_table_lookup(eail_property_cache, obj);
+   if (!entry)
+     {
+        if (!eail_property_cache_subscribed)
+          {
+             eail_property_cache_subscribed = TRUE;
+             eail_journal_reader_add();
+          }
+
+        entry = g_new0(EailPropertyEntry, 1);
+        entry->record.id = (guint64)(gsize)obj;
+        g_hash_table_insert(eail_property_cache, obj, entry);
+        g_object_weak_ref(G_OBJECT(obj), _eail_property_cache_weak_notify,
+                          NULL);
+     }
+
+   if (!(entry->valid & EAIL_PROPERTY_ROLE))
+     {
+        entry->record.role = atk_object_get_role(obj);
+        entry->valid |= EAIL_PROPERTY_ROLE;
+     }
+
+   if (!(entry->valid & EAIL_PROPERTY_NAME))
+     {
+        eina_stringshare_replace(&entry->record.name,
+                                 atk_object_get_name(obj));
+        entry->valid |= EAIL_PROPERTY_NAME;
+     }
+
+   if (!(entry->valid & EAIL_PROPERTY_STATES))
+     {
+        AtkStateSet *state_set = atk_object_ref_state_set(obj);
+
+        entry->record.states = eail_state_set_get_states(state_set);
+        if (state_set) g_object_unref(state_set);
+        entry->valid |= EAIL_PROPERTY_STATES;
+     }
+
+   if (entry->index_generation != eail_property_index_generation)
+     entry->valid &= ~EAIL_PROPERTY_INDEX;
+
+   return entry;
+}
+
+/**
+ * @brief Stores index of accessible found by walking its parent
+ *
+ * @param entry EailPropertyEntry instance
+ * @param index index of accessible in parent
+ */
+static void
+_eail_property_entry_set_index(EailPropertyEntry *entry, gint32 index)
+{
+   entry->record.index = index;
+   entry->index_generation = eail_property_index_generation;
+   entry->valid |= EAIL_PROPERTY_INDEX;
+}
+
+static gint _eail_property_cache_fetch_node(EailPropertyFetch *fetch,
+                                            AtkObject *obj,
+                                            gint32 parent,
+                                            gint32 index);
+
+/**
+ * @brief Emits record of child accessible and walks its subtree
+ *
+ * @param child AtkObject instance
+ * @param index index of child among children of its parent
+ * @param user_data EailPropertyFetch instance
+ */
+static void
+_eail_property_cache_fetch_child(AtkObject *child,
+                                 gint index,
+                                 gpointer user_data)
+{
+   EailPropertyFetch *fetch = user_data;
+
+   _eail_property_cache_fetch_node(fetch, child, fetch->parent, index);
+}
+
+/**
+ * @brief Walks children of accessible
+ *
+ * @param fetch EailPropertyFetch instance
+ * @param obj AtkObject instance
+ * @param parent index of obj record
+ *
+ * @returns number of walked children
+ */
+static guint32
+_eail_property_cache_fetch_children(EailPropertyFetch *fetch,
+                                    AtkObject *obj,
+                                    gint32 parent)
+{
+   gint32 saved_parent = fetch->parent;
+   guint32 n_children;
+
+   fetch->parent = parent;
+   n_children = eail_tree_walk_children(&fetch->walk, obj,
+                                        _eail_property_cache_fetch_child,
+                                        fetch);
+   fetch->parent = saved_parent;
+
+   return n_children;
+}
+
+/**
+ * @brief Emits record of accessible and walks its subtree
+ *
+ * Child count and indexes of children are taken from the walk itself and
+ * stored in the cache.
+ *
+ * @param fetch EailPropertyFetch instance
+ * @param obj AtkObject instance
+ * @param parent index of parent record, -1 for subtree root
+ * @param index index of obj among children of its parent
+ *
+ * @returns index of obj record
+ */
+static gint
+_eail_property_cache_fetch_node(EailPropertyFetch *fetch,
+                                AtkObject *obj,
+                                gint32 parent,
+                                gint32 index)
+{
+   EailPropertyEntry *entry = _eail_property_cache_lookup(obj);
+   gint node_index = fetch->count++;
+   guint32 n_children;
+
+   _eail_property_entry_set_index(entry, index);
+
+   n_children = _eail_property_cache_fetch_children(fetch, obj, node_index);
+
+   /* entry may be gone if the walk made the accessible go away */
+   entry = g_hash_table_lookup(eail_property_cache, obj);
+   if (entry)
+     {
+        entry->record.n_children = n_children;
+        entry->valid |= EAIL_PROPERTY_N_CHILDREN;
+     }
+
+   if (node_index < fetch->max_records)
+     {
+        EailPropertyRecord *record = &fetch->records[node_index];
+
+        if (entry)
+          *record = entry->record;
+        else
+          memset(record, 0, sizeof(*record));
+
+        record->id = (guint64)(gsize)obj;
+        record->parent = parent;
+        record->index = index;
+        record->n_children = n_children;
+     }
+
+   return node_index;
+}
+
+/**
+ * Registers journal listener keeping entries up to date. Does nothing if
+ * cache is already running.
+ */
+void
+eail_property_cache_init(void)
+{
+   if (eail_property_cache) return;
+
+   eail_property_cache = g_hash_table_new_full(g_direct_hash, g_direct_equal,
+                                               NULL,
+                                               _eail_property_entry_free);
+   eail_journal_listener_add(_eail_property_cache_on_delta, NULL);
+}
+
+/**
+ * Names returned in records become invalid.
+ */
+void
+eail_property_cache_shutdown(void)
+{
+   GHashTableIter iter;
+   gpointer obj;
+
+   if (!eail_property_cache) return;
+
+   eail_journal_listener_remove(_eail_property_cache_on_delta, NULL);
+   if (eail_property_cache_subscribed)
+     {
+        eail_property_cache_subscribed = FALSE;
+        eail_journal_reader_remove();
+     }
+
+   g_hash_table_iter_init(&iter, eail_property_cache);
+   while (g_hash_table_iter_next(&iter, &obj, NULL))
+     g_object_weak_unref(obj, _eail_property_cache_weak_notify, NULL);
+
+   g_hash_table_destroy(eail_property_cache);
+   eail_property_cache = NULL;
+}
+
+/**
+ * Values not cached yet are taken from the accessible and kept for the
+ * following calls.
+ *
+ * @param obj AtkObject instance
+ * @param record record to fill, parent is set to -1
+ *
+ * @returns TRUE on success, FALSE otherwise
+ */
+gboolean
+eail_property_cache_get(AtkObject *obj, EailPropertyRecord *record)
+{
+   EailPropertyEntry *entry;
+
+   g_return_val_if_fail(ATK_IS_OBJECT(obj), FALSE);
+   g_return_val_if_fail(record, FALSE);
+
+   if (!eail_property_cache) eail_property_cache_init();
+
+   entry = _eail_property_cache_lookup(obj);
+
+   if (!(entry->valid & EAIL_PROPERTY_N_CHILDREN))
+     {
+        entry->record.n_children = atk_object_get_n_accessible_children(obj);
+        entry->valid |= EAIL_PROPERTY_N_CHILDREN;
+     }
+
+   if (!(entry->valid & EAIL_PROPERTY_INDEX))
+     _eail_property_entry_set_index(entry,
+                                    atk_object_get_index_in_parent(obj));
+
+   *record = entry->record;
+   record->parent = -1;
+
+   return TRUE;
+}
+
+/**
+ * Records are stored in document order (parent before its children), root
+ * first, each with index of its parent record. Only roles, names and
+ * states not cached yet are asked from the accessibles; child counts and
+ * indexes come from the walk.
+ *
+ * Returned count covers the whole subtree even if it does not fit in
+ * records; in that case the call has to be repeated with an array of at
+ * least returned size. Passing NULL records with zero max_records only
+ * counts the accessibles.
+ *
+ * @param root AtkObject instance the subtree starts at
+ * @param records array to fill
+ * @param max_records size of records array
+ *
+ * @returns number of accessibles in subtree
+ */
+gint
+eail_property_cache_fetch(AtkObject *root,
+                          EailPropertyRecord *records,
+                          gint max_records)
+{
+   EailPropertyFetch fetch;
+
+   g_return_val_if_fail(ATK_IS_OBJECT(root), 0);
+   g_return_val_if_fail(records || max_records <= 0, 0);
+
+   if (!eail_property_cache) eail_property_cache_init();
+
+   memset(&fetch, 0, sizeof(fetch));
+   eail_tree_walk_init(&fetch.walk, ATK_XY_SCREEN);
+   fetch.records = records;
+   fetch.max_records = max_records;
+
+   g_object_ref(root);
+   _eail_property_cache_fetch_node(&fetch, root, -1,
+                                   atk_object_get_index_in_parent(root));
+   g_object_unref(root);
+
+   return fetch.count;
+}
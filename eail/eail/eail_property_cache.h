@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2013 Samsung Electronics Co., Ltd.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/**
+ * @file eail_property_cache.h
+ *
+ * @brief Header for cache of basic accessible properties
+ */
+
+#ifndef EAIL_PROPERTY_CACHE_H
+#define EAIL_PROPERTY_CACHE_H
+
+#include <atk/atk.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Packed properties of single accessible
+ *
+ * Name is owned by the cache and stays valid until the name changes or the
+ * accessible is destroyed, callers keeping it across main loop iterations
+ * have to copy it.
+ */
+typedef struct _EailPropertyRecord
+{
+   guint64 id;/**< @brief address of AtkObject, unique while object is alive */
+   guint64 states;/**< @brief mask of EAIL_STATE_BIT values */
+   const gchar *name;/**< @brief name of accessible, NULL if none */
+   gint32 parent;/**< @brief index of parent record, -1 for subtree root */
+   gint32 index;/**< @brief index of accessible among children of parent */
+   guint32 role;/**< @brief AtkRole of accessible */
+   guint32 n_children;/**< @brief number of children of accessible */
+} EailPropertyRecord;
+
+/**
+ * @brief Starts keeping cached properties up to date
+ */
+void eail_property_cache_init(void);
+
+/**
+ * @brief Drops all cached properties
+ */
+void eail_property_cache_shutdown(void);
+
+/**
+ * @brief Gets cached properties of single accessible
+ */
+gboolean eail_property_cache_get(AtkObject *obj, EailPropertyRecord *record);
+
+/**
+ * @brief Gets cached properties of accessible and its whole subtree in a
+ * single walk
+ */
+gint eail_property_cache_fetch(AtkObject *root,
+                               EailPropertyRecord *records,
+                               gint max_records);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
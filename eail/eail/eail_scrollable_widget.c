@@ -41,8 +41,8 @@
  * all needed functions for ATK_ACTION interface so additional implementing of
  * ATK_ACTION interface here is not needed.
  * Only thing that is really needed is to call:
- * eail_action_widget_action_append(...) to register all needed additional
- * actions
+ * eail_action_widget_class_add_actions(...) from class_init to register all
+ * needed additional actions
  */
 G_DEFINE_TYPE(EailScrollableWidget, eail_scrollable_widget,
               EAIL_TYPE_ACTION_WIDGET);
@@ -168,23 +168,21 @@ _action_scroll_right(AtkAction *action,
 
 /**
  * @brief Adds actions for scrolling to actions table
- * @param widget widget that implements EailScrollable interface
+ * @param klass EailActionWidgetClass instance
  */
 static void
-eail_scrollable_widget_actions_table_init(EailScrollableWidget *widget)
+eail_scrollable_widget_actions_table_init(EailActionWidgetClass *klass)
 {
-   eail_action_widget_action_append(EAIL_ACTION_WIDGET(widget),
-                                    EAIL_STR_SCROLL_UP, NULL,
-                                    _action_scroll_up);
-   eail_action_widget_action_append(EAIL_ACTION_WIDGET(widget),
-                                    EAIL_STR_SCROLL_DOWN, NULL,
-                                    _action_scroll_down);
-   eail_action_widget_action_append(EAIL_ACTION_WIDGET(widget),
-                                    EAIL_STR_SCROLL_LEFT, NULL,
-                                    _action_scroll_left);
-   eail_action_widget_action_append(EAIL_ACTION_WIDGET(widget),
-                                    EAIL_STR_SCROLL_RIGHT, NULL,
-                                    _action_scroll_right);
+   static const EailActionDesc scroll_actions[] =
+     {
+        { EAIL_STR_SCROLL_UP, NULL, _action_scroll_up },
+        { EAIL_STR_SCROLL_DOWN, NULL, _action_scroll_down },
+        { EAIL_STR_SCROLL_LEFT, NULL, _action_scroll_left },
+        { EAIL_STR_SCROLL_RIGHT, NULL, _action_scroll_right },
+     };
+
+   eail_action_widget_class_add_actions(klass, scroll_actions,
+                                        G_N_ELEMENTS(scroll_actions));
 }
 
 /**
@@ -200,9 +198,6 @@ eail_scrollable_widget_initialize(AtkObject *obj, gpointer data)
    Evas_Object *evas_obj = NULL;
    EailScrollableWidget *widget = EAIL_SCROLLABLE_WIDGET(obj);
 
-   /* Initializing possible widget actions table*/
-   eail_scrollable_widget_actions_table_init(widget);
-
    evas_obj = eail_widget_get_widget(EAIL_WIDGET(widget));
    if (!evas_obj)
      {
@@ -242,4 +237,6 @@ eail_scrollable_widget_class_init(EailScrollableWidgetClass *klass)
    GObjectClass *gobject_class = G_OBJECT_CLASS(klass);
    class->initialize = eail_scrollable_widget_initialize;
    gobject_class->finalize = eail_scrollable_widget_finalize;
+
+   eail_scrollable_widget_actions_table_init(EAIL_ACTION_WIDGET_CLASS(klass));
 }
@@ -0,0 +1,690 @@
+/*
+ * Copyright (c) 2013 Samsung Electronics Co., Ltd.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/**
+ * @file eail_shared_tree.c
+ * @brief Implementation of immutable copy of accessible tree readable from
+ * any thread
+ *
+ * Journal deltas mark changed accessibles dirty and every ancestor of them
+ * as leading to a dirty node, then schedule a rebuild. The rebuild walks
+ * only dirty paths of the live tree: clean subtrees of the previous tree
+ * are shared by the new one, nodes on dirty paths are copied and only
+ * accessibles that changed themselves are asked for their properties
+ * again.
+ *
+ * Children of some containers (table, grid...) change without
+ * children-changed, so nothing reaches the journal. Callers changing them
+ * ask for eail_shared_tree_refresh, which walks the whole live tree once;
+ * nodes that turn out unchanged are still shared with the previous tree.
+ *
+ * New tree is published by swapping a single pointer. Readers announce
+ * themselves in eail_shared_tree_readers only between reading the pointer
+ * and taking their reference, so a replaced tree is released by the main
+ * loop as soon as that counter is seen at zero; readers never wait and the
+ * main loop never waits for them, it retries later instead.
+ */
+
+#include <string.h>
+
+#include <Elementary.h>
+
+#include "eail_shared_tree.h"
+#include "eail_journal.h"
+#include "eail_utils.h"
+#include "eail_priv.h"
+
+/** @brief Interval of retries releasing replaced trees, in seconds */
+#define EAIL_SHARED_TREE_RELEASE_INTERVAL 0.1
+
+/** @brief Dirty flags of accessible */
+typedef enum
+{
+   EAIL_SHARED_DIRTY_SELF = 1 << 0,/**< @brief properties changed */
+   EAIL_SHARED_DIRTY_CHILDREN = 1 << 1,/**< @brief children added or removed */
+   EAIL_SHARED_DIRTY_PATH = 1 << 2/**< @brief a descendant is dirty */
+} EailSharedDirtyFlags;
+
+/** @brief Main loop state of shared tree publishing */
+typedef struct _EailSharedPublisher
+{
+   GHashTable *dirty;/**< @brief EailSharedDirtyFlags keyed by AtkObject */
+   GSList *retired;/**< @brief replaced trees still referenced by publisher */
+   Ecore_Idler *idler;/**< @brief pending rebuild, NULL if none */
+   Ecore_Timer *release_timer;/**< @brief pending release retry, NULL if none */
+   gboolean full;/**< @brief whether next rebuild walks the whole tree */
+   EailTreeWalk walk;/**< @brief state of currently running rebuild walk */
+} EailSharedPublisher;
+
+/** @brief Publisher, NULL if shared tree is not running */
+static EailSharedPublisher *eail_shared_publisher = NULL;
+
+/** @brief Current tree, swapped atomically */
+static EailSharedTree *volatile eail_shared_tree_current = NULL;
+
+/** @brief Number of readers between reading current tree and taking ref */
+static volatile gint eail_shared_tree_readers = 0;
+
+/**
+ * @brief Drops reference to node, freeing it with its subtree if unused
+ *
+ * @param node EailSharedNode instance
+ */
+static void
+_eail_shared_node_unref(EailSharedNode *node)
+{
+   guint i;
+
+   if (!g_atomic_int_dec_and_test(&node->ref_count)) return;
+
+   for (i = 0; i < node->n_children; ++i)
+     _eail_shared_node_unref(node->children[i]);
+
+   g_free(node->children);
+   g_free(node->name);
+   g_free(node);
+}
+
+/**
+ * @brief Marks accessible dirty together with path leading to it
+ *
+ * @param publisher EailSharedPublisher instance
+ * @param obj changed AtkObject
+ * @param flags EailSharedDirtyFlags of obj
+ */
+static void
+_eail_shared_tree_mark(EailSharedPublisher *publisher,
+                       AtkObject *obj,
+                       guint flags)
+{
+   guint old_flags;
+
+   old_flags = GPOINTER_TO_UINT(g_hash_table_lookup(publisher->dirty, obj));
+   g_hash_table_insert(publisher->dirty, obj,
+                       GUINT_TO_POINTER(old_flags | flags));
+
+   /* ancestors of an already marked accessible are marked too */
+   if (old_flags) return;
+
+   for (obj = atk_object_get_parent(obj); obj; obj = atk_object_get_parent(obj))
+     {
+        old_flags = GPOINTER_TO_UINT(g_hash_table_lookup(publisher->dirty,
+                                                         obj));
+        if (old_flags & EAIL_SHARED_DIRTY_PATH) break;
+
+        g_hash_table_insert(publisher->dirty, obj,
+                            GUINT_TO_POINTER(old_flags |
+                                             EAIL_SHARED_DIRTY_PATH));
+     }
+}
+
+static Eina_Bool _eail_shared_tree_rebuild(void *data);
+
+/**
+ * @brief Marks changed accessible and schedules rebuild
+ *
+ * @param delta recorded delta
+ * @param data EailSharedPublisher instance
+ */
+static void
+_eail_shared_tree_on_delta(const EailDelta *delta, gpointer data)
+{
+   EailSharedPublisher *publisher = data;
+   guint flags;
+
+   if (delta->type == EAIL_DELTA_CHILD_ADDED ||
+       delta->type == EAIL_DELTA_CHILD_REMOVED)
+     flags = EAIL_SHARED_DIRTY_CHILDREN;
+   else
+     flags = EAIL_SHARED_DIRTY_SELF;
+
+   _eail_shared_tree_mark(publisher, (AtkObject *)(gsize)delta->id, flags);
+
+   if (!publisher->idler)
+     publisher->idler = ecore_idler_add(_eail_shared_tree_rebuild, publisher);
+}
+
+/**
+ * @brief Fills node with current properties of accessible
+ *
+ * @param publisher EailSharedPublisher instance
+ * @param obj AtkObject instance
+ * @param node EailSharedNode to fill
+ */
+static void
+_eail_shared_node_fill(EailSharedPublisher *publisher,
+                       AtkObject *obj,
+                       EailSharedNode *node)
+{
+   EailObjectRecord record;
+
+   eail_tree_walk_fill(&publisher->walk, obj, &record);
+
+   node->role = record.role;
+   node->name = g_strdup(atk_object_get_name(obj));
+   node->states = record.states;
+   node->x = record.x;
+   node->y = record.y;
+   node->width = record.width;
+   node->height = record.height;
+}
+
+/**
+ * @brief Finds child of previous node by id
+ *
+ * @param old previous EailSharedNode, may be NULL
+ * @param id id of child
+ * @param hint expected index of child
+ *
+ * @returns previous child node, NULL if there is none
+ */
+static EailSharedNode *
+_eail_shared_node_find_child(EailSharedNode *old, guint64 id, guint hint)
+{
+   guint i;
+
+   if (!old) return NULL;
+
+   /* children mostly keep their index or move by one */
+   if (hint < old->n_children && old->children[hint]->id == id)
+     return old->children[hint];
+   if (hint > 0 && hint - 1 < old->n_children &&
+       old->children[hint - 1]->id == id)
+     return old->children[hint - 1];
+   if (hint + 1 < old->n_children && old->children[hint + 1]->id == id)
+     return old->children[hint + 1];
+
+   for (i = 0; i < old->n_children; ++i)
+     if (old->children[i]->id == id) return old->children[i];
+
+   return NULL;
+}
+
+/**
+ * @brief Adds reference to child to GPtrArray
+ *
+ * @param child AtkObject instance
+ * @param index index of child (unused)
+ * @param user_data GPtrArray of referenced children
+ */
+static void
+_eail_shared_tree_child_add(AtkObject *child, gint index, gpointer user_data)
+{
+   g_ptr_array_add(user_data, g_object_ref(child));
+}
+
+/**
+ * @brief Gets live children of accessible
+ *
+ * @param publisher EailSharedPublisher instance
+ * @param obj AtkObject instance
+ *
+ * @returns GPtrArray of referenced AtkObject children
+ */
+static GPtrArray *
+_eail_shared_tree_children(EailSharedPublisher *publisher, AtkObject *obj)
+{
+   GPtrArray *children = g_ptr_array_new_with_free_func(g_object_unref);
+
+   eail_tree_walk_children(&publisher->walk, obj,
+                           _eail_shared_tree_child_add, children);
+
+   return children;
+}
+
+/**
+ * @brief Checks whether node built again equals previous node
+ *
+ * @param node new EailSharedNode
+ * @param old previous EailSharedNode
+ *
+ * @returns TRUE if properties and children of nodes are the same
+ */
+static gboolean
+_eail_shared_node_equal(const EailSharedNode *node, const EailSharedNode *old)
+{
+   if (node->states != old->states || node->role != old->role ||
+       node->index != old->index || node->x != old->x || node->y != old->y ||
+       node->width != old->width || node->height != old->height ||
+       node->n_children != old->n_children ||
+       g_strcmp0(node->name, old->name))
+     return FALSE;
+
+   /* unchanged children are shared, so comparing pointers is enough */
+   return !memcmp(node->children, old->children,
+                  node->n_children * sizeof(EailSharedNode *));
+}
+
+/**
+ * @brief Builds node of accessible, sharing clean parts of previous node
+ *
+ * During full rebuild every node is built again and replaced by the
+ * previous one if they are equal.
+ *
+ * @param publisher EailSharedPublisher instance
+ * @param obj AtkObject instance
+ * @param old node of obj in previous tree, NULL if none
+ * @param index index of obj among children of its parent
+ *
+ * @returns new reference to node
+ */
+static EailSharedNode *
+_eail_shared_tree_build(EailSharedPublisher *publisher,
+                        AtkObject *obj,
+                        EailSharedNode *old,
+                        gint32 index)
+{
+   EailSharedNode *node;
+   guint flags = 0, i;
+
+   if (publisher->full)
+     flags = EAIL_SHARED_DIRTY_SELF | EAIL_SHARED_DIRTY_CHILDREN;
+   else if (old)
+     flags = GPOINTER_TO_UINT(g_hash_table_lookup(publisher->dirty, obj));
+
+   if (old && !flags && old->index == index)
+     {
+        g_atomic_int_inc(&old->ref_count);
+        return old;
+     }
+
+   node = g_new0(EailSharedNode, 1);
+   node->ref_count = 1;
+   node->id = (guint64)(gsize)obj;
+   node->index = index;
+
+   if (!old || (flags & EAIL_SHARED_DIRTY_SELF))
+     _eail_shared_node_fill(publisher, obj, node);
+   else
+     {
+        node->states = old->states;
+        node->name = g_strdup(old->name);
+        node->role = old->role;
+        node->x = old->x;
+        node->y = old->y;
+        node->width = old->width;
+        node->height = old->height;
+     }
+
+   if (old && !(flags & (EAIL_SHARED_DIRTY_CHILDREN | EAIL_SHARED_DIRTY_PATH)))
+     {
+        /* children did not change, share them as they are */
+        node->n_children = old->n_children;
+        node->n_descendants = old->n_descendants;
+        node->children = g_new(EailSharedNode *, old->n_children);
+        memcpy(node->children, old->children,
+               old->n_children * sizeof(EailSharedNode *));
+        for (i = 0; i < node->n_children; ++i)
+          g_atomic_int_inc(&node->children[i]->ref_count);
+
+        return node;
+     }
+
+   {
+      GPtrArray *children = _eail_shared_tree_children(publisher, obj);
+
+      node->n_children = children->len;
+      node->children = g_new(EailSharedNode *, children->len);
+
+      for (i = 0; i < children->len; ++i)
+        {
+           AtkObject *child = g_ptr_array_index(children, i);
+           EailSharedNode *old_child =
+              _eail_shared_node_find_child(old, (guint64)(gsize)child, i);
+
+           node->children[i] =
+              _eail_shared_tree_build(publisher, child, old_child, i);
+           node->n_descendants += node->children[i]->n_descendants + 1;
+        }
+
+      g_ptr_array_free(children, TRUE);
+   }
+
+   if (publisher->full && old && _eail_shared_node_equal(node, old))
+     {
+        _eail_shared_node_unref(node);
+        g_atomic_int_inc(&old->ref_count);
+        return old;
+     }
+
+   return node;
+}
+
+/**
+ * @brief Releases replaced trees once no reader can be taking reference to
+ * them
+ *
+ * @param publisher EailSharedPublisher instance
+ *
+ * @returns TRUE if all replaced trees are released
+ */
+static gboolean
+_eail_shared_tree_release(EailSharedPublisher *publisher)
+{
+   EailSharedTree *tree;
+
+   /* readers entering now see the new tree, others already hold their ref */
+   if (g_atomic_int_get(&eail_shared_tree_readers)) return FALSE;
+
+   while (publisher->retired)
+     {
+        tree = publisher->retired->data;
+        publisher->retired = g_slist_delete_link(publisher->retired,
+                                                 publisher->retired);
+        eail_shared_tree_unref(tree);
+     }
+
+   return TRUE;
+}
+
+/**
+ * @brief Retries releasing of replaced trees
+ *
+ * @param data EailSharedPublisher instance
+ *
+ * @returns ECORE_CALLBACK_RENEW until all replaced trees are released
+ */
+static Eina_Bool
+_eail_shared_tree_release_retry(void *data)
+{
+   EailSharedPublisher *publisher = data;
+
+   if (!_eail_shared_tree_release(publisher))
+     return ECORE_CALLBACK_RENEW;
+
+   publisher->release_timer = NULL;
+   return ECORE_CALLBACK_CANCEL;
+}
+
+/**
+ * @brief Replaces current tree, old one is released once it is safe
+ *
+ * @param publisher EailSharedPublisher instance
+ * @param tree new tree, publisher's reference is taken over
+ */
+static void
+_eail_shared_tree_publish(EailSharedPublisher *publisher, EailSharedTree *tree)
+{
+   EailSharedTree *old;
+
+   old = g_atomic_pointer_get(&eail_shared_tree_current);
+   g_atomic_pointer_set(&eail_shared_tree_current, tree);
+
+   if (old)
+     publisher->retired = g_slist_prepend(publisher->retired, old);
+
+   if (!_eail_shared_tree_release(publisher) && !publisher->release_timer)
+     publisher->release_timer =
+        ecore_timer_add(EAIL_SHARED_TREE_RELEASE_INTERVAL,
+                        _eail_shared_tree_release_retry, publisher);
+}
+
+/**
+ * @brief Builds new tree from dirty parts of accessible tree and publishes
+ * it
+ *
+ * @param data EailSharedPublisher instance
+ *
+ * @returns ECORE_CALLBACK_CANCEL, idler is added again on next change
+ */
+static Eina_Bool
+_eail_shared_tree_rebuild(void *data)
+{
+   EailSharedPublisher *publisher = data;
+   EailSharedTree *old, *tree;
+   AtkObject *root;
+
+   publisher->idler = NULL;
+
+   root = atk_get_root();
+   if (!root) return ECORE_CALLBACK_CANCEL;
+
+   /* only the main loop changes current tree, its reference is still held */
+   old = g_atomic_pointer_get(&eail_shared_tree_current);
+
+   /* windows may have moved since the previous walk */
+   eail_tree_walk_init(&publisher->walk, ATK_XY_SCREEN);
+
+   tree = g_new0(EailSharedTree, 1);
+   tree->ref_count = 1;
+   tree->sequence = eail_journal_sequence_get();
+   tree->root = _eail_shared_tree_build(publisher, root,
+                                        old ? old->root : NULL, 0);
+   tree->n_nodes = tree->root->n_descendants + 1;
+
+   g_hash_table_remove_all(publisher->dirty);
+   publisher->full = FALSE;
+
+   _eail_shared_tree_publish(publisher, tree);
+
+   return ECORE_CALLBACK_CANCEL;
+}
+
+/**
+ * @brief Calls callback on node and its subtree until it matches
+ *
+ * @param node EailSharedNode instance
+ * @param func callback
+ * @param data data passed to func
+ *
+ * @returns matching node, NULL if none
+ */
+static const EailSharedNode *
+_eail_shared_node_find(const EailSharedNode *node,
+                       EailSharedNodeFunc func,
+                       gpointer data)
+{
+   const EailSharedNode *found;
+   guint i;
+
+   if (func(node, data)) return node;
+
+   for (i = 0; i < node->n_children; ++i)
+     {
+        found = _eail_shared_node_find(node->children[i], func, data);
+        if (found) return found;
+     }
+
+   return NULL;
+}
+
+/**
+ * @brief Adds role of node and its subtree to counters
+ *
+ * @param node EailSharedNode instance
+ * @param counts counters indexed by AtkRole
+ * @param n_counts number of counters
+ */
+static void
+_eail_shared_node_count_roles(const EailSharedNode *node,
+                              guint *counts,
+                              guint n_counts)
+{
+   guint i;
+
+   if (node->role < n_counts)
+     ++counts[node->role];
+
+   for (i = 0; i < node->n_children; ++i)
+     _eail_shared_node_count_roles(node->children[i], counts, n_counts);
+}
+
+/**
+ * First tree is built once the main loop runs. Does nothing if shared tree
+ * is already published.
+ */
+void
+eail_shared_tree_init(void)
+{
+   if (eail_shared_publisher) return;
+
+   eail_shared_publisher = g_new0(EailSharedPublisher, 1);
+   eail_shared_publisher->dirty = g_hash_table_new(g_direct_hash,
+                                                   g_direct_equal);
+   eail_shared_publisher->idler =
+      ecore_idler_add(_eail_shared_tree_rebuild, eail_shared_publisher);
+
+   eail_journal_listener_add(_eail_shared_tree_on_delta,
+                             eail_shared_publisher);
+
+   eail_journal_reader_add();
+}
+
+/**
+ * Trees already referenced by readers stay valid until they are unreferenced.
+ */
+void
+eail_shared_tree_shutdown(void)
+{
+   EailSharedPublisher *publisher = eail_shared_publisher;
+   EailSharedTree *old;
+
+   if (!publisher) return;
+
+   eail_journal_listener_remove(_eail_shared_tree_on_delta, publisher);
+   eail_journal_reader_remove();
+   if (publisher->idler)
+     ecore_idler_del(publisher->idler);
+   if (publisher->release_timer)
+     ecore_timer_del(publisher->release_timer);
+
+   old = g_atomic_pointer_get(&eail_shared_tree_current);
+   g_atomic_pointer_set(&eail_shared_tree_current, NULL);
+   if (old)
+     publisher->retired = g_slist_prepend(publisher->retired, old);
+
+   /* readers stay in their window for a few instructions only */
+   while (!_eail_shared_tree_release(publisher))
+     g_thread_yield();
+
+   g_hash_table_destroy(publisher->dirty);
+   g_free(publisher);
+   eail_shared_publisher = NULL;
+}
+
+/**
+ * Needed only after changes that are not notified, e.g. packing into a
+ * table; the rebuild runs once the main loop is idle. Does nothing if
+ * shared tree is not running.
+ */
+void
+eail_shared_tree_refresh(void)
+{
+   EailSharedPublisher *publisher = eail_shared_publisher;
+
+   if (!publisher) return;
+
+   publisher->full = TRUE;
+   if (!publisher->idler)
+     publisher->idler = ecore_idler_add(_eail_shared_tree_rebuild, publisher);
+}
+
+/**
+ * Can be called from any thread, never blocks.
+ *
+ * @returns new reference to the current tree, to be dropped with
+ * eail_shared_tree_unref; NULL if no tree is published
+ */
+EailSharedTree *
+eail_shared_tree_get(void)
+{
+   EailSharedTree *tree;
+
+   g_atomic_int_inc(&eail_shared_tree_readers);
+
+   tree = g_atomic_pointer_get(&eail_shared_tree_current);
+   if (tree)
+     g_atomic_int_inc(&tree->ref_count);
+
+   g_atomic_int_add(&eail_shared_tree_readers, -1);
+
+   return tree;
+}
+
+/**
+ * @param tree EailSharedTree instance
+ *
+ * @returns tree
+ */
+EailSharedTree *
+eail_shared_tree_ref(EailSharedTree *tree)
+{
+   g_return_val_if_fail(tree, NULL);
+
+   g_atomic_int_inc(&tree->ref_count);
+
+   return tree;
+}
+
+/**
+ * Nodes not shared with other trees are freed together with the last
+ * reference.
+ *
+ * @param tree EailSharedTree instance
+ */
+void
+eail_shared_tree_unref(EailSharedTree *tree)
+{
+   g_return_if_fail(tree);
+
+   if (!g_atomic_int_dec_and_test(&tree->ref_count)) return;
+
+   _eail_shared_node_unref(tree->root);
+   g_free(tree);
+}
+
+/**
+ * Nodes are checked in document order (parent before its children).
+ *
+ * @param tree EailSharedTree instance
+ * @param func callback checking nodes
+ * @param data data passed to func
+ *
+ * @returns first matching node, owned by tree; NULL if none matches
+ */
+const EailSharedNode *
+eail_shared_tree_find(const EailSharedTree *tree,
+                      EailSharedNodeFunc func,
+                      gpointer data)
+{
+   g_return_val_if_fail(tree, NULL);
+   g_return_val_if_fail(func, NULL);
+
+   return _eail_shared_node_find(tree->root, func, data);
+}
+
+/**
+ * Counters are not cleared before counting. Nodes with roles not smaller
+ * than n_counts are skipped, pass ATK_ROLE_LAST_DEFINED counters to cover
+ * all predefined roles.
+ *
+ * @param tree EailSharedTree instance
+ * @param counts counters indexed by AtkRole
+ * @param n_counts number of counters
+ */
+void
+eail_shared_tree_count_roles(const EailSharedTree *tree,
+                             guint *counts,
+                             guint n_counts)
+{
+   g_return_if_fail(tree);
+   g_return_if_fail(counts || !n_counts);
+
+   _eail_shared_node_count_roles(tree->root, counts, n_counts);
+}
@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2013 Samsung Electronics Co., Ltd.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/**
+ * @file eail_shared_tree.h
+ *
+ * @brief Header for immutable copy of accessible tree readable from any
+ * thread
+ *
+ * The tree is copied on the main loop and published as an immutable,
+ * reference counted EailSharedTree. Any thread can take a reference to the
+ * current tree with eail_shared_tree_get and query it without locking and
+ * without touching Evas or Elementary; the main loop publishes new trees
+ * meanwhile without waiting for readers.
+ *
+ * eail_shared_tree_init, eail_shared_tree_shutdown and
+ * eail_shared_tree_refresh must be called from the main loop, other threads
+ * can use ecore_main_loop_thread_safe_call_async to do so. All other
+ * functions are thread-safe.
+ */
+
+#ifndef EAIL_SHARED_TREE_H
+#define EAIL_SHARED_TREE_H
+
+#include <atk/atk.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Node of shared tree, never changed once published
+ *
+ * Unchanged nodes are shared between successive trees.
+ */
+typedef struct _EailSharedNode EailSharedNode;
+
+/** @brief Immutable copy of accessible tree */
+typedef struct _EailSharedTree EailSharedTree;
+
+struct _EailSharedNode
+{
+   gint ref_count;/**< @brief number of trees and parents holding node */
+   guint64 id;/**< @brief address of AtkObject, do not dereference */
+   guint64 states;/**< @brief mask of EAIL_STATE_BIT values */
+   gchar *name;/**< @brief name of accessible, NULL if none */
+   guint32 role;/**< @brief AtkRole of accessible */
+   gint32 index;/**< @brief index of node among children of its parent */
+   gint32 x;/**< @brief x coordinate of accessible on the screen */
+   gint32 y;/**< @brief y coordinate of accessible on the screen */
+   gint32 width;/**< @brief width of accessible */
+   gint32 height;/**< @brief height of accessible */
+   guint n_descendants;/**< @brief number of nodes in subtree below node */
+   guint n_children;/**< @brief number of children */
+   EailSharedNode **children;/**< @brief children in index order */
+};
+
+struct _EailSharedTree
+{
+   gint ref_count;/**< @brief number of references */
+   guint64 sequence;/**< @brief journal sequence the tree is taken at */
+   guint n_nodes;/**< @brief number of nodes in tree */
+   EailSharedNode *root;/**< @brief root node */
+};
+
+/**
+ * @brief Callback checking node of shared tree
+ *
+ * @param node EailSharedNode instance
+ * @param data data passed to eail_shared_tree_find
+ *
+ * @returns TRUE if node matches
+ */
+typedef gboolean (*EailSharedNodeFunc)(const EailSharedNode *node,
+                                       gpointer data);
+
+/**
+ * @brief Starts publishing shared tree
+ */
+void eail_shared_tree_init(void);
+
+/**
+ * @brief Stops publishing shared tree
+ */
+void eail_shared_tree_shutdown(void);
+
+/**
+ * @brief Schedules rebuild walking the whole accessible tree
+ */
+void eail_shared_tree_refresh(void);
+
+/**
+ * @brief Gets reference to the current shared tree
+ */
+EailSharedTree *eail_shared_tree_get(void);
+
+/**
+ * @brief Adds reference to shared tree
+ */
+EailSharedTree *eail_shared_tree_ref(EailSharedTree *tree);
+
+/**
+ * @brief Drops reference to shared tree
+ */
+void eail_shared_tree_unref(EailSharedTree *tree);
+
+/**
+ * @brief Finds first node of shared tree matching callback
+ */
+const EailSharedNode *eail_shared_tree_find(const EailSharedTree *tree,
+                                            EailSharedNodeFunc func,
+                                            gpointer data);
+
+/**
+ * @brief Counts nodes of shared tree by role
+ */
+void eail_shared_tree_count_roles(const EailSharedTree *tree,
+                                  guint *counts,
+                                  guint n_counts);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
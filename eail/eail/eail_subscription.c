@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) 2013 Samsung Electronics Co., Ltd.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/**
+ * @file eail_subscription.c
+ * @brief Implementation of subscriptions driving callbacks attached to widgets
+ *
+ * Every EailSubscription value has a subscriber count. Counts are atomic, so
+ * global event listeners can subscribe from any thread. When the set of
+ * subscriptions with subscribers changes, the main loop walks accessibles
+ * known to the factory and lets each of them attach or detach its callbacks
+ * with eail_widget_instrument. Accessibles created later attach callbacks of
+ * eail_subscription_get in their initialize.
+ *
+ * Until somebody subscribes, accessibles attach no show/hide, move/resize
+ * or caret callbacks and emit no visibility, bounds or caret events.
+ * EailWidget computes state sets on demand then.
+ */
+
+#include <string.h>
+
+#include <Elementary.h>
+
+#include "eail_subscription.h"
+#include "eail_widget.h"
+#include "eail_factory.h"
+#include "eail_priv.h"
+
+/** @brief Subscriber count of every EailSubscription value, by bit index */
+static volatile gint eail_subscription_counts[EAIL_SUBSCRIPTION_N];
+
+/** @brief Subscriptions whose callbacks are attached, main loop only */
+static guint eail_subscription_applied = 0;
+
+/**
+ * @brief Gets subscriptions that have subscribers
+ *
+ * @returns mask of EailSubscription values
+ */
+static guint
+_eail_subscription_wanted(void)
+{
+   guint subscriptions = 0;
+   guint i;
+
+   for (i = 0; i < EAIL_SUBSCRIPTION_N; ++i)
+     if (g_atomic_int_get(&eail_subscription_counts[i]) > 0)
+       subscriptions |= 1 << i;
+
+   return subscriptions;
+}
+
+/**
+ * @brief Attaches and detaches callbacks of all accessibles to match
+ * subscribers
+ *
+ * Runs in the main loop.
+ *
+ * @param data unused
+ */
+static void
+_eail_subscription_apply(void *data)
+{
+   Eina_List *accessibles;
+   AtkObject *obj;
+   guint wanted = _eail_subscription_wanted();
+
+   if (wanted == eail_subscription_applied) return;
+
+   DBG("Subscriptions changed from %x to %x",
+       eail_subscription_applied, wanted);
+   eail_subscription_applied = wanted;
+
+   accessibles = eail_factory_get_accessibles();
+   EINA_LIST_FREE(accessibles, obj)
+     {
+        if (EAIL_IS_WIDGET(obj))
+          eail_widget_instrument(EAIL_WIDGET(obj), wanted);
+        g_object_unref(obj);
+     }
+}
+
+/**
+ * @brief Schedules update of attached callbacks in the main loop
+ */
+static void
+_eail_subscription_changed(void)
+{
+   if (eina_main_loop_is())
+     _eail_subscription_apply(NULL);
+   else
+     ecore_main_loop_thread_safe_call_async(_eail_subscription_apply, NULL);
+}
+
+/**
+ * Can be called from any thread. Callbacks are attached right away when
+ * called from the main loop, otherwise once the main loop gets to it.
+ *
+ * @param subscriptions mask of EailSubscription values
+ */
+void
+eail_subscription_add(guint subscriptions)
+{
+   gboolean changed = FALSE;
+   guint i;
+
+   for (i = 0; i < EAIL_SUBSCRIPTION_N; ++i)
+     {
+        if (!(subscriptions & (1 << i))) continue;
+
+        if (g_atomic_int_add(&eail_subscription_counts[i], 1) == 0)
+          changed = TRUE;
+     }
+
+   if (changed)
+     _eail_subscription_changed();
+}
+
+/**
+ * Can be called from any thread.
+ *
+ * @param subscriptions mask of EailSubscription values, every value has to
+ * be taken with eail_subscription_add before
+ */
+void
+eail_subscription_remove(guint subscriptions)
+{
+   gboolean changed = FALSE;
+   guint i;
+
+   for (i = 0; i < EAIL_SUBSCRIPTION_N; ++i)
+     {
+        if (!(subscriptions & (1 << i))) continue;
+
+        if (g_atomic_int_dec_and_test(&eail_subscription_counts[i]))
+          changed = TRUE;
+     }
+
+   if (changed)
+     _eail_subscription_changed();
+}
+
+/**
+ * Has to be called from the main loop.
+ *
+ * @returns mask of EailSubscription values
+ */
+guint
+eail_subscription_get(void)
+{
+   return eail_subscription_applied;
+}
+
+/**
+ * Signals not listed need no callbacks beyond those attached eagerly.
+ *
+ * @param signal name of AtkObject signal, without detail
+ *
+ * @returns mask of EailSubscription values, 0 if signal needs none
+ */
+guint
+eail_subscription_for_signal(const gchar *signal)
+{
+   if (!signal) return 0;
+
+   if (!strcmp(signal, "state-change"))
+     return EAIL_SUBSCRIPTION_STATE;
+   if (!strcmp(signal, "bounds-changed"))
+     return EAIL_SUBSCRIPTION_BOUNDS;
+   if (!strcmp(signal, "text-caret-moved"))
+     return EAIL_SUBSCRIPTION_CARET;
+
+   return 0;
+}
+
+/**
+ * Has to be called from the main loop, before the factory is shut down.
+ */
+void
+eail_subscription_shutdown(void)
+{
+   guint i;
+
+   for (i = 0; i < EAIL_SUBSCRIPTION_N; ++i)
+     g_atomic_int_set(&eail_subscription_counts[i], 0);
+
+   _eail_subscription_apply(NULL);
+}
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2013 Samsung Electronics Co., Ltd.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/**
+ * @file eail_subscription.h
+ *
+ * @brief Header for subscriptions driving callbacks attached to widgets
+ *
+ * Accessibles hook widget callbacks only for events that somebody listens
+ * to. Global event listeners and internal consumers (mirror, shared tree,
+ * property cache...) take subscriptions; callbacks of a subscription are
+ * attached to all widgets when it gets its first subscriber and detached
+ * when the last one goes away. Show/hide callbacks belong to
+ * EAIL_SUBSCRIPTION_STATE and move/resize callbacks to
+ * EAIL_SUBSCRIPTION_BOUNDS; while both are not attached, states are computed
+ * on every query.
+ *
+ * Focus callbacks are not part of it, they back atk_get_focus_object and
+ * stay attached.
+ */
+
+#ifndef EAIL_SUBSCRIPTION_H
+#define EAIL_SUBSCRIPTION_H
+
+#include <glib.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief Groups of widget callbacks attached on demand */
+typedef enum
+{
+   EAIL_SUBSCRIPTION_STATE = 1 << 0,/**< @brief visibility and other states */
+   EAIL_SUBSCRIPTION_BOUNDS = 1 << 1,/**< @brief move and resize */
+   EAIL_SUBSCRIPTION_CARET = 1 << 2/**< @brief text cursor moves */
+} EailSubscription;
+
+/** @brief Number of EailSubscription values */
+#define EAIL_SUBSCRIPTION_N 3
+
+/** @brief Mask of all EailSubscription values */
+#define EAIL_SUBSCRIPTION_ALL ((1 << EAIL_SUBSCRIPTION_N) - 1)
+
+/** @brief Subscriptions keeping tracked states and extents up to date */
+#define EAIL_SUBSCRIPTION_GEOMETRY \
+   (EAIL_SUBSCRIPTION_STATE | EAIL_SUBSCRIPTION_BOUNDS)
+
+/**
+ * @brief Subscribes to given mask of EailSubscription values
+ */
+void eail_subscription_add(guint subscriptions);
+
+/**
+ * @brief Drops subscriptions taken with eail_subscription_add
+ */
+void eail_subscription_remove(guint subscriptions);
+
+/**
+ * @brief Gets subscriptions whose callbacks are attached to widgets
+ */
+guint eail_subscription_get(void);
+
+/**
+ * @brief Gets subscriptions needed to emit given AtkObject signal
+ */
+guint eail_subscription_for_signal(const gchar *signal);
+
+/**
+ * @brief Detaches all callbacks and drops all subscriptions
+ */
+void eail_subscription_shutdown(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
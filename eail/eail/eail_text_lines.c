@@ -0,0 +1,944 @@
+/*
+ * Copyright (c) 2013 Samsung Electronics Co., Ltd.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/**
+ * @file eail_text_lines.c
+ * @brief Implementation of cached line geometry of textblocks
+ *
+ * Geometry of every line of a textblock is gathered in a single cursor pass
+ * and kept on the textblock until it is resized or its content changes.
+ * Extents queries reuse one cursor per textblock instead of allocating
+ * cursors for every call.
+ *
+ * Lines are sorted by offset, so line boundary queries are binary searches.
+ * Edits reported with eail_text_lines_update re-read only the paragraphs
+ * touched by the edit and shift the lines after them.
+ *
+ * Word and sentence boundaries are kept alongside the lines. They do not
+ * depend on layout, so they survive resizes and are dropped only when the
+ * content changes.
+ *
+ * Textblocks emit no event when their content changes, so the table
+ * listens on the edje object owning the textblock: text set on a part drops
+ * lines at once, "entry,changed" of editable parts only marks them outdated,
+ * as the edit may still be applied by eail_text_lines_update. Owners
+ * reporting edits themselves call eail_text_lines_invalidate. Queries do
+ * not look at the content, so a valid table is used without reading text.
+ */
+
+#include <stdlib.h>
+
+#include <atk/atk.h>
+#include <Evas.h>
+#include <Ecore_Evas.h>
+#include <Edje.h>
+
+#include "eail_text_lines.h"
+#include "eail_text_segment.h"
+#include "eail_window.h"
+#include "eail_utils.h"
+#include "eail_priv.h"
+
+/** @brief Key under which line table is stored on textblock */
+#define EAIL_TEXT_LINES_KEY "eail_text_lines"
+
+/** @brief Geometry of single textblock line */
+typedef struct _EailTextLine
+{
+   gint start;/**< @brief offset of the first character of the line */
+   gint last;/**< @brief offset of the last character of the line */
+   gint end;/**< @brief offset of the first character after the line */
+   Evas_Coord x;/**< @brief x coordinate relative to textblock */
+   Evas_Coord y;/**< @brief y coordinate relative to textblock */
+   Evas_Coord w;/**< @brief line width */
+   Evas_Coord h;/**< @brief line height */
+} EailTextLine;
+
+/** @brief Line table stored on textblock */
+typedef struct _EailTextLines
+{
+   Evas_Textblock_Cursor *cur;/**< @brief cursor reused by all queries */
+   GArray *lines;/**< @brief EailTextLine items, NULL if not valid */
+   gboolean dirty;/**< @brief content changed since lines were built */
+   gboolean applied;/**< @brief edit applied before its change was marked */
+   Evas_Coord width;/**< @brief textblock width the table was built for */
+   guint8 *breaks;/**< @brief EAIL_TEXT_SEGMENT_FLAGS, NULL if not valid */
+   gint n_breaks;/**< @brief number of characters covered by breaks */
+} EailTextLines;
+
+/** @brief Number of line tables built from scratch */
+static guint eail_text_lines_builds = 0;
+
+/**
+ * @brief Frees line table when textblock is deleted
+ *
+ * @param data EailTextLines instance
+ * @param e Evas instance
+ * @param obj textblock object
+ * @param event_info additional event info
+ */
+static void
+_eail_text_lines_on_del(void *data,
+                        Evas *e,
+                        Evas_Object *obj,
+                        void *event_info)
+{
+   EailTextLines *tl = data;
+
+   evas_object_data_del(obj, EAIL_TEXT_LINES_KEY);
+
+   if (tl->lines) g_array_free(tl->lines, TRUE);
+   g_free(tl->breaks);
+   evas_textblock_cursor_free(tl->cur);
+   g_free(tl);
+}
+
+/**
+ * @brief Drops line geometry when textblock is resized (relayout)
+ *
+ * @param data EailTextLines instance
+ * @param e Evas instance
+ * @param obj textblock object
+ * @param event_info additional event info
+ */
+static void
+_eail_text_lines_on_resize(void *data,
+                           Evas *e,
+                           Evas_Object *obj,
+                           void *event_info)
+{
+   EailTextLines *tl = data;
+
+   if (!tl->lines) return;
+
+   g_array_free(tl->lines, TRUE);
+   tl->lines = NULL;
+}
+
+/**
+ * @brief Reads geometry of lines starting at given offset
+ *
+ * @param cur cursor used for the walk
+ * @param lines GArray the lines are appended to
+ * @param from offset of the first character of the first line
+ * @param until offset at which the walk stops, -1 for the end of text
+ */
+static void
+_eail_text_lines_walk(Evas_Textblock_Cursor *cur,
+                      GArray *lines,
+                      gint from,
+                      gint until)
+{
+   EailTextLine line;
+   gint last = from - 1;
+
+   evas_textblock_cursor_pos_set(cur, from);
+   do
+     {
+        if (evas_textblock_cursor_line_geometry_get
+            (cur, &line.x, &line.y, &line.w, &line.h) < 0)
+          break;
+
+        evas_textblock_cursor_line_char_first(cur);
+        line.start = evas_textblock_cursor_pos_get(cur);
+        evas_textblock_cursor_line_char_last(cur);
+        line.last = evas_textblock_cursor_pos_get(cur);
+        line.end = line.last + 1;
+
+        /* cursor did not advance, we are at the end of text */
+        if (line.start <= last) break;
+        if (until >= 0 && line.start >= until) break;
+        last = line.last;
+
+        g_array_append_val(lines, line);
+     }
+   while (evas_textblock_cursor_char_next(cur));
+}
+
+/**
+ * @brief Gets offset of the end of text
+ *
+ * Costs a step per paragraph, no text is read.
+ *
+ * @param tl EailTextLines instance
+ * @returns offset of the end of the last paragraph
+ */
+static gint
+_eail_text_lines_end_get(EailTextLines *tl)
+{
+   evas_textblock_cursor_paragraph_last(tl->cur);
+   evas_textblock_cursor_paragraph_char_last(tl->cur);
+
+   return evas_textblock_cursor_pos_get(tl->cur);
+}
+
+/**
+ * @brief Gets offset of the end of text described by cached lines
+ *
+ * @param tl EailTextLines instance with lines
+ * @returns end of the last line, 0 if there are no lines
+ */
+static gint
+_eail_text_lines_cached_end_get(const EailTextLines *tl)
+{
+   if (tl->lines->len == 0) return 0;
+
+   return g_array_index(tl->lines, EailTextLine, tl->lines->len - 1).end;
+}
+
+/**
+ * @brief Makes the last line end at the end of text, not after it
+ *
+ * @param tl EailTextLines instance
+ */
+static void
+_eail_text_lines_fix_last(EailTextLines *tl)
+{
+   EailTextLine *l;
+
+   if (tl->lines->len == 0) return;
+
+   l = &g_array_index(tl->lines, EailTextLine, tl->lines->len - 1);
+   l->end = MAX(l->start, _eail_text_lines_end_get(tl));
+}
+
+/**
+ * @brief Drops lines and boundaries, they are found again on next query
+ *
+ * @param tl EailTextLines instance
+ */
+static void
+_eail_text_lines_drop(EailTextLines *tl)
+{
+   if (tl->lines) g_array_free(tl->lines, TRUE);
+   tl->lines = NULL;
+   tl->dirty = FALSE;
+   tl->applied = FALSE;
+
+   g_free(tl->breaks);
+   tl->breaks = NULL;
+}
+
+/**
+ * @brief Drops table of textblock whose content has been set
+ *
+ * @param data unused
+ * @param obj edje object owning the textblock
+ * @param part name of part whose text has been set
+ */
+static void
+_eail_text_lines_on_text_set(void *data, Evas_Object *obj, const char *part)
+{
+   const Evas_Object *textblock = edje_object_part_object_get(obj, part);
+   EailTextLines *tl;
+
+   if (!textblock) return;
+
+   tl = evas_object_data_get(textblock, EAIL_TEXT_LINES_KEY);
+   if (tl) _eail_text_lines_drop(tl);
+}
+
+/**
+ * @brief Marks table of edited textblock as outdated
+ *
+ * @param data unused
+ * @param obj edje object owning the textblock
+ * @param emission signal emitted
+ * @param source name of edited part
+ */
+static void
+_eail_text_lines_on_entry_changed(void *data,
+                                  Evas_Object *obj,
+                                  const char *emission,
+                                  const char *source)
+{
+   const Evas_Object *textblock = edje_object_part_object_get(obj, source);
+
+   if (textblock)
+     eail_text_lines_invalidate(textblock);
+}
+
+/**
+ * @brief Starts listening to content changes reported by edje object
+ * owning the textblock
+ *
+ * @param textblock Evas textblock
+ */
+static void
+_eail_text_lines_watch(Evas_Object *textblock)
+{
+   Evas_Object *edje = evas_object_smart_parent_get(textblock);
+
+   if (!edje || g_strcmp0(evas_object_type_get(edje), "edje")) return;
+   if (evas_object_data_get(edje, EAIL_TEXT_LINES_KEY)) return;
+
+   evas_object_data_set(edje, EAIL_TEXT_LINES_KEY, edje);
+   eail_edje_text_change_callback_add(edje, _eail_text_lines_on_text_set,
+                                      NULL);
+   edje_object_signal_callback_add(edje, "entry,changed", "*",
+                                   _eail_text_lines_on_entry_changed, NULL);
+}
+
+/**
+ * @brief Gathers geometry of all lines in one cursor pass
+ *
+ * @param tl EailTextLines instance
+ */
+static void
+_eail_text_lines_build(EailTextLines *tl)
+{
+   tl->lines = g_array_new(FALSE, FALSE, sizeof(EailTextLine));
+   tl->dirty = FALSE;
+   tl->applied = FALSE;
+   eail_text_lines_builds++;
+
+   _eail_text_lines_walk(tl->cur, tl->lines, 0, -1);
+   _eail_text_lines_fix_last(tl);
+
+   DBG("Cached geometry of %u lines", tl->lines->len);
+}
+
+/**
+ * @brief Gets line table of textblock, creating or rebuilding it if needed
+ *
+ * Table is rebuilt when it has been marked outdated or when textblock
+ * width differs from the one it was built for.
+ *
+ * @param textblock Evas textblock
+ * @returns EailTextLines instance or NULL if textblock is NULL
+ */
+static EailTextLines *
+_eail_text_lines_get(const Evas_Object *textblock)
+{
+   Evas_Object *obj = (Evas_Object *)textblock;
+   EailTextLines *tl;
+   Evas_Coord width;
+
+   if (!obj) return NULL;
+
+   tl = evas_object_data_get(obj, EAIL_TEXT_LINES_KEY);
+   if (!tl)
+     {
+        tl = g_new0(EailTextLines, 1);
+        tl->cur = evas_object_textblock_cursor_new(obj);
+        evas_object_data_set(obj, EAIL_TEXT_LINES_KEY, tl);
+        evas_object_event_callback_add(obj, EVAS_CALLBACK_DEL,
+                                       _eail_text_lines_on_del, tl);
+        evas_object_event_callback_add(obj, EVAS_CALLBACK_RESIZE,
+                                       _eail_text_lines_on_resize, tl);
+        _eail_text_lines_watch(obj);
+     }
+
+   evas_object_geometry_get(obj, NULL, NULL, &width, NULL);
+
+   if (tl->dirty)
+     _eail_text_lines_drop(tl);
+   else if (tl->lines && tl->width != width)
+     {
+        g_array_free(tl->lines, TRUE);
+        tl->lines = NULL;
+     }
+   tl->applied = FALSE;
+
+   if (!tl->lines)
+     {
+        tl->width = width;
+        _eail_text_lines_build(tl);
+     }
+
+   return tl;
+}
+
+/**
+ * @brief Finds index of the first line which ends after offset
+ *
+ * @param tl EailTextLines instance
+ * @param offset character offset
+ * @returns line index, equal to number of lines if there is no such line
+ */
+static guint
+_eail_text_lines_bsearch(const EailTextLines *tl, gint offset)
+{
+   guint low = 0, high = tl->lines->len;
+
+   while (low < high)
+     {
+        guint mid = low + (high - low) / 2;
+
+        if (g_array_index(tl->lines, EailTextLine, mid).end <= offset)
+          low = mid + 1;
+        else
+          high = mid;
+     }
+
+   return low;
+}
+
+/**
+ * @brief Finds index of the line containing offset
+ *
+ * @param tl EailTextLines instance
+ * @param offset character offset
+ * @returns line index or -1 if offset is out of text
+ */
+static gint
+_eail_text_lines_find(const EailTextLines *tl, gint offset)
+{
+   guint i;
+
+   if (offset < 0) return -1;
+
+   i = _eail_text_lines_bsearch(tl, offset);
+   if (i >= tl->lines->len ||
+       g_array_index(tl->lines, EailTextLine, i).start > offset)
+     return -1;
+
+   return i;
+}
+
+/**
+ * @brief Gets origin of textblock coordinates in given coordinate system
+ *
+ * @param textblock Evas textblock
+ * @param coords coordinate type
+ * @param [out] x x coordinate of textblock origin
+ * @param [out] y y coordinate of textblock origin
+ */
+static void
+_eail_text_lines_origin_get(const Evas_Object *textblock,
+                            AtkCoordType coords,
+                            gint *x,
+                            gint *y)
+{
+   Evas_Coord obj_x, obj_y;
+
+   evas_object_geometry_get(textblock, &obj_x, &obj_y, NULL, NULL);
+   *x = obj_x;
+   *y = obj_y;
+
+   if (coords == ATK_XY_SCREEN)
+     {
+        int ee_x, ee_y;
+
+        eail_window_screen_origin_get(textblock, &ee_x, &ee_y);
+        *x += ee_x;
+        *y += ee_y;
+     }
+}
+
+/**
+ * @brief Extends rectangle so that it contains given area
+ *
+ * @param rect AtkTextRectangle to be extended, width < 0 means empty
+ * @param x x coordinate of the area
+ * @param y y coordinate of the area
+ * @param w area width
+ * @param h area height
+ */
+static void
+_eail_text_rect_union(AtkTextRectangle *rect,
+                      Evas_Coord x,
+                      Evas_Coord y,
+                      Evas_Coord w,
+                      Evas_Coord h)
+{
+   gint x2, y2;
+
+   if (rect->width < 0)
+     {
+        rect->x = x;
+        rect->y = y;
+        rect->width = w;
+        rect->height = h;
+        return;
+     }
+
+   x2 = MAX(rect->x + rect->width, x + w);
+   y2 = MAX(rect->y + rect->height, y + h);
+   rect->x = MIN(rect->x, x);
+   rect->y = MIN(rect->y, y);
+   rect->width = x2 - rect->x;
+   rect->height = y2 - rect->y;
+}
+
+/**
+ * Calling this more than once for the same change does no harm. Table is
+ * rebuilt on the next query unless eail_text_lines_update is called for the
+ * edit. If the edit has been applied already, the change is taken as the
+ * one of the edit as long as the text length matches the lines.
+ *
+ * @param textblock Evas textblock
+ */
+void
+eail_text_lines_invalidate(const Evas_Object *textblock)
+{
+   EailTextLines *tl;
+
+   if (!textblock) return;
+
+   tl = evas_object_data_get(textblock, EAIL_TEXT_LINES_KEY);
+   if (!tl) return;
+
+   g_free(tl->breaks);
+   tl->breaks = NULL;
+
+   if (tl->applied && tl->lines &&
+       _eail_text_lines_cached_end_get(tl) == _eail_text_lines_end_get(tl))
+     return;
+
+   tl->dirty = TRUE;
+   tl->applied = FALSE;
+}
+
+/**
+ * Only the paragraphs touched by the edit are read again, lines after them
+ * are shifted by the edit length and the height difference.
+ *
+ * The edit is applied whether eail_text_lines_invalidate is called for it
+ * before or after, as long as the text length changed by the edit length.
+ * Content set in other ways drops the lines at once, so the edit is never
+ * applied to lines of replaced content.
+ *
+ * @param textblock Evas textblock
+ * @param pos offset at which the edit happened
+ * @param removed number of removed characters
+ * @param inserted number of inserted characters
+ */
+void
+eail_text_lines_update(const Evas_Object *textblock,
+                       gint pos,
+                       gint removed,
+                       gint inserted)
+{
+   EailTextLines *tl;
+   GArray *lines;
+   gint delta = inserted - removed;
+   gint p0, p1, old_top, old_bottom, new_bottom, dy;
+   guint i0, i1, i;
+
+   if (!textblock) return;
+
+   tl = evas_object_data_get(textblock, EAIL_TEXT_LINES_KEY);
+   if (!tl || !tl->lines) return;
+
+   g_free(tl->breaks);
+   tl->breaks = NULL;
+
+   if (_eail_text_lines_cached_end_get(tl) + delta !=
+       _eail_text_lines_end_get(tl))
+     {
+        DBG("Edit does not match length of cached lines, dropping them");
+        _eail_text_lines_drop(tl);
+        return;
+     }
+
+   /* paragraphs containing edit in the new text */
+   evas_textblock_cursor_pos_set(tl->cur, pos);
+   evas_textblock_cursor_paragraph_char_first(tl->cur);
+   p0 = evas_textblock_cursor_pos_get(tl->cur);
+   evas_textblock_cursor_pos_set(tl->cur, pos + inserted);
+   evas_textblock_cursor_paragraph_char_last(tl->cur);
+   p1 = evas_textblock_cursor_pos_get(tl->cur) + 1;
+
+   /* text around edit is unchanged, so p0 and p1 - delta are paragraph
+    * boundaries in the old table as well */
+   i0 = _eail_text_lines_bsearch(tl, p0);
+   i1 = _eail_text_lines_bsearch(tl, p1 - delta);
+   if (i0 >= tl->lines->len ||
+       g_array_index(tl->lines, EailTextLine, i0).start != p0)
+     {
+        DBG("Edit does not match cached lines, dropping them");
+        _eail_text_lines_drop(tl);
+        return;
+     }
+
+   old_top = g_array_index(tl->lines, EailTextLine, i0).y;
+   if (i1 < tl->lines->len)
+     old_bottom = g_array_index(tl->lines, EailTextLine, i1).y;
+   else
+     {
+        EailTextLine *l = &g_array_index(tl->lines, EailTextLine,
+                                         tl->lines->len - 1);
+        old_bottom = l->y + l->h;
+     }
+
+   lines = g_array_new(FALSE, FALSE, sizeof(EailTextLine));
+   _eail_text_lines_walk(tl->cur, lines, p0,
+                         i1 < tl->lines->len ? p1 : -1);
+
+   if (lines->len > 0)
+     {
+        EailTextLine *l = &g_array_index(lines, EailTextLine, lines->len - 1);
+        new_bottom = l->y + l->h;
+     }
+   else
+     new_bottom = old_top;
+   dy = new_bottom - old_bottom;
+
+   for (i = i1; i < tl->lines->len; ++i)
+     {
+        EailTextLine *l = &g_array_index(tl->lines, EailTextLine, i);
+
+        l->start += delta;
+        l->last += delta;
+        l->end += delta;
+        l->y += dy;
+     }
+
+   g_array_remove_range(tl->lines, i0, i1 - i0);
+   g_array_insert_vals(tl->lines, i0, lines->data, lines->len);
+   g_array_free(lines, TRUE);
+
+   _eail_text_lines_fix_last(tl);
+
+   /* change marked before the edit is the edit itself */
+   tl->applied = !tl->dirty;
+   tl->dirty = FALSE;
+}
+
+/**
+ * Flags are found for the whole text on first use and reused until the
+ * content of textblock changes.
+ *
+ * @param textblock Evas textblock
+ * @param [out] length number of characters in textblock
+ *
+ * @returns array of EAIL_TEXT_SEGMENT_FLAGS for positions from 0 to length
+ * (inclusive) or NULL if textblock is NULL. Owned by textblock, must not be
+ * freed
+ */
+const guint8 *
+eail_text_lines_get_breaks(const Evas_Object *textblock, gint *length)
+{
+   EailTextLines *tl = _eail_text_lines_get(textblock);
+
+   if (!tl) return NULL;
+
+   if (!tl->breaks)
+     {
+        char *text = evas_textblock_text_markup_to_utf8
+           (textblock, evas_object_textblock_text_markup_get(textblock));
+
+        tl->breaks = eail_text_segment(text, &tl->n_breaks);
+        free(text);
+     }
+
+   if (length) *length = tl->n_breaks;
+
+   return tl->breaks;
+}
+
+/**
+ * @param textblock Evas textblock
+ *
+ * @returns number of characters in textblock
+ */
+gint
+eail_text_lines_get_length(const Evas_Object *textblock)
+{
+   EailTextLines *tl = _eail_text_lines_get(textblock);
+
+   if (!tl || tl->lines->len == 0) return 0;
+
+   return g_array_index(tl->lines, EailTextLine, tl->lines->len - 1).end;
+}
+
+/**
+ * Offsets past the end of text belong to the last line.
+ *
+ * @param textblock Evas textblock
+ * @param offset character offset
+ * @param [out] first offset of the first character of the line
+ * @param [out] last offset of the last character of the line
+ *
+ * @returns TRUE if offset belongs to a line, FALSE otherwise
+ */
+gboolean
+eail_text_lines_get_line(const Evas_Object *textblock,
+                         gint offset,
+                         gint *first,
+                         gint *last)
+{
+   EailTextLines *tl = _eail_text_lines_get(textblock);
+   const EailTextLine *line;
+   guint i;
+
+   if (!tl || offset < 0 || tl->lines->len == 0) return FALSE;
+
+   i = MIN(_eail_text_lines_bsearch(tl, offset), tl->lines->len - 1);
+   line = &g_array_index(tl->lines, EailTextLine, i);
+
+   if (first) *first = line->start;
+   if (last) *last = line->last;
+
+   return TRUE;
+}
+
+/**
+ * @param textblock Evas textblock
+ * @param offset character offset
+ * @param [out] x x coordinate of the bounding box
+ * @param [out] y y coordinate of the bounding box
+ * @param [out] width width of the bounding box
+ * @param [out] height height of the bounding box
+ * @param coords specify whether coordinates are relative to the
+ * screen or widget window
+ *
+ * @returns TRUE on success, FALSE otherwise
+ */
+gboolean
+eail_text_get_character_extents(const Evas_Object *textblock,
+                                gint offset,
+                                gint *x,
+                                gint *y,
+                                gint *width,
+                                gint *height,
+                                AtkCoordType coords)
+{
+   EailTextLines *tl = _eail_text_lines_get(textblock);
+   Evas_Coord cx, cy, cw, ch;
+   gint ox, oy;
+
+   if (!tl) return FALSE;
+
+   evas_textblock_cursor_pos_set(tl->cur, offset);
+   if (-1 == evas_textblock_cursor_char_geometry_get
+       (tl->cur, &cx, &cy, &cw, &ch))
+     return FALSE;
+
+   _eail_text_lines_origin_get(textblock, coords, &ox, &oy);
+
+   *x = cx + ox;
+   *y = cy + oy;
+   *width = cw;
+   *height = ch;
+
+   return TRUE;
+}
+
+/**
+ * @param textblock Evas textblock
+ * @param x x coordinate
+ * @param y y coordinate
+ * @param coords specify whether coordinates are relative to the
+ * screen or widget window
+ *
+ * @returns offset of the character at given coordinates or -1
+ */
+gint
+eail_text_get_offset_at_point(const Evas_Object *textblock,
+                              gint x,
+                              gint y,
+                              AtkCoordType coords)
+{
+   EailTextLines *tl = _eail_text_lines_get(textblock);
+   gint ox, oy;
+
+   if (!tl) return -1;
+
+   _eail_text_lines_origin_get(textblock, coords, &ox, &oy);
+
+   if (!evas_textblock_cursor_char_coord_set(tl->cur, x - ox, y - oy))
+     return -1;
+
+   return evas_textblock_cursor_pos_get(tl->cur);
+}
+
+/**
+ * Lines fully covered by the range are taken from cached line geometry,
+ * only the first and the last line need character geometry.
+ *
+ * @param textblock Evas textblock
+ * @param start_offset offset of the first character of the range
+ * @param end_offset offset of the first character after the range
+ * @param coords specify whether coordinates are relative to the
+ * screen or widget window
+ * @param [out] rect AtkTextRectangle filled with the bounding box
+ */
+void
+eail_text_get_range_extents(const Evas_Object *textblock,
+                            gint start_offset,
+                            gint end_offset,
+                            AtkCoordType coords,
+                            AtkTextRectangle *rect)
+{
+   EailTextLines *tl = _eail_text_lines_get(textblock);
+   AtkTextRectangle result = {0, 0, -1, -1};
+   gint i, ox, oy;
+
+   if (!tl || start_offset >= end_offset) return;
+
+   i = _eail_text_lines_find(tl, start_offset);
+   if (i < 0) return;
+
+   for (; i < (gint)tl->lines->len; ++i)
+     {
+        const EailTextLine *line = &g_array_index(tl->lines, EailTextLine, i);
+        Evas_Coord x1, x2, cw;
+        gint first, last;
+
+        if (line->start >= end_offset) break;
+
+        first = MAX(start_offset, line->start);
+        last = MIN(end_offset, line->end) - 1;
+
+        if (first == line->start && last == line->end - 1)
+          {
+             _eail_text_rect_union(&result, line->x, line->y, line->w,
+                                   line->h);
+             continue;
+          }
+
+        evas_textblock_cursor_pos_set(tl->cur, first);
+        evas_textblock_cursor_char_geometry_get(tl->cur, &x1, NULL, NULL,
+                                                NULL);
+        evas_textblock_cursor_pos_set(tl->cur, last);
+        evas_textblock_cursor_char_geometry_get(tl->cur, &x2, NULL, &cw,
+                                                NULL);
+        x2 += cw;
+
+        _eail_text_rect_union(&result, MIN(x1, x2), line->y,
+                              ABS(x2 - x1), line->h);
+     }
+
+   if (result.width < 0) return;
+
+   _eail_text_lines_origin_get(textblock, coords, &ox, &oy);
+
+   rect->x = result.x + ox;
+   rect->y = result.y + oy;
+   rect->width = result.width;
+   rect->height = result.height;
+}
+
+/**
+ * Each line crossing the rectangle is walked once with the shared cursor.
+ *
+ * @param textblock Evas textblock
+ * @param rect rectangle bounding the ranges
+ * @param coords specify whether coordinates are relative to the
+ * screen or widget window
+ * @param x_clip_type how to treat characters partially inside rect
+ * horizontally
+ * @param y_clip_type how to treat lines partially inside rect vertically
+ *
+ * @returns NULL-terminated array of AtkTextRange, free with
+ * atk_text_free_ranges
+ */
+AtkTextRange **
+eail_text_get_bounded_ranges(const Evas_Object *textblock,
+                             AtkTextRectangle *rect,
+                             AtkCoordType coords,
+                             AtkTextClipType x_clip_type,
+                             AtkTextClipType y_clip_type)
+{
+   EailTextLines *tl = _eail_text_lines_get(textblock);
+   GPtrArray *ranges = g_ptr_array_new();
+   gboolean clip_x_min, clip_x_max, clip_y_min, clip_y_max;
+   gint rx1, ry1, rx2, ry2, ox, oy;
+   char *text = NULL;
+   guint i;
+
+   if (!tl || !rect)
+     {
+        g_ptr_array_add(ranges, NULL);
+        return (AtkTextRange **)g_ptr_array_free(ranges, FALSE);
+     }
+
+   clip_x_min = (x_clip_type == ATK_TEXT_CLIP_MIN ||
+                 x_clip_type == ATK_TEXT_CLIP_BOTH);
+   clip_x_max = (x_clip_type == ATK_TEXT_CLIP_MAX ||
+                 x_clip_type == ATK_TEXT_CLIP_BOTH);
+   clip_y_min = (y_clip_type == ATK_TEXT_CLIP_MIN ||
+                 y_clip_type == ATK_TEXT_CLIP_BOTH);
+   clip_y_max = (y_clip_type == ATK_TEXT_CLIP_MAX ||
+                 y_clip_type == ATK_TEXT_CLIP_BOTH);
+
+   /* rectangle in textblock coordinates */
+   _eail_text_lines_origin_get(textblock, coords, &ox, &oy);
+   rx1 = rect->x - ox;
+   ry1 = rect->y - oy;
+   rx2 = rx1 + rect->width;
+   ry2 = ry1 + rect->height;
+
+   for (i = 0; i < tl->lines->len; ++i)
+     {
+        const EailTextLine *line = &g_array_index(tl->lines, EailTextLine, i);
+        AtkTextRectangle bounds = {0, 0, -1, -1};
+        gint first = -1, last = -1, pos;
+        AtkTextRange *range;
+
+        if (line->y + line->h <= ry1) continue;
+        if (line->y >= ry2) break;
+        if (clip_y_min && line->y < ry1) continue;
+        if (clip_y_max && line->y + line->h > ry2) continue;
+
+        evas_textblock_cursor_pos_set(tl->cur, line->start);
+        for (pos = line->start; pos < line->end; ++pos)
+          {
+             Evas_Coord cx, cy, cw, ch;
+
+             if (-1 == evas_textblock_cursor_char_geometry_get
+                 (tl->cur, &cx, &cy, &cw, &ch))
+               break;
+
+             if (cx + cw > rx1 && cx < rx2 &&
+                 !(clip_x_min && cx < rx1) &&
+                 !(clip_x_max && cx + cw > rx2))
+               {
+                  if (first < 0) first = pos;
+                  last = pos;
+                  _eail_text_rect_union(&bounds, cx, line->y, cw, line->h);
+               }
+
+             if (!evas_textblock_cursor_char_next(tl->cur)) break;
+          }
+
+        if (first < 0) continue;
+
+        if (!text)
+          text = evas_textblock_text_markup_to_utf8
+             (textblock, evas_object_textblock_text_markup_get(textblock));
+
+        range = g_new0(AtkTextRange, 1);
+        range->start_offset = first;
+        range->end_offset = last + 1;
+        range->bounds.x = bounds.x + ox;
+        range->bounds.y = bounds.y + oy;
+        range->bounds.width = bounds.width;
+        range->bounds.height = bounds.height;
+        range->content = text ? g_utf8_substring(text, first, last + 1) :
+           g_strdup("");
+        g_ptr_array_add(ranges, range);
+     }
+
+   free(text);
+
+   g_ptr_array_add(ranges, NULL);
+   return (AtkTextRange **)g_ptr_array_free(ranges, FALSE);
+}
+
+/**
+ * @returns number of line tables built from scratch since start-up
+ */
+guint
+eail_text_lines_get_build_count(void)
+{
+   return eail_text_lines_builds;
+}
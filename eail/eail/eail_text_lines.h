@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2013 Samsung Electronics Co., Ltd.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/**
+ * @file eail_text_lines.h
+ *
+ * @brief Header for cached line geometry of textblocks
+ */
+
+#ifndef EAIL_TEXT_LINES_H
+#define EAIL_TEXT_LINES_H
+
+#include <atk/atk.h>
+#include <Evas.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Marks cached line geometry of textblock as outdated
+ *
+ * Has to be called when content of textblock changes, before or after
+ * eail_text_lines_update.
+ */
+void eail_text_lines_invalidate(const Evas_Object *textblock);
+
+/**
+ * @brief Updates outdated line geometry after a single edit
+ */
+void eail_text_lines_update(const Evas_Object *textblock,
+                            gint pos,
+                            gint removed,
+                            gint inserted);
+
+/**
+ * @brief Gets number of characters in textblock
+ */
+gint eail_text_lines_get_length(const Evas_Object *textblock);
+
+/**
+ * @brief Gets offsets of the first and the last character of the line
+ * containing offset
+ */
+gboolean eail_text_lines_get_line(const Evas_Object *textblock,
+                                  gint offset,
+                                  gint *first,
+                                  gint *last);
+
+/**
+ * @brief Gets word and sentence boundary flags of textblock text
+ */
+const guint8 *eail_text_lines_get_breaks(const Evas_Object *textblock,
+                                         gint *length);
+
+/**
+ * @brief Gets the bounding box of the character at offset
+ */
+gboolean eail_text_get_character_extents(const Evas_Object *textblock,
+                                         gint offset,
+                                         gint *x,
+                                         gint *y,
+                                         gint *width,
+                                         gint *height,
+                                         AtkCoordType coords);
+
+/**
+ * @brief Gets the offset of the character located at given coordinates
+ */
+gint eail_text_get_offset_at_point(const Evas_Object *textblock,
+                                   gint x,
+                                   gint y,
+                                   AtkCoordType coords);
+
+/**
+ * @brief Gets the bounding box for text within the specified range
+ */
+void eail_text_get_range_extents(const Evas_Object *textblock,
+                                 gint start_offset,
+                                 gint end_offset,
+                                 AtkCoordType coords,
+                                 AtkTextRectangle *rect);
+
+/**
+ * @brief Gets the ranges of text inside given rectangle
+ */
+AtkTextRange **eail_text_get_bounded_ranges(const Evas_Object *textblock,
+                                            AtkTextRectangle *rect,
+                                            AtkCoordType coords,
+                                            AtkTextClipType x_clip_type,
+                                            AtkTextClipType y_clip_type);
+
+/**
+ * @brief Gets number of line tables built from scratch, for tests
+ */
+guint eail_text_lines_get_build_count(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
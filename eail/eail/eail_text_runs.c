@@ -0,0 +1,650 @@
+/*
+ * Copyright (c) 2013 Samsung Electronics Co., Ltd.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/**
+ * @file eail_text_runs.c
+ * @brief Implementation of text attribute runs
+ *
+ * Format nodes of a textblock are walked once and folded into a sorted table
+ * of runs, each holding the values of the supported attributes. Named tags
+ * (eg. "<b>" or theme specific "<hilight>") are resolved through the style
+ * of the textblock. Lookups by offset are binary searches over that table.
+ */
+
+#include <string.h>
+
+#include <atk/atk.h>
+#include <Evas.h>
+
+#include "eail_text_runs.h"
+#include "eail_attributes.h"
+#include "eail_priv.h"
+
+/**
+ * @brief Converter from textblock format value to ATK attribute value
+ *
+ * Returned string has to be interned.
+ */
+typedef const gchar *(*Eail_Text_Run_Value_Cb)(AtkTextAttribute attr,
+                                               const gchar *value);
+
+/** @brief Mapping of textblock format key to ATK text attribute */
+typedef struct _EailTextRunKey
+{
+   const gchar *key;/**< @brief textblock format key */
+   AtkTextAttribute attr;/**< @brief corresponding ATK attribute */
+   Eail_Text_Run_Value_Cb convert;/**< @brief value converter */
+} EailTextRunKey;
+
+static const gchar *_eail_text_run_plain(AtkTextAttribute attr,
+                                         const gchar *value);
+static const gchar *_eail_text_run_family(AtkTextAttribute attr,
+                                          const gchar *value);
+static const gchar *_eail_text_run_weight(AtkTextAttribute attr,
+                                          const gchar *value);
+static const gchar *_eail_text_run_style(AtkTextAttribute attr,
+                                         const gchar *value);
+static const gchar *_eail_text_run_color(AtkTextAttribute attr,
+                                         const gchar *value);
+static const gchar *_eail_text_run_underline(AtkTextAttribute attr,
+                                             const gchar *value);
+static const gchar *_eail_text_run_strikethrough(AtkTextAttribute attr,
+                                                 const gchar *value);
+static const gchar *_eail_text_run_justification(AtkTextAttribute attr,
+                                                 const gchar *value);
+
+/** @brief Textblock format keys reported as run attributes */
+static const EailTextRunKey eail_text_run_keys[] =
+{
+   {"font", ATK_TEXT_ATTR_FAMILY_NAME, _eail_text_run_family},
+   {"font_size", ATK_TEXT_ATTR_SIZE, _eail_text_run_plain},
+   {"font_weight", ATK_TEXT_ATTR_WEIGHT, _eail_text_run_weight},
+   {"font_style", ATK_TEXT_ATTR_STYLE, _eail_text_run_style},
+   {"color", ATK_TEXT_ATTR_FG_COLOR, _eail_text_run_color},
+   {"backing_color", ATK_TEXT_ATTR_BG_COLOR, _eail_text_run_color},
+   {"underline", ATK_TEXT_ATTR_UNDERLINE, _eail_text_run_underline},
+   {"strikethrough", ATK_TEXT_ATTR_STRIKETHROUGH,
+    _eail_text_run_strikethrough},
+   {"align", ATK_TEXT_ATTR_JUSTIFICATION, _eail_text_run_justification},
+   {"lang", ATK_TEXT_ATTR_LANGUAGE, _eail_text_run_plain}
+};
+
+/** @brief Number of supported textblock format keys */
+#define EAIL_TEXT_RUN_N_KEYS G_N_ELEMENTS(eail_text_run_keys)
+
+/**
+ * @brief Attribute values in effect for a range of text
+ *
+ * Values are interned strings, so states can be compared by pointers.
+ */
+typedef struct _EailTextRunState
+{
+   const gchar *values[G_N_ELEMENTS(eail_text_run_keys)];/**< @brief values */
+} EailTextRunState;
+
+/** @brief Single run of text with invariant attributes */
+typedef struct _EailTextRun
+{
+   gint start;/**< @brief offset of the first character of the run */
+   gint end;/**< @brief offset of the first character after the run */
+   EailTextRunState state;/**< @brief attributes of the run */
+   EailAttributes *attrs;/**< @brief shared attribute set of the run */
+} EailTextRun;
+
+/** @brief Definition of text attribute run table */
+struct _EailTextRuns
+{
+   GArray *runs;/**< @brief EailTextRun items sorted by start offset */
+   gint length;/**< @brief length of the text the table was built for */
+};
+
+/**
+ * @brief Passes format value as it is
+ *
+ * @param attr ATK text attribute
+ * @param value textblock format value
+ * @returns interned ATK attribute value
+ */
+static const gchar *
+_eail_text_run_plain(AtkTextAttribute attr, const gchar *value)
+{
+   return g_intern_string(value);
+}
+
+/**
+ * @brief Gets font family from font description (eg. "Sans:style=Bold")
+ *
+ * @param attr ATK text attribute
+ * @param value textblock format value
+ * @returns interned ATK attribute value
+ */
+static const gchar *
+_eail_text_run_family(AtkTextAttribute attr, const gchar *value)
+{
+   const gchar *result;
+   gchar *family;
+
+   family = g_strndup(value, strcspn(value, ":"));
+   result = g_intern_string(family);
+   g_free(family);
+
+   return result;
+}
+
+/**
+ * @brief Converts font weight name to numeric weight used by ATK
+ *
+ * @param attr ATK text attribute
+ * @param value textblock format value
+ * @returns interned ATK attribute value
+ */
+static const gchar *
+_eail_text_run_weight(AtkTextAttribute attr, const gchar *value)
+{
+   static const struct
+     {
+        const gchar *name;
+        const gchar *weight;
+     } weights[] =
+     {
+        {"thin", "100"}, {"ultralight", "200"}, {"extralight", "200"},
+        {"light", "300"}, {"book", "380"}, {"normal", "400"},
+        {"medium", "500"}, {"semibold", "600"}, {"bold", "700"},
+        {"ultrabold", "800"}, {"extrabold", "800"}, {"black", "900"},
+        {"extrablack", "950"}
+     };
+   guint i;
+
+   for (i = 0; i < G_N_ELEMENTS(weights); ++i)
+     if (!g_ascii_strcasecmp(value, weights[i].name))
+       return weights[i].weight;
+
+   return g_intern_string(value);
+}
+
+/**
+ * @brief Converts font style name to ATK style
+ *
+ * @param attr ATK text attribute
+ * @param value textblock format value
+ * @returns interned ATK attribute value
+ */
+static const gchar *
+_eail_text_run_style(AtkTextAttribute attr, const gchar *value)
+{
+   if (!g_ascii_strcasecmp(value, "italic"))
+     return atk_text_attribute_get_value(attr, 2);
+   else if (!g_ascii_strcasecmp(value, "oblique"))
+     return atk_text_attribute_get_value(attr, 1);
+
+   return atk_text_attribute_get_value(attr, 0);
+}
+
+/**
+ * @brief Converts textblock color (#rgb, #rgba, #rrggbb or #rrggbbaa) to
+ * "r,g,b" string with 16-bit components used by ATK
+ *
+ * @param attr ATK text attribute
+ * @param value textblock format value
+ * @returns interned ATK attribute value
+ */
+static const gchar *
+_eail_text_run_color(AtkTextAttribute attr, const gchar *value)
+{
+   guint components[3] = {0, 0, 0};
+   gchar buf[32];
+   gsize len, i;
+
+   if (value[0] != '#')
+     return g_intern_string(value);
+
+   value++;
+   len = strlen(value);
+
+   for (i = 0; i < 3; ++i)
+     {
+        if (len == 3 || len == 4)
+          components[i] = g_ascii_xdigit_value(value[i]) * 0x11;
+        else if (len == 6 || len == 8)
+          components[i] = g_ascii_xdigit_value(value[2 * i]) * 16 +
+             g_ascii_xdigit_value(value[2 * i + 1]);
+        else
+          return NULL;
+     }
+
+   g_snprintf(buf, sizeof(buf), "%u,%u,%u", components[0] * 257,
+              components[1] * 257, components[2] * 257);
+
+   return g_intern_string(buf);
+}
+
+/**
+ * @brief Converts textblock underline value to ATK underline
+ *
+ * @param attr ATK text attribute
+ * @param value textblock format value
+ * @returns interned ATK attribute value
+ */
+static const gchar *
+_eail_text_run_underline(AtkTextAttribute attr, const gchar *value)
+{
+   if (!strcmp(value, "double"))
+     return atk_text_attribute_get_value(attr, 2);
+   else if (!strcmp(value, "on") || !strcmp(value, "single"))
+     return atk_text_attribute_get_value(attr, 1);
+
+   return atk_text_attribute_get_value(attr, 0);
+}
+
+/**
+ * @brief Converts textblock strikethrough value to ATK strikethrough
+ *
+ * @param attr ATK text attribute
+ * @param value textblock format value
+ * @returns interned ATK attribute value
+ */
+static const gchar *
+_eail_text_run_strikethrough(AtkTextAttribute attr, const gchar *value)
+{
+   return atk_text_attribute_get_value(attr, !strcmp(value, "on"));
+}
+
+/**
+ * @brief Converts textblock align value to ATK justification
+ *
+ * @param attr ATK text attribute
+ * @param value textblock format value
+ * @returns interned ATK attribute value
+ */
+static const gchar *
+_eail_text_run_justification(AtkTextAttribute attr, const gchar *value)
+{
+   if (!strcmp(value, "right"))
+     return atk_text_attribute_get_value(attr, 1);
+   else if (!strcmp(value, "center") || !strcmp(value, "middle"))
+     return atk_text_attribute_get_value(attr, 2);
+
+   return atk_text_attribute_get_value(attr, 0);
+}
+
+/**
+ * @brief Applies single "key=value" format parameter to state
+ *
+ * @param state EailTextRunState to be modified
+ * @param key format key
+ * @param value format value
+ */
+static void
+_eail_text_run_state_apply(EailTextRunState *state,
+                           const gchar *key,
+                           const gchar *value)
+{
+   guint i;
+
+   for (i = 0; i < EAIL_TEXT_RUN_N_KEYS; ++i)
+     {
+        if (strcmp(key, eail_text_run_keys[i].key)) continue;
+
+        state->values[i] = eail_text_run_keys[i].convert
+           (eail_text_run_keys[i].attr, value);
+        return;
+     }
+}
+
+/**
+ * @brief Reads next parameter of format string
+ *
+ * Parameters are either "key=value" pairs (value may be quoted) or bare
+ * words, which name style tags (eg. "b" for "<b>").
+ *
+ * @param p position in format string
+ * @param key GString to store parameter key in
+ * @param value GString to store parameter value in, empty for bare words
+ *
+ * @returns position after the parameter
+ */
+static const gchar *
+_eail_text_run_format_next(const gchar *p, GString *key, GString *value)
+{
+   gchar quote = '\0';
+
+   g_string_truncate(key, 0);
+   g_string_truncate(value, 0);
+
+   while (*p == ' ') p++;
+
+   while (*p && *p != '=' && *p != ' ')
+     g_string_append_c(key, *p++);
+
+   if (*p != '=') return p;
+   p++;
+
+   if (*p == '\'' || *p == '"') quote = *p++;
+
+   while (*p && (quote ? *p != quote : *p != ' '))
+     {
+        if (*p == '\\' && p[1]) p++;
+        g_string_append_c(value, *p++);
+     }
+   if (quote && *p) p++;
+
+   return p;
+}
+
+/**
+ * @brief Builds table of style tags of a textblock
+ *
+ * Style string (eg. "DEFAULT='font=Sans' b='+ font_weight=Bold'") maps tag
+ * names to formats, which are applied when the tag is pushed.
+ *
+ * @param textblock Evas textblock
+ *
+ * @returns GHashTable mapping tag names to formats, NULL if textblock has
+ * no style
+ */
+static GHashTable *
+_eail_text_run_tags_new(const Evas_Object *textblock)
+{
+   const Evas_Textblock_Style *ts;
+   const gchar *p;
+   GHashTable *tags;
+   GString *key, *value;
+
+   ts = evas_object_textblock_style_get(textblock);
+   if (!ts) return NULL;
+
+   p = evas_textblock_style_get(ts);
+   if (!p) return NULL;
+
+   tags = g_hash_table_new_full(g_str_hash, g_str_equal, g_free, g_free);
+   key = g_string_new(NULL);
+   value = g_string_new(NULL);
+
+   while (*p)
+     {
+        const gchar *format;
+
+        p = _eail_text_run_format_next(p, key, value);
+        if (!key->len || !value->len) continue;
+
+        /* formats of tags are written with or without push prefix */
+        format = value->str;
+        if (*format == '+') format++;
+
+        g_hash_table_replace(tags, g_strdup(key->str), g_strdup(format));
+     }
+
+   g_string_free(key, TRUE);
+   g_string_free(value, TRUE);
+
+   return tags;
+}
+
+/**
+ * @brief Parses format string (eg. "font_weight=Bold color='#f00'" or "b")
+ * and applies its parameters to state
+ *
+ * @param state EailTextRunState to be modified
+ * @param format format string without '+' prefix
+ * @param tags style tags of the textblock used to resolve bare words, NULL
+ * when tags are not resolved
+ */
+static void
+_eail_text_run_state_parse(EailTextRunState *state,
+                           const gchar *format,
+                           GHashTable *tags)
+{
+   const gchar *p = format;
+   GString *key = g_string_new(NULL);
+   GString *value = g_string_new(NULL);
+
+   while (*p)
+     {
+        p = _eail_text_run_format_next(p, key, value);
+        if (!key->len) continue;
+
+        if (value->len)
+          _eail_text_run_state_apply(state, key->str, value->str);
+        else if (tags)
+          {
+             const gchar *tag_format = g_hash_table_lookup(tags, key->str);
+
+             /* formats of tags do not refer to other tags */
+             if (tag_format)
+               _eail_text_run_state_parse(state, tag_format, NULL);
+          }
+     }
+
+   g_string_free(key, TRUE);
+   g_string_free(value, TRUE);
+}
+
+/**
+ * @brief Gets shared attribute set for run state
+ *
+ * Runs with equal attributes, in this and other textblocks, share one
+ * refcounted set.
+ *
+ * @param state attributes of the run
+ * @returns EailAttributes with a new reference
+ */
+static EailAttributes *
+_eail_text_run_state_intern(const EailTextRunState *state)
+{
+   const gchar *pairs[2 * EAIL_TEXT_RUN_N_KEYS];
+   guint i;
+
+   for (i = 0; i < EAIL_TEXT_RUN_N_KEYS; ++i)
+     {
+        pairs[2 * i] = atk_text_attribute_get_name(eail_text_run_keys[i].attr);
+        pairs[2 * i + 1] = state->values[i];
+     }
+
+   return eail_attributes_intern_pairs(pairs, EAIL_TEXT_RUN_N_KEYS);
+}
+
+/**
+ * @brief Appends run to the table, merging it with the previous one when
+ * attributes are the same
+ *
+ * @param runs GArray of EailTextRun items
+ * @param start offset of the first character of the run
+ * @param end offset of the first character after the run
+ * @param state attributes of the run
+ */
+static void
+_eail_text_runs_append(GArray *runs,
+                       gint start,
+                       gint end,
+                       const EailTextRunState *state)
+{
+   EailTextRun run;
+
+   if (end <= start) return;
+
+   if (runs->len > 0)
+     {
+        EailTextRun *last = &g_array_index(runs, EailTextRun, runs->len - 1);
+
+        if (!memcmp(&last->state, state, sizeof(EailTextRunState)))
+          {
+             last->end = end;
+             return;
+          }
+     }
+
+   run.start = start;
+   run.end = end;
+   run.state = *state;
+   run.attrs = _eail_text_run_state_intern(state);
+   g_array_append_val(runs, run);
+}
+
+/**
+ * @param textblock Evas textblock
+ * @param length length of the text in characters
+ *
+ * @returns EailTextRuns table, free with eail_text_runs_free
+ */
+EailTextRuns *
+eail_text_runs_new(const Evas_Object *textblock, gint length)
+{
+   const Evas_Object_Textblock_Node_Format *node;
+   Evas_Textblock_Cursor *cur = NULL;
+   EailTextRuns *runs;
+   GArray *stack;
+   GHashTable *tags = NULL;
+   EailTextRunState state;
+   gint run_start = 0;
+
+   runs = g_new0(EailTextRuns, 1);
+   runs->runs = g_array_new(FALSE, FALSE, sizeof(EailTextRun));
+   runs->length = length;
+
+   memset(&state, 0, sizeof(state));
+   stack = g_array_new(FALSE, FALSE, sizeof(EailTextRunState));
+
+   if (textblock)
+     {
+        cur = evas_object_textblock_cursor_new(textblock);
+        tags = _eail_text_run_tags_new(textblock);
+        node = evas_textblock_node_format_first_get(textblock);
+     }
+   else
+     node = NULL;
+
+   for (; node && cur; node = evas_textblock_node_format_next_get(node))
+     {
+        const char *format = evas_textblock_node_format_text_get(node);
+        gint pos;
+
+        /* only push ('+') and pop ('-') nodes change attributes */
+        if (!format || (format[0] != '+' && format[0] != '-')) continue;
+
+        evas_textblock_cursor_at_format_set(cur, node);
+        pos = CLAMP(evas_textblock_cursor_pos_get(cur), 0, length);
+
+        if (pos > run_start)
+          {
+             _eail_text_runs_append(runs->runs, run_start, pos, &state);
+             run_start = pos;
+          }
+
+        if (format[0] == '+')
+          {
+             g_array_append_val(stack, state);
+             _eail_text_run_state_parse(&state, format + 1, tags);
+          }
+        else if (stack->len > 0)
+          {
+             state = g_array_index(stack, EailTextRunState, stack->len - 1);
+             g_array_set_size(stack, stack->len - 1);
+          }
+     }
+
+   _eail_text_runs_append(runs->runs, run_start, length, &state);
+
+   if (cur) evas_textblock_cursor_free(cur);
+   if (tags) g_hash_table_destroy(tags);
+   g_array_free(stack, TRUE);
+
+   DBG("Built %u attribute runs for %d characters", runs->runs->len, length);
+
+   return runs;
+}
+
+/**
+ * @param runs EailTextRuns table
+ *
+ * @returns length of the text in characters
+ */
+gint
+eail_text_runs_get_length(const EailTextRuns *runs)
+{
+   g_return_val_if_fail(runs, -1);
+
+   return runs->length;
+}
+
+/**
+ * @param runs EailTextRuns table
+ * @param attrib_set AtkAttributeSet to add the attributes to
+ * @param offset character offset
+ * @param [out] start_offset start offset of the run
+ * @param [out] end_offset offset of the first character after the run
+ *
+ * @returns AtkAttributeSet with attributes of the run added, or attrib_set
+ * with offsets set to -1 if offset is out of range
+ */
+AtkAttributeSet *
+eail_text_runs_get_attributes(const EailTextRuns *runs,
+                              AtkAttributeSet *attrib_set,
+                              gint offset,
+                              gint *start_offset,
+                              gint *end_offset)
+{
+   const EailTextRun *run = NULL;
+   guint low = 0, high;
+
+   *start_offset = -1;
+   *end_offset = -1;
+
+   g_return_val_if_fail(runs, attrib_set);
+
+   high = runs->runs->len;
+   while (low < high)
+     {
+        guint mid = low + (high - low) / 2;
+        const EailTextRun *cand = &g_array_index(runs->runs, EailTextRun, mid);
+
+        if (offset < cand->start)
+          high = mid;
+        else if (offset >= cand->end)
+          low = mid + 1;
+        else
+          {
+             run = cand;
+             break;
+          }
+     }
+
+   if (!run) return attrib_set;
+
+   *start_offset = run->start;
+   *end_offset = run->end;
+
+   return eail_attributes_add(run->attrs, attrib_set);
+}
+
+/**
+ * @param runs EailTextRuns table
+ */
+void
+eail_text_runs_free(EailTextRuns *runs)
+{
+   guint i;
+
+   if (!runs) return;
+
+   for (i = 0; i < runs->runs->len; ++i)
+     eail_attributes_unref(g_array_index(runs->runs, EailTextRun, i).attrs);
+
+   g_array_free(runs->runs, TRUE);
+   g_free(runs);
+}
@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2013 Samsung Electronics Co., Ltd.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/**
+ * @file eail_text_runs.h
+ *
+ * @brief Header for text attribute runs built from textblock format nodes
+ */
+
+#ifndef EAIL_TEXT_RUNS_H
+#define EAIL_TEXT_RUNS_H
+
+#include <atk/atk.h>
+#include <Evas.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief Definition of text attribute run table */
+typedef struct _EailTextRuns EailTextRuns;
+
+/**
+ * @brief Builds a table of attribute runs from textblock format nodes
+ *
+ * The table is sorted by offset and covers the whole text. It stays valid
+ * until the content of the textblock changes.
+ */
+EailTextRuns *eail_text_runs_new(const Evas_Object *textblock, gint length);
+
+/**
+ * @brief Gets the length of the text the run table was built for
+ */
+gint eail_text_runs_get_length(const EailTextRuns *runs);
+
+/**
+ * @brief Adds attributes of the run containing offset to attribute set
+ */
+AtkAttributeSet *eail_text_runs_get_attributes(const EailTextRuns *runs,
+                                               AtkAttributeSet *attrib_set,
+                                               gint offset,
+                                               gint *start_offset,
+                                               gint *end_offset);
+
+/**
+ * @brief Frees run table
+ */
+void eail_text_runs_free(EailTextRuns *runs);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
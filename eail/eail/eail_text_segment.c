@@ -0,0 +1,496 @@
+/*
+ * Copyright (c) 2013 Samsung Electronics Co., Ltd.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/**
+ * @file eail_text_segment.c
+ * @brief Implementation of word and sentence segmentation
+ *
+ * Word and sentence boundaries follow Unicode Standard Annex #29 (rules
+ * WB1-WB999 and SB1-SB998, without the WB3c emoji rule). Property values
+ * come from static range tables generated by eail_text_segment_gen.pl.
+ *
+ * Scripts written without spaces need a dictionary to be split into words,
+ * which UAX #29 leaves to tailoring. Two cheap approximations are used
+ * instead: a run of letters of Thai, Lao, Khmer, Myanmar and Tai scripts
+ * forms a single word (usually a phrase), while Han, Hiragana and other
+ * ideographic characters form one-character words as the default rules
+ * prescribe.
+ */
+
+#include "eail_text_segment.h"
+
+/** @brief Range of code points sharing a property value */
+typedef struct _EailSegmentRange
+{
+   guint32 first;/**< @brief first code point of the range */
+   guint16 length;/**< @brief number of code points in the range */
+   guint8 value;/**< @brief property value */
+} EailSegmentRange;
+
+/**
+ * @enum EAIL_WB Word_Break property values
+ */
+enum EAIL_WB
+{
+   EAIL_WB_OTHER,
+   EAIL_WB_CR,
+   EAIL_WB_LF,
+   EAIL_WB_NEWLINE,
+   EAIL_WB_EXTEND,
+   EAIL_WB_ZWJ,
+   EAIL_WB_REGIONAL_INDICATOR,
+   EAIL_WB_FORMAT,
+   EAIL_WB_KATAKANA,
+   EAIL_WB_HEBREW_LETTER,
+   EAIL_WB_ALETTER,
+   EAIL_WB_SINGLE_QUOTE,
+   EAIL_WB_DOUBLE_QUOTE,
+   EAIL_WB_MIDNUMLET,
+   EAIL_WB_MIDLETTER,
+   EAIL_WB_MIDNUM,
+   EAIL_WB_NUMERIC,
+   EAIL_WB_EXTENDNUMLET,
+   EAIL_WB_WSEGSPACE,
+   /* not a Word_Break value, letters of scripts written without spaces */
+   EAIL_WB_COMPLEX_CONTEXT
+};
+
+/**
+ * @enum EAIL_SB Sentence_Break property values
+ */
+enum EAIL_SB
+{
+   EAIL_SB_OTHER,
+   EAIL_SB_CR,
+   EAIL_SB_LF,
+   EAIL_SB_EXTEND,
+   EAIL_SB_SEP,
+   EAIL_SB_FORMAT,
+   EAIL_SB_SP,
+   EAIL_SB_LOWER,
+   EAIL_SB_UPPER,
+   EAIL_SB_OLETTER,
+   EAIL_SB_NUMERIC,
+   EAIL_SB_ATERM,
+   EAIL_SB_SCONTINUE,
+   EAIL_SB_STERM,
+   EAIL_SB_CLOSE
+};
+
+#include "eail_text_segment_tables.h"
+
+#define WB_IS_AHLETTER(p) \
+   ((p) == EAIL_WB_ALETTER || (p) == EAIL_WB_HEBREW_LETTER)
+#define WB_IS_MIDNUMLETQ(p) \
+   ((p) == EAIL_WB_MIDNUMLET || (p) == EAIL_WB_SINGLE_QUOTE)
+#define WB_IS_NEWLINE(p) \
+   ((p) == EAIL_WB_CR || (p) == EAIL_WB_LF || (p) == EAIL_WB_NEWLINE)
+#define WB_IS_IGNORABLE(p) \
+   ((p) == EAIL_WB_EXTEND || (p) == EAIL_WB_FORMAT || (p) == EAIL_WB_ZWJ)
+
+#define SB_IS_PARASEP(p) \
+   ((p) == EAIL_SB_SEP || (p) == EAIL_SB_CR || (p) == EAIL_SB_LF)
+#define SB_IS_SATERM(p) ((p) == EAIL_SB_STERM || (p) == EAIL_SB_ATERM)
+#define SB_IS_IGNORABLE(p) ((p) == EAIL_SB_EXTEND || (p) == EAIL_SB_FORMAT)
+
+/**
+ * @brief Gets property value of character from generated tables
+ *
+ * @param ranges property ranges sorted by code point
+ * @param n_ranges number of ranges
+ * @param ascii property values of ASCII characters
+ * @param c character
+ * @returns property value, 0 (Other) if character is not in the tables
+ */
+static guint8
+_eail_segment_lookup(const EailSegmentRange *ranges,
+                     guint n_ranges,
+                     const guint8 *ascii,
+                     gunichar c)
+{
+   guint low = 0, high = n_ranges;
+
+   if (c < 128) return ascii[c];
+
+   while (low < high)
+     {
+        guint mid = low + (high - low) / 2;
+
+        if (c < ranges[mid].first)
+          high = mid;
+        else if (c >= ranges[mid].first + ranges[mid].length)
+          low = mid + 1;
+        else
+          return ranges[mid].value;
+     }
+
+   return 0;
+}
+
+/**
+ * @brief Gets word property of character
+ *
+ * Letters of scripts written without spaces between words have no
+ * Word_Break value of their own, they get EAIL_WB_COMPLEX_CONTEXT so that
+ * their runs are kept together.
+ *
+ * @param c character
+ * @returns EAIL_WB value
+ */
+static guint8
+_eail_segment_word_property(gunichar c)
+{
+   guint8 wb = _eail_segment_lookup(eail_word_break_ranges,
+                                    G_N_ELEMENTS(eail_word_break_ranges),
+                                    eail_word_break_ascii, c);
+
+   if (wb != EAIL_WB_OTHER || c < 128 || !g_unichar_isalpha(c)) return wb;
+
+   switch (g_unichar_get_script(c))
+     {
+      case G_UNICODE_SCRIPT_THAI:
+      case G_UNICODE_SCRIPT_LAO:
+      case G_UNICODE_SCRIPT_KHMER:
+      case G_UNICODE_SCRIPT_MYANMAR:
+      case G_UNICODE_SCRIPT_TAI_LE:
+      case G_UNICODE_SCRIPT_NEW_TAI_LUE:
+      case G_UNICODE_SCRIPT_TAI_THAM:
+      case G_UNICODE_SCRIPT_TAI_VIET:
+        return EAIL_WB_COMPLEX_CONTEXT;
+
+      default:
+        return wb;
+     }
+}
+
+/**
+ * @brief Finds the character that Extend/Format characters ending at i are
+ * attached to (rules WB4 and SB5)
+ *
+ * @param props property values
+ * @param i index of the last character
+ * @param is_sep TRUE if checking sentence properties, FALSE for words
+ * @returns index of the effective character
+ */
+static gint
+_eail_segment_skip_back(const guint8 *props, gint i, gboolean is_sep)
+{
+   gint k = i;
+
+   if (is_sep)
+     {
+        while (k > 0 && SB_IS_IGNORABLE(props[k])) k--;
+        if (k < i && SB_IS_PARASEP(props[k])) return k + 1;
+     }
+   else
+     {
+        while (k > 0 && WB_IS_IGNORABLE(props[k])) k--;
+        if (k < i && WB_IS_NEWLINE(props[k])) return k + 1;
+     }
+
+   return k;
+}
+
+/**
+ * @brief Checks whether there is a word boundary before character i
+ *
+ * @param wb Word_Break values of the text
+ * @param n text length
+ * @param i character index, 0 < i < n
+ * @returns TRUE if there is a boundary, FALSE otherwise
+ */
+static gboolean
+_eail_segment_is_word_break(const guint8 *wb, gint n, gint i)
+{
+   guint8 a = wb[i - 1], b = wb[i];
+   guint8 l, ll, rr;
+   gint li, k;
+
+   /* WB3 - WB3b */
+   if (a == EAIL_WB_CR && b == EAIL_WB_LF) return FALSE;
+   if (WB_IS_NEWLINE(a) || WB_IS_NEWLINE(b)) return TRUE;
+
+   /* WB3d, WB4 */
+   if (a == EAIL_WB_WSEGSPACE && b == EAIL_WB_WSEGSPACE) return FALSE;
+   if (WB_IS_IGNORABLE(b)) return FALSE;
+
+   li = _eail_segment_skip_back(wb, i - 1, FALSE);
+   l = wb[li];
+   ll = li > 0 ? wb[_eail_segment_skip_back(wb, li - 1, FALSE)] :
+      EAIL_WB_OTHER;
+   for (k = i + 1; k < n && WB_IS_IGNORABLE(wb[k]); ++k);
+   rr = k < n ? wb[k] : EAIL_WB_OTHER;
+
+   /* WB5 - WB7 */
+   if (WB_IS_AHLETTER(l) && WB_IS_AHLETTER(b)) return FALSE;
+   if (WB_IS_AHLETTER(l) && WB_IS_AHLETTER(rr) &&
+       (b == EAIL_WB_MIDLETTER || WB_IS_MIDNUMLETQ(b)))
+     return FALSE;
+   if (WB_IS_AHLETTER(ll) && WB_IS_AHLETTER(b) &&
+       (l == EAIL_WB_MIDLETTER || WB_IS_MIDNUMLETQ(l)))
+     return FALSE;
+
+   /* WB7a - WB7c */
+   if (l == EAIL_WB_HEBREW_LETTER && b == EAIL_WB_SINGLE_QUOTE) return FALSE;
+   if (l == EAIL_WB_HEBREW_LETTER && b == EAIL_WB_DOUBLE_QUOTE &&
+       rr == EAIL_WB_HEBREW_LETTER)
+     return FALSE;
+   if (ll == EAIL_WB_HEBREW_LETTER && l == EAIL_WB_DOUBLE_QUOTE &&
+       b == EAIL_WB_HEBREW_LETTER)
+     return FALSE;
+
+   /* no dictionary, runs of letters written without spaces stay together */
+   if (l == EAIL_WB_COMPLEX_CONTEXT && b == EAIL_WB_COMPLEX_CONTEXT)
+     return FALSE;
+
+   /* WB8 - WB12 */
+   if (l == EAIL_WB_NUMERIC && b == EAIL_WB_NUMERIC) return FALSE;
+   if (WB_IS_AHLETTER(l) && b == EAIL_WB_NUMERIC) return FALSE;
+   if (l == EAIL_WB_NUMERIC && WB_IS_AHLETTER(b)) return FALSE;
+   if (ll == EAIL_WB_NUMERIC && b == EAIL_WB_NUMERIC &&
+       (l == EAIL_WB_MIDNUM || WB_IS_MIDNUMLETQ(l)))
+     return FALSE;
+   if (l == EAIL_WB_NUMERIC && rr == EAIL_WB_NUMERIC &&
+       (b == EAIL_WB_MIDNUM || WB_IS_MIDNUMLETQ(b)))
+     return FALSE;
+
+   /* WB13 - WB13b */
+   if (l == EAIL_WB_KATAKANA && b == EAIL_WB_KATAKANA) return FALSE;
+   if (b == EAIL_WB_EXTENDNUMLET &&
+       (WB_IS_AHLETTER(l) || l == EAIL_WB_NUMERIC ||
+        l == EAIL_WB_KATAKANA || l == EAIL_WB_EXTENDNUMLET))
+     return FALSE;
+   if (l == EAIL_WB_EXTENDNUMLET &&
+       (WB_IS_AHLETTER(b) || b == EAIL_WB_NUMERIC || b == EAIL_WB_KATAKANA))
+     return FALSE;
+
+   /* WB15, WB16 - regional indicators pair up */
+   if (l == EAIL_WB_REGIONAL_INDICATOR && b == EAIL_WB_REGIONAL_INDICATOR)
+     {
+        gint count = 0;
+
+        for (k = li; k >= 0 && wb[k] == EAIL_WB_REGIONAL_INDICATOR;
+             k = k > 0 ? _eail_segment_skip_back(wb, k - 1, FALSE) : -1)
+          count++;
+
+        if (count % 2) return FALSE;
+     }
+
+   /* WB999 */
+   return TRUE;
+}
+
+/**
+ * @brief Checks whether there is a sentence boundary before character i
+ *
+ * @param sb Sentence_Break values of the text
+ * @param n text length
+ * @param i character index, 0 < i < n
+ * @returns TRUE if there is a boundary, FALSE otherwise
+ */
+static gboolean
+_eail_segment_is_sentence_break(const guint8 *sb, gint n, gint i)
+{
+   guint8 a = sb[i - 1], b = sb[i];
+   gboolean has_sp = FALSE;
+   gint li, k;
+
+   /* SB3 - SB5 */
+   if (a == EAIL_SB_CR && b == EAIL_SB_LF) return FALSE;
+   if (SB_IS_PARASEP(a)) return TRUE;
+   if (SB_IS_IGNORABLE(b)) return FALSE;
+
+   li = _eail_segment_skip_back(sb, i - 1, TRUE);
+
+   /* SB6, SB7 */
+   if (sb[li] == EAIL_SB_ATERM && b == EAIL_SB_NUMERIC) return FALSE;
+   if (sb[li] == EAIL_SB_ATERM && b == EAIL_SB_UPPER && li > 0)
+     {
+        guint8 ll = sb[_eail_segment_skip_back(sb, li - 1, TRUE)];
+
+        if (ll == EAIL_SB_UPPER || ll == EAIL_SB_LOWER) return FALSE;
+     }
+
+   /* match SATerm Close* Sp* before the position */
+   for (k = li; k >= 0 && sb[k] == EAIL_SB_SP;
+        k = k > 0 ? _eail_segment_skip_back(sb, k - 1, TRUE) : -1)
+     has_sp = TRUE;
+   for (; k >= 0 && sb[k] == EAIL_SB_CLOSE;
+        k = k > 0 ? _eail_segment_skip_back(sb, k - 1, TRUE) : -1);
+
+   /* SB998 */
+   if (k < 0 || !SB_IS_SATERM(sb[k])) return FALSE;
+
+   /* SB8 */
+   if (sb[k] == EAIL_SB_ATERM)
+     {
+        gint j;
+
+        for (j = i; j < n; ++j)
+          {
+             guint8 p = sb[j];
+
+             if (p == EAIL_SB_OLETTER || p == EAIL_SB_UPPER ||
+                 p == EAIL_SB_LOWER || SB_IS_PARASEP(p) || SB_IS_SATERM(p))
+               break;
+          }
+
+        if (j < n && sb[j] == EAIL_SB_LOWER) return FALSE;
+     }
+
+   /* SB8a - SB10 */
+   if (b == EAIL_SB_SCONTINUE || SB_IS_SATERM(b)) return FALSE;
+   if (!has_sp && (b == EAIL_SB_CLOSE || b == EAIL_SB_SP ||
+                   SB_IS_PARASEP(b)))
+     return FALSE;
+   if (b == EAIL_SB_SP || SB_IS_PARASEP(b)) return FALSE;
+
+   /* SB11 */
+   return TRUE;
+}
+
+/**
+ * @brief Checks whether a word segment holds a word, not spaces or
+ * punctuation
+ *
+ * @param chars text
+ * @param wb Word_Break values of the text
+ * @param start first character of the segment
+ * @param end character after the segment
+ * @returns TRUE if the segment is a word, FALSE otherwise
+ */
+static gboolean
+_eail_segment_is_word(const gunichar *chars,
+                      const guint8 *wb,
+                      gint start,
+                      gint end)
+{
+   gint i;
+
+   for (i = start; i < end; ++i)
+     {
+        if (WB_IS_AHLETTER(wb[i]) || wb[i] == EAIL_WB_NUMERIC ||
+            wb[i] == EAIL_WB_KATAKANA || wb[i] == EAIL_WB_COMPLEX_CONTEXT)
+          return TRUE;
+
+        if (wb[i] == EAIL_WB_OTHER && g_unichar_isalnum(chars[i]))
+          return TRUE;
+     }
+
+   return FALSE;
+}
+
+/**
+ * @brief Finds the end of sentence, that is the position before trailing
+ * spaces and paragraph separators of a sentence segment
+ *
+ * @param sb Sentence_Break values of the text
+ * @param start first character of the segment
+ * @param end character after the segment
+ * @returns end of sentence, equal to start if there is no sentence
+ */
+static gint
+_eail_segment_sentence_end(const guint8 *sb, gint start, gint end)
+{
+   gint j = end - 1;
+
+   while (j >= start)
+     {
+        gint k = _eail_segment_skip_back(sb, j, TRUE);
+
+        if (sb[k] != EAIL_SB_SP && !SB_IS_PARASEP(sb[k])) break;
+        j = k - 1;
+     }
+
+   return MAX(j + 1, start);
+}
+
+/**
+ * Text is walked once for each kind of boundaries. Flags are set for all
+ * positions from 0 up to and including the text length.
+ *
+ * Use g_free() to free the returned array.
+ *
+ * @param text UTF-8 text
+ * @param [out] length number of characters in text
+ *
+ * @returns newly allocated array of EAIL_TEXT_SEGMENT_FLAGS
+ */
+guint8 *
+eail_text_segment(const gchar *text, gint *length)
+{
+   gunichar *chars;
+   guint8 *wb, *sb, *flags;
+   glong n = 0;
+   gint i, start;
+
+   chars = g_utf8_to_ucs4_fast(text ? text : "", -1, &n);
+   wb = g_new(guint8, n + 1);
+   sb = g_new(guint8, n + 1);
+   flags = g_new0(guint8, n + 1);
+
+   for (i = 0; i < n; ++i)
+     {
+        wb[i] = _eail_segment_word_property(chars[i]);
+        sb[i] = _eail_segment_lookup(eail_sentence_break_ranges,
+                                     G_N_ELEMENTS(eail_sentence_break_ranges),
+                                     eail_sentence_break_ascii, chars[i]);
+     }
+
+   for (start = 0, i = 1; i <= n; ++i)
+     {
+        gint j;
+
+        if (i < n && !_eail_segment_is_word_break(wb, n, i)) continue;
+
+        if (_eail_segment_is_word(chars, wb, start, i))
+          {
+             flags[start] |= EAIL_TEXT_WORD_START;
+             flags[i] |= EAIL_TEXT_WORD_END;
+             for (j = start; j < i; ++j)
+               flags[j] |= EAIL_TEXT_IN_WORD;
+          }
+        start = i;
+     }
+
+   for (start = 0, i = 1; i <= n; ++i)
+     {
+        gint j, end;
+
+        if (i < n && !_eail_segment_is_sentence_break(sb, n, i)) continue;
+
+        end = _eail_segment_sentence_end(sb, start, i);
+        if (end > start)
+          {
+             flags[start] |= EAIL_TEXT_SENTENCE_START;
+             flags[end] |= EAIL_TEXT_SENTENCE_END;
+             for (j = start; j < end; ++j)
+               flags[j] |= EAIL_TEXT_IN_SENTENCE;
+          }
+        start = i;
+     }
+
+   g_free(chars);
+   g_free(wb);
+   g_free(sb);
+
+   *length = n;
+
+   return flags;
+}
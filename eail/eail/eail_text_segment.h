@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2013 Samsung Electronics Co., Ltd.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/**
+ * @file eail_text_segment.h
+ *
+ * @brief Header for word and sentence segmentation (UAX #29)
+ */
+
+#ifndef EAIL_TEXT_SEGMENT_H
+#define EAIL_TEXT_SEGMENT_H
+
+#include <glib.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @enum EAIL_TEXT_SEGMENT_FLAGS Flags describing text position
+ */
+enum EAIL_TEXT_SEGMENT_FLAGS
+{
+   EAIL_TEXT_WORD_START = 1 << 0,/**< position starts a word */
+   EAIL_TEXT_WORD_END = 1 << 1,/**< position follows a word */
+   EAIL_TEXT_IN_WORD = 1 << 2,/**< character belongs to a word */
+   EAIL_TEXT_SENTENCE_START = 1 << 3,/**< position starts a sentence */
+   /** position right after the terminator (and closing punctuation) of a
+    * sentence, trailing spaces and separators are not part of it */
+   EAIL_TEXT_SENTENCE_END = 1 << 4,
+   EAIL_TEXT_IN_SENTENCE = 1 << 5/**< character belongs to a sentence */
+};
+
+/**
+ * @brief Finds word and sentence boundaries in text
+ */
+guint8 *eail_text_segment(const gchar *text, gint *length);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
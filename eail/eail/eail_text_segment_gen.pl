@@ -0,0 +1,153 @@
+#!/usr/bin/perl
+#
+# Copyright (c) 2013 Samsung Electronics Co., Ltd.
+#
+# This library is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2 of the License, or (at your option) any later version.
+#
+# This library is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License
+# along with this library; see the file COPYING.LIB.  If not, write to
+# the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+# Boston, MA 02110-1301, USA.
+#
+# Generates eail_text_segment_tables.h with Word_Break and Sentence_Break
+# property tables (UAX #29) from the Unicode database shipped with perl.
+#
+# Usage: perl eail_text_segment_gen.pl > eail_text_segment_tables.h
+
+use strict;
+use warnings;
+use Unicode::UCD qw(prop_invmap);
+
+# UAX #29 WSegSpace: space separators which are not no-break spaces
+sub wb_hspace
+{
+   my $c = chr(shift);
+   return $c =~ /\p{Zs}/ && $c !~ /\p{Line_Break=Glue}/ ? 'WSegSpace' : 'Other';
+}
+
+# perl tailors some Word_Break values, map them back to UAX #29 ones;
+# code references map single code points
+my %wb_alias = (
+   'Perl_Tailored_HSpace' => \&wb_hspace,
+   'ExtPict_LE' => 'ALetter',
+   'ExtPict_XX' => 'Other',
+);
+
+my @wb_values = qw(Other CR LF Newline Extend ZWJ Regional_Indicator Format
+                   Katakana Hebrew_Letter ALetter Single_Quote Double_Quote
+                   MidNumLet MidLetter MidNum Numeric ExtendNumLet WSegSpace);
+
+my @sb_values = qw(Other CR LF Extend Sep Format Sp Lower Upper OLetter
+                   Numeric ATerm SContinue STerm Close);
+
+# longest range which fits into guint16 length field
+my $max_len = 0xFFFF;
+
+sub enum_name
+{
+   my ($prefix, $value) = @_;
+   return 'EAIL_' . $prefix . '_' . uc($value);
+}
+
+sub dump_property
+{
+   my ($property, $prefix, $name, $values, $alias) = @_;
+   my ($list, $map, $format, $default) = prop_invmap($property);
+   my %known = map { $_ => 1 } @$values;
+   my @ascii = ('Other') x 128;
+   my (@ranges, @list, @map);
+
+   # split ranges whose alias depends on the code point
+   for my $i (0 .. $#$list)
+     {
+        my $value = $map->[$i];
+        my $first = $list->[$i];
+        my $last = $i < $#$list ? $list->[$i + 1] - 1 : 0x10FFFF;
+
+        $value = $alias->{$value} if $alias && exists $alias->{$value};
+        if (ref $value eq 'CODE')
+          {
+             for my $c ($first .. $last)
+               {
+                  push @list, $c;
+                  push @map, $value->($c);
+               }
+             next;
+          }
+        push @list, $first;
+        push @map, $value;
+     }
+
+   for my $i (0 .. $#list)
+     {
+        my $value = $map[$i];
+        my $first = $list[$i];
+        my $last = $i < $#list ? $list[$i + 1] - 1 : 0x10FFFF;
+
+        die "Unknown $property value $value\n" unless $known{$value};
+        next if $value eq 'Other';
+
+        for my $c ($first .. ($last < 128 ? $last : 127))
+          {
+             $ascii[$c] = $value;
+          }
+
+        # merge with previous range if adjacent and of the same value
+        if (@ranges && $ranges[-1][2] eq $value &&
+            $ranges[-1][1] + 1 == $first)
+          {
+             $ranges[-1][1] = $last;
+             next;
+          }
+        push @ranges, [$first, $last, $value];
+     }
+
+   print "/** \@brief $property values of ASCII characters */\n";
+   print "static const guint8 ${name}_ascii[128] =\n{\n";
+   for (my $c = 0; $c < 128; $c += 4)
+     {
+        print "   ", join(", ", map { enum_name($prefix, $_) }
+                                  @ascii[$c .. $c + 3]), ",\n";
+     }
+   print "};\n\n";
+
+   my $count = 0;
+   print "/** \@brief $property ranges sorted by code point */\n";
+   print "static const EailSegmentRange ${name}_ranges[] =\n{\n";
+   for my $r (@ranges)
+     {
+        my ($first, $last, $value) = @$r;
+        while ($first <= $last)
+          {
+             my $len = $last - $first + 1;
+             $len = $max_len if $len > $max_len;
+             printf "   {0x%04X, %d, %s},\n", $first, $len,
+                    enum_name($prefix, $value);
+             $first += $len;
+             $count++;
+          }
+     }
+   print "};\n\n";
+
+   return $count;
+}
+
+print <<"EOF";
+/*
+ * This file is generated by eail_text_segment_gen.pl from Unicode
+ * ${\ Unicode::UCD::UnicodeVersion()} data, do not edit.
+ */
+
+EOF
+
+dump_property('Word_Break', 'WB', 'eail_word_break', \@wb_values,
+              \%wb_alias);
+dump_property('Sentence_Break', 'SB', 'eail_sentence_break', \@sb_values);
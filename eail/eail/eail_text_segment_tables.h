@@ -0,0 +1,3516 @@
+/*
+ * This file is generated by eail_text_segment_gen.pl from Unicode
+ * 14.0.0 data, do not edit.
+ */
+
+/** @brief Word_Break values of ASCII characters */
+static const guint8 eail_word_break_ascii[128] =
+{
+   EAIL_WB_OTHER, EAIL_WB_OTHER, EAIL_WB_OTHER, EAIL_WB_OTHER,
+   EAIL_WB_OTHER, EAIL_WB_OTHER, EAIL_WB_OTHER, EAIL_WB_OTHER,
+   EAIL_WB_OTHER, EAIL_WB_OTHER, EAIL_WB_LF, EAIL_WB_NEWLINE,
+   EAIL_WB_NEWLINE, EAIL_WB_CR, EAIL_WB_OTHER, EAIL_WB_OTHER,
+   EAIL_WB_OTHER, EAIL_WB_OTHER, EAIL_WB_OTHER, EAIL_WB_OTHER,
+   EAIL_WB_OTHER, EAIL_WB_OTHER, EAIL_WB_OTHER, EAIL_WB_OTHER,
+   EAIL_WB_OTHER, EAIL_WB_OTHER, EAIL_WB_OTHER, EAIL_WB_OTHER,
+   EAIL_WB_OTHER, EAIL_WB_OTHER, EAIL_WB_OTHER, EAIL_WB_OTHER,
+   EAIL_WB_WSEGSPACE, EAIL_WB_OTHER, EAIL_WB_DOUBLE_QUOTE, EAIL_WB_OTHER,
+   EAIL_WB_OTHER, EAIL_WB_OTHER, EAIL_WB_OTHER, EAIL_WB_SINGLE_QUOTE,
+   EAIL_WB_OTHER, EAIL_WB_OTHER, EAIL_WB_OTHER, EAIL_WB_OTHER,
+   EAIL_WB_MIDNUM, EAIL_WB_OTHER, EAIL_WB_MIDNUMLET, EAIL_WB_OTHER,
+   EAIL_WB_NUMERIC, EAIL_WB_NUMERIC, EAIL_WB_NUMERIC, EAIL_WB_NUMERIC,
+   EAIL_WB_NUMERIC, EAIL_WB_NUMERIC, EAIL_WB_NUMERIC, EAIL_WB_NUMERIC,
+   EAIL_WB_NUMERIC, EAIL_WB_NUMERIC, EAIL_WB_MIDLETTER, EAIL_WB_MIDNUM,
+   EAIL_WB_OTHER, EAIL_WB_OTHER, EAIL_WB_OTHER, EAIL_WB_OTHER,
+   EAIL_WB_OTHER, EAIL_WB_ALETTER, EAIL_WB_ALETTER, EAIL_WB_ALETTER,
+   EAIL_WB_ALETTER, EAIL_WB_ALETTER, EAIL_WB_ALETTER, EAIL_WB_ALETTER,
+   EAIL_WB_ALETTER, EAIL_WB_ALETTER, EAIL_WB_ALETTER, EAIL_WB_ALETTER,
+   EAIL_WB_ALETTER, EAIL_WB_ALETTER, EAIL_WB_ALETTER, EAIL_WB_ALETTER,
+   EAIL_WB_ALETTER, EAIL_WB_ALETTER, EAIL_WB_ALETTER, EAIL_WB_ALETTER,
+   EAIL_WB_ALETTER, EAIL_WB_ALETTER, EAIL_WB_ALETTER, EAIL_WB_ALETTER,
+   EAIL_WB_ALETTER, EAIL_WB_ALETTER, EAIL_WB_ALETTER, EAIL_WB_OTHER,
+   EAIL_WB_OTHER, EAIL_WB_OTHER, EAIL_WB_OTHER, EAIL_WB_EXTENDNUMLET,
+   EAIL_WB_OTHER, EAIL_WB_ALETTER, EAIL_WB_ALETTER, EAIL_WB_ALETTER,
+   EAIL_WB_ALETTER, EAIL_WB_ALETTER, EAIL_WB_ALETTER, EAIL_WB_ALETTER,
+   EAIL_WB_ALETTER, EAIL_WB_ALETTER, EAIL_WB_ALETTER, EAIL_WB_ALETTER,
+   EAIL_WB_ALETTER, EAIL_WB_ALETTER, EAIL_WB_ALETTER, EAIL_WB_ALETTER,
+   EAIL_WB_ALETTER, EAIL_WB_ALETTER, EAIL_WB_ALETTER, EAIL_WB_ALETTER,
+   EAIL_WB_ALETTER, EAIL_WB_ALETTER, EAIL_WB_ALETTER, EAIL_WB_ALETTER,
+   EAIL_WB_ALETTER, EAIL_WB_ALETTER, EAIL_WB_ALETTER, EAIL_WB_OTHER,
+   EAIL_WB_OTHER, EAIL_WB_OTHER, EAIL_WB_OTHER, EAIL_WB_OTHER,
+};
+
+/** @brief Word_Break ranges sorted by code point */
+static const EailSegmentRange eail_word_break_ranges[] =
+{
+   {0x000A, 1, EAIL_WB_LF},
+   {0x000B, 2, EAIL_WB_NEWLINE},
+   {0x000D, 1, EAIL_WB_CR},
+   {0x0020, 1, EAIL_WB_WSEGSPACE},
+   {0x0022, 1, EAIL_WB_DOUBLE_QUOTE},
+   {0x0027, 1, EAIL_WB_SINGLE_QUOTE},
+   {0x002C, 1, EAIL_WB_MIDNUM},
+   {0x002E, 1, EAIL_WB_MIDNUMLET},
+   {0x0030, 10, EAIL_WB_NUMERIC},
+   {0x003A, 1, EAIL_WB_MIDLETTER},
+   {0x003B, 1, EAIL_WB_MIDNUM},
+   {0x0041, 26, EAIL_WB_ALETTER},
+   {0x005F, 1, EAIL_WB_EXTENDNUMLET},
+   {0x0061, 26, EAIL_WB_ALETTER},
+   {0x0085, 1, EAIL_WB_NEWLINE},
+   {0x00AA, 1, EAIL_WB_ALETTER},
+   {0x00AD, 1, EAIL_WB_FORMAT},
+   {0x00B5, 1, EAIL_WB_ALETTER},
+   {0x00B7, 1, EAIL_WB_MIDLETTER},
+   {0x00BA, 1, EAIL_WB_ALETTER},
+   {0x00C0, 23, EAIL_WB_ALETTER},
+   {0x00D8, 31, EAIL_WB_ALETTER},
+   {0x00F8, 480, EAIL_WB_ALETTER},
+   {0x02DE, 34, EAIL_WB_ALETTER},
+   {0x0300, 112, EAIL_WB_EXTEND},
+   {0x0370, 5, EAIL_WB_ALETTER},
+   {0x0376, 2, EAIL_WB_ALETTER},
+   {0x037A, 4, EAIL_WB_ALETTER},
+   {0x037E, 1, EAIL_WB_MIDNUM},
+   {0x037F, 1, EAIL_WB_ALETTER},
+   {0x0386, 1, EAIL_WB_ALETTER},
+   {0x0387, 1, EAIL_WB_MIDLETTER},
+   {0x0388, 3, EAIL_WB_ALETTER},
+   {0x038C, 1, EAIL_WB_ALETTER},
+   {0x038E, 20, EAIL_WB_ALETTER},
+   {0x03A3, 83, EAIL_WB_ALETTER},
+   {0x03F7, 139, EAIL_WB_ALETTER},
+   {0x0483, 7, EAIL_WB_EXTEND},
+   {0x048A, 166, EAIL_WB_ALETTER},
+   {0x0531, 38, EAIL_WB_ALETTER},
+   {0x0559, 4, EAIL_WB_ALETTER},
+   {0x055E, 1, EAIL_WB_ALETTER},
+   {0x055F, 1, EAIL_WB_MIDLETTER},
+   {0x0560, 41, EAIL_WB_ALETTER},
+   {0x0589, 1, EAIL_WB_MIDNUM},
+   {0x058A, 1, EAIL_WB_ALETTER},
+   {0x0591, 45, EAIL_WB_EXTEND},
+   {0x05BF, 1, EAIL_WB_EXTEND},
+   {0x05C1, 2, EAIL_WB_EXTEND},
+   {0x05C4, 2, EAIL_WB_EXTEND},
+   {0x05C7, 1, EAIL_WB_EXTEND},
+   {0x05D0, 27, EAIL_WB_HEBREW_LETTER},
+   {0x05EF, 4, EAIL_WB_HEBREW_LETTER},
+   {0x05F3, 1, EAIL_WB_ALETTER},
+   {0x05F4, 1, EAIL_WB_MIDLETTER},
+   {0x0600, 6, EAIL_WB_FORMAT},
+   {0x060C, 2, EAIL_WB_MIDNUM},
+   {0x0610, 11, EAIL_WB_EXTEND},
+   {0x061C, 1, EAIL_WB_FORMAT},
+   {0x0620, 43, EAIL_WB_ALETTER},
+   {0x064B, 21, EAIL_WB_EXTEND},
+   {0x0660, 10, EAIL_WB_NUMERIC},
+   {0x066B, 1, EAIL_WB_NUMERIC},
+   {0x066C, 1, EAIL_WB_MIDNUM},
+   {0x066E, 2, EAIL_WB_ALETTER},
+   {0x0670, 1, EAIL_WB_EXTEND},
+   {0x0671, 99, EAIL_WB_ALETTER},
+   {0x06D5, 1, EAIL_WB_ALETTER},
+   {0x06D6, 7, EAIL_WB_EXTEND},
+   {0x06DD, 1, EAIL_WB_FORMAT},
+   {0x06DF, 6, EAIL_WB_EXTEND},
+   {0x06E5, 2, EAIL_WB_ALETTER},
+   {0x06E7, 2, EAIL_WB_EXTEND},
+   {0x06EA, 4, EAIL_WB_EXTEND},
+   {0x06EE, 2, EAIL_WB_ALETTER},
+   {0x06F0, 10, EAIL_WB_NUMERIC},
+   {0x06FA, 3, EAIL_WB_ALETTER},
+   {0x06FF, 1, EAIL_WB_ALETTER},
+   {0x070F, 1, EAIL_WB_FORMAT},
+   {0x0710, 1, EAIL_WB_ALETTER},
+   {0x0711, 1, EAIL_WB_EXTEND},
+   {0x0712, 30, EAIL_WB_ALETTER},
+   {0x0730, 27, EAIL_WB_EXTEND},
+   {0x074D, 89, EAIL_WB_ALETTER},
+   {0x07A6, 11, EAIL_WB_EXTEND},
+   {0x07B1, 1, EAIL_WB_ALETTER},
+   {0x07C0, 10, EAIL_WB_NUMERIC},
+   {0x07CA, 33, EAIL_WB_ALETTER},
+   {0x07EB, 9, EAIL_WB_EXTEND},
+   {0x07F4, 2, EAIL_WB_ALETTER},
+   {0x07F8, 1, EAIL_WB_MIDNUM},
+   {0x07FA, 1, EAIL_WB_ALETTER},
+   {0x07FD, 1, EAIL_WB_EXTEND},
+   {0x0800, 22, EAIL_WB_ALETTER},
+   {0x0816, 4, EAIL_WB_EXTEND},
+   {0x081A, 1, EAIL_WB_ALETTER},
+   {0x081B, 9, EAIL_WB_EXTEND},
+   {0x0824, 1, EAIL_WB_ALETTER},
+   {0x0825, 3, EAIL_WB_EXTEND},
+   {0x0828, 1, EAIL_WB_ALETTER},
+   {0x0829, 5, EAIL_WB_EXTEND},
+   {0x0840, 25, EAIL_WB_ALETTER},
+   {0x0859, 3, EAIL_WB_EXTEND},
+   {0x0860, 11, EAIL_WB_ALETTER},
+   {0x0870, 24, EAIL_WB_ALETTER},
+   {0x0889, 6, EAIL_WB_ALETTER},
+   {0x0890, 2, EAIL_WB_FORMAT},
+   {0x0898, 8, EAIL_WB_EXTEND},
+   {0x08A0, 42, EAIL_WB_ALETTER},
+   {0x08CA, 24, EAIL_WB_EXTEND},
+   {0x08E2, 1, EAIL_WB_FORMAT},
+   {0x08E3, 33, EAIL_WB_EXTEND},
+   {0x0904, 54, EAIL_WB_ALETTER},
+   {0x093A, 3, EAIL_WB_EXTEND},
+   {0x093D, 1, EAIL_WB_ALETTER},
+   {0x093E, 18, EAIL_WB_EXTEND},
+   {0x0950, 1, EAIL_WB_ALETTER},
+   {0x0951, 7, EAIL_WB_EXTEND},
+   {0x0958, 10, EAIL_WB_ALETTER},
+   {0x0962, 2, EAIL_WB_EXTEND},
+   {0x0966, 10, EAIL_WB_NUMERIC},
+   {0x0971, 16, EAIL_WB_ALETTER},
+   {0x0981, 3, EAIL_WB_EXTEND},
+   {0x0985, 8, EAIL_WB_ALETTER},
+   {0x098F, 2, EAIL_WB_ALETTER},
+   {0x0993, 22, EAIL_WB_ALETTER},
+   {0x09AA, 7, EAIL_WB_ALETTER},
+   {0x09B2, 1, EAIL_WB_ALETTER},
+   {0x09B6, 4, EAIL_WB_ALETTER},
+   {0x09BC, 1, EAIL_WB_EXTEND},
+   {0x09BD, 1, EAIL_WB_ALETTER},
+   {0x09BE, 7, EAIL_WB_EXTEND},
+   {0x09C7, 2, EAIL_WB_EXTEND},
+   {0x09CB, 3, EAIL_WB_EXTEND},
+   {0x09CE, 1, EAIL_WB_ALETTER},
+   {0x09D7, 1, EAIL_WB_EXTEND},
+   {0x09DC, 2, EAIL_WB_ALETTER},
+   {0x09DF, 3, EAIL_WB_ALETTER},
+   {0x09E2, 2, EAIL_WB_EXTEND},
+   {0x09E6, 10, EAIL_WB_NUMERIC},
+   {0x09F0, 2, EAIL_WB_ALETTER},
+   {0x09FC, 1, EAIL_WB_ALETTER},
+   {0x09FE, 1, EAIL_WB_EXTEND},
+   {0x0A01, 3, EAIL_WB_EXTEND},
+   {0x0A05, 6, EAIL_WB_ALETTER},
+   {0x0A0F, 2, EAIL_WB_ALETTER},
+   {0x0A13, 22, EAIL_WB_ALETTER},
+   {0x0A2A, 7, EAIL_WB_ALETTER},
+   {0x0A32, 2, EAIL_WB_ALETTER},
+   {0x0A35, 2, EAIL_WB_ALETTER},
+   {0x0A38, 2, EAIL_WB_ALETTER},
+   {0x0A3C, 1, EAIL_WB_EXTEND},
+   {0x0A3E, 5, EAIL_WB_EXTEND},
+   {0x0A47, 2, EAIL_WB_EXTEND},
+   {0x0A4B, 3, EAIL_WB_EXTEND},
+   {0x0A51, 1, EAIL_WB_EXTEND},
+   {0x0A59, 4, EAIL_WB_ALETTER},
+   {0x0A5E, 1, EAIL_WB_ALETTER},
+   {0x0A66, 10, EAIL_WB_NUMERIC},
+   {0x0A70, 2, EAIL_WB_EXTEND},
+   {0x0A72, 3, EAIL_WB_ALETTER},
+   {0x0A75, 1, EAIL_WB_EXTEND},
+   {0x0A81, 3, EAIL_WB_EXTEND},
+   {0x0A85, 9, EAIL_WB_ALETTER},
+   {0x0A8F, 3, EAIL_WB_ALETTER},
+   {0x0A93, 22, EAIL_WB_ALETTER},
+   {0x0AAA, 7, EAIL_WB_ALETTER},
+   {0x0AB2, 2, EAIL_WB_ALETTER},
+   {0x0AB5, 5, EAIL_WB_ALETTER},
+   {0x0ABC, 1, EAIL_WB_EXTEND},
+   {0x0ABD, 1, EAIL_WB_ALETTER},
+   {0x0ABE, 8, EAIL_WB_EXTEND},
+   {0x0AC7, 3, EAIL_WB_EXTEND},
+   {0x0ACB, 3, EAIL_WB_EXTEND},
+   {0x0AD0, 1, EAIL_WB_ALETTER},
+   {0x0AE0, 2, EAIL_WB_ALETTER},
+   {0x0AE2, 2, EAIL_WB_EXTEND},
+   {0x0AE6, 10, EAIL_WB_NUMERIC},
+   {0x0AF9, 1, EAIL_WB_ALETTER},
+   {0x0AFA, 6, EAIL_WB_EXTEND},
+   {0x0B01, 3, EAIL_WB_EXTEND},
+   {0x0B05, 8, EAIL_WB_ALETTER},
+   {0x0B0F, 2, EAIL_WB_ALETTER},
+   {0x0B13, 22, EAIL_WB_ALETTER},
+   {0x0B2A, 7, EAIL_WB_ALETTER},
+   {0x0B32, 2, EAIL_WB_ALETTER},
+   {0x0B35, 5, EAIL_WB_ALETTER},
+   {0x0B3C, 1, EAIL_WB_EXTEND},
+   {0x0B3D, 1, EAIL_WB_ALETTER},
+   {0x0B3E, 7, EAIL_WB_EXTEND},
+   {0x0B47, 2, EAIL_WB_EXTEND},
+   {0x0B4B, 3, EAIL_WB_EXTEND},
+   {0x0B55, 3, EAIL_WB_EXTEND},
+   {0x0B5C, 2, EAIL_WB_ALETTER},
+   {0x0B5F, 3, EAIL_WB_ALETTER},
+   {0x0B62, 2, EAIL_WB_EXTEND},
+   {0x0B66, 10, EAIL_WB_NUMERIC},
+   {0x0B71, 1, EAIL_WB_ALETTER},
+   {0x0B82, 1, EAIL_WB_EXTEND},
+   {0x0B83, 1, EAIL_WB_ALETTER},
+   {0x0B85, 6, EAIL_WB_ALETTER},
+   {0x0B8E, 3, EAIL_WB_ALETTER},
+   {0x0B92, 4, EAIL_WB_ALETTER},
+   {0x0B99, 2, EAIL_WB_ALETTER},
+   {0x0B9C, 1, EAIL_WB_ALETTER},
+   {0x0B9E, 2, EAIL_WB_ALETTER},
+   {0x0BA3, 2, EAIL_WB_ALETTER},
+   {0x0BA8, 3, EAIL_WB_ALETTER},
+   {0x0BAE, 12, EAIL_WB_ALETTER},
+   {0x0BBE, 5, EAIL_WB_EXTEND},
+   {0x0BC6, 3, EAIL_WB_EXTEND},
+   {0x0BCA, 4, EAIL_WB_EXTEND},
+   {0x0BD0, 1, EAIL_WB_ALETTER},
+   {0x0BD7, 1, EAIL_WB_EXTEND},
+   {0x0BE6, 10, EAIL_WB_NUMERIC},
+   {0x0C00, 5, EAIL_WB_EXTEND},
+   {0x0C05, 8, EAIL_WB_ALETTER},
+   {0x0C0E, 3, EAIL_WB_ALETTER},
+   {0x0C12, 23, EAIL_WB_ALETTER},
+   {0x0C2A, 16, EAIL_WB_ALETTER},
+   {0x0C3C, 1, EAIL_WB_EXTEND},
+   {0x0C3D, 1, EAIL_WB_ALETTER},
+   {0x0C3E, 7, EAIL_WB_EXTEND},
+   {0x0C46, 3, EAIL_WB_EXTEND},
+   {0x0C4A, 4, EAIL_WB_EXTEND},
+   {0x0C55, 2, EAIL_WB_EXTEND},
+   {0x0C58, 3, EAIL_WB_ALETTER},
+   {0x0C5D, 1, EAIL_WB_ALETTER},
+   {0x0C60, 2, EAIL_WB_ALETTER},
+   {0x0C62, 2, EAIL_WB_EXTEND},
+   {0x0C66, 10, EAIL_WB_NUMERIC},
+   {0x0C80, 1, EAIL_WB_ALETTER},
+   {0x0C81, 3, EAIL_WB_EXTEND},
+   {0x0C85, 8, EAIL_WB_ALETTER},
+   {0x0C8E, 3, EAIL_WB_ALETTER},
+   {0x0C92, 23, EAIL_WB_ALETTER},
+   {0x0CAA, 10, EAIL_WB_ALETTER},
+   {0x0CB5, 5, EAIL_WB_ALETTER},
+   {0x0CBC, 1, EAIL_WB_EXTEND},
+   {0x0CBD, 1, EAIL_WB_ALETTER},
+   {0x0CBE, 7, EAIL_WB_EXTEND},
+   {0x0CC6, 3, EAIL_WB_EXTEND},
+   {0x0CCA, 4, EAIL_WB_EXTEND},
+   {0x0CD5, 2, EAIL_WB_EXTEND},
+   {0x0CDD, 2, EAIL_WB_ALETTER},
+   {0x0CE0, 2, EAIL_WB_ALETTER},
+   {0x0CE2, 2, EAIL_WB_EXTEND},
+   {0x0CE6, 10, EAIL_WB_NUMERIC},
+   {0x0CF1, 2, EAIL_WB_ALETTER},
+   {0x0D00, 4, EAIL_WB_EXTEND},
+   {0x0D04, 9, EAIL_WB_ALETTER},
+   {0x0D0E, 3, EAIL_WB_ALETTER},
+   {0x0D12, 41, EAIL_WB_ALETTER},
+   {0x0D3B, 2, EAIL_WB_EXTEND},
+   {0x0D3D, 1, EAIL_WB_ALETTER},
+   {0x0D3E, 7, EAIL_WB_EXTEND},
+   {0x0D46, 3, EAIL_WB_EXTEND},
+   {0x0D4A, 4, EAIL_WB_EXTEND},
+   {0x0D4E, 1, EAIL_WB_ALETTER},
+   {0x0D54, 3, EAIL_WB_ALETTER},
+   {0x0D57, 1, EAIL_WB_EXTEND},
+   {0x0D5F, 3, EAIL_WB_ALETTER},
+   {0x0D62, 2, EAIL_WB_EXTEND},
+   {0x0D66, 10, EAIL_WB_NUMERIC},
+   {0x0D7A, 6, EAIL_WB_ALETTER},
+   {0x0D81, 3, EAIL_WB_EXTEND},
+   {0x0D85, 18, EAIL_WB_ALETTER},
+   {0x0D9A, 24, EAIL_WB_ALETTER},
+   {0x0DB3, 9, EAIL_WB_ALETTER},
+   {0x0DBD, 1, EAIL_WB_ALETTER},
+   {0x0DC0, 7, EAIL_WB_ALETTER},
+   {0x0DCA, 1, EAIL_WB_EXTEND},
+   {0x0DCF, 6, EAIL_WB_EXTEND},
+   {0x0DD6, 1, EAIL_WB_EXTEND},
+   {0x0DD8, 8, EAIL_WB_EXTEND},
+   {0x0DE6, 10, EAIL_WB_NUMERIC},
+   {0x0DF2, 2, EAIL_WB_EXTEND},
+   {0x0E31, 1, EAIL_WB_EXTEND},
+   {0x0E34, 7, EAIL_WB_EXTEND},
+   {0x0E47, 8, EAIL_WB_EXTEND},
+   {0x0E50, 10, EAIL_WB_NUMERIC},
+   {0x0EB1, 1, EAIL_WB_EXTEND},
+   {0x0EB4, 9, EAIL_WB_EXTEND},
+   {0x0EC8, 6, EAIL_WB_EXTEND},
+   {0x0ED0, 10, EAIL_WB_NUMERIC},
+   {0x0F00, 1, EAIL_WB_ALETTER},
+   {0x0F18, 2, EAIL_WB_EXTEND},
+   {0x0F20, 10, EAIL_WB_NUMERIC},
+   {0x0F35, 1, EAIL_WB_EXTEND},
+   {0x0F37, 1, EAIL_WB_EXTEND},
+   {0x0F39, 1, EAIL_WB_EXTEND},
+   {0x0F3E, 2, EAIL_WB_EXTEND},
+   {0x0F40, 8, EAIL_WB_ALETTER},
+   {0x0F49, 36, EAIL_WB_ALETTER},
+   {0x0F71, 20, EAIL_WB_EXTEND},
+   {0x0F86, 2, EAIL_WB_EXTEND},
+   {0x0F88, 5, EAIL_WB_ALETTER},
+   {0x0F8D, 11, EAIL_WB_EXTEND},
+   {0x0F99, 36, EAIL_WB_EXTEND},
+   {0x0FC6, 1, EAIL_WB_EXTEND},
+   {0x102B, 20, EAIL_WB_EXTEND},
+   {0x1040, 10, EAIL_WB_NUMERIC},
+   {0x1056, 4, EAIL_WB_EXTEND},
+   {0x105E, 3, EAIL_WB_EXTEND},
+   {0x1062, 3, EAIL_WB_EXTEND},
+   {0x1067, 7, EAIL_WB_EXTEND},
+   {0x1071, 4, EAIL_WB_EXTEND},
+   {0x1082, 12, EAIL_WB_EXTEND},
+   {0x108F, 1, EAIL_WB_EXTEND},
+   {0x1090, 10, EAIL_WB_NUMERIC},
+   {0x109A, 4, EAIL_WB_EXTEND},
+   {0x10A0, 38, EAIL_WB_ALETTER},
+   {0x10C7, 1, EAIL_WB_ALETTER},
+   {0x10CD, 1, EAIL_WB_ALETTER},
+   {0x10D0, 43, EAIL_WB_ALETTER},
+   {0x10FC, 333, EAIL_WB_ALETTER},
+   {0x124A, 4, EAIL_WB_ALETTER},
+   {0x1250, 7, EAIL_WB_ALETTER},
+   {0x1258, 1, EAIL_WB_ALETTER},
+   {0x125A, 4, EAIL_WB_ALETTER},
+   {0x1260, 41, EAIL_WB_ALETTER},
+   {0x128A, 4, EAIL_WB_ALETTER},
+   {0x1290, 33, EAIL_WB_ALETTER},
+   {0x12B2, 4, EAIL_WB_ALETTER},
+   {0x12B8, 7, EAIL_WB_ALETTER},
+   {0x12C0, 1, EAIL_WB_ALETTER},
+   {0x12C2, 4, EAIL_WB_ALETTER},
+   {0x12C8, 15, EAIL_WB_ALETTER},
+   {0x12D8, 57, EAIL_WB_ALETTER},
+   {0x1312, 4, EAIL_WB_ALETTER},
+   {0x1318, 67, EAIL_WB_ALETTER},
+   {0x135D, 3, EAIL_WB_EXTEND},
+   {0x1380, 16, EAIL_WB_ALETTER},
+   {0x13A0, 86, EAIL_WB_ALETTER},
+   {0x13F8, 6, EAIL_WB_ALETTER},
+   {0x1401, 620, EAIL_WB_ALETTER},
+   {0x166F, 17, EAIL_WB_ALETTER},
+   {0x1680, 1, EAIL_WB_WSEGSPACE},
+   {0x1681, 26, EAIL_WB_ALETTER},
+   {0x16A0, 75, EAIL_WB_ALETTER},
+   {0x16EE, 11, EAIL_WB_ALETTER},
+   {0x1700, 18, EAIL_WB_ALETTER},
+   {0x1712, 4, EAIL_WB_EXTEND},
+   {0x171F, 19, EAIL_WB_ALETTER},
+   {0x1732, 3, EAIL_WB_EXTEND},
+   {0x1740, 18, EAIL_WB_ALETTER},
+   {0x1752, 2, EAIL_WB_EXTEND},
+   {0x1760, 13, EAIL_WB_ALETTER},
+   {0x176E, 3, EAIL_WB_ALETTER},
+   {0x1772, 2, EAIL_WB_EXTEND},
+   {0x17B4, 32, EAIL_WB_EXTEND},
+   {0x17DD, 1, EAIL_WB_EXTEND},
+   {0x17E0, 10, EAIL_WB_NUMERIC},
+   {0x180B, 3, EAIL_WB_EXTEND},
+   {0x180E, 1, EAIL_WB_FORMAT},
+   {0x180F, 1, EAIL_WB_EXTEND},
+   {0x1810, 10, EAIL_WB_NUMERIC},
+   {0x1820, 89, EAIL_WB_ALETTER},
+   {0x1880, 5, EAIL_WB_ALETTER},
+   {0x1885, 2, EAIL_WB_EXTEND},
+   {0x1887, 34, EAIL_WB_ALETTER},
+   {0x18A9, 1, EAIL_WB_EXTEND},
+   {0x18AA, 1, EAIL_WB_ALETTER},
+   {0x18B0, 70, EAIL_WB_ALETTER},
+   {0x1900, 31, EAIL_WB_ALETTER},
+   {0x1920, 12, EAIL_WB_EXTEND},
+   {0x1930, 12, EAIL_WB_EXTEND},
+   {0x1946, 10, EAIL_WB_NUMERIC},
+   {0x19D0, 10, EAIL_WB_NUMERIC},
+   {0x1A00, 23, EAIL_WB_ALETTER},
+   {0x1A17, 5, EAIL_WB_EXTEND},
+   {0x1A55, 10, EAIL_WB_EXTEND},
+   {0x1A60, 29, EAIL_WB_EXTEND},
+   {0x1A7F, 1, EAIL_WB_EXTEND},
+   {0x1A80, 10, EAIL_WB_NUMERIC},
+   {0x1A90, 10, EAIL_WB_NUMERIC},
+   {0x1AB0, 31, EAIL_WB_EXTEND},
+   {0x1B00, 5, EAIL_WB_EXTEND},
+   {0x1B05, 47, EAIL_WB_ALETTER},
+   {0x1B34, 17, EAIL_WB_EXTEND},
+   {0x1B45, 8, EAIL_WB_ALETTER},
+   {0x1B50, 10, EAIL_WB_NUMERIC},
+   {0x1B6B, 9, EAIL_WB_EXTEND},
+   {0x1B80, 3, EAIL_WB_EXTEND},
+   {0x1B83, 30, EAIL_WB_ALETTER},
+   {0x1BA1, 13, EAIL_WB_EXTEND},
+   {0x1BAE, 2, EAIL_WB_ALETTER},
+   {0x1BB0, 10, EAIL_WB_NUMERIC},
+   {0x1BBA, 44, EAIL_WB_ALETTER},
+   {0x1BE6, 14, EAIL_WB_EXTEND},
+   {0x1C00, 36, EAIL_WB_ALETTER},
+   {0x1C24, 20, EAIL_WB_EXTEND},
+   {0x1C40, 10, EAIL_WB_NUMERIC},
+   {0x1C4D, 3, EAIL_WB_ALETTER},
+   {0x1C50, 10, EAIL_WB_NUMERIC},
+   {0x1C5A, 36, EAIL_WB_ALETTER},
+   {0x1C80, 9, EAIL_WB_ALETTER},
+   {0x1C90, 43, EAIL_WB_ALETTER},
+   {0x1CBD, 3, EAIL_WB_ALETTER},
+   {0x1CD0, 3, EAIL_WB_EXTEND},
+   {0x1CD4, 21, EAIL_WB_EXTEND},
+   {0x1CE9, 4, EAIL_WB_ALETTER},
+   {0x1CED, 1, EAIL_WB_EXTEND},
+   {0x1CEE, 6, EAIL_WB_ALETTER},
+   {0x1CF4, 1, EAIL_WB_EXTEND},
+   {0x1CF5, 2, EAIL_WB_ALETTER},
+   {0x1CF7, 3, EAIL_WB_EXTEND},
+   {0x1CFA, 1, EAIL_WB_ALETTER},
+   {0x1D00, 192, EAIL_WB_ALETTER},
+   {0x1DC0, 64, EAIL_WB_EXTEND},
+   {0x1E00, 278, EAIL_WB_ALETTER},
+   {0x1F18, 6, EAIL_WB_ALETTER},
+   {0x1F20, 38, EAIL_WB_ALETTER},
+   {0x1F48, 6, EAIL_WB_ALETTER},
+   {0x1F50, 8, EAIL_WB_ALETTER},
+   {0x1F59, 1, EAIL_WB_ALETTER},
+   {0x1F5B, 1, EAIL_WB_ALETTER},
+   {0x1F5D, 1, EAIL_WB_ALETTER},
+   {0x1F5F, 31, EAIL_WB_ALETTER},
+   {0x1F80, 53, EAIL_WB_ALETTER},
+   {0x1FB6, 7, EAIL_WB_ALETTER},
+   {0x1FBE, 1, EAIL_WB_ALETTER},
+   {0x1FC2, 3, EAIL_WB_ALETTER},
+   {0x1FC6, 7, EAIL_WB_ALETTER},
+   {0x1FD0, 4, EAIL_WB_ALETTER},
+   {0x1FD6, 6, EAIL_WB_ALETTER},
+   {0x1FE0, 13, EAIL_WB_ALETTER},
+   {0x1FF2, 3, EAIL_WB_ALETTER},
+   {0x1FF6, 7, EAIL_WB_ALETTER},
+   {0x2000, 7, EAIL_WB_WSEGSPACE},
+   {0x2008, 3, EAIL_WB_WSEGSPACE},
+   {0x200C, 1, EAIL_WB_EXTEND},
+   {0x200D, 1, EAIL_WB_ZWJ},
+   {0x200E, 2, EAIL_WB_FORMAT},
+   {0x2018, 2, EAIL_WB_MIDNUMLET},
+   {0x2024, 1, EAIL_WB_MIDNUMLET},
+   {0x2027, 1, EAIL_WB_MIDLETTER},
+   {0x2028, 2, EAIL_WB_NEWLINE},
+   {0x202A, 5, EAIL_WB_FORMAT},
+   {0x202F, 1, EAIL_WB_EXTENDNUMLET},
+   {0x203F, 2, EAIL_WB_EXTENDNUMLET},
+   {0x2044, 1, EAIL_WB_MIDNUM},
+   {0x2054, 1, EAIL_WB_EXTENDNUMLET},
+   {0x205F, 1, EAIL_WB_WSEGSPACE},
+   {0x2060, 5, EAIL_WB_FORMAT},
+   {0x2066, 10, EAIL_WB_FORMAT},
+   {0x2071, 1, EAIL_WB_ALETTER},
+   {0x207F, 1, EAIL_WB_ALETTER},
+   {0x2090, 13, EAIL_WB_ALETTER},
+   {0x20D0, 33, EAIL_WB_EXTEND},
+   {0x2102, 1, EAIL_WB_ALETTER},
+   {0x2107, 1, EAIL_WB_ALETTER},
+   {0x210A, 10, EAIL_WB_ALETTER},
+   {0x2115, 1, EAIL_WB_ALETTER},
+   {0x2119, 5, EAIL_WB_ALETTER},
+   {0x2124, 1, EAIL_WB_ALETTER},
+   {0x2126, 1, EAIL_WB_ALETTER},
+   {0x2128, 1, EAIL_WB_ALETTER},
+   {0x212A, 4, EAIL_WB_ALETTER},
+   {0x212F, 11, EAIL_WB_ALETTER},
+   {0x213C, 4, EAIL_WB_ALETTER},
+   {0x2145, 5, EAIL_WB_ALETTER},
+   {0x214E, 1, EAIL_WB_ALETTER},
+   {0x2160, 41, EAIL_WB_ALETTER},
+   {0x24B6, 52, EAIL_WB_ALETTER},
+   {0x2C00, 229, EAIL_WB_ALETTER},
+   {0x2CEB, 4, EAIL_WB_ALETTER},
+   {0x2CEF, 3, EAIL_WB_EXTEND},
+   {0x2CF2, 2, EAIL_WB_ALETTER},
+   {0x2D00, 38, EAIL_WB_ALETTER},
+   {0x2D27, 1, EAIL_WB_ALETTER},
+   {0x2D2D, 1, EAIL_WB_ALETTER},
+   {0x2D30, 56, EAIL_WB_ALETTER},
+   {0x2D6F, 1, EAIL_WB_ALETTER},
+   {0x2D7F, 1, EAIL_WB_EXTEND},
+   {0x2D80, 23, EAIL_WB_ALETTER},
+   {0x2DA0, 7, EAIL_WB_ALETTER},
+   {0x2DA8, 7, EAIL_WB_ALETTER},
+   {0x2DB0, 7, EAIL_WB_ALETTER},
+   {0x2DB8, 7, EAIL_WB_ALETTER},
+   {0x2DC0, 7, EAIL_WB_ALETTER},
+   {0x2DC8, 7, EAIL_WB_ALETTER},
+   {0x2DD0, 7, EAIL_WB_ALETTER},
+   {0x2DD8, 7, EAIL_WB_ALETTER},
+   {0x2DE0, 32, EAIL_WB_EXTEND},
+   {0x2E2F, 1, EAIL_WB_ALETTER},
+   {0x3000, 1, EAIL_WB_WSEGSPACE},
+   {0x3005, 1, EAIL_WB_ALETTER},
+   {0x302A, 6, EAIL_WB_EXTEND},
+   {0x3031, 5, EAIL_WB_KATAKANA},
+   {0x303B, 2, EAIL_WB_ALETTER},
+   {0x3099, 2, EAIL_WB_EXTEND},
+   {0x309B, 2, EAIL_WB_KATAKANA},
+   {0x30A0, 91, EAIL_WB_KATAKANA},
+   {0x30FC, 4, EAIL_WB_KATAKANA},
+   {0x3105, 43, EAIL_WB_ALETTER},
+   {0x3131, 94, EAIL_WB_ALETTER},
+   {0x31A0, 32, EAIL_WB_ALETTER},
+   {0x31F0, 16, EAIL_WB_KATAKANA},
+   {0x32D0, 47, EAIL_WB_KATAKANA},
+   {0x3300, 88, EAIL_WB_KATAKANA},
+   {0xA000, 1165, EAIL_WB_ALETTER},
+   {0xA4D0, 46, EAIL_WB_ALETTER},
+   {0xA500, 269, EAIL_WB_ALETTER},
+   {0xA610, 16, EAIL_WB_ALETTER},
+   {0xA620, 10, EAIL_WB_NUMERIC},
+   {0xA62A, 2, EAIL_WB_ALETTER},
+   {0xA640, 47, EAIL_WB_ALETTER},
+   {0xA66F, 4, EAIL_WB_EXTEND},
+   {0xA674, 10, EAIL_WB_EXTEND},
+   {0xA67F, 31, EAIL_WB_ALETTER},
+   {0xA69E, 2, EAIL_WB_EXTEND},
+   {0xA6A0, 80, EAIL_WB_ALETTER},
+   {0xA6F0, 2, EAIL_WB_EXTEND},
+   {0xA708, 195, EAIL_WB_ALETTER},
+   {0xA7D0, 2, EAIL_WB_ALETTER},
+   {0xA7D3, 1, EAIL_WB_ALETTER},
+   {0xA7D5, 5, EAIL_WB_ALETTER},
+   {0xA7F2, 16, EAIL_WB_ALETTER},
+   {0xA802, 1, EAIL_WB_EXTEND},
+   {0xA803, 3, EAIL_WB_ALETTER},
+   {0xA806, 1, EAIL_WB_EXTEND},
+   {0xA807, 4, EAIL_WB_ALETTER},
+   {0xA80B, 1, EAIL_WB_EXTEND},
+   {0xA80C, 23, EAIL_WB_ALETTER},
+   {0xA823, 5, EAIL_WB_EXTEND},
+   {0xA82C, 1, EAIL_WB_EXTEND},
+   {0xA840, 52, EAIL_WB_ALETTER},
+   {0xA880, 2, EAIL_WB_EXTEND},
+   {0xA882, 50, EAIL_WB_ALETTER},
+   {0xA8B4, 18, EAIL_WB_EXTEND},
+   {0xA8D0, 10, EAIL_WB_NUMERIC},
+   {0xA8E0, 18, EAIL_WB_EXTEND},
+   {0xA8F2, 6, EAIL_WB_ALETTER},
+   {0xA8FB, 1, EAIL_WB_ALETTER},
+   {0xA8FD, 2, EAIL_WB_ALETTER},
+   {0xA8FF, 1, EAIL_WB_EXTEND},
+   {0xA900, 10, EAIL_WB_NUMERIC},
+   {0xA90A, 28, EAIL_WB_ALETTER},
+   {0xA926, 8, EAIL_WB_EXTEND},
+   {0xA930, 23, EAIL_WB_ALETTER},
+   {0xA947, 13, EAIL_WB_EXTEND},
+   {0xA960, 29, EAIL_WB_ALETTER},
+   {0xA980, 4, EAIL_WB_EXTEND},
+   {0xA984, 47, EAIL_WB_ALETTER},
+   {0xA9B3, 14, EAIL_WB_EXTEND},
+   {0xA9CF, 1, EAIL_WB_ALETTER},
+   {0xA9D0, 10, EAIL_WB_NUMERIC},
+   {0xA9E5, 1, EAIL_WB_EXTEND},
+   {0xA9F0, 10, EAIL_WB_NUMERIC},
+   {0xAA00, 41, EAIL_WB_ALETTER},
+   {0xAA29, 14, EAIL_WB_EXTEND},
+   {0xAA40, 3, EAIL_WB_ALETTER},
+   {0xAA43, 1, EAIL_WB_EXTEND},
+   {0xAA44, 8, EAIL_WB_ALETTER},
+   {0xAA4C, 2, EAIL_WB_EXTEND},
+   {0xAA50, 10, EAIL_WB_NUMERIC},
+   {0xAA7B, 3, EAIL_WB_EXTEND},
+   {0xAAB0, 1, EAIL_WB_EXTEND},
+   {0xAAB2, 3, EAIL_WB_EXTEND},
+   {0xAAB7, 2, EAIL_WB_EXTEND},
+   {0xAABE, 2, EAIL_WB_EXTEND},
+   {0xAAC1, 1, EAIL_WB_EXTEND},
+   {0xAAE0, 11, EAIL_WB_ALETTER},
+   {0xAAEB, 5, EAIL_WB_EXTEND},
+   {0xAAF2, 3, EAIL_WB_ALETTER},
+   {0xAAF5, 2, EAIL_WB_EXTEND},
+   {0xAB01, 6, EAIL_WB_ALETTER},
+   {0xAB09, 6, EAIL_WB_ALETTER},
+   {0xAB11, 6, EAIL_WB_ALETTER},
+   {0xAB20, 7, EAIL_WB_ALETTER},
+   {0xAB28, 7, EAIL_WB_ALETTER},
+   {0xAB30, 58, EAIL_WB_ALETTER},
+   {0xAB70, 115, EAIL_WB_ALETTER},
+   {0xABE3, 8, EAIL_WB_EXTEND},
+   {0xABEC, 2, EAIL_WB_EXTEND},
+   {0xABF0, 10, EAIL_WB_NUMERIC},
+   {0xAC00, 11172, EAIL_WB_ALETTER},
+   {0xD7B0, 23, EAIL_WB_ALETTER},
+   {0xD7CB, 49, EAIL_WB_ALETTER},
+   {0xFB00, 7, EAIL_WB_ALETTER},
+   {0xFB13, 5, EAIL_WB_ALETTER},
+   {0xFB1D, 1, EAIL_WB_HEBREW_LETTER},
+   {0xFB1E, 1, EAIL_WB_EXTEND},
+   {0xFB1F, 10, EAIL_WB_HEBREW_LETTER},
+   {0xFB2A, 13, EAIL_WB_HEBREW_LETTER},
+   {0xFB38, 5, EAIL_WB_HEBREW_LETTER},
+   {0xFB3E, 1, EAIL_WB_HEBREW_LETTER},
+   {0xFB40, 2, EAIL_WB_HEBREW_LETTER},
+   {0xFB43, 2, EAIL_WB_HEBREW_LETTER},
+   {0xFB46, 10, EAIL_WB_HEBREW_LETTER},
+   {0xFB50, 98, EAIL_WB_ALETTER},
+   {0xFBD3, 363, EAIL_WB_ALETTER},
+   {0xFD50, 64, EAIL_WB_ALETTER},
+   {0xFD92, 54, EAIL_WB_ALETTER},
+   {0xFDF0, 12, EAIL_WB_ALETTER},
+   {0xFE00, 16, EAIL_WB_EXTEND},
+   {0xFE10, 1, EAIL_WB_MIDNUM},
+   {0xFE13, 1, EAIL_WB_MIDLETTER},
+   {0xFE14, 1, EAIL_WB_MIDNUM},
+   {0xFE20, 16, EAIL_WB_EXTEND},
+   {0xFE33, 2, EAIL_WB_EXTENDNUMLET},
+   {0xFE4D, 3, EAIL_WB_EXTENDNUMLET},
+   {0xFE50, 1, EAIL_WB_MIDNUM},
+   {0xFE52, 1, EAIL_WB_MIDNUMLET},
+   {0xFE54, 1, EAIL_WB_MIDNUM},
+   {0xFE55, 1, EAIL_WB_MIDLETTER},
+   {0xFE70, 5, EAIL_WB_ALETTER},
+   {0xFE76, 135, EAIL_WB_ALETTER},
+   {0xFEFF, 1, EAIL_WB_FORMAT},
+   {0xFF07, 1, EAIL_WB_MIDNUMLET},
+   {0xFF0C, 1, EAIL_WB_MIDNUM},
+   {0xFF0E, 1, EAIL_WB_MIDNUMLET},
+   {0xFF10, 10, EAIL_WB_NUMERIC},
+   {0xFF1A, 1, EAIL_WB_MIDLETTER},
+   {0xFF1B, 1, EAIL_WB_MIDNUM},
+   {0xFF21, 26, EAIL_WB_ALETTER},
+   {0xFF3F, 1, EAIL_WB_EXTENDNUMLET},
+   {0xFF41, 26, EAIL_WB_ALETTER},
+   {0xFF66, 56, EAIL_WB_KATAKANA},
+   {0xFF9E, 2, EAIL_WB_EXTEND},
+   {0xFFA0, 31, EAIL_WB_ALETTER},
+   {0xFFC2, 6, EAIL_WB_ALETTER},
+   {0xFFCA, 6, EAIL_WB_ALETTER},
+   {0xFFD2, 6, EAIL_WB_ALETTER},
+   {0xFFDA, 3, EAIL_WB_ALETTER},
+   {0xFFF9, 3, EAIL_WB_FORMAT},
+   {0x10000, 12, EAIL_WB_ALETTER},
+   {0x1000D, 26, EAIL_WB_ALETTER},
+   {0x10028, 19, EAIL_WB_ALETTER},
+   {0x1003C, 2, EAIL_WB_ALETTER},
+   {0x1003F, 15, EAIL_WB_ALETTER},
+   {0x10050, 14, EAIL_WB_ALETTER},
+   {0x10080, 123, EAIL_WB_ALETTER},
+   {0x10140, 53, EAIL_WB_ALETTER},
+   {0x101FD, 1, EAIL_WB_EXTEND},
+   {0x10280, 29, EAIL_WB_ALETTER},
+   {0x102A0, 49, EAIL_WB_ALETTER},
+   {0x102E0, 1, EAIL_WB_EXTEND},
+   {0x10300, 32, EAIL_WB_ALETTER},
+   {0x1032D, 30, EAIL_WB_ALETTER},
+   {0x10350, 38, EAIL_WB_ALETTER},
+   {0x10376, 5, EAIL_WB_EXTEND},
+   {0x10380, 30, EAIL_WB_ALETTER},
+   {0x103A0, 36, EAIL_WB_ALETTER},
+   {0x103C8, 8, EAIL_WB_ALETTER},
+   {0x103D1, 5, EAIL_WB_ALETTER},
+   {0x10400, 158, EAIL_WB_ALETTER},
+   {0x104A0, 10, EAIL_WB_NUMERIC},
+   {0x104B0, 36, EAIL_WB_ALETTER},
+   {0x104D8, 36, EAIL_WB_ALETTER},
+   {0x10500, 40, EAIL_WB_ALETTER},
+   {0x10530, 52, EAIL_WB_ALETTER},
+   {0x10570, 11, EAIL_WB_ALETTER},
+   {0x1057C, 15, EAIL_WB_ALETTER},
+   {0x1058C, 7, EAIL_WB_ALETTER},
+   {0x10594, 2, EAIL_WB_ALETTER},
+   {0x10597, 11, EAIL_WB_ALETTER},
+   {0x105A3, 15, EAIL_WB_ALETTER},
+   {0x105B3, 7, EAIL_WB_ALETTER},
+   {0x105BB, 2, EAIL_WB_ALETTER},
+   {0x10600, 311, EAIL_WB_ALETTER},
+   {0x10740, 22, EAIL_WB_ALETTER},
+   {0x10760, 8, EAIL_WB_ALETTER},
+   {0x10780, 6, EAIL_WB_ALETTER},
+   {0x10787, 42, EAIL_WB_ALETTER},
+   {0x107B2, 9, EAIL_WB_ALETTER},
+   {0x10800, 6, EAIL_WB_ALETTER},
+   {0x10808, 1, EAIL_WB_ALETTER},
+   {0x1080A, 44, EAIL_WB_ALETTER},
+   {0x10837, 2, EAIL_WB_ALETTER},
+   {0x1083C, 1, EAIL_WB_ALETTER},
+   {0x1083F, 23, EAIL_WB_ALETTER},
+   {0x10860, 23, EAIL_WB_ALETTER},
+   {0x10880, 31, EAIL_WB_ALETTER},
+   {0x108E0, 19, EAIL_WB_ALETTER},
+   {0x108F4, 2, EAIL_WB_ALETTER},
+   {0x10900, 22, EAIL_WB_ALETTER},
+   {0x10920, 26, EAIL_WB_ALETTER},
+   {0x10980, 56, EAIL_WB_ALETTER},
+   {0x109BE, 2, EAIL_WB_ALETTER},
+   {0x10A00, 1, EAIL_WB_ALETTER},
+   {0x10A01, 3, EAIL_WB_EXTEND},
+   {0x10A05, 2, EAIL_WB_EXTEND},
+   {0x10A0C, 4, EAIL_WB_EXTEND},
+   {0x10A10, 4, EAIL_WB_ALETTER},
+   {0x10A15, 3, EAIL_WB_ALETTER},
+   {0x10A19, 29, EAIL_WB_ALETTER},
+   {0x10A38, 3, EAIL_WB_EXTEND},
+   {0x10A3F, 1, EAIL_WB_EXTEND},
+   {0x10A60, 29, EAIL_WB_ALETTER},
+   {0x10A80, 29, EAIL_WB_ALETTER},
+   {0x10AC0, 8, EAIL_WB_ALETTER},
+   {0x10AC9, 28, EAIL_WB_ALETTER},
+   {0x10AE5, 2, EAIL_WB_EXTEND},
+   {0x10B00, 54, EAIL_WB_ALETTER},
+   {0x10B40, 22, EAIL_WB_ALETTER},
+   {0x10B60, 19, EAIL_WB_ALETTER},
+   {0x10B80, 18, EAIL_WB_ALETTER},
+   {0x10C00, 73, EAIL_WB_ALETTER},
+   {0x10C80, 51, EAIL_WB_ALETTER},
+   {0x10CC0, 51, EAIL_WB_ALETTER},
+   {0x10D00, 36, EAIL_WB_ALETTER},
+   {0x10D24, 4, EAIL_WB_EXTEND},
+   {0x10D30, 10, EAIL_WB_NUMERIC},
+   {0x10E80, 42, EAIL_WB_ALETTER},
+   {0x10EAB, 2, EAIL_WB_EXTEND},
+   {0x10EB0, 2, EAIL_WB_ALETTER},
+   {0x10F00, 29, EAIL_WB_ALETTER},
+   {0x10F27, 1, EAIL_WB_ALETTER},
+   {0x10F30, 22, EAIL_WB_ALETTER},
+   {0x10F46, 11, EAIL_WB_EXTEND},
+   {0x10F70, 18, EAIL_WB_ALETTER},
+   {0x10F82, 4, EAIL_WB_EXTEND},
+   {0x10FB0, 21, EAIL_WB_ALETTER},
+   {0x10FE0, 23, EAIL_WB_ALETTER},
+   {0x11000, 3, EAIL_WB_EXTEND},
+   {0x11003, 53, EAIL_WB_ALETTER},
+   {0x11038, 15, EAIL_WB_EXTEND},
+   {0x11066, 10, EAIL_WB_NUMERIC},
+   {0x11070, 1, EAIL_WB_EXTEND},
+   {0x11071, 2, EAIL_WB_ALETTER},
+   {0x11073, 2, EAIL_WB_EXTEND},
+   {0x11075, 1, EAIL_WB_ALETTER},
+   {0x1107F, 4, EAIL_WB_EXTEND},
+   {0x11083, 45, EAIL_WB_ALETTER},
+   {0x110B0, 11, EAIL_WB_EXTEND},
+   {0x110BD, 1, EAIL_WB_FORMAT},
+   {0x110C2, 1, EAIL_WB_EXTEND},
+   {0x110CD, 1, EAIL_WB_FORMAT},
+   {0x110D0, 25, EAIL_WB_ALETTER},
+   {0x110F0, 10, EAIL_WB_NUMERIC},
+   {0x11100, 3, EAIL_WB_EXTEND},
+   {0x11103, 36, EAIL_WB_ALETTER},
+   {0x11127, 14, EAIL_WB_EXTEND},
+   {0x11136, 10, EAIL_WB_NUMERIC},
+   {0x11144, 1, EAIL_WB_ALETTER},
+   {0x11145, 2, EAIL_WB_EXTEND},
+   {0x11147, 1, EAIL_WB_ALETTER},
+   {0x11150, 35, EAIL_WB_ALETTER},
+   {0x11173, 1, EAIL_WB_EXTEND},
+   {0x11176, 1, EAIL_WB_ALETTER},
+   {0x11180, 3, EAIL_WB_EXTEND},
+   {0x11183, 48, EAIL_WB_ALETTER},
+   {0x111B3, 14, EAIL_WB_EXTEND},
+   {0x111C1, 4, EAIL_WB_ALETTER},
+   {0x111C9, 4, EAIL_WB_EXTEND},
+   {0x111CE, 2, EAIL_WB_EXTEND},
+   {0x111D0, 10, EAIL_WB_NUMERIC},
+   {0x111DA, 1, EAIL_WB_ALETTER},
+   {0x111DC, 1, EAIL_WB_ALETTER},
+   {0x11200, 18, EAIL_WB_ALETTER},
+   {0x11213, 25, EAIL_WB_ALETTER},
+   {0x1122C, 12, EAIL_WB_EXTEND},
+   {0x1123E, 1, EAIL_WB_EXTEND},
+   {0x11280, 7, EAIL_WB_ALETTER},
+   {0x11288, 1, EAIL_WB_ALETTER},
+   {0x1128A, 4, EAIL_WB_ALETTER},
+   {0x1128F, 15, EAIL_WB_ALETTER},
+   {0x1129F, 10, EAIL_WB_ALETTER},
+   {0x112B0, 47, EAIL_WB_ALETTER},
+   {0x112DF, 12, EAIL_WB_EXTEND},
+   {0x112F0, 10, EAIL_WB_NUMERIC},
+   {0x11300, 4, EAIL_WB_EXTEND},
+   {0x11305, 8, EAIL_WB_ALETTER},
+   {0x1130F, 2, EAIL_WB_ALETTER},
+   {0x11313, 22, EAIL_WB_ALETTER},
+   {0x1132A, 7, EAIL_WB_ALETTER},
+   {0x11332, 2, EAIL_WB_ALETTER},
+   {0x11335, 5, EAIL_WB_ALETTER},
+   {0x1133B, 2, EAIL_WB_EXTEND},
+   {0x1133D, 1, EAIL_WB_ALETTER},
+   {0x1133E, 7, EAIL_WB_EXTEND},
+   {0x11347, 2, EAIL_WB_EXTEND},
+   {0x1134B, 3, EAIL_WB_EXTEND},
+   {0x11350, 1, EAIL_WB_ALETTER},
+   {0x11357, 1, EAIL_WB_EXTEND},
+   {0x1135D, 5, EAIL_WB_ALETTER},
+   {0x11362, 2, EAIL_WB_EXTEND},
+   {0x11366, 7, EAIL_WB_EXTEND},
+   {0x11370, 5, EAIL_WB_EXTEND},
+   {0x11400, 53, EAIL_WB_ALETTER},
+   {0x11435, 18, EAIL_WB_EXTEND},
+   {0x11447, 4, EAIL_WB_ALETTER},
+   {0x11450, 10, EAIL_WB_NUMERIC},
+   {0x1145E, 1, EAIL_WB_EXTEND},
+   {0x1145F, 3, EAIL_WB_ALETTER},
+   {0x11480, 48, EAIL_WB_ALETTER},
+   {0x114B0, 20, EAIL_WB_EXTEND},
+   {0x114C4, 2, EAIL_WB_ALETTER},
+   {0x114C7, 1, EAIL_WB_ALETTER},
+   {0x114D0, 10, EAIL_WB_NUMERIC},
+   {0x11580, 47, EAIL_WB_ALETTER},
+   {0x115AF, 7, EAIL_WB_EXTEND},
+   {0x115B8, 9, EAIL_WB_EXTEND},
+   {0x115D8, 4, EAIL_WB_ALETTER},
+   {0x115DC, 2, EAIL_WB_EXTEND},
+   {0x11600, 48, EAIL_WB_ALETTER},
+   {0x11630, 17, EAIL_WB_EXTEND},
+   {0x11644, 1, EAIL_WB_ALETTER},
+   {0x11650, 10, EAIL_WB_NUMERIC},
+   {0x11680, 43, EAIL_WB_ALETTER},
+   {0x116AB, 13, EAIL_WB_EXTEND},
+   {0x116B8, 1, EAIL_WB_ALETTER},
+   {0x116C0, 10, EAIL_WB_NUMERIC},
+   {0x1171D, 15, EAIL_WB_EXTEND},
+   {0x11730, 10, EAIL_WB_NUMERIC},
+   {0x11800, 44, EAIL_WB_ALETTER},
+   {0x1182C, 15, EAIL_WB_EXTEND},
+   {0x118A0, 64, EAIL_WB_ALETTER},
+   {0x118E0, 10, EAIL_WB_NUMERIC},
+   {0x118FF, 8, EAIL_WB_ALETTER},
+   {0x11909, 1, EAIL_WB_ALETTER},
+   {0x1190C, 8, EAIL_WB_ALETTER},
+   {0x11915, 2, EAIL_WB_ALETTER},
+   {0x11918, 24, EAIL_WB_ALETTER},
+   {0x11930, 6, EAIL_WB_EXTEND},
+   {0x11937, 2, EAIL_WB_EXTEND},
+   {0x1193B, 4, EAIL_WB_EXTEND},
+   {0x1193F, 1, EAIL_WB_ALETTER},
+   {0x11940, 1, EAIL_WB_EXTEND},
+   {0x11941, 1, EAIL_WB_ALETTER},
+   {0x11942, 2, EAIL_WB_EXTEND},
+   {0x11950, 10, EAIL_WB_NUMERIC},
+   {0x119A0, 8, EAIL_WB_ALETTER},
+   {0x119AA, 39, EAIL_WB_ALETTER},
+   {0x119D1, 7, EAIL_WB_EXTEND},
+   {0x119DA, 7, EAIL_WB_EXTEND},
+   {0x119E1, 1, EAIL_WB_ALETTER},
+   {0x119E3, 1, EAIL_WB_ALETTER},
+   {0x119E4, 1, EAIL_WB_EXTEND},
+   {0x11A00, 1, EAIL_WB_ALETTER},
+   {0x11A01, 10, EAIL_WB_EXTEND},
+   {0x11A0B, 40, EAIL_WB_ALETTER},
+   {0x11A33, 7, EAIL_WB_EXTEND},
+   {0x11A3A, 1, EAIL_WB_ALETTER},
+   {0x11A3B, 4, EAIL_WB_EXTEND},
+   {0x11A47, 1, EAIL_WB_EXTEND},
+   {0x11A50, 1, EAIL_WB_ALETTER},
+   {0x11A51, 11, EAIL_WB_EXTEND},
+   {0x11A5C, 46, EAIL_WB_ALETTER},
+   {0x11A8A, 16, EAIL_WB_EXTEND},
+   {0x11A9D, 1, EAIL_WB_ALETTER},
+   {0x11AB0, 73, EAIL_WB_ALETTER},
+   {0x11C00, 9, EAIL_WB_ALETTER},
+   {0x11C0A, 37, EAIL_WB_ALETTER},
+   {0x11C2F, 8, EAIL_WB_EXTEND},
+   {0x11C38, 8, EAIL_WB_EXTEND},
+   {0x11C40, 1, EAIL_WB_ALETTER},
+   {0x11C50, 10, EAIL_WB_NUMERIC},
+   {0x11C72, 30, EAIL_WB_ALETTER},
+   {0x11C92, 22, EAIL_WB_EXTEND},
+   {0x11CA9, 14, EAIL_WB_EXTEND},
+   {0x11D00, 7, EAIL_WB_ALETTER},
+   {0x11D08, 2, EAIL_WB_ALETTER},
+   {0x11D0B, 38, EAIL_WB_ALETTER},
+   {0x11D31, 6, EAIL_WB_EXTEND},
+   {0x11D3A, 1, EAIL_WB_EXTEND},
+   {0x11D3C, 2, EAIL_WB_EXTEND},
+   {0x11D3F, 7, EAIL_WB_EXTEND},
+   {0x11D46, 1, EAIL_WB_ALETTER},
+   {0x11D47, 1, EAIL_WB_EXTEND},
+   {0x11D50, 10, EAIL_WB_NUMERIC},
+   {0x11D60, 6, EAIL_WB_ALETTER},
+   {0x11D67, 2, EAIL_WB_ALETTER},
+   {0x11D6A, 32, EAIL_WB_ALETTER},
+   {0x11D8A, 5, EAIL_WB_EXTEND},
+   {0x11D90, 2, EAIL_WB_EXTEND},
+   {0x11D93, 5, EAIL_WB_EXTEND},
+   {0x11D98, 1, EAIL_WB_ALETTER},
+   {0x11DA0, 10, EAIL_WB_NUMERIC},
+   {0x11EE0, 19, EAIL_WB_ALETTER},
+   {0x11EF3, 4, EAIL_WB_EXTEND},
+   {0x11FB0, 1, EAIL_WB_ALETTER},
+   {0x12000, 922, EAIL_WB_ALETTER},
+   {0x12400, 111, EAIL_WB_ALETTER},
+   {0x12480, 196, EAIL_WB_ALETTER},
+   {0x12F90, 97, EAIL_WB_ALETTER},
+   {0x13000, 1071, EAIL_WB_ALETTER},
+   {0x13430, 9, EAIL_WB_FORMAT},
+   {0x14400, 583, EAIL_WB_ALETTER},
+   {0x16800, 569, EAIL_WB_ALETTER},
+   {0x16A40, 31, EAIL_WB_ALETTER},
+   {0x16A60, 10, EAIL_WB_NUMERIC},
+   {0x16A70, 79, EAIL_WB_ALETTER},
+   {0x16AC0, 10, EAIL_WB_NUMERIC},
+   {0x16AD0, 30, EAIL_WB_ALETTER},
+   {0x16AF0, 5, EAIL_WB_EXTEND},
+   {0x16B00, 48, EAIL_WB_ALETTER},
+   {0x16B30, 7, EAIL_WB_EXTEND},
+   {0x16B40, 4, EAIL_WB_ALETTER},
+   {0x16B50, 10, EAIL_WB_NUMERIC},
+   {0x16B63, 21, EAIL_WB_ALETTER},
+   {0x16B7D, 19, EAIL_WB_ALETTER},
+   {0x16E40, 64, EAIL_WB_ALETTER},
+   {0x16F00, 75, EAIL_WB_ALETTER},
+   {0x16F4F, 1, EAIL_WB_EXTEND},
+   {0x16F50, 1, EAIL_WB_ALETTER},
+   {0x16F51, 55, EAIL_WB_EXTEND},
+   {0x16F8F, 4, EAIL_WB_EXTEND},
+   {0x16F93, 13, EAIL_WB_ALETTER},
+   {0x16FE0, 2, EAIL_WB_ALETTER},
+   {0x16FE3, 1, EAIL_WB_ALETTER},
+   {0x16FE4, 1, EAIL_WB_EXTEND},
+   {0x16FF0, 2, EAIL_WB_EXTEND},
+   {0x1AFF0, 4, EAIL_WB_KATAKANA},
+   {0x1AFF5, 7, EAIL_WB_KATAKANA},
+   {0x1AFFD, 2, EAIL_WB_KATAKANA},
+   {0x1B000, 1, EAIL_WB_KATAKANA},
+   {0x1B120, 3, EAIL_WB_KATAKANA},
+   {0x1B164, 4, EAIL_WB_KATAKANA},
+   {0x1BC00, 107, EAIL_WB_ALETTER},
+   {0x1BC70, 13, EAIL_WB_ALETTER},
+   {0x1BC80, 9, EAIL_WB_ALETTER},
+   {0x1BC90, 10, EAIL_WB_ALETTER},
+   {0x1BC9D, 2, EAIL_WB_EXTEND},
+   {0x1BCA0, 4, EAIL_WB_FORMAT},
+   {0x1CF00, 46, EAIL_WB_EXTEND},
+   {0x1CF30, 23, EAIL_WB_EXTEND},
+   {0x1D165, 5, EAIL_WB_EXTEND},
+   {0x1D16D, 6, EAIL_WB_EXTEND},
+   {0x1D173, 8, EAIL_WB_FORMAT},
+   {0x1D17B, 8, EAIL_WB_EXTEND},
+   {0x1D185, 7, EAIL_WB_EXTEND},
+   {0x1D1AA, 4, EAIL_WB_EXTEND},
+   {0x1D242, 3, EAIL_WB_EXTEND},
+   {0x1D400, 85, EAIL_WB_ALETTER},
+   {0x1D456, 71, EAIL_WB_ALETTER},
+   {0x1D49E, 2, EAIL_WB_ALETTER},
+   {0x1D4A2, 1, EAIL_WB_ALETTER},
+   {0x1D4A5, 2, EAIL_WB_ALETTER},
+   {0x1D4A9, 4, EAIL_WB_ALETTER},
+   {0x1D4AE, 12, EAIL_WB_ALETTER},
+   {0x1D4BB, 1, EAIL_WB_ALETTER},
+   {0x1D4BD, 7, EAIL_WB_ALETTER},
+   {0x1D4C5, 65, EAIL_WB_ALETTER},
+   {0x1D507, 4, EAIL_WB_ALETTER},
+   {0x1D50D, 8, EAIL_WB_ALETTER},
+   {0x1D516, 7, EAIL_WB_ALETTER},
+   {0x1D51E, 28, EAIL_WB_ALETTER},
+   {0x1D53B, 4, EAIL_WB_ALETTER},
+   {0x1D540, 5, EAIL_WB_ALETTER},
+   {0x1D546, 1, EAIL_WB_ALETTER},
+   {0x1D54A, 7, EAIL_WB_ALETTER},
+   {0x1D552, 340, EAIL_WB_ALETTER},
+   {0x1D6A8, 25, EAIL_WB_ALETTER},
+   {0x1D6C2, 25, EAIL_WB_ALETTER},
+   {0x1D6DC, 31, EAIL_WB_ALETTER},
+   {0x1D6FC, 25, EAIL_WB_ALETTER},
+   {0x1D716, 31, EAIL_WB_ALETTER},
+   {0x1D736, 25, EAIL_WB_ALETTER},
+   {0x1D750, 31, EAIL_WB_ALETTER},
+   {0x1D770, 25, EAIL_WB_ALETTER},
+   {0x1D78A, 31, EAIL_WB_ALETTER},
+   {0x1D7AA, 25, EAIL_WB_ALETTER},
+   {0x1D7C4, 8, EAIL_WB_ALETTER},
+   {0x1D7CE, 50, EAIL_WB_NUMERIC},
+   {0x1DA00, 55, EAIL_WB_EXTEND},
+   {0x1DA3B, 50, EAIL_WB_EXTEND},
+   {0x1DA75, 1, EAIL_WB_EXTEND},
+   {0x1DA84, 1, EAIL_WB_EXTEND},
+   {0x1DA9B, 5, EAIL_WB_EXTEND},
+   {0x1DAA1, 15, EAIL_WB_EXTEND},
+   {0x1DF00, 31, EAIL_WB_ALETTER},
+   {0x1E000, 7, EAIL_WB_EXTEND},
+   {0x1E008, 17, EAIL_WB_EXTEND},
+   {0x1E01B, 7, EAIL_WB_EXTEND},
+   {0x1E023, 2, EAIL_WB_EXTEND},
+   {0x1E026, 5, EAIL_WB_EXTEND},
+   {0x1E100, 45, EAIL_WB_ALETTER},
+   {0x1E130, 7, EAIL_WB_EXTEND},
+   {0x1E137, 7, EAIL_WB_ALETTER},
+   {0x1E140, 10, EAIL_WB_NUMERIC},
+   {0x1E14E, 1, EAIL_WB_ALETTER},
+   {0x1E290, 30, EAIL_WB_ALETTER},
+   {0x1E2AE, 1, EAIL_WB_EXTEND},
+   {0x1E2C0, 44, EAIL_WB_ALETTER},
+   {0x1E2EC, 4, EAIL_WB_EXTEND},
+   {0x1E2F0, 10, EAIL_WB_NUMERIC},
+   {0x1E7E0, 7, EAIL_WB_ALETTER},
+   {0x1E7E8, 4, EAIL_WB_ALETTER},
+   {0x1E7ED, 2, EAIL_WB_ALETTER},
+   {0x1E7F0, 15, EAIL_WB_ALETTER},
+   {0x1E800, 197, EAIL_WB_ALETTER},
+   {0x1E8D0, 7, EAIL_WB_EXTEND},
+   {0x1E900, 68, EAIL_WB_ALETTER},
+   {0x1E944, 7, EAIL_WB_EXTEND},
+   {0x1E94B, 1, EAIL_WB_ALETTER},
+   {0x1E950, 10, EAIL_WB_NUMERIC},
+   {0x1EE00, 4, EAIL_WB_ALETTER},
+   {0x1EE05, 27, EAIL_WB_ALETTER},
+   {0x1EE21, 2, EAIL_WB_ALETTER},
+   {0x1EE24, 1, EAIL_WB_ALETTER},
+   {0x1EE27, 1, EAIL_WB_ALETTER},
+   {0x1EE29, 10, EAIL_WB_ALETTER},
+   {0x1EE34, 4, EAIL_WB_ALETTER},
+   {0x1EE39, 1, EAIL_WB_ALETTER},
+   {0x1EE3B, 1, EAIL_WB_ALETTER},
+   {0x1EE42, 1, EAIL_WB_ALETTER},
+   {0x1EE47, 1, EAIL_WB_ALETTER},
+   {0x1EE49, 1, EAIL_WB_ALETTER},
+   {0x1EE4B, 1, EAIL_WB_ALETTER},
+   {0x1EE4D, 3, EAIL_WB_ALETTER},
+   {0x1EE51, 2, EAIL_WB_ALETTER},
+   {0x1EE54, 1, EAIL_WB_ALETTER},
+   {0x1EE57, 1, EAIL_WB_ALETTER},
+   {0x1EE59, 1, EAIL_WB_ALETTER},
+   {0x1EE5B, 1, EAIL_WB_ALETTER},
+   {0x1EE5D, 1, EAIL_WB_ALETTER},
+   {0x1EE5F, 1, EAIL_WB_ALETTER},
+   {0x1EE61, 2, EAIL_WB_ALETTER},
+   {0x1EE64, 1, EAIL_WB_ALETTER},
+   {0x1EE67, 4, EAIL_WB_ALETTER},
+   {0x1EE6C, 7, EAIL_WB_ALETTER},
+   {0x1EE74, 4, EAIL_WB_ALETTER},
+   {0x1EE79, 4, EAIL_WB_ALETTER},
+   {0x1EE7E, 1, EAIL_WB_ALETTER},
+   {0x1EE80, 10, EAIL_WB_ALETTER},
+   {0x1EE8B, 17, EAIL_WB_ALETTER},
+   {0x1EEA1, 3, EAIL_WB_ALETTER},
+   {0x1EEA5, 5, EAIL_WB_ALETTER},
+   {0x1EEAB, 17, EAIL_WB_ALETTER},
+   {0x1F130, 26, EAIL_WB_ALETTER},
+   {0x1F150, 26, EAIL_WB_ALETTER},
+   {0x1F170, 26, EAIL_WB_ALETTER},
+   {0x1F1E6, 26, EAIL_WB_REGIONAL_INDICATOR},
+   {0x1F3FB, 5, EAIL_WB_EXTEND},
+   {0x1FBF0, 10, EAIL_WB_NUMERIC},
+   {0xE0001, 1, EAIL_WB_FORMAT},
+   {0xE0020, 96, EAIL_WB_EXTEND},
+   {0xE0100, 240, EAIL_WB_EXTEND},
+};
+
+/** @brief Sentence_Break values of ASCII characters */
+static const guint8 eail_sentence_break_ascii[128] =
+{
+   EAIL_SB_OTHER, EAIL_SB_OTHER, EAIL_SB_OTHER, EAIL_SB_OTHER,
+   EAIL_SB_OTHER, EAIL_SB_OTHER, EAIL_SB_OTHER, EAIL_SB_OTHER,
+   EAIL_SB_OTHER, EAIL_SB_SP, EAIL_SB_LF, EAIL_SB_SP,
+   EAIL_SB_SP, EAIL_SB_CR, EAIL_SB_OTHER, EAIL_SB_OTHER,
+   EAIL_SB_OTHER, EAIL_SB_OTHER, EAIL_SB_OTHER, EAIL_SB_OTHER,
+   EAIL_SB_OTHER, EAIL_SB_OTHER, EAIL_SB_OTHER, EAIL_SB_OTHER,
+   EAIL_SB_OTHER, EAIL_SB_OTHER, EAIL_SB_OTHER, EAIL_SB_OTHER,
+   EAIL_SB_OTHER, EAIL_SB_OTHER, EAIL_SB_OTHER, EAIL_SB_OTHER,
+   EAIL_SB_SP, EAIL_SB_STERM, EAIL_SB_CLOSE, EAIL_SB_OTHER,
+   EAIL_SB_OTHER, EAIL_SB_OTHER, EAIL_SB_OTHER, EAIL_SB_CLOSE,
+   EAIL_SB_CLOSE, EAIL_SB_CLOSE, EAIL_SB_OTHER, EAIL_SB_OTHER,
+   EAIL_SB_SCONTINUE, EAIL_SB_SCONTINUE, EAIL_SB_ATERM, EAIL_SB_OTHER,
+   EAIL_SB_NUMERIC, EAIL_SB_NUMERIC, EAIL_SB_NUMERIC, EAIL_SB_NUMERIC,
+   EAIL_SB_NUMERIC, EAIL_SB_NUMERIC, EAIL_SB_NUMERIC, EAIL_SB_NUMERIC,
+   EAIL_SB_NUMERIC, EAIL_SB_NUMERIC, EAIL_SB_SCONTINUE, EAIL_SB_OTHER,
+   EAIL_SB_OTHER, EAIL_SB_OTHER, EAIL_SB_OTHER, EAIL_SB_STERM,
+   EAIL_SB_OTHER, EAIL_SB_UPPER, EAIL_SB_UPPER, EAIL_SB_UPPER,
+   EAIL_SB_UPPER, EAIL_SB_UPPER, EAIL_SB_UPPER, EAIL_SB_UPPER,
+   EAIL_SB_UPPER, EAIL_SB_UPPER, EAIL_SB_UPPER, EAIL_SB_UPPER,
+   EAIL_SB_UPPER, EAIL_SB_UPPER, EAIL_SB_UPPER, EAIL_SB_UPPER,
+   EAIL_SB_UPPER, EAIL_SB_UPPER, EAIL_SB_UPPER, EAIL_SB_UPPER,
+   EAIL_SB_UPPER, EAIL_SB_UPPER, EAIL_SB_UPPER, EAIL_SB_UPPER,
+   EAIL_SB_UPPER, EAIL_SB_UPPER, EAIL_SB_UPPER, EAIL_SB_CLOSE,
+   EAIL_SB_OTHER, EAIL_SB_CLOSE, EAIL_SB_OTHER, EAIL_SB_OTHER,
+   EAIL_SB_OTHER, EAIL_SB_LOWER, EAIL_SB_LOWER, EAIL_SB_LOWER,
+   EAIL_SB_LOWER, EAIL_SB_LOWER, EAIL_SB_LOWER, EAIL_SB_LOWER,
+   EAIL_SB_LOWER, EAIL_SB_LOWER, EAIL_SB_LOWER, EAIL_SB_LOWER,
+   EAIL_SB_LOWER, EAIL_SB_LOWER, EAIL_SB_LOWER, EAIL_SB_LOWER,
+   EAIL_SB_LOWER, EAIL_SB_LOWER, EAIL_SB_LOWER, EAIL_SB_LOWER,
+   EAIL_SB_LOWER, EAIL_SB_LOWER, EAIL_SB_LOWER, EAIL_SB_LOWER,
+   EAIL_SB_LOWER, EAIL_SB_LOWER, EAIL_SB_LOWER, EAIL_SB_CLOSE,
+   EAIL_SB_OTHER, EAIL_SB_CLOSE, EAIL_SB_OTHER, EAIL_SB_OTHER,
+};
+
+/** @brief Sentence_Break ranges sorted by code point */
+static const EailSegmentRange eail_sentence_break_ranges[] =
+{
+   {0x0009, 1, EAIL_SB_SP},
+   {0x000A, 1, EAIL_SB_LF},
+   {0x000B, 2, EAIL_SB_SP},
+   {0x000D, 1, EAIL_SB_CR},
+   {0x0020, 1, EAIL_SB_SP},
+   {0x0021, 1, EAIL_SB_STERM},
+   {0x0022, 1, EAIL_SB_CLOSE},
+   {0x0027, 3, EAIL_SB_CLOSE},
+   {0x002C, 2, EAIL_SB_SCONTINUE},
+   {0x002E, 1, EAIL_SB_ATERM},
+   {0x0030, 10, EAIL_SB_NUMERIC},
+   {0x003A, 1, EAIL_SB_SCONTINUE},
+   {0x003F, 1, EAIL_SB_STERM},
+   {0x0041, 26, EAIL_SB_UPPER},
+   {0x005B, 1, EAIL_SB_CLOSE},
+   {0x005D, 1, EAIL_SB_CLOSE},
+   {0x0061, 26, EAIL_SB_LOWER},
+   {0x007B, 1, EAIL_SB_CLOSE},
+   {0x007D, 1, EAIL_SB_CLOSE},
+   {0x0085, 1, EAIL_SB_SEP},
+   {0x00A0, 1, EAIL_SB_SP},
+   {0x00AA, 1, EAIL_SB_LOWER},
+   {0x00AB, 1, EAIL_SB_CLOSE},
+   {0x00AD, 1, EAIL_SB_FORMAT},
+   {0x00B5, 1, EAIL_SB_LOWER},
+   {0x00BA, 1, EAIL_SB_LOWER},
+   {0x00BB, 1, EAIL_SB_CLOSE},
+   {0x00C0, 23, EAIL_SB_UPPER},
+   {0x00D8, 7, EAIL_SB_UPPER},
+   {0x00DF, 24, EAIL_SB_LOWER},
+   {0x00F8, 8, EAIL_SB_LOWER},
+   {0x0100, 1, EAIL_SB_UPPER},
+   {0x0101, 1, EAIL_SB_LOWER},
+   {0x0102, 1, EAIL_SB_UPPER},
+   {0x0103, 1, EAIL_SB_LOWER},
+   {0x0104, 1, EAIL_SB_UPPER},
+   {0x0105, 1, EAIL_SB_LOWER},
+   {0x0106, 1, EAIL_SB_UPPER},
+   {0x0107, 1, EAIL_SB_LOWER},
+   {0x0108, 1, EAIL_SB_UPPER},
+   {0x0109, 1, EAIL_SB_LOWER},
+   {0x010A, 1, EAIL_SB_UPPER},
+   {0x010B, 1, EAIL_SB_LOWER},
+   {0x010C, 1, EAIL_SB_UPPER},
+   {0x010D, 1, EAIL_SB_LOWER},
+   {0x010E, 1, EAIL_SB_UPPER},
+   {0x010F, 1, EAIL_SB_LOWER},
+   {0x0110, 1, EAIL_SB_UPPER},
+   {0x0111, 1, EAIL_SB_LOWER},
+   {0x0112, 1, EAIL_SB_UPPER},
+   {0x0113, 1, EAIL_SB_LOWER},
+   {0x0114, 1, EAIL_SB_UPPER},
+   {0x0115, 1, EAIL_SB_LOWER},
+   {0x0116, 1, EAIL_SB_UPPER},
+   {0x0117, 1, EAIL_SB_LOWER},
+   {0x0118, 1, EAIL_SB_UPPER},
+   {0x0119, 1, EAIL_SB_LOWER},
+   {0x011A, 1, EAIL_SB_UPPER},
+   {0x011B, 1, EAIL_SB_LOWER},
+   {0x011C, 1, EAIL_SB_UPPER},
+   {0x011D, 1, EAIL_SB_LOWER},
+   {0x011E, 1, EAIL_SB_UPPER},
+   {0x011F, 1, EAIL_SB_LOWER},
+   {0x0120, 1, EAIL_SB_UPPER},
+   {0x0121, 1, EAIL_SB_LOWER},
+   {0x0122, 1, EAIL_SB_UPPER},
+   {0x0123, 1, EAIL_SB_LOWER},
+   {0x0124, 1, EAIL_SB_UPPER},
+   {0x0125, 1, EAIL_SB_LOWER},
+   {0x0126, 1, EAIL_SB_UPPER},
+   {0x0127, 1, EAIL_SB_LOWER},
+   {0x0128, 1, EAIL_SB_UPPER},
+   {0x0129, 1, EAIL_SB_LOWER},
+   {0x012A, 1, EAIL_SB_UPPER},
+   {0x012B, 1, EAIL_SB_LOWER},
+   {0x012C, 1, EAIL_SB_UPPER},
+   {0x012D, 1, EAIL_SB_LOWER},
+   {0x012E, 1, EAIL_SB_UPPER},
+   {0x012F, 1, EAIL_SB_LOWER},
+   {0x0130, 1, EAIL_SB_UPPER},
+   {0x0131, 1, EAIL_SB_LOWER},
+   {0x0132, 1, EAIL_SB_UPPER},
+   {0x0133, 1, EAIL_SB_LOWER},
+   {0x0134, 1, EAIL_SB_UPPER},
+   {0x0135, 1, EAIL_SB_LOWER},
+   {0x0136, 1, EAIL_SB_UPPER},
+   {0x0137, 2, EAIL_SB_LOWER},
+   {0x0139, 1, EAIL_SB_UPPER},
+   {0x013A, 1, EAIL_SB_LOWER},
+   {0x013B, 1, EAIL_SB_UPPER},
+   {0x013C, 1, EAIL_SB_LOWER},
+   {0x013D, 1, EAIL_SB_UPPER},
+   {0x013E, 1, EAIL_SB_LOWER},
+   {0x013F, 1, EAIL_SB_UPPER},
+   {0x0140, 1, EAIL_SB_LOWER},
+   {0x0141, 1, EAIL_SB_UPPER},
+   {0x0142, 1, EAIL_SB_LOWER},
+   {0x0143, 1, EAIL_SB_UPPER},
+   {0x0144, 1, EAIL_SB_LOWER},
+   {0x0145, 1, EAIL_SB_UPPER},
+   {0x0146, 1, EAIL_SB_LOWER},
+   {0x0147, 1, EAIL_SB_UPPER},
+   {0x0148, 2, EAIL_SB_LOWER},
+   {0x014A, 1, EAIL_SB_UPPER},
+   {0x014B, 1, EAIL_SB_LOWER},
+   {0x014C, 1, EAIL_SB_UPPER},
+   {0x014D, 1, EAIL_SB_LOWER},
+   {0x014E, 1, EAIL_SB_UPPER},
+   {0x014F, 1, EAIL_SB_LOWER},
+   {0x0150, 1, EAIL_SB_UPPER},
+   {0x0151, 1, EAIL_SB_LOWER},
+   {0x0152, 1, EAIL_SB_UPPER},
+   {0x0153, 1, EAIL_SB_LOWER},
+   {0x0154, 1, EAIL_SB_UPPER},
+   {0x0155, 1, EAIL_SB_LOWER},
+   {0x0156, 1, EAIL_SB_UPPER},
+   {0x0157, 1, EAIL_SB_LOWER},
+   {0x0158, 1, EAIL_SB_UPPER},
+   {0x0159, 1, EAIL_SB_LOWER},
+   {0x015A, 1, EAIL_SB_UPPER},
+   {0x015B, 1, EAIL_SB_LOWER},
+   {0x015C, 1, EAIL_SB_UPPER},
+   {0x015D, 1, EAIL_SB_LOWER},
+   {0x015E, 1, EAIL_SB_UPPER},
+   {0x015F, 1, EAIL_SB_LOWER},
+   {0x0160, 1, EAIL_SB_UPPER},
+   {0x0161, 1, EAIL_SB_LOWER},
+   {0x0162, 1, EAIL_SB_UPPER},
+   {0x0163, 1, EAIL_SB_LOWER},
+   {0x0164, 1, EAIL_SB_UPPER},
+   {0x0165, 1, EAIL_SB_LOWER},
+   {0x0166, 1, EAIL_SB_UPPER},
+   {0x0167, 1, EAIL_SB_LOWER},
+   {0x0168, 1, EAIL_SB_UPPER},
+   {0x0169, 1, EAIL_SB_LOWER},
+   {0x016A, 1, EAIL_SB_UPPER},
+   {0x016B, 1, EAIL_SB_LOWER},
+   {0x016C, 1, EAIL_SB_UPPER},
+   {0x016D, 1, EAIL_SB_LOWER},
+   {0x016E, 1, EAIL_SB_UPPER},
+   {0x016F, 1, EAIL_SB_LOWER},
+   {0x0170, 1, EAIL_SB_UPPER},
+   {0x0171, 1, EAIL_SB_LOWER},
+   {0x0172, 1, EAIL_SB_UPPER},
+   {0x0173, 1, EAIL_SB_LOWER},
+   {0x0174, 1, EAIL_SB_UPPER},
+   {0x0175, 1, EAIL_SB_LOWER},
+   {0x0176, 1, EAIL_SB_UPPER},
+   {0x0177, 1, EAIL_SB_LOWER},
+   {0x0178, 2, EAIL_SB_UPPER},
+   {0x017A, 1, EAIL_SB_LOWER},
+   {0x017B, 1, EAIL_SB_UPPER},
+   {0x017C, 1, EAIL_SB_LOWER},
+   {0x017D, 1, EAIL_SB_UPPER},
+   {0x017E, 3, EAIL_SB_LOWER},
+   {0x0181, 2, EAIL_SB_UPPER},
+   {0x0183, 1, EAIL_SB_LOWER},
+   {0x0184, 1, EAIL_SB_UPPER},
+   {0x0185, 1, EAIL_SB_LOWER},
+   {0x0186, 2, EAIL_SB_UPPER},
+   {0x0188, 1, EAIL_SB_LOWER},
+   {0x0189, 3, EAIL_SB_UPPER},
+   {0x018C, 2, EAIL_SB_LOWER},
+   {0x018E, 4, EAIL_SB_UPPER},
+   {0x0192, 1, EAIL_SB_LOWER},
+   {0x0193, 2, EAIL_SB_UPPER},
+   {0x0195, 1, EAIL_SB_LOWER},
+   {0x0196, 3, EAIL_SB_UPPER},
+   {0x0199, 3, EAIL_SB_LOWER},
+   {0x019C, 2, EAIL_SB_UPPER},
+   {0x019E, 1, EAIL_SB_LOWER},
+   {0x019F, 2, EAIL_SB_UPPER},
+   {0x01A1, 1, EAIL_SB_LOWER},
+   {0x01A2, 1, EAIL_SB_UPPER},
+   {0x01A3, 1, EAIL_SB_LOWER},
+   {0x01A4, 1, EAIL_SB_UPPER},
+   {0x01A5, 1, EAIL_SB_LOWER},
+   {0x01A6, 2, EAIL_SB_UPPER},
+   {0x01A8, 1, EAIL_SB_LOWER},
+   {0x01A9, 1, EAIL_SB_UPPER},
+   {0x01AA, 2, EAIL_SB_LOWER},
+   {0x01AC, 1, EAIL_SB_UPPER},
+   {0x01AD, 1, EAIL_SB_LOWER},
+   {0x01AE, 2, EAIL_SB_UPPER},
+   {0x01B0, 1, EAIL_SB_LOWER},
+   {0x01B1, 3, EAIL_SB_UPPER},
+   {0x01B4, 1, EAIL_SB_LOWER},
+   {0x01B5, 1, EAIL_SB_UPPER},
+   {0x01B6, 1, EAIL_SB_LOWER},
+   {0x01B7, 2, EAIL_SB_UPPER},
+   {0x01B9, 2, EAIL_SB_LOWER},
+   {0x01BB, 1, EAIL_SB_OLETTER},
+   {0x01BC, 1, EAIL_SB_UPPER},
+   {0x01BD, 3, EAIL_SB_LOWER},
+   {0x01C0, 4, EAIL_SB_OLETTER},
+   {0x01C4, 2, EAIL_SB_UPPER},
+   {0x01C6, 1, EAIL_SB_LOWER},
+   {0x01C7, 2, EAIL_SB_UPPER},
+   {0x01C9, 1, EAIL_SB_LOWER},
+   {0x01CA, 2, EAIL_SB_UPPER},
+   {0x01CC, 1, EAIL_SB_LOWER},
+   {0x01CD, 1, EAIL_SB_UPPER},
+   {0x01CE, 1, EAIL_SB_LOWER},
+   {0x01CF, 1, EAIL_SB_UPPER},
+   {0x01D0, 1, EAIL_SB_LOWER},
+   {0x01D1, 1, EAIL_SB_UPPER},
+   {0x01D2, 1, EAIL_SB_LOWER},
+   {0x01D3, 1, EAIL_SB_UPPER},
+   {0x01D4, 1, EAIL_SB_LOWER},
+   {0x01D5, 1, EAIL_SB_UPPER},
+   {0x01D6, 1, EAIL_SB_LOWER},
+   {0x01D7, 1, EAIL_SB_UPPER},
+   {0x01D8, 1, EAIL_SB_LOWER},
+   {0x01D9, 1, EAIL_SB_UPPER},
+   {0x01DA, 1, EAIL_SB_LOWER},
+   {0x01DB, 1, EAIL_SB_UPPER},
+   {0x01DC, 2, EAIL_SB_LOWER},
+   {0x01DE, 1, EAIL_SB_UPPER},
+   {0x01DF, 1, EAIL_SB_LOWER},
+   {0x01E0, 1, EAIL_SB_UPPER},
+   {0x01E1, 1, EAIL_SB_LOWER},
+   {0x01E2, 1, EAIL_SB_UPPER},
+   {0x01E3, 1, EAIL_SB_LOWER},
+   {0x01E4, 1, EAIL_SB_UPPER},
+   {0x01E5, 1, EAIL_SB_LOWER},
+   {0x01E6, 1, EAIL_SB_UPPER},
+   {0x01E7, 1, EAIL_SB_LOWER},
+   {0x01E8, 1, EAIL_SB_UPPER},
+   {0x01E9, 1, EAIL_SB_LOWER},
+   {0x01EA, 1, EAIL_SB_UPPER},
+   {0x01EB, 1, EAIL_SB_LOWER},
+   {0x01EC, 1, EAIL_SB_UPPER},
+   {0x01ED, 1, EAIL_SB_LOWER},
+   {0x01EE, 1, EAIL_SB_UPPER},
+   {0x01EF, 2, EAIL_SB_LOWER},
+   {0x01F1, 2, EAIL_SB_UPPER},
+   {0x01F3, 1, EAIL_SB_LOWER},
+   {0x01F4, 1, EAIL_SB_UPPER},
+   {0x01F5, 1, EAIL_SB_LOWER},
+   {0x01F6, 3, EAIL_SB_UPPER},
+   {0x01F9, 1, EAIL_SB_LOWER},
+   {0x01FA, 1, EAIL_SB_UPPER},
+   {0x01FB, 1, EAIL_SB_LOWER},
+   {0x01FC, 1, EAIL_SB_UPPER},
+   {0x01FD, 1, EAIL_SB_LOWER},
+   {0x01FE, 1, EAIL_SB_UPPER},
+   {0x01FF, 1, EAIL_SB_LOWER},
+   {0x0200, 1, EAIL_SB_UPPER},
+   {0x0201, 1, EAIL_SB_LOWER},
+   {0x0202, 1, EAIL_SB_UPPER},
+   {0x0203, 1, EAIL_SB_LOWER},
+   {0x0204, 1, EAIL_SB_UPPER},
+   {0x0205, 1, EAIL_SB_LOWER},
+   {0x0206, 1, EAIL_SB_UPPER},
+   {0x0207, 1, EAIL_SB_LOWER},
+   {0x0208, 1, EAIL_SB_UPPER},
+   {0x0209, 1, EAIL_SB_LOWER},
+   {0x020A, 1, EAIL_SB_UPPER},
+   {0x020B, 1, EAIL_SB_LOWER},
+   {0x020C, 1, EAIL_SB_UPPER},
+   {0x020D, 1, EAIL_SB_LOWER},
+   {0x020E, 1, EAIL_SB_UPPER},
+   {0x020F, 1, EAIL_SB_LOWER},
+   {0x0210, 1, EAIL_SB_UPPER},
+   {0x0211, 1, EAIL_SB_LOWER},
+   {0x0212, 1, EAIL_SB_UPPER},
+   {0x0213, 1, EAIL_SB_LOWER},
+   {0x0214, 1, EAIL_SB_UPPER},
+   {0x0215, 1, EAIL_SB_LOWER},
+   {0x0216, 1, EAIL_SB_UPPER},
+   {0x0217, 1, EAIL_SB_LOWER},
+   {0x0218, 1, EAIL_SB_UPPER},
+   {0x0219, 1, EAIL_SB_LOWER},
+   {0x021A, 1, EAIL_SB_UPPER},
+   {0x021B, 1, EAIL_SB_LOWER},
+   {0x021C, 1, EAIL_SB_UPPER},
+   {0x021D, 1, EAIL_SB_LOWER},
+   {0x021E, 1, EAIL_SB_UPPER},
+   {0x021F, 1, EAIL_SB_LOWER},
+   {0x0220, 1, EAIL_SB_UPPER},
+   {0x0221, 1, EAIL_SB_LOWER},
+   {0x0222, 1, EAIL_SB_UPPER},
+   {0x0223, 1, EAIL_SB_LOWER},
+   {0x0224, 1, EAIL_SB_UPPER},
+   {0x0225, 1, EAIL_SB_LOWER},
+   {0x0226, 1, EAIL_SB_UPPER},
+   {0x0227, 1, EAIL_SB_LOWER},
+   {0x0228, 1, EAIL_SB_UPPER},
+   {0x0229, 1, EAIL_SB_LOWER},
+   {0x022A, 1, EAIL_SB_UPPER},
+   {0x022B, 1, EAIL_SB_LOWER},
+   {0x022C, 1, EAIL_SB_UPPER},
+   {0x022D, 1, EAIL_SB_LOWER},
+   {0x022E, 1, EAIL_SB_UPPER},
+   {0x022F, 1, EAIL_SB_LOWER},
+   {0x0230, 1, EAIL_SB_UPPER},
+   {0x0231, 1, EAIL_SB_LOWER},
+   {0x0232, 1, EAIL_SB_UPPER},
+   {0x0233, 7, EAIL_SB_LOWER},
+   {0x023A, 2, EAIL_SB_UPPER},
+   {0x023C, 1, EAIL_SB_LOWER},
+   {0x023D, 2, EAIL_SB_UPPER},
+   {0x023F, 2, EAIL_SB_LOWER},
+   {0x0241, 1, EAIL_SB_UPPER},
+   {0x0242, 1, EAIL_SB_LOWER},
+   {0x0243, 4, EAIL_SB_UPPER},
+   {0x0247, 1, EAIL_SB_LOWER},
+   {0x0248, 1, EAIL_SB_UPPER},
+   {0x0249, 1, EAIL_SB_LOWER},
+   {0x024A, 1, EAIL_SB_UPPER},
+   {0x024B, 1, EAIL_SB_LOWER},
+   {0x024C, 1, EAIL_SB_UPPER},
+   {0x024D, 1, EAIL_SB_LOWER},
+   {0x024E, 1, EAIL_SB_UPPER},
+   {0x024F, 69, EAIL_SB_LOWER},
+   {0x0294, 1, EAIL_SB_OLETTER},
+   {0x0295, 36, EAIL_SB_LOWER},
+   {0x02B9, 7, EAIL_SB_OLETTER},
+   {0x02C0, 2, EAIL_SB_LOWER},
+   {0x02C6, 12, EAIL_SB_OLETTER},
+   {0x02E0, 5, EAIL_SB_LOWER},
+   {0x02EC, 1, EAIL_SB_OLETTER},
+   {0x02EE, 1, EAIL_SB_OLETTER},
+   {0x0300, 112, EAIL_SB_EXTEND},
+   {0x0370, 1, EAIL_SB_UPPER},
+   {0x0371, 1, EAIL_SB_LOWER},
+   {0x0372, 1, EAIL_SB_UPPER},
+   {0x0373, 1, EAIL_SB_LOWER},
+   {0x0374, 1, EAIL_SB_OLETTER},
+   {0x0376, 1, EAIL_SB_UPPER},
+   {0x0377, 1, EAIL_SB_LOWER},
+   {0x037A, 4, EAIL_SB_LOWER},
+   {0x037F, 1, EAIL_SB_UPPER},
+   {0x0386, 1, EAIL_SB_UPPER},
+   {0x0388, 3, EAIL_SB_UPPER},
+   {0x038C, 1, EAIL_SB_UPPER},
+   {0x038E, 2, EAIL_SB_UPPER},
+   {0x0390, 1, EAIL_SB_LOWER},
+   {0x0391, 17, EAIL_SB_UPPER},
+   {0x03A3, 9, EAIL_SB_UPPER},
+   {0x03AC, 35, EAIL_SB_LOWER},
+   {0x03CF, 1, EAIL_SB_UPPER},
+   {0x03D0, 2, EAIL_SB_LOWER},
+   {0x03D2, 3, EAIL_SB_UPPER},
+   {0x03D5, 3, EAIL_SB_LOWER},
+   {0x03D8, 1, EAIL_SB_UPPER},
+   {0x03D9, 1, EAIL_SB_LOWER},
+   {0x03DA, 1, EAIL_SB_UPPER},
+   {0x03DB, 1, EAIL_SB_LOWER},
+   {0x03DC, 1, EAIL_SB_UPPER},
+   {0x03DD, 1, EAIL_SB_LOWER},
+   {0x03DE, 1, EAIL_SB_UPPER},
+   {0x03DF, 1, EAIL_SB_LOWER},
+   {0x03E0, 1, EAIL_SB_UPPER},
+   {0x03E1, 1, EAIL_SB_LOWER},
+   {0x03E2, 1, EAIL_SB_UPPER},
+   {0x03E3, 1, EAIL_SB_LOWER},
+   {0x03E4, 1, EAIL_SB_UPPER},
+   {0x03E5, 1, EAIL_SB_LOWER},
+   {0x03E6, 1, EAIL_SB_UPPER},
+   {0x03E7, 1, EAIL_SB_LOWER},
+   {0x03E8, 1, EAIL_SB_UPPER},
+   {0x03E9, 1, EAIL_SB_LOWER},
+   {0x03EA, 1, EAIL_SB_UPPER},
+   {0x03EB, 1, EAIL_SB_LOWER},
+   {0x03EC, 1, EAIL_SB_UPPER},
+   {0x03ED, 1, EAIL_SB_LOWER},
+   {0x03EE, 1, EAIL_SB_UPPER},
+   {0x03EF, 5, EAIL_SB_LOWER},
+   {0x03F4, 1, EAIL_SB_UPPER},
+   {0x03F5, 1, EAIL_SB_LOWER},
+   {0x03F7, 1, EAIL_SB_UPPER},
+   {0x03F8, 1, EAIL_SB_LOWER},
+   {0x03F9, 2, EAIL_SB_UPPER},
+   {0x03FB, 2, EAIL_SB_LOWER},
+   {0x03FD, 51, EAIL_SB_UPPER},
+   {0x0430, 48, EAIL_SB_LOWER},
+   {0x0460, 1, EAIL_SB_UPPER},
+   {0x0461, 1, EAIL_SB_LOWER},
+   {0x0462, 1, EAIL_SB_UPPER},
+   {0x0463, 1, EAIL_SB_LOWER},
+   {0x0464, 1, EAIL_SB_UPPER},
+   {0x0465, 1, EAIL_SB_LOWER},
+   {0x0466, 1, EAIL_SB_UPPER},
+   {0x0467, 1, EAIL_SB_LOWER},
+   {0x0468, 1, EAIL_SB_UPPER},
+   {0x0469, 1, EAIL_SB_LOWER},
+   {0x046A, 1, EAIL_SB_UPPER},
+   {0x046B, 1, EAIL_SB_LOWER},
+   {0x046C, 1, EAIL_SB_UPPER},
+   {0x046D, 1, EAIL_SB_LOWER},
+   {0x046E, 1, EAIL_SB_UPPER},
+   {0x046F, 1, EAIL_SB_LOWER},
+   {0x0470, 1, EAIL_SB_UPPER},
+   {0x0471, 1, EAIL_SB_LOWER},
+   {0x0472, 1, EAIL_SB_UPPER},
+   {0x0473, 1, EAIL_SB_LOWER},
+   {0x0474, 1, EAIL_SB_UPPER},
+   {0x0475, 1, EAIL_SB_LOWER},
+   {0x0476, 1, EAIL_SB_UPPER},
+   {0x0477, 1, EAIL_SB_LOWER},
+   {0x0478, 1, EAIL_SB_UPPER},
+   {0x0479, 1, EAIL_SB_LOWER},
+   {0x047A, 1, EAIL_SB_UPPER},
+   {0x047B, 1, EAIL_SB_LOWER},
+   {0x047C, 1, EAIL_SB_UPPER},
+   {0x047D, 1, EAIL_SB_LOWER},
+   {0x047E, 1, EAIL_SB_UPPER},
+   {0x047F, 1, EAIL_SB_LOWER},
+   {0x0480, 1, EAIL_SB_UPPER},
+   {0x0481, 1, EAIL_SB_LOWER},
+   {0x0483, 7, EAIL_SB_EXTEND},
+   {0x048A, 1, EAIL_SB_UPPER},
+   {0x048B, 1, EAIL_SB_LOWER},
+   {0x048C, 1, EAIL_SB_UPPER},
+   {0x048D, 1, EAIL_SB_LOWER},
+   {0x048E, 1, EAIL_SB_UPPER},
+   {0x048F, 1, EAIL_SB_LOWER},
+   {0x0490, 1, EAIL_SB_UPPER},
+   {0x0491, 1, EAIL_SB_LOWER},
+   {0x0492, 1, EAIL_SB_UPPER},
+   {0x0493, 1, EAIL_SB_LOWER},
+   {0x0494, 1, EAIL_SB_UPPER},
+   {0x0495, 1, EAIL_SB_LOWER},
+   {0x0496, 1, EAIL_SB_UPPER},
+   {0x0497, 1, EAIL_SB_LOWER},
+   {0x0498, 1, EAIL_SB_UPPER},
+   {0x0499, 1, EAIL_SB_LOWER},
+   {0x049A, 1, EAIL_SB_UPPER},
+   {0x049B, 1, EAIL_SB_LOWER},
+   {0x049C, 1, EAIL_SB_UPPER},
+   {0x049D, 1, EAIL_SB_LOWER},
+   {0x049E, 1, EAIL_SB_UPPER},
+   {0x049F, 1, EAIL_SB_LOWER},
+   {0x04A0, 1, EAIL_SB_UPPER},
+   {0x04A1, 1, EAIL_SB_LOWER},
+   {0x04A2, 1, EAIL_SB_UPPER},
+   {0x04A3, 1, EAIL_SB_LOWER},
+   {0x04A4, 1, EAIL_SB_UPPER},
+   {0x04A5, 1, EAIL_SB_LOWER},
+   {0x04A6, 1, EAIL_SB_UPPER},
+   {0x04A7, 1, EAIL_SB_LOWER},
+   {0x04A8, 1, EAIL_SB_UPPER},
+   {0x04A9, 1, EAIL_SB_LOWER},
+   {0x04AA, 1, EAIL_SB_UPPER},
+   {0x04AB, 1, EAIL_SB_LOWER},
+   {0x04AC, 1, EAIL_SB_UPPER},
+   {0x04AD, 1, EAIL_SB_LOWER},
+   {0x04AE, 1, EAIL_SB_UPPER},
+   {0x04AF, 1, EAIL_SB_LOWER},
+   {0x04B0, 1, EAIL_SB_UPPER},
+   {0x04B1, 1, EAIL_SB_LOWER},
+   {0x04B2, 1, EAIL_SB_UPPER},
+   {0x04B3, 1, EAIL_SB_LOWER},
+   {0x04B4, 1, EAIL_SB_UPPER},
+   {0x04B5, 1, EAIL_SB_LOWER},
+   {0x04B6, 1, EAIL_SB_UPPER},
+   {0x04B7, 1, EAIL_SB_LOWER},
+   {0x04B8, 1, EAIL_SB_UPPER},
+   {0x04B9, 1, EAIL_SB_LOWER},
+   {0x04BA, 1, EAIL_SB_UPPER},
+   {0x04BB, 1, EAIL_SB_LOWER},
+   {0x04BC, 1, EAIL_SB_UPPER},
+   {0x04BD, 1, EAIL_SB_LOWER},
+   {0x04BE, 1, EAIL_SB_UPPER},
+   {0x04BF, 1, EAIL_SB_LOWER},
+   {0x04C0, 2, EAIL_SB_UPPER},
+   {0x04C2, 1, EAIL_SB_LOWER},
+   {0x04C3, 1, EAIL_SB_UPPER},
+   {0x04C4, 1, EAIL_SB_LOWER},
+   {0x04C5, 1, EAIL_SB_UPPER},
+   {0x04C6, 1, EAIL_SB_LOWER},
+   {0x04C7, 1, EAIL_SB_UPPER},
+   {0x04C8, 1, EAIL_SB_LOWER},
+   {0x04C9, 1, EAIL_SB_UPPER},
+   {0x04CA, 1, EAIL_SB_LOWER},
+   {0x04CB, 1, EAIL_SB_UPPER},
+   {0x04CC, 1, EAIL_SB_LOWER},
+   {0x04CD, 1, EAIL_SB_UPPER},
+   {0x04CE, 2, EAIL_SB_LOWER},
+   {0x04D0, 1, EAIL_SB_UPPER},
+   {0x04D1, 1, EAIL_SB_LOWER},
+   {0x04D2, 1, EAIL_SB_UPPER},
+   {0x04D3, 1, EAIL_SB_LOWER},
+   {0x04D4, 1, EAIL_SB_UPPER},
+   {0x04D5, 1, EAIL_SB_LOWER},
+   {0x04D6, 1, EAIL_SB_UPPER},
+   {0x04D7, 1, EAIL_SB_LOWER},
+   {0x04D8, 1, EAIL_SB_UPPER},
+   {0x04D9, 1, EAIL_SB_LOWER},
+   {0x04DA, 1, EAIL_SB_UPPER},
+   {0x04DB, 1, EAIL_SB_LOWER},
+   {0x04DC, 1, EAIL_SB_UPPER},
+   {0x04DD, 1, EAIL_SB_LOWER},
+   {0x04DE, 1, EAIL_SB_UPPER},
+   {0x04DF, 1, EAIL_SB_LOWER},
+   {0x04E0, 1, EAIL_SB_UPPER},
+   {0x04E1, 1, EAIL_SB_LOWER},
+   {0x04E2, 1, EAIL_SB_UPPER},
+   {0x04E3, 1, EAIL_SB_LOWER},
+   {0x04E4, 1, EAIL_SB_UPPER},
+   {0x04E5, 1, EAIL_SB_LOWER},
+   {0x04E6, 1, EAIL_SB_UPPER},
+   {0x04E7, 1, EAIL_SB_LOWER},
+   {0x04E8, 1, EAIL_SB_UPPER},
+   {0x04E9, 1, EAIL_SB_LOWER},
+   {0x04EA, 1, EAIL_SB_UPPER},
+   {0x04EB, 1, EAIL_SB_LOWER},
+   {0x04EC, 1, EAIL_SB_UPPER},
+   {0x04ED, 1, EAIL_SB_LOWER},
+   {0x04EE, 1, EAIL_SB_UPPER},
+   {0x04EF, 1, EAIL_SB_LOWER},
+   {0x04F0, 1, EAIL_SB_UPPER},
+   {0x04F1, 1, EAIL_SB_LOWER},
+   {0x04F2, 1, EAIL_SB_UPPER},
+   {0x04F3, 1, EAIL_SB_LOWER},
+   {0x04F4, 1, EAIL_SB_UPPER},
+   {0x04F5, 1, EAIL_SB_LOWER},
+   {0x04F6, 1, EAIL_SB_UPPER},
+   {0x04F7, 1, EAIL_SB_LOWER},
+   {0x04F8, 1, EAIL_SB_UPPER},
+   {0x04F9, 1, EAIL_SB_LOWER},
+   {0x04FA, 1, EAIL_SB_UPPER},
+   {0x04FB, 1, EAIL_SB_LOWER},
+   {0x04FC, 1, EAIL_SB_UPPER},
+   {0x04FD, 1, EAIL_SB_LOWER},
+   {0x04FE, 1, EAIL_SB_UPPER},
+   {0x04FF, 1, EAIL_SB_LOWER},
+   {0x0500, 1, EAIL_SB_UPPER},
+   {0x0501, 1, EAIL_SB_LOWER},
+   {0x0502, 1, EAIL_SB_UPPER},
+   {0x0503, 1, EAIL_SB_LOWER},
+   {0x0504, 1, EAIL_SB_UPPER},
+   {0x0505, 1, EAIL_SB_LOWER},
+   {0x0506, 1, EAIL_SB_UPPER},
+   {0x0507, 1, EAIL_SB_LOWER},
+   {0x0508, 1, EAIL_SB_UPPER},
+   {0x0509, 1, EAIL_SB_LOWER},
+   {0x050A, 1, EAIL_SB_UPPER},
+   {0x050B, 1, EAIL_SB_LOWER},
+   {0x050C, 1, EAIL_SB_UPPER},
+   {0x050D, 1, EAIL_SB_LOWER},
+   {0x050E, 1, EAIL_SB_UPPER},
+   {0x050F, 1, EAIL_SB_LOWER},
+   {0x0510, 1, EAIL_SB_UPPER},
+   {0x0511, 1, EAIL_SB_LOWER},
+   {0x0512, 1, EAIL_SB_UPPER},
+   {0x0513, 1, EAIL_SB_LOWER},
+   {0x0514, 1, EAIL_SB_UPPER},
+   {0x0515, 1, EAIL_SB_LOWER},
+   {0x0516, 1, EAIL_SB_UPPER},
+   {0x0517, 1, EAIL_SB_LOWER},
+   {0x0518, 1, EAIL_SB_UPPER},
+   {0x0519, 1, EAIL_SB_LOWER},
+   {0x051A, 1, EAIL_SB_UPPER},
+   {0x051B, 1, EAIL_SB_LOWER},
+   {0x051C, 1, EAIL_SB_UPPER},
+   {0x051D, 1, EAIL_SB_LOWER},
+   {0x051E, 1, EAIL_SB_UPPER},
+   {0x051F, 1, EAIL_SB_LOWER},
+   {0x0520, 1, EAIL_SB_UPPER},
+   {0x0521, 1, EAIL_SB_LOWER},
+   {0x0522, 1, EAIL_SB_UPPER},
+   {0x0523, 1, EAIL_SB_LOWER},
+   {0x0524, 1, EAIL_SB_UPPER},
+   {0x0525, 1, EAIL_SB_LOWER},
+   {0x0526, 1, EAIL_SB_UPPER},
+   {0x0527, 1, EAIL_SB_LOWER},
+   {0x0528, 1, EAIL_SB_UPPER},
+   {0x0529, 1, EAIL_SB_LOWER},
+   {0x052A, 1, EAIL_SB_UPPER},
+   {0x052B, 1, EAIL_SB_LOWER},
+   {0x052C, 1, EAIL_SB_UPPER},
+   {0x052D, 1, EAIL_SB_LOWER},
+   {0x052E, 1, EAIL_SB_UPPER},
+   {0x052F, 1, EAIL_SB_LOWER},
+   {0x0531, 38, EAIL_SB_UPPER},
+   {0x0559, 1, EAIL_SB_OLETTER},
+   {0x055D, 1, EAIL_SB_SCONTINUE},
+   {0x0560, 41, EAIL_SB_LOWER},
+   {0x0589, 1, EAIL_SB_STERM},
+   {0x0591, 45, EAIL_SB_EXTEND},
+   {0x05BF, 1, EAIL_SB_EXTEND},
+   {0x05C1, 2, EAIL_SB_EXTEND},
+   {0x05C4, 2, EAIL_SB_EXTEND},
+   {0x05C7, 1, EAIL_SB_EXTEND},
+   {0x05D0, 27, EAIL_SB_OLETTER},
+   {0x05EF, 5, EAIL_SB_OLETTER},
+   {0x0600, 6, EAIL_SB_FORMAT},
+   {0x060C, 2, EAIL_SB_SCONTINUE},
+   {0x0610, 11, EAIL_SB_EXTEND},
+   {0x061C, 1, EAIL_SB_FORMAT},
+   {0x061D, 3, EAIL_SB_STERM},
+   {0x0620, 43, EAIL_SB_OLETTER},
+   {0x064B, 21, EAIL_SB_EXTEND},
+   {0x0660, 10, EAIL_SB_NUMERIC},
+   {0x066B, 2, EAIL_SB_NUMERIC},
+   {0x066E, 2, EAIL_SB_OLETTER},
+   {0x0670, 1, EAIL_SB_EXTEND},
+   {0x0671, 99, EAIL_SB_OLETTER},
+   {0x06D4, 1, EAIL_SB_STERM},
+   {0x06D5, 1, EAIL_SB_OLETTER},
+   {0x06D6, 7, EAIL_SB_EXTEND},
+   {0x06DD, 1, EAIL_SB_FORMAT},
+   {0x06DF, 6, EAIL_SB_EXTEND},
+   {0x06E5, 2, EAIL_SB_OLETTER},
+   {0x06E7, 2, EAIL_SB_EXTEND},
+   {0x06EA, 4, EAIL_SB_EXTEND},
+   {0x06EE, 2, EAIL_SB_OLETTER},
+   {0x06F0, 10, EAIL_SB_NUMERIC},
+   {0x06FA, 3, EAIL_SB_OLETTER},
+   {0x06FF, 1, EAIL_SB_OLETTER},
+   {0x0700, 3, EAIL_SB_STERM},
+   {0x070F, 1, EAIL_SB_FORMAT},
+   {0x0710, 1, EAIL_SB_OLETTER},
+   {0x0711, 1, EAIL_SB_EXTEND},
+   {0x0712, 30, EAIL_SB_OLETTER},
+   {0x0730, 27, EAIL_SB_EXTEND},
+   {0x074D, 89, EAIL_SB_OLETTER},
+   {0x07A6, 11, EAIL_SB_EXTEND},
+   {0x07B1, 1, EAIL_SB_OLETTER},
+   {0x07C0, 10, EAIL_SB_NUMERIC},
+   {0x07CA, 33, EAIL_SB_OLETTER},
+   {0x07EB, 9, EAIL_SB_EXTEND},
+   {0x07F4, 2, EAIL_SB_OLETTER},
+   {0x07F8, 1, EAIL_SB_SCONTINUE},
+   {0x07F9, 1, EAIL_SB_STERM},
+   {0x07FA, 1, EAIL_SB_OLETTER},
+   {0x07FD, 1, EAIL_SB_EXTEND},
+   {0x0800, 22, EAIL_SB_OLETTER},
+   {0x0816, 4, EAIL_SB_EXTEND},
+   {0x081A, 1, EAIL_SB_OLETTER},
+   {0x081B, 9, EAIL_SB_EXTEND},
+   {0x0824, 1, EAIL_SB_OLETTER},
+   {0x0825, 3, EAIL_SB_EXTEND},
+   {0x0828, 1, EAIL_SB_OLETTER},
+   {0x0829, 5, EAIL_SB_EXTEND},
+   {0x0837, 1, EAIL_SB_STERM},
+   {0x0839, 1, EAIL_SB_STERM},
+   {0x083D, 2, EAIL_SB_STERM},
+   {0x0840, 25, EAIL_SB_OLETTER},
+   {0x0859, 3, EAIL_SB_EXTEND},
+   {0x0860, 11, EAIL_SB_OLETTER},
+   {0x0870, 24, EAIL_SB_OLETTER},
+   {0x0889, 6, EAIL_SB_OLETTER},
+   {0x0890, 2, EAIL_SB_FORMAT},
+   {0x0898, 8, EAIL_SB_EXTEND},
+   {0x08A0, 42, EAIL_SB_OLETTER},
+   {0x08CA, 24, EAIL_SB_EXTEND},
+   {0x08E2, 1, EAIL_SB_FORMAT},
+   {0x08E3, 33, EAIL_SB_EXTEND},
+   {0x0904, 54, EAIL_SB_OLETTER},
+   {0x093A, 3, EAIL_SB_EXTEND},
+   {0x093D, 1, EAIL_SB_OLETTER},
+   {0x093E, 18, EAIL_SB_EXTEND},
+   {0x0950, 1, EAIL_SB_OLETTER},
+   {0x0951, 7, EAIL_SB_EXTEND},
+   {0x0958, 10, EAIL_SB_OLETTER},
+   {0x0962, 2, EAIL_SB_EXTEND},
+   {0x0964, 2, EAIL_SB_STERM},
+   {0x0966, 10, EAIL_SB_NUMERIC},
+   {0x0971, 16, EAIL_SB_OLETTER},
+   {0x0981, 3, EAIL_SB_EXTEND},
+   {0x0985, 8, EAIL_SB_OLETTER},
+   {0x098F, 2, EAIL_SB_OLETTER},
+   {0x0993, 22, EAIL_SB_OLETTER},
+   {0x09AA, 7, EAIL_SB_OLETTER},
+   {0x09B2, 1, EAIL_SB_OLETTER},
+   {0x09B6, 4, EAIL_SB_OLETTER},
+   {0x09BC, 1, EAIL_SB_EXTEND},
+   {0x09BD, 1, EAIL_SB_OLETTER},
+   {0x09BE, 7, EAIL_SB_EXTEND},
+   {0x09C7, 2, EAIL_SB_EXTEND},
+   {0x09CB, 3, EAIL_SB_EXTEND},
+   {0x09CE, 1, EAIL_SB_OLETTER},
+   {0x09D7, 1, EAIL_SB_EXTEND},
+   {0x09DC, 2, EAIL_SB_OLETTER},
+   {0x09DF, 3, EAIL_SB_OLETTER},
+   {0x09E2, 2, EAIL_SB_EXTEND},
+   {0x09E6, 10, EAIL_SB_NUMERIC},
+   {0x09F0, 2, EAIL_SB_OLETTER},
+   {0x09FC, 1, EAIL_SB_OLETTER},
+   {0x09FE, 1, EAIL_SB_EXTEND},
+   {0x0A01, 3, EAIL_SB_EXTEND},
+   {0x0A05, 6, EAIL_SB_OLETTER},
+   {0x0A0F, 2, EAIL_SB_OLETTER},
+   {0x0A13, 22, EAIL_SB_OLETTER},
+   {0x0A2A, 7, EAIL_SB_OLETTER},
+   {0x0A32, 2, EAIL_SB_OLETTER},
+   {0x0A35, 2, EAIL_SB_OLETTER},
+   {0x0A38, 2, EAIL_SB_OLETTER},
+   {0x0A3C, 1, EAIL_SB_EXTEND},
+   {0x0A3E, 5, EAIL_SB_EXTEND},
+   {0x0A47, 2, EAIL_SB_EXTEND},
+   {0x0A4B, 3, EAIL_SB_EXTEND},
+   {0x0A51, 1, EAIL_SB_EXTEND},
+   {0x0A59, 4, EAIL_SB_OLETTER},
+   {0x0A5E, 1, EAIL_SB_OLETTER},
+   {0x0A66, 10, EAIL_SB_NUMERIC},
+   {0x0A70, 2, EAIL_SB_EXTEND},
+   {0x0A72, 3, EAIL_SB_OLETTER},
+   {0x0A75, 1, EAIL_SB_EXTEND},
+   {0x0A81, 3, EAIL_SB_EXTEND},
+   {0x0A85, 9, EAIL_SB_OLETTER},
+   {0x0A8F, 3, EAIL_SB_OLETTER},
+   {0x0A93, 22, EAIL_SB_OLETTER},
+   {0x0AAA, 7, EAIL_SB_OLETTER},
+   {0x0AB2, 2, EAIL_SB_OLETTER},
+   {0x0AB5, 5, EAIL_SB_OLETTER},
+   {0x0ABC, 1, EAIL_SB_EXTEND},
+   {0x0ABD, 1, EAIL_SB_OLETTER},
+   {0x0ABE, 8, EAIL_SB_EXTEND},
+   {0x0AC7, 3, EAIL_SB_EXTEND},
+   {0x0ACB, 3, EAIL_SB_EXTEND},
+   {0x0AD0, 1, EAIL_SB_OLETTER},
+   {0x0AE0, 2, EAIL_SB_OLETTER},
+   {0x0AE2, 2, EAIL_SB_EXTEND},
+   {0x0AE6, 10, EAIL_SB_NUMERIC},
+   {0x0AF9, 1, EAIL_SB_OLETTER},
+   {0x0AFA, 6, EAIL_SB_EXTEND},
+   {0x0B01, 3, EAIL_SB_EXTEND},
+   {0x0B05, 8, EAIL_SB_OLETTER},
+   {0x0B0F, 2, EAIL_SB_OLETTER},
+   {0x0B13, 22, EAIL_SB_OLETTER},
+   {0x0B2A, 7, EAIL_SB_OLETTER},
+   {0x0B32, 2, EAIL_SB_OLETTER},
+   {0x0B35, 5, EAIL_SB_OLETTER},
+   {0x0B3C, 1, EAIL_SB_EXTEND},
+   {0x0B3D, 1, EAIL_SB_OLETTER},
+   {0x0B3E, 7, EAIL_SB_EXTEND},
+   {0x0B47, 2, EAIL_SB_EXTEND},
+   {0x0B4B, 3, EAIL_SB_EXTEND},
+   {0x0B55, 3, EAIL_SB_EXTEND},
+   {0x0B5C, 2, EAIL_SB_OLETTER},
+   {0x0B5F, 3, EAIL_SB_OLETTER},
+   {0x0B62, 2, EAIL_SB_EXTEND},
+   {0x0B66, 10, EAIL_SB_NUMERIC},
+   {0x0B71, 1, EAIL_SB_OLETTER},
+   {0x0B82, 1, EAIL_SB_EXTEND},
+   {0x0B83, 1, EAIL_SB_OLETTER},
+   {0x0B85, 6, EAIL_SB_OLETTER},
+   {0x0B8E, 3, EAIL_SB_OLETTER},
+   {0x0B92, 4, EAIL_SB_OLETTER},
+   {0x0B99, 2, EAIL_SB_OLETTER},
+   {0x0B9C, 1, EAIL_SB_OLETTER},
+   {0x0B9E, 2, EAIL_SB_OLETTER},
+   {0x0BA3, 2, EAIL_SB_OLETTER},
+   {0x0BA8, 3, EAIL_SB_OLETTER},
+   {0x0BAE, 12, EAIL_SB_OLETTER},
+   {0x0BBE, 5, EAIL_SB_EXTEND},
+   {0x0BC6, 3, EAIL_SB_EXTEND},
+   {0x0BCA, 4, EAIL_SB_EXTEND},
+   {0x0BD0, 1, EAIL_SB_OLETTER},
+   {0x0BD7, 1, EAIL_SB_EXTEND},
+   {0x0BE6, 10, EAIL_SB_NUMERIC},
+   {0x0C00, 5, EAIL_SB_EXTEND},
+   {0x0C05, 8, EAIL_SB_OLETTER},
+   {0x0C0E, 3, EAIL_SB_OLETTER},
+   {0x0C12, 23, EAIL_SB_OLETTER},
+   {0x0C2A, 16, EAIL_SB_OLETTER},
+   {0x0C3C, 1, EAIL_SB_EXTEND},
+   {0x0C3D, 1, EAIL_SB_OLETTER},
+   {0x0C3E, 7, EAIL_SB_EXTEND},
+   {0x0C46, 3, EAIL_SB_EXTEND},
+   {0x0C4A, 4, EAIL_SB_EXTEND},
+   {0x0C55, 2, EAIL_SB_EXTEND},
+   {0x0C58, 3, EAIL_SB_OLETTER},
+   {0x0C5D, 1, EAIL_SB_OLETTER},
+   {0x0C60, 2, EAIL_SB_OLETTER},
+   {0x0C62, 2, EAIL_SB_EXTEND},
+   {0x0C66, 10, EAIL_SB_NUMERIC},
+   {0x0C80, 1, EAIL_SB_OLETTER},
+   {0x0C81, 3, EAIL_SB_EXTEND},
+   {0x0C85, 8, EAIL_SB_OLETTER},
+   {0x0C8E, 3, EAIL_SB_OLETTER},
+   {0x0C92, 23, EAIL_SB_OLETTER},
+   {0x0CAA, 10, EAIL_SB_OLETTER},
+   {0x0CB5, 5, EAIL_SB_OLETTER},
+   {0x0CBC, 1, EAIL_SB_EXTEND},
+   {0x0CBD, 1, EAIL_SB_OLETTER},
+   {0x0CBE, 7, EAIL_SB_EXTEND},
+   {0x0CC6, 3, EAIL_SB_EXTEND},
+   {0x0CCA, 4, EAIL_SB_EXTEND},
+   {0x0CD5, 2, EAIL_SB_EXTEND},
+   {0x0CDD, 2, EAIL_SB_OLETTER},
+   {0x0CE0, 2, EAIL_SB_OLETTER},
+   {0x0CE2, 2, EAIL_SB_EXTEND},
+   {0x0CE6, 10, EAIL_SB_NUMERIC},
+   {0x0CF1, 2, EAIL_SB_OLETTER},
+   {0x0D00, 4, EAIL_SB_EXTEND},
+   {0x0D04, 9, EAIL_SB_OLETTER},
+   {0x0D0E, 3, EAIL_SB_OLETTER},
+   {0x0D12, 41, EAIL_SB_OLETTER},
+   {0x0D3B, 2, EAIL_SB_EXTEND},
+   {0x0D3D, 1, EAIL_SB_OLETTER},
+   {0x0D3E, 7, EAIL_SB_EXTEND},
+   {0x0D46, 3, EAIL_SB_EXTEND},
+   {0x0D4A, 4, EAIL_SB_EXTEND},
+   {0x0D4E, 1, EAIL_SB_OLETTER},
+   {0x0D54, 3, EAIL_SB_OLETTER},
+   {0x0D57, 1, EAIL_SB_EXTEND},
+   {0x0D5F, 3, EAIL_SB_OLETTER},
+   {0x0D62, 2, EAIL_SB_EXTEND},
+   {0x0D66, 10, EAIL_SB_NUMERIC},
+   {0x0D7A, 6, EAIL_SB_OLETTER},
+   {0x0D81, 3, EAIL_SB_EXTEND},
+   {0x0D85, 18, EAIL_SB_OLETTER},
+   {0x0D9A, 24, EAIL_SB_OLETTER},
+   {0x0DB3, 9, EAIL_SB_OLETTER},
+   {0x0DBD, 1, EAIL_SB_OLETTER},
+   {0x0DC0, 7, EAIL_SB_OLETTER},
+   {0x0DCA, 1, EAIL_SB_EXTEND},
+   {0x0DCF, 6, EAIL_SB_EXTEND},
+   {0x0DD6, 1, EAIL_SB_EXTEND},
+   {0x0DD8, 8, EAIL_SB_EXTEND},
+   {0x0DE6, 10, EAIL_SB_NUMERIC},
+   {0x0DF2, 2, EAIL_SB_EXTEND},
+   {0x0E01, 48, EAIL_SB_OLETTER},
+   {0x0E31, 1, EAIL_SB_EXTEND},
+   {0x0E32, 2, EAIL_SB_OLETTER},
+   {0x0E34, 7, EAIL_SB_EXTEND},
+   {0x0E40, 7, EAIL_SB_OLETTER},
+   {0x0E47, 8, EAIL_SB_EXTEND},
+   {0x0E50, 10, EAIL_SB_NUMERIC},
+   {0x0E81, 2, EAIL_SB_OLETTER},
+   {0x0E84, 1, EAIL_SB_OLETTER},
+   {0x0E86, 5, EAIL_SB_OLETTER},
+   {0x0E8C, 24, EAIL_SB_OLETTER},
+   {0x0EA5, 1, EAIL_SB_OLETTER},
+   {0x0EA7, 10, EAIL_SB_OLETTER},
+   {0x0EB1, 1, EAIL_SB_EXTEND},
+   {0x0EB2, 2, EAIL_SB_OLETTER},
+   {0x0EB4, 9, EAIL_SB_EXTEND},
+   {0x0EBD, 1, EAIL_SB_OLETTER},
+   {0x0EC0, 5, EAIL_SB_OLETTER},
+   {0x0EC6, 1, EAIL_SB_OLETTER},
+   {0x0EC8, 6, EAIL_SB_EXTEND},
+   {0x0ED0, 10, EAIL_SB_NUMERIC},
+   {0x0EDC, 4, EAIL_SB_OLETTER},
+   {0x0F00, 1, EAIL_SB_OLETTER},
+   {0x0F18, 2, EAIL_SB_EXTEND},
+   {0x0F20, 10, EAIL_SB_NUMERIC},
+   {0x0F35, 1, EAIL_SB_EXTEND},
+   {0x0F37, 1, EAIL_SB_EXTEND},
+   {0x0F39, 1, EAIL_SB_EXTEND},
+   {0x0F3A, 4, EAIL_SB_CLOSE},
+   {0x0F3E, 2, EAIL_SB_EXTEND},
+   {0x0F40, 8, EAIL_SB_OLETTER},
+   {0x0F49, 36, EAIL_SB_OLETTER},
+   {0x0F71, 20, EAIL_SB_EXTEND},
+   {0x0F86, 2, EAIL_SB_EXTEND},
+   {0x0F88, 5, EAIL_SB_OLETTER},
+   {0x0F8D, 11, EAIL_SB_EXTEND},
+   {0x0F99, 36, EAIL_SB_EXTEND},
+   {0x0FC6, 1, EAIL_SB_EXTEND},
+   {0x1000, 43, EAIL_SB_OLETTER},
+   {0x102B, 20, EAIL_SB_EXTEND},
+   {0x103F, 1, EAIL_SB_OLETTER},
+   {0x1040, 10, EAIL_SB_NUMERIC},
+   {0x104A, 2, EAIL_SB_STERM},
+   {0x1050, 6, EAIL_SB_OLETTER},
+   {0x1056, 4, EAIL_SB_EXTEND},
+   {0x105A, 4, EAIL_SB_OLETTER},
+   {0x105E, 3, EAIL_SB_EXTEND},
+   {0x1061, 1, EAIL_SB_OLETTER},
+   {0x1062, 3, EAIL_SB_EXTEND},
+   {0x1065, 2, EAIL_SB_OLETTER},
+   {0x1067, 7, EAIL_SB_EXTEND},
+   {0x106E, 3, EAIL_SB_OLETTER},
+   {0x1071, 4, EAIL_SB_EXTEND},
+   {0x1075, 13, EAIL_SB_OLETTER},
+   {0x1082, 12, EAIL_SB_EXTEND},
+   {0x108E, 1, EAIL_SB_OLETTER},
+   {0x108F, 1, EAIL_SB_EXTEND},
+   {0x1090, 10, EAIL_SB_NUMERIC},
+   {0x109A, 4, EAIL_SB_EXTEND},
+   {0x10A0, 38, EAIL_SB_UPPER},
+   {0x10C7, 1, EAIL_SB_UPPER},
+   {0x10CD, 1, EAIL_SB_UPPER},
+   {0x10D0, 43, EAIL_SB_OLETTER},
+   {0x10FC, 333, EAIL_SB_OLETTER},
+   {0x124A, 4, EAIL_SB_OLETTER},
+   {0x1250, 7, EAIL_SB_OLETTER},
+   {0x1258, 1, EAIL_SB_OLETTER},
+   {0x125A, 4, EAIL_SB_OLETTER},
+   {0x1260, 41, EAIL_SB_OLETTER},
+   {0x128A, 4, EAIL_SB_OLETTER},
+   {0x1290, 33, EAIL_SB_OLETTER},
+   {0x12B2, 4, EAIL_SB_OLETTER},
+   {0x12B8, 7, EAIL_SB_OLETTER},
+   {0x12C0, 1, EAIL_SB_OLETTER},
+   {0x12C2, 4, EAIL_SB_OLETTER},
+   {0x12C8, 15, EAIL_SB_OLETTER},
+   {0x12D8, 57, EAIL_SB_OLETTER},
+   {0x1312, 4, EAIL_SB_OLETTER},
+   {0x1318, 67, EAIL_SB_OLETTER},
+   {0x135D, 3, EAIL_SB_EXTEND},
+   {0x1362, 1, EAIL_SB_STERM},
+   {0x1367, 2, EAIL_SB_STERM},
+   {0x1380, 16, EAIL_SB_OLETTER},
+   {0x13A0, 86, EAIL_SB_UPPER},
+   {0x13F8, 6, EAIL_SB_LOWER},
+   {0x1401, 620, EAIL_SB_OLETTER},
+   {0x166E, 1, EAIL_SB_STERM},
+   {0x166F, 17, EAIL_SB_OLETTER},
+   {0x1680, 1, EAIL_SB_SP},
+   {0x1681, 26, EAIL_SB_OLETTER},
+   {0x169B, 2, EAIL_SB_CLOSE},
+   {0x16A0, 75, EAIL_SB_OLETTER},
+   {0x16EE, 11, EAIL_SB_OLETTER},
+   {0x1700, 18, EAIL_SB_OLETTER},
+   {0x1712, 4, EAIL_SB_EXTEND},
+   {0x171F, 19, EAIL_SB_OLETTER},
+   {0x1732, 3, EAIL_SB_EXTEND},
+   {0x1735, 2, EAIL_SB_STERM},
+   {0x1740, 18, EAIL_SB_OLETTER},
+   {0x1752, 2, EAIL_SB_EXTEND},
+   {0x1760, 13, EAIL_SB_OLETTER},
+   {0x176E, 3, EAIL_SB_OLETTER},
+   {0x1772, 2, EAIL_SB_EXTEND},
+   {0x1780, 52, EAIL_SB_OLETTER},
+   {0x17B4, 32, EAIL_SB_EXTEND},
+   {0x17D7, 1, EAIL_SB_OLETTER},
+   {0x17DC, 1, EAIL_SB_OLETTER},
+   {0x17DD, 1, EAIL_SB_EXTEND},
+   {0x17E0, 10, EAIL_SB_NUMERIC},
+   {0x1802, 1, EAIL_SB_SCONTINUE},
+   {0x1803, 1, EAIL_SB_STERM},
+   {0x1808, 1, EAIL_SB_SCONTINUE},
+   {0x1809, 1, EAIL_SB_STERM},
+   {0x180B, 3, EAIL_SB_EXTEND},
+   {0x180E, 1, EAIL_SB_FORMAT},
+   {0x180F, 1, EAIL_SB_EXTEND},
+   {0x1810, 10, EAIL_SB_NUMERIC},
+   {0x1820, 89, EAIL_SB_OLETTER},
+   {0x1880, 5, EAIL_SB_OLETTER},
+   {0x1885, 2, EAIL_SB_EXTEND},
+   {0x1887, 34, EAIL_SB_OLETTER},
+   {0x18A9, 1, EAIL_SB_EXTEND},
+   {0x18AA, 1, EAIL_SB_OLETTER},
+   {0x18B0, 70, EAIL_SB_OLETTER},
+   {0x1900, 31, EAIL_SB_OLETTER},
+   {0x1920, 12, EAIL_SB_EXTEND},
+   {0x1930, 12, EAIL_SB_EXTEND},
+   {0x1944, 2, EAIL_SB_STERM},
+   {0x1946, 10, EAIL_SB_NUMERIC},
+   {0x1950, 30, EAIL_SB_OLETTER},
+   {0x1970, 5, EAIL_SB_OLETTER},
+   {0x1980, 44, EAIL_SB_OLETTER},
+   {0x19B0, 26, EAIL_SB_OLETTER},
+   {0x19D0, 10, EAIL_SB_NUMERIC},
+   {0x1A00, 23, EAIL_SB_OLETTER},
+   {0x1A17, 5, EAIL_SB_EXTEND},
+   {0x1A20, 53, EAIL_SB_OLETTER},
+   {0x1A55, 10, EAIL_SB_EXTEND},
+   {0x1A60, 29, EAIL_SB_EXTEND},
+   {0x1A7F, 1, EAIL_SB_EXTEND},
+   {0x1A80, 10, EAIL_SB_NUMERIC},
+   {0x1A90, 10, EAIL_SB_NUMERIC},
+   {0x1AA7, 1, EAIL_SB_OLETTER},
+   {0x1AA8, 4, EAIL_SB_STERM},
+   {0x1AB0, 31, EAIL_SB_EXTEND},
+   {0x1B00, 5, EAIL_SB_EXTEND},
+   {0x1B05, 47, EAIL_SB_OLETTER},
+   {0x1B34, 17, EAIL_SB_EXTEND},
+   {0x1B45, 8, EAIL_SB_OLETTER},
+   {0x1B50, 10, EAIL_SB_NUMERIC},
+   {0x1B5A, 2, EAIL_SB_STERM},
+   {0x1B5E, 2, EAIL_SB_STERM},
+   {0x1B6B, 9, EAIL_SB_EXTEND},
+   {0x1B7D, 2, EAIL_SB_STERM},
+   {0x1B80, 3, EAIL_SB_EXTEND},
+   {0x1B83, 30, EAIL_SB_OLETTER},
+   {0x1BA1, 13, EAIL_SB_EXTEND},
+   {0x1BAE, 2, EAIL_SB_OLETTER},
+   {0x1BB0, 10, EAIL_SB_NUMERIC},
+   {0x1BBA, 44, EAIL_SB_OLETTER},
+   {0x1BE6, 14, EAIL_SB_EXTEND},
+   {0x1C00, 36, EAIL_SB_OLETTER},
+   {0x1C24, 20, EAIL_SB_EXTEND},
+   {0x1C3B, 2, EAIL_SB_STERM},
+   {0x1C40, 10, EAIL_SB_NUMERIC},
+   {0x1C4D, 3, EAIL_SB_OLETTER},
+   {0x1C50, 10, EAIL_SB_NUMERIC},
+   {0x1C5A, 36, EAIL_SB_OLETTER},
+   {0x1C7E, 2, EAIL_SB_STERM},
+   {0x1C80, 9, EAIL_SB_LOWER},
+   {0x1C90, 43, EAIL_SB_OLETTER},
+   {0x1CBD, 3, EAIL_SB_OLETTER},
+   {0x1CD0, 3, EAIL_SB_EXTEND},
+   {0x1CD4, 21, EAIL_SB_EXTEND},
+   {0x1CE9, 4, EAIL_SB_OLETTER},
+   {0x1CED, 1, EAIL_SB_EXTEND},
+   {0x1CEE, 6, EAIL_SB_OLETTER},
+   {0x1CF4, 1, EAIL_SB_EXTEND},
+   {0x1CF5, 2, EAIL_SB_OLETTER},
+   {0x1CF7, 3, EAIL_SB_EXTEND},
+   {0x1CFA, 1, EAIL_SB_OLETTER},
+   {0x1D00, 192, EAIL_SB_LOWER},
+   {0x1DC0, 64, EAIL_SB_EXTEND},
+   {0x1E00, 1, EAIL_SB_UPPER},
+   {0x1E01, 1, EAIL_SB_LOWER},
+   {0x1E02, 1, EAIL_SB_UPPER},
+   {0x1E03, 1, EAIL_SB_LOWER},
+   {0x1E04, 1, EAIL_SB_UPPER},
+   {0x1E05, 1, EAIL_SB_LOWER},
+   {0x1E06, 1, EAIL_SB_UPPER},
+   {0x1E07, 1, EAIL_SB_LOWER},
+   {0x1E08, 1, EAIL_SB_UPPER},
+   {0x1E09, 1, EAIL_SB_LOWER},
+   {0x1E0A, 1, EAIL_SB_UPPER},
+   {0x1E0B, 1, EAIL_SB_LOWER},
+   {0x1E0C, 1, EAIL_SB_UPPER},
+   {0x1E0D, 1, EAIL_SB_LOWER},
+   {0x1E0E, 1, EAIL_SB_UPPER},
+   {0x1E0F, 1, EAIL_SB_LOWER},
+   {0x1E10, 1, EAIL_SB_UPPER},
+   {0x1E11, 1, EAIL_SB_LOWER},
+   {0x1E12, 1, EAIL_SB_UPPER},
+   {0x1E13, 1, EAIL_SB_LOWER},
+   {0x1E14, 1, EAIL_SB_UPPER},
+   {0x1E15, 1, EAIL_SB_LOWER},
+   {0x1E16, 1, EAIL_SB_UPPER},
+   {0x1E17, 1, EAIL_SB_LOWER},
+   {0x1E18, 1, EAIL_SB_UPPER},
+   {0x1E19, 1, EAIL_SB_LOWER},
+   {0x1E1A, 1, EAIL_SB_UPPER},
+   {0x1E1B, 1, EAIL_SB_LOWER},
+   {0x1E1C, 1, EAIL_SB_UPPER},
+   {0x1E1D, 1, EAIL_SB_LOWER},
+   {0x1E1E, 1, EAIL_SB_UPPER},
+   {0x1E1F, 1, EAIL_SB_LOWER},
+   {0x1E20, 1, EAIL_SB_UPPER},
+   {0x1E21, 1, EAIL_SB_LOWER},
+   {0x1E22, 1, EAIL_SB_UPPER},
+   {0x1E23, 1, EAIL_SB_LOWER},
+   {0x1E24, 1, EAIL_SB_UPPER},
+   {0x1E25, 1, EAIL_SB_LOWER},
+   {0x1E26, 1, EAIL_SB_UPPER},
+   {0x1E27, 1, EAIL_SB_LOWER},
+   {0x1E28, 1, EAIL_SB_UPPER},
+   {0x1E29, 1, EAIL_SB_LOWER},
+   {0x1E2A, 1, EAIL_SB_UPPER},
+   {0x1E2B, 1, EAIL_SB_LOWER},
+   {0x1E2C, 1, EAIL_SB_UPPER},
+   {0x1E2D, 1, EAIL_SB_LOWER},
+   {0x1E2E, 1, EAIL_SB_UPPER},
+   {0x1E2F, 1, EAIL_SB_LOWER},
+   {0x1E30, 1, EAIL_SB_UPPER},
+   {0x1E31, 1, EAIL_SB_LOWER},
+   {0x1E32, 1, EAIL_SB_UPPER},
+   {0x1E33, 1, EAIL_SB_LOWER},
+   {0x1E34, 1, EAIL_SB_UPPER},
+   {0x1E35, 1, EAIL_SB_LOWER},
+   {0x1E36, 1, EAIL_SB_UPPER},
+   {0x1E37, 1, EAIL_SB_LOWER},
+   {0x1E38, 1, EAIL_SB_UPPER},
+   {0x1E39, 1, EAIL_SB_LOWER},
+   {0x1E3A, 1, EAIL_SB_UPPER},
+   {0x1E3B, 1, EAIL_SB_LOWER},
+   {0x1E3C, 1, EAIL_SB_UPPER},
+   {0x1E3D, 1, EAIL_SB_LOWER},
+   {0x1E3E, 1, EAIL_SB_UPPER},
+   {0x1E3F, 1, EAIL_SB_LOWER},
+   {0x1E40, 1, EAIL_SB_UPPER},
+   {0x1E41, 1, EAIL_SB_LOWER},
+   {0x1E42, 1, EAIL_SB_UPPER},
+   {0x1E43, 1, EAIL_SB_LOWER},
+   {0x1E44, 1, EAIL_SB_UPPER},
+   {0x1E45, 1, EAIL_SB_LOWER},
+   {0x1E46, 1, EAIL_SB_UPPER},
+   {0x1E47, 1, EAIL_SB_LOWER},
+   {0x1E48, 1, EAIL_SB_UPPER},
+   {0x1E49, 1, EAIL_SB_LOWER},
+   {0x1E4A, 1, EAIL_SB_UPPER},
+   {0x1E4B, 1, EAIL_SB_LOWER},
+   {0x1E4C, 1, EAIL_SB_UPPER},
+   {0x1E4D, 1, EAIL_SB_LOWER},
+   {0x1E4E, 1, EAIL_SB_UPPER},
+   {0x1E4F, 1, EAIL_SB_LOWER},
+   {0x1E50, 1, EAIL_SB_UPPER},
+   {0x1E51, 1, EAIL_SB_LOWER},
+   {0x1E52, 1, EAIL_SB_UPPER},
+   {0x1E53, 1, EAIL_SB_LOWER},
+   {0x1E54, 1, EAIL_SB_UPPER},
+   {0x1E55, 1, EAIL_SB_LOWER},
+   {0x1E56, 1, EAIL_SB_UPPER},
+   {0x1E57, 1, EAIL_SB_LOWER},
+   {0x1E58, 1, EAIL_SB_UPPER},
+   {0x1E59, 1, EAIL_SB_LOWER},
+   {0x1E5A, 1, EAIL_SB_UPPER},
+   {0x1E5B, 1, EAIL_SB_LOWER},
+   {0x1E5C, 1, EAIL_SB_UPPER},
+   {0x1E5D, 1, EAIL_SB_LOWER},
+   {0x1E5E, 1, EAIL_SB_UPPER},
+   {0x1E5F, 1, EAIL_SB_LOWER},
+   {0x1E60, 1, EAIL_SB_UPPER},
+   {0x1E61, 1, EAIL_SB_LOWER},
+   {0x1E62, 1, EAIL_SB_UPPER},
+   {0x1E63, 1, EAIL_SB_LOWER},
+   {0x1E64, 1, EAIL_SB_UPPER},
+   {0x1E65, 1, EAIL_SB_LOWER},
+   {0x1E66, 1, EAIL_SB_UPPER},
+   {0x1E67, 1, EAIL_SB_LOWER},
+   {0x1E68, 1, EAIL_SB_UPPER},
+   {0x1E69, 1, EAIL_SB_LOWER},
+   {0x1E6A, 1, EAIL_SB_UPPER},
+   {0x1E6B, 1, EAIL_SB_LOWER},
+   {0x1E6C, 1, EAIL_SB_UPPER},
+   {0x1E6D, 1, EAIL_SB_LOWER},
+   {0x1E6E, 1, EAIL_SB_UPPER},
+   {0x1E6F, 1, EAIL_SB_LOWER},
+   {0x1E70, 1, EAIL_SB_UPPER},
+   {0x1E71, 1, EAIL_SB_LOWER},
+   {0x1E72, 1, EAIL_SB_UPPER},
+   {0x1E73, 1, EAIL_SB_LOWER},
+   {0x1E74, 1, EAIL_SB_UPPER},
+   {0x1E75, 1, EAIL_SB_LOWER},
+   {0x1E76, 1, EAIL_SB_UPPER},
+   {0x1E77, 1, EAIL_SB_LOWER},
+   {0x1E78, 1, EAIL_SB_UPPER},
+   {0x1E79, 1, EAIL_SB_LOWER},
+   {0x1E7A, 1, EAIL_SB_UPPER},
+   {0x1E7B, 1, EAIL_SB_LOWER},
+   {0x1E7C, 1, EAIL_SB_UPPER},
+   {0x1E7D, 1, EAIL_SB_LOWER},
+   {0x1E7E, 1, EAIL_SB_UPPER},
+   {0x1E7F, 1, EAIL_SB_LOWER},
+   {0x1E80, 1, EAIL_SB_UPPER},
+   {0x1E81, 1, EAIL_SB_LOWER},
+   {0x1E82, 1, EAIL_SB_UPPER},
+   {0x1E83, 1, EAIL_SB_LOWER},
+   {0x1E84, 1, EAIL_SB_UPPER},
+   {0x1E85, 1, EAIL_SB_LOWER},
+   {0x1E86, 1, EAIL_SB_UPPER},
+   {0x1E87, 1, EAIL_SB_LOWER},
+   {0x1E88, 1, EAIL_SB_UPPER},
+   {0x1E89, 1, EAIL_SB_LOWER},
+   {0x1E8A, 1, EAIL_SB_UPPER},
+   {0x1E8B, 1, EAIL_SB_LOWER},
+   {0x1E8C, 1, EAIL_SB_UPPER},
+   {0x1E8D, 1, EAIL_SB_LOWER},
+   {0x1E8E, 1, EAIL_SB_UPPER},
+   {0x1E8F, 1, EAIL_SB_LOWER},
+   {0x1E90, 1, EAIL_SB_UPPER},
+   {0x1E91, 1, EAIL_SB_LOWER},
+   {0x1E92, 1, EAIL_SB_UPPER},
+   {0x1E93, 1, EAIL_SB_LOWER},
+   {0x1E94, 1, EAIL_SB_UPPER},
+   {0x1E95, 9, EAIL_SB_LOWER},
+   {0x1E9E, 1, EAIL_SB_UPPER},
+   {0x1E9F, 1, EAIL_SB_LOWER},
+   {0x1EA0, 1, EAIL_SB_UPPER},
+   {0x1EA1, 1, EAIL_SB_LOWER},
+   {0x1EA2, 1, EAIL_SB_UPPER},
+   {0x1EA3, 1, EAIL_SB_LOWER},
+   {0x1EA4, 1, EAIL_SB_UPPER},
+   {0x1EA5, 1, EAIL_SB_LOWER},
+   {0x1EA6, 1, EAIL_SB_UPPER},
+   {0x1EA7, 1, EAIL_SB_LOWER},
+   {0x1EA8, 1, EAIL_SB_UPPER},
+   {0x1EA9, 1, EAIL_SB_LOWER},
+   {0x1EAA, 1, EAIL_SB_UPPER},
+   {0x1EAB, 1, EAIL_SB_LOWER},
+   {0x1EAC, 1, EAIL_SB_UPPER},
+   {0x1EAD, 1, EAIL_SB_LOWER},
+   {0x1EAE, 1, EAIL_SB_UPPER},
+   {0x1EAF, 1, EAIL_SB_LOWER},
+   {0x1EB0, 1, EAIL_SB_UPPER},
+   {0x1EB1, 1, EAIL_SB_LOWER},
+   {0x1EB2, 1, EAIL_SB_UPPER},
+   {0x1EB3, 1, EAIL_SB_LOWER},
+   {0x1EB4, 1, EAIL_SB_UPPER},
+   {0x1EB5, 1, EAIL_SB_LOWER},
+   {0x1EB6, 1, EAIL_SB_UPPER},
+   {0x1EB7, 1, EAIL_SB_LOWER},
+   {0x1EB8, 1, EAIL_SB_UPPER},
+   {0x1EB9, 1, EAIL_SB_LOWER},
+   {0x1EBA, 1, EAIL_SB_UPPER},
+   {0x1EBB, 1, EAIL_SB_LOWER},
+   {0x1EBC, 1, EAIL_SB_UPPER},
+   {0x1EBD, 1, EAIL_SB_LOWER},
+   {0x1EBE, 1, EAIL_SB_UPPER},
+   {0x1EBF, 1, EAIL_SB_LOWER},
+   {0x1EC0, 1, EAIL_SB_UPPER},
+   {0x1EC1, 1, EAIL_SB_LOWER},
+   {0x1EC2, 1, EAIL_SB_UPPER},
+   {0x1EC3, 1, EAIL_SB_LOWER},
+   {0x1EC4, 1, EAIL_SB_UPPER},
+   {0x1EC5, 1, EAIL_SB_LOWER},
+   {0x1EC6, 1, EAIL_SB_UPPER},
+   {0x1EC7, 1, EAIL_SB_LOWER},
+   {0x1EC8, 1, EAIL_SB_UPPER},
+   {0x1EC9, 1, EAIL_SB_LOWER},
+   {0x1ECA, 1, EAIL_SB_UPPER},
+   {0x1ECB, 1, EAIL_SB_LOWER},
+   {0x1ECC, 1, EAIL_SB_UPPER},
+   {0x1ECD, 1, EAIL_SB_LOWER},
+   {0x1ECE, 1, EAIL_SB_UPPER},
+   {0x1ECF, 1, EAIL_SB_LOWER},
+   {0x1ED0, 1, EAIL_SB_UPPER},
+   {0x1ED1, 1, EAIL_SB_LOWER},
+   {0x1ED2, 1, EAIL_SB_UPPER},
+   {0x1ED3, 1, EAIL_SB_LOWER},
+   {0x1ED4, 1, EAIL_SB_UPPER},
+   {0x1ED5, 1, EAIL_SB_LOWER},
+   {0x1ED6, 1, EAIL_SB_UPPER},
+   {0x1ED7, 1, EAIL_SB_LOWER},
+   {0x1ED8, 1, EAIL_SB_UPPER},
+   {0x1ED9, 1, EAIL_SB_LOWER},
+   {0x1EDA, 1, EAIL_SB_UPPER},
+   {0x1EDB, 1, EAIL_SB_LOWER},
+   {0x1EDC, 1, EAIL_SB_UPPER},
+   {0x1EDD, 1, EAIL_SB_LOWER},
+   {0x1EDE, 1, EAIL_SB_UPPER},
+   {0x1EDF, 1, EAIL_SB_LOWER},
+   {0x1EE0, 1, EAIL_SB_UPPER},
+   {0x1EE1, 1, EAIL_SB_LOWER},
+   {0x1EE2, 1, EAIL_SB_UPPER},
+   {0x1EE3, 1, EAIL_SB_LOWER},
+   {0x1EE4, 1, EAIL_SB_UPPER},
+   {0x1EE5, 1, EAIL_SB_LOWER},
+   {0x1EE6, 1, EAIL_SB_UPPER},
+   {0x1EE7, 1, EAIL_SB_LOWER},
+   {0x1EE8, 1, EAIL_SB_UPPER},
+   {0x1EE9, 1, EAIL_SB_LOWER},
+   {0x1EEA, 1, EAIL_SB_UPPER},
+   {0x1EEB, 1, EAIL_SB_LOWER},
+   {0x1EEC, 1, EAIL_SB_UPPER},
+   {0x1EED, 1, EAIL_SB_LOWER},
+   {0x1EEE, 1, EAIL_SB_UPPER},
+   {0x1EEF, 1, EAIL_SB_LOWER},
+   {0x1EF0, 1, EAIL_SB_UPPER},
+   {0x1EF1, 1, EAIL_SB_LOWER},
+   {0x1EF2, 1, EAIL_SB_UPPER},
+   {0x1EF3, 1, EAIL_SB_LOWER},
+   {0x1EF4, 1, EAIL_SB_UPPER},
+   {0x1EF5, 1, EAIL_SB_LOWER},
+   {0x1EF6, 1, EAIL_SB_UPPER},
+   {0x1EF7, 1, EAIL_SB_LOWER},
+   {0x1EF8, 1, EAIL_SB_UPPER},
+   {0x1EF9, 1, EAIL_SB_LOWER},
+   {0x1EFA, 1, EAIL_SB_UPPER},
+   {0x1EFB, 1, EAIL_SB_LOWER},
+   {0x1EFC, 1, EAIL_SB_UPPER},
+   {0x1EFD, 1, EAIL_SB_LOWER},
+   {0x1EFE, 1, EAIL_SB_UPPER},
+   {0x1EFF, 9, EAIL_SB_LOWER},
+   {0x1F08, 8, EAIL_SB_UPPER},
+   {0x1F10, 6, EAIL_SB_LOWER},
+   {0x1F18, 6, EAIL_SB_UPPER},
+   {0x1F20, 8, EAIL_SB_LOWER},
+   {0x1F28, 8, EAIL_SB_UPPER},
+   {0x1F30, 8, EAIL_SB_LOWER},
+   {0x1F38, 8, EAIL_SB_UPPER},
+   {0x1F40, 6, EAIL_SB_LOWER},
+   {0x1F48, 6, EAIL_SB_UPPER},
+   {0x1F50, 8, EAIL_SB_LOWER},
+   {0x1F59, 1, EAIL_SB_UPPER},
+   {0x1F5B, 1, EAIL_SB_UPPER},
+   {0x1F5D, 1, EAIL_SB_UPPER},
+   {0x1F5F, 1, EAIL_SB_UPPER},
+   {0x1F60, 8, EAIL_SB_LOWER},
+   {0x1F68, 8, EAIL_SB_UPPER},
+   {0x1F70, 14, EAIL_SB_LOWER},
+   {0x1F80, 8, EAIL_SB_LOWER},
+   {0x1F88, 8, EAIL_SB_UPPER},
+   {0x1F90, 8, EAIL_SB_LOWER},
+   {0x1F98, 8, EAIL_SB_UPPER},
+   {0x1FA0, 8, EAIL_SB_LOWER},
+   {0x1FA8, 8, EAIL_SB_UPPER},
+   {0x1FB0, 5, EAIL_SB_LOWER},
+   {0x1FB6, 2, EAIL_SB_LOWER},
+   {0x1FB8, 5, EAIL_SB_UPPER},
+   {0x1FBE, 1, EAIL_SB_LOWER},
+   {0x1FC2, 3, EAIL_SB_LOWER},
+   {0x1FC6, 2, EAIL_SB_LOWER},
+   {0x1FC8, 5, EAIL_SB_UPPER},
+   {0x1FD0, 4, EAIL_SB_LOWER},
+   {0x1FD6, 2, EAIL_SB_LOWER},
+   {0x1FD8, 4, EAIL_SB_UPPER},
+   {0x1FE0, 8, EAIL_SB_LOWER},
+   {0x1FE8, 5, EAIL_SB_UPPER},
+   {0x1FF2, 3, EAIL_SB_LOWER},
+   {0x1FF6, 2, EAIL_SB_LOWER},
+   {0x1FF8, 5, EAIL_SB_UPPER},
+   {0x2000, 11, EAIL_SB_SP},
+   {0x200B, 1, EAIL_SB_FORMAT},
+   {0x200C, 2, EAIL_SB_EXTEND},
+   {0x200E, 2, EAIL_SB_FORMAT},
+   {0x2013, 2, EAIL_SB_SCONTINUE},
+   {0x2018, 8, EAIL_SB_CLOSE},
+   {0x2024, 1, EAIL_SB_ATERM},
+   {0x2028, 2, EAIL_SB_SEP},
+   {0x202A, 5, EAIL_SB_FORMAT},
+   {0x202F, 1, EAIL_SB_SP},
+   {0x2039, 2, EAIL_SB_CLOSE},
+   {0x203C, 2, EAIL_SB_STERM},
+   {0x2045, 2, EAIL_SB_CLOSE},
+   {0x2047, 3, EAIL_SB_STERM},
+   {0x205F, 1, EAIL_SB_SP},
+   {0x2060, 5, EAIL_SB_FORMAT},
+   {0x2066, 10, EAIL_SB_FORMAT},
+   {0x2071, 1, EAIL_SB_LOWER},
+   {0x207D, 2, EAIL_SB_CLOSE},
+   {0x207F, 1, EAIL_SB_LOWER},
+   {0x208D, 2, EAIL_SB_CLOSE},
+   {0x2090, 13, EAIL_SB_LOWER},
+   {0x20D0, 33, EAIL_SB_EXTEND},
+   {0x2102, 1, EAIL_SB_UPPER},
+   {0x2107, 1, EAIL_SB_UPPER},
+   {0x210A, 1, EAIL_SB_LOWER},
+   {0x210B, 3, EAIL_SB_UPPER},
+   {0x210E, 2, EAIL_SB_LOWER},
+   {0x2110, 3, EAIL_SB_UPPER},
+   {0x2113, 1, EAIL_SB_LOWER},
+   {0x2115, 1, EAIL_SB_UPPER},
+   {0x2119, 5, EAIL_SB_UPPER},
+   {0x2124, 1, EAIL_SB_UPPER},
+   {0x2126, 1, EAIL_SB_UPPER},
+   {0x2128, 1, EAIL_SB_UPPER},
+   {0x212A, 4, EAIL_SB_UPPER},
+   {0x212F, 1, EAIL_SB_LOWER},
+   {0x2130, 4, EAIL_SB_UPPER},
+   {0x2134, 1, EAIL_SB_LOWER},
+   {0x2135, 4, EAIL_SB_OLETTER},
+   {0x2139, 1, EAIL_SB_LOWER},
+   {0x213C, 2, EAIL_SB_LOWER},
+   {0x213E, 2, EAIL_SB_UPPER},
+   {0x2145, 1, EAIL_SB_UPPER},
+   {0x2146, 4, EAIL_SB_LOWER},
+   {0x214E, 1, EAIL_SB_LOWER},
+   {0x2160, 16, EAIL_SB_UPPER},
+   {0x2170, 16, EAIL_SB_LOWER},
+   {0x2180, 3, EAIL_SB_OLETTER},
+   {0x2183, 1, EAIL_SB_UPPER},
+   {0x2184, 1, EAIL_SB_LOWER},
+   {0x2185, 4, EAIL_SB_OLETTER},
+   {0x2308, 4, EAIL_SB_CLOSE},
+   {0x2329, 2, EAIL_SB_CLOSE},
+   {0x24B6, 26, EAIL_SB_UPPER},
+   {0x24D0, 26, EAIL_SB_LOWER},
+   {0x275B, 6, EAIL_SB_CLOSE},
+   {0x2768, 14, EAIL_SB_CLOSE},
+   {0x27C5, 2, EAIL_SB_CLOSE},
+   {0x27E6, 10, EAIL_SB_CLOSE},
+   {0x2983, 22, EAIL_SB_CLOSE},
+   {0x29D8, 4, EAIL_SB_CLOSE},
+   {0x29FC, 2, EAIL_SB_CLOSE},
+   {0x2C00, 48, EAIL_SB_UPPER},
+   {0x2C30, 48, EAIL_SB_LOWER},
+   {0x2C60, 1, EAIL_SB_UPPER},
+   {0x2C61, 1, EAIL_SB_LOWER},
+   {0x2C62, 3, EAIL_SB_UPPER},
+   {0x2C65, 2, EAIL_SB_LOWER},
+   {0x2C67, 1, EAIL_SB_UPPER},
+   {0x2C68, 1, EAIL_SB_LOWER},
+   {0x2C69, 1, EAIL_SB_UPPER},
+   {0x2C6A, 1, EAIL_SB_LOWER},
+   {0x2C6B, 1, EAIL_SB_UPPER},
+   {0x2C6C, 1, EAIL_SB_LOWER},
+   {0x2C6D, 4, EAIL_SB_UPPER},
+   {0x2C71, 1, EAIL_SB_LOWER},
+   {0x2C72, 1, EAIL_SB_UPPER},
+   {0x2C73, 2, EAIL_SB_LOWER},
+   {0x2C75, 1, EAIL_SB_UPPER},
+   {0x2C76, 8, EAIL_SB_LOWER},
+   {0x2C7E, 3, EAIL_SB_UPPER},
+   {0x2C81, 1, EAIL_SB_LOWER},
+   {0x2C82, 1, EAIL_SB_UPPER},
+   {0x2C83, 1, EAIL_SB_LOWER},
+   {0x2C84, 1, EAIL_SB_UPPER},
+   {0x2C85, 1, EAIL_SB_LOWER},
+   {0x2C86, 1, EAIL_SB_UPPER},
+   {0x2C87, 1, EAIL_SB_LOWER},
+   {0x2C88, 1, EAIL_SB_UPPER},
+   {0x2C89, 1, EAIL_SB_LOWER},
+   {0x2C8A, 1, EAIL_SB_UPPER},
+   {0x2C8B, 1, EAIL_SB_LOWER},
+   {0x2C8C, 1, EAIL_SB_UPPER},
+   {0x2C8D, 1, EAIL_SB_LOWER},
+   {0x2C8E, 1, EAIL_SB_UPPER},
+   {0x2C8F, 1, EAIL_SB_LOWER},
+   {0x2C90, 1, EAIL_SB_UPPER},
+   {0x2C91, 1, EAIL_SB_LOWER},
+   {0x2C92, 1, EAIL_SB_UPPER},
+   {0x2C93, 1, EAIL_SB_LOWER},
+   {0x2C94, 1, EAIL_SB_UPPER},
+   {0x2C95, 1, EAIL_SB_LOWER},
+   {0x2C96, 1, EAIL_SB_UPPER},
+   {0x2C97, 1, EAIL_SB_LOWER},
+   {0x2C98, 1, EAIL_SB_UPPER},
+   {0x2C99, 1, EAIL_SB_LOWER},
+   {0x2C9A, 1, EAIL_SB_UPPER},
+   {0x2C9B, 1, EAIL_SB_LOWER},
+   {0x2C9C, 1, EAIL_SB_UPPER},
+   {0x2C9D, 1, EAIL_SB_LOWER},
+   {0x2C9E, 1, EAIL_SB_UPPER},
+   {0x2C9F, 1, EAIL_SB_LOWER},
+   {0x2CA0, 1, EAIL_SB_UPPER},
+   {0x2CA1, 1, EAIL_SB_LOWER},
+   {0x2CA2, 1, EAIL_SB_UPPER},
+   {0x2CA3, 1, EAIL_SB_LOWER},
+   {0x2CA4, 1, EAIL_SB_UPPER},
+   {0x2CA5, 1, EAIL_SB_LOWER},
+   {0x2CA6, 1, EAIL_SB_UPPER},
+   {0x2CA7, 1, EAIL_SB_LOWER},
+   {0x2CA8, 1, EAIL_SB_UPPER},
+   {0x2CA9, 1, EAIL_SB_LOWER},
+   {0x2CAA, 1, EAIL_SB_UPPER},
+   {0x2CAB, 1, EAIL_SB_LOWER},
+   {0x2CAC, 1, EAIL_SB_UPPER},
+   {0x2CAD, 1, EAIL_SB_LOWER},
+   {0x2CAE, 1, EAIL_SB_UPPER},
+   {0x2CAF, 1, EAIL_SB_LOWER},
+   {0x2CB0, 1, EAIL_SB_UPPER},
+   {0x2CB1, 1, EAIL_SB_LOWER},
+   {0x2CB2, 1, EAIL_SB_UPPER},
+   {0x2CB3, 1, EAIL_SB_LOWER},
+   {0x2CB4, 1, EAIL_SB_UPPER},
+   {0x2CB5, 1, EAIL_SB_LOWER},
+   {0x2CB6, 1, EAIL_SB_UPPER},
+   {0x2CB7, 1, EAIL_SB_LOWER},
+   {0x2CB8, 1, EAIL_SB_UPPER},
+   {0x2CB9, 1, EAIL_SB_LOWER},
+   {0x2CBA, 1, EAIL_SB_UPPER},
+   {0x2CBB, 1, EAIL_SB_LOWER},
+   {0x2CBC, 1, EAIL_SB_UPPER},
+   {0x2CBD, 1, EAIL_SB_LOWER},
+   {0x2CBE, 1, EAIL_SB_UPPER},
+   {0x2CBF, 1, EAIL_SB_LOWER},
+   {0x2CC0, 1, EAIL_SB_UPPER},
+   {0x2CC1, 1, EAIL_SB_LOWER},
+   {0x2CC2, 1, EAIL_SB_UPPER},
+   {0x2CC3, 1, EAIL_SB_LOWER},
+   {0x2CC4, 1, EAIL_SB_UPPER},
+   {0x2CC5, 1, EAIL_SB_LOWER},
+   {0x2CC6, 1, EAIL_SB_UPPER},
+   {0x2CC7, 1, EAIL_SB_LOWER},
+   {0x2CC8, 1, EAIL_SB_UPPER},
+   {0x2CC9, 1, EAIL_SB_LOWER},
+   {0x2CCA, 1, EAIL_SB_UPPER},
+   {0x2CCB, 1, EAIL_SB_LOWER},
+   {0x2CCC, 1, EAIL_SB_UPPER},
+   {0x2CCD, 1, EAIL_SB_LOWER},
+   {0x2CCE, 1, EAIL_SB_UPPER},
+   {0x2CCF, 1, EAIL_SB_LOWER},
+   {0x2CD0, 1, EAIL_SB_UPPER},
+   {0x2CD1, 1, EAIL_SB_LOWER},
+   {0x2CD2, 1, EAIL_SB_UPPER},
+   {0x2CD3, 1, EAIL_SB_LOWER},
+   {0x2CD4, 1, EAIL_SB_UPPER},
+   {0x2CD5, 1, EAIL_SB_LOWER},
+   {0x2CD6, 1, EAIL_SB_UPPER},
+   {0x2CD7, 1, EAIL_SB_LOWER},
+   {0x2CD8, 1, EAIL_SB_UPPER},
+   {0x2CD9, 1, EAIL_SB_LOWER},
+   {0x2CDA, 1, EAIL_SB_UPPER},
+   {0x2CDB, 1, EAIL_SB_LOWER},
+   {0x2CDC, 1, EAIL_SB_UPPER},
+   {0x2CDD, 1, EAIL_SB_LOWER},
+   {0x2CDE, 1, EAIL_SB_UPPER},
+   {0x2CDF, 1, EAIL_SB_LOWER},
+   {0x2CE0, 1, EAIL_SB_UPPER},
+   {0x2CE1, 1, EAIL_SB_LOWER},
+   {0x2CE2, 1, EAIL_SB_UPPER},
+   {0x2CE3, 2, EAIL_SB_LOWER},
+   {0x2CEB, 1, EAIL_SB_UPPER},
+   {0x2CEC, 1, EAIL_SB_LOWER},
+   {0x2CED, 1, EAIL_SB_UPPER},
+   {0x2CEE, 1, EAIL_SB_LOWER},
+   {0x2CEF, 3, EAIL_SB_EXTEND},
+   {0x2CF2, 1, EAIL_SB_UPPER},
+   {0x2CF3, 1, EAIL_SB_LOWER},
+   {0x2D00, 38, EAIL_SB_LOWER},
+   {0x2D27, 1, EAIL_SB_LOWER},
+   {0x2D2D, 1, EAIL_SB_LOWER},
+   {0x2D30, 56, EAIL_SB_OLETTER},
+   {0x2D6F, 1, EAIL_SB_OLETTER},
+   {0x2D7F, 1, EAIL_SB_EXTEND},
+   {0x2D80, 23, EAIL_SB_OLETTER},
+   {0x2DA0, 7, EAIL_SB_OLETTER},
+   {0x2DA8, 7, EAIL_SB_OLETTER},
+   {0x2DB0, 7, EAIL_SB_OLETTER},
+   {0x2DB8, 7, EAIL_SB_OLETTER},
+   {0x2DC0, 7, EAIL_SB_OLETTER},
+   {0x2DC8, 7, EAIL_SB_OLETTER},
+   {0x2DD0, 7, EAIL_SB_OLETTER},
+   {0x2DD8, 7, EAIL_SB_OLETTER},
+   {0x2DE0, 32, EAIL_SB_EXTEND},
+   {0x2E00, 14, EAIL_SB_CLOSE},
+   {0x2E1C, 2, EAIL_SB_CLOSE},
+   {0x2E20, 10, EAIL_SB_CLOSE},
+   {0x2E2E, 1, EAIL_SB_STERM},
+   {0x2E2F, 1, EAIL_SB_OLETTER},
+   {0x2E3C, 1, EAIL_SB_STERM},
+   {0x2E42, 1, EAIL_SB_CLOSE},
+   {0x2E53, 2, EAIL_SB_STERM},
+   {0x2E55, 8, EAIL_SB_CLOSE},
+   {0x3000, 1, EAIL_SB_SP},
+   {0x3001, 1, EAIL_SB_SCONTINUE},
+   {0x3002, 1, EAIL_SB_STERM},
+   {0x3005, 3, EAIL_SB_OLETTER},
+   {0x3008, 10, EAIL_SB_CLOSE},
+   {0x3014, 8, EAIL_SB_CLOSE},
+   {0x301D, 3, EAIL_SB_CLOSE},
+   {0x3021, 9, EAIL_SB_OLETTER},
+   {0x302A, 6, EAIL_SB_EXTEND},
+   {0x3031, 5, EAIL_SB_OLETTER},
+   {0x3038, 5, EAIL_SB_OLETTER},
+   {0x3041, 86, EAIL_SB_OLETTER},
+   {0x3099, 2, EAIL_SB_EXTEND},
+   {0x309D, 3, EAIL_SB_OLETTER},
+   {0x30A1, 90, EAIL_SB_OLETTER},
+   {0x30FC, 4, EAIL_SB_OLETTER},
+   {0x3105, 43, EAIL_SB_OLETTER},
+   {0x3131, 94, EAIL_SB_OLETTER},
+   {0x31A0, 32, EAIL_SB_OLETTER},
+   {0x31F0, 16, EAIL_SB_OLETTER},
+   {0x3400, 6592, EAIL_SB_OLETTER},
+   {0x4E00, 22157, EAIL_SB_OLETTER},
+   {0xA4D0, 46, EAIL_SB_OLETTER},
+   {0xA4FF, 1, EAIL_SB_STERM},
+   {0xA500, 269, EAIL_SB_OLETTER},
+   {0xA60E, 2, EAIL_SB_STERM},
+   {0xA610, 16, EAIL_SB_OLETTER},
+   {0xA620, 10, EAIL_SB_NUMERIC},
+   {0xA62A, 2, EAIL_SB_OLETTER},
+   {0xA640, 1, EAIL_SB_UPPER},
+   {0xA641, 1, EAIL_SB_LOWER},
+   {0xA642, 1, EAIL_SB_UPPER},
+   {0xA643, 1, EAIL_SB_LOWER},
+   {0xA644, 1, EAIL_SB_UPPER},
+   {0xA645, 1, EAIL_SB_LOWER},
+   {0xA646, 1, EAIL_SB_UPPER},
+   {0xA647, 1, EAIL_SB_LOWER},
+   {0xA648, 1, EAIL_SB_UPPER},
+   {0xA649, 1, EAIL_SB_LOWER},
+   {0xA64A, 1, EAIL_SB_UPPER},
+   {0xA64B, 1, EAIL_SB_LOWER},
+   {0xA64C, 1, EAIL_SB_UPPER},
+   {0xA64D, 1, EAIL_SB_LOWER},
+   {0xA64E, 1, EAIL_SB_UPPER},
+   {0xA64F, 1, EAIL_SB_LOWER},
+   {0xA650, 1, EAIL_SB_UPPER},
+   {0xA651, 1, EAIL_SB_LOWER},
+   {0xA652, 1, EAIL_SB_UPPER},
+   {0xA653, 1, EAIL_SB_LOWER},
+   {0xA654, 1, EAIL_SB_UPPER},
+   {0xA655, 1, EAIL_SB_LOWER},
+   {0xA656, 1, EAIL_SB_UPPER},
+   {0xA657, 1, EAIL_SB_LOWER},
+   {0xA658, 1, EAIL_SB_UPPER},
+   {0xA659, 1, EAIL_SB_LOWER},
+   {0xA65A, 1, EAIL_SB_UPPER},
+   {0xA65B, 1, EAIL_SB_LOWER},
+   {0xA65C, 1, EAIL_SB_UPPER},
+   {0xA65D, 1, EAIL_SB_LOWER},
+   {0xA65E, 1, EAIL_SB_UPPER},
+   {0xA65F, 1, EAIL_SB_LOWER},
+   {0xA660, 1, EAIL_SB_UPPER},
+   {0xA661, 1, EAIL_SB_LOWER},
+   {0xA662, 1, EAIL_SB_UPPER},
+   {0xA663, 1, EAIL_SB_LOWER},
+   {0xA664, 1, EAIL_SB_UPPER},
+   {0xA665, 1, EAIL_SB_LOWER},
+   {0xA666, 1, EAIL_SB_UPPER},
+   {0xA667, 1, EAIL_SB_LOWER},
+   {0xA668, 1, EAIL_SB_UPPER},
+   {0xA669, 1, EAIL_SB_LOWER},
+   {0xA66A, 1, EAIL_SB_UPPER},
+   {0xA66B, 1, EAIL_SB_LOWER},
+   {0xA66C, 1, EAIL_SB_UPPER},
+   {0xA66D, 1, EAIL_SB_LOWER},
+   {0xA66E, 1, EAIL_SB_OLETTER},
+   {0xA66F, 4, EAIL_SB_EXTEND},
+   {0xA674, 10, EAIL_SB_EXTEND},
+   {0xA67F, 1, EAIL_SB_OLETTER},
+   {0xA680, 1, EAIL_SB_UPPER},
+   {0xA681, 1, EAIL_SB_LOWER},
+   {0xA682, 1, EAIL_SB_UPPER},
+   {0xA683, 1, EAIL_SB_LOWER},
+   {0xA684, 1, EAIL_SB_UPPER},
+   {0xA685, 1, EAIL_SB_LOWER},
+   {0xA686, 1, EAIL_SB_UPPER},
+   {0xA687, 1, EAIL_SB_LOWER},
+   {0xA688, 1, EAIL_SB_UPPER},
+   {0xA689, 1, EAIL_SB_LOWER},
+   {0xA68A, 1, EAIL_SB_UPPER},
+   {0xA68B, 1, EAIL_SB_LOWER},
+   {0xA68C, 1, EAIL_SB_UPPER},
+   {0xA68D, 1, EAIL_SB_LOWER},
+   {0xA68E, 1, EAIL_SB_UPPER},
+   {0xA68F, 1, EAIL_SB_LOWER},
+   {0xA690, 1, EAIL_SB_UPPER},
+   {0xA691, 1, EAIL_SB_LOWER},
+   {0xA692, 1, EAIL_SB_UPPER},
+   {0xA693, 1, EAIL_SB_LOWER},
+   {0xA694, 1, EAIL_SB_UPPER},
+   {0xA695, 1, EAIL_SB_LOWER},
+   {0xA696, 1, EAIL_SB_UPPER},
+   {0xA697, 1, EAIL_SB_LOWER},
+   {0xA698, 1, EAIL_SB_UPPER},
+   {0xA699, 1, EAIL_SB_LOWER},
+   {0xA69A, 1, EAIL_SB_UPPER},
+   {0xA69B, 3, EAIL_SB_LOWER},
+   {0xA69E, 2, EAIL_SB_EXTEND},
+   {0xA6A0, 80, EAIL_SB_OLETTER},
+   {0xA6F0, 2, EAIL_SB_EXTEND},
+   {0xA6F3, 1, EAIL_SB_STERM},
+   {0xA6F7, 1, EAIL_SB_STERM},
+   {0xA717, 9, EAIL_SB_OLETTER},
+   {0xA722, 1, EAIL_SB_UPPER},
+   {0xA723, 1, EAIL_SB_LOWER},
+   {0xA724, 1, EAIL_SB_UPPER},
+   {0xA725, 1, EAIL_SB_LOWER},
+   {0xA726, 1, EAIL_SB_UPPER},
+   {0xA727, 1, EAIL_SB_LOWER},
+   {0xA728, 1, EAIL_SB_UPPER},
+   {0xA729, 1, EAIL_SB_LOWER},
+   {0xA72A, 1, EAIL_SB_UPPER},
+   {0xA72B, 1, EAIL_SB_LOWER},
+   {0xA72C, 1, EAIL_SB_UPPER},
+   {0xA72D, 1, EAIL_SB_LOWER},
+   {0xA72E, 1, EAIL_SB_UPPER},
+   {0xA72F, 3, EAIL_SB_LOWER},
+   {0xA732, 1, EAIL_SB_UPPER},
+   {0xA733, 1, EAIL_SB_LOWER},
+   {0xA734, 1, EAIL_SB_UPPER},
+   {0xA735, 1, EAIL_SB_LOWER},
+   {0xA736, 1, EAIL_SB_UPPER},
+   {0xA737, 1, EAIL_SB_LOWER},
+   {0xA738, 1, EAIL_SB_UPPER},
+   {0xA739, 1, EAIL_SB_LOWER},
+   {0xA73A, 1, EAIL_SB_UPPER},
+   {0xA73B, 1, EAIL_SB_LOWER},
+   {0xA73C, 1, EAIL_SB_UPPER},
+   {0xA73D, 1, EAIL_SB_LOWER},
+   {0xA73E, 1, EAIL_SB_UPPER},
+   {0xA73F, 1, EAIL_SB_LOWER},
+   {0xA740, 1, EAIL_SB_UPPER},
+   {0xA741, 1, EAIL_SB_LOWER},
+   {0xA742, 1, EAIL_SB_UPPER},
+   {0xA743, 1, EAIL_SB_LOWER},
+   {0xA744, 1, EAIL_SB_UPPER},
+   {0xA745, 1, EAIL_SB_LOWER},
+   {0xA746, 1, EAIL_SB_UPPER},
+   {0xA747, 1, EAIL_SB_LOWER},
+   {0xA748, 1, EAIL_SB_UPPER},
+   {0xA749, 1, EAIL_SB_LOWER},
+   {0xA74A, 1, EAIL_SB_UPPER},
+   {0xA74B, 1, EAIL_SB_LOWER},
+   {0xA74C, 1, EAIL_SB_UPPER},
+   {0xA74D, 1, EAIL_SB_LOWER},
+   {0xA74E, 1, EAIL_SB_UPPER},
+   {0xA74F, 1, EAIL_SB_LOWER},
+   {0xA750, 1, EAIL_SB_UPPER},
+   {0xA751, 1, EAIL_SB_LOWER},
+   {0xA752, 1, EAIL_SB_UPPER},
+   {0xA753, 1, EAIL_SB_LOWER},
+   {0xA754, 1, EAIL_SB_UPPER},
+   {0xA755, 1, EAIL_SB_LOWER},
+   {0xA756, 1, EAIL_SB_UPPER},
+   {0xA757, 1, EAIL_SB_LOWER},
+   {0xA758, 1, EAIL_SB_UPPER},
+   {0xA759, 1, EAIL_SB_LOWER},
+   {0xA75A, 1, EAIL_SB_UPPER},
+   {0xA75B, 1, EAIL_SB_LOWER},
+   {0xA75C, 1, EAIL_SB_UPPER},
+   {0xA75D, 1, EAIL_SB_LOWER},
+   {0xA75E, 1, EAIL_SB_UPPER},
+   {0xA75F, 1, EAIL_SB_LOWER},
+   {0xA760, 1, EAIL_SB_UPPER},
+   {0xA761, 1, EAIL_SB_LOWER},
+   {0xA762, 1, EAIL_SB_UPPER},
+   {0xA763, 1, EAIL_SB_LOWER},
+   {0xA764, 1, EAIL_SB_UPPER},
+   {0xA765, 1, EAIL_SB_LOWER},
+   {0xA766, 1, EAIL_SB_UPPER},
+   {0xA767, 1, EAIL_SB_LOWER},
+   {0xA768, 1, EAIL_SB_UPPER},
+   {0xA769, 1, EAIL_SB_LOWER},
+   {0xA76A, 1, EAIL_SB_UPPER},
+   {0xA76B, 1, EAIL_SB_LOWER},
+   {0xA76C, 1, EAIL_SB_UPPER},
+   {0xA76D, 1, EAIL_SB_LOWER},
+   {0xA76E, 1, EAIL_SB_UPPER},
+   {0xA76F, 10, EAIL_SB_LOWER},
+   {0xA779, 1, EAIL_SB_UPPER},
+   {0xA77A, 1, EAIL_SB_LOWER},
+   {0xA77B, 1, EAIL_SB_UPPER},
+   {0xA77C, 1, EAIL_SB_LOWER},
+   {0xA77D, 2, EAIL_SB_UPPER},
+   {0xA77F, 1, EAIL_SB_LOWER},
+   {0xA780, 1, EAIL_SB_UPPER},
+   {0xA781, 1, EAIL_SB_LOWER},
+   {0xA782, 1, EAIL_SB_UPPER},
+   {0xA783, 1, EAIL_SB_LOWER},
+   {0xA784, 1, EAIL_SB_UPPER},
+   {0xA785, 1, EAIL_SB_LOWER},
+   {0xA786, 1, EAIL_SB_UPPER},
+   {0xA787, 1, EAIL_SB_LOWER},
+   {0xA788, 1, EAIL_SB_OLETTER},
+   {0xA78B, 1, EAIL_SB_UPPER},
+   {0xA78C, 1, EAIL_SB_LOWER},
+   {0xA78D, 1, EAIL_SB_UPPER},
+   {0xA78E, 1, EAIL_SB_LOWER},
+   {0xA78F, 1, EAIL_SB_OLETTER},
+   {0xA790, 1, EAIL_SB_UPPER},
+   {0xA791, 1, EAIL_SB_LOWER},
+   {0xA792, 1, EAIL_SB_UPPER},
+   {0xA793, 3, EAIL_SB_LOWER},
+   {0xA796, 1, EAIL_SB_UPPER},
+   {0xA797, 1, EAIL_SB_LOWER},
+   {0xA798, 1, EAIL_SB_UPPER},
+   {0xA799, 1, EAIL_SB_LOWER},
+   {0xA79A, 1, EAIL_SB_UPPER},
+   {0xA79B, 1, EAIL_SB_LOWER},
+   {0xA79C, 1, EAIL_SB_UPPER},
+   {0xA79D, 1, EAIL_SB_LOWER},
+   {0xA79E, 1, EAIL_SB_UPPER},
+   {0xA79F, 1, EAIL_SB_LOWER},
+   {0xA7A0, 1, EAIL_SB_UPPER},
+   {0xA7A1, 1, EAIL_SB_LOWER},
+   {0xA7A2, 1, EAIL_SB_UPPER},
+   {0xA7A3, 1, EAIL_SB_LOWER},
+   {0xA7A4, 1, EAIL_SB_UPPER},
+   {0xA7A5, 1, EAIL_SB_LOWER},
+   {0xA7A6, 1, EAIL_SB_UPPER},
+   {0xA7A7, 1, EAIL_SB_LOWER},
+   {0xA7A8, 1, EAIL_SB_UPPER},
+   {0xA7A9, 1, EAIL_SB_LOWER},
+   {0xA7AA, 5, EAIL_SB_UPPER},
+   {0xA7AF, 1, EAIL_SB_LOWER},
+   {0xA7B0, 5, EAIL_SB_UPPER},
+   {0xA7B5, 1, EAIL_SB_LOWER},
+   {0xA7B6, 1, EAIL_SB_UPPER},
+   {0xA7B7, 1, EAIL_SB_LOWER},
+   {0xA7B8, 1, EAIL_SB_UPPER},
+   {0xA7B9, 1, EAIL_SB_LOWER},
+   {0xA7BA, 1, EAIL_SB_UPPER},
+   {0xA7BB, 1, EAIL_SB_LOWER},
+   {0xA7BC, 1, EAIL_SB_UPPER},
+   {0xA7BD, 1, EAIL_SB_LOWER},
+   {0xA7BE, 1, EAIL_SB_UPPER},
+   {0xA7BF, 1, EAIL_SB_LOWER},
+   {0xA7C0, 1, EAIL_SB_UPPER},
+   {0xA7C1, 1, EAIL_SB_LOWER},
+   {0xA7C2, 1, EAIL_SB_UPPER},
+   {0xA7C3, 1, EAIL_SB_LOWER},
+   {0xA7C4, 4, EAIL_SB_UPPER},
+   {0xA7C8, 1, EAIL_SB_LOWER},
+   {0xA7C9, 1, EAIL_SB_UPPER},
+   {0xA7CA, 1, EAIL_SB_LOWER},
+   {0xA7D0, 1, EAIL_SB_UPPER},
+   {0xA7D1, 1, EAIL_SB_LOWER},
+   {0xA7D3, 1, EAIL_SB_LOWER},
+   {0xA7D5, 1, EAIL_SB_LOWER},
+   {0xA7D6, 1, EAIL_SB_UPPER},
+   {0xA7D7, 1, EAIL_SB_LOWER},
+   {0xA7D8, 1, EAIL_SB_UPPER},
+   {0xA7D9, 1, EAIL_SB_LOWER},
+   {0xA7F2, 3, EAIL_SB_OLETTER},
+   {0xA7F5, 1, EAIL_SB_UPPER},
+   {0xA7F6, 1, EAIL_SB_LOWER},
+   {0xA7F7, 1, EAIL_SB_OLETTER},
+   {0xA7F8, 3, EAIL_SB_LOWER},
+   {0xA7FB, 7, EAIL_SB_OLETTER},
+   {0xA802, 1, EAIL_SB_EXTEND},
+   {0xA803, 3, EAIL_SB_OLETTER},
+   {0xA806, 1, EAIL_SB_EXTEND},
+   {0xA807, 4, EAIL_SB_OLETTER},
+   {0xA80B, 1, EAIL_SB_EXTEND},
+   {0xA80C, 23, EAIL_SB_OLETTER},
+   {0xA823, 5, EAIL_SB_EXTEND},
+   {0xA82C, 1, EAIL_SB_EXTEND},
+   {0xA840, 52, EAIL_SB_OLETTER},
+   {0xA876, 2, EAIL_SB_STERM},
+   {0xA880, 2, EAIL_SB_EXTEND},
+   {0xA882, 50, EAIL_SB_OLETTER},
+   {0xA8B4, 18, EAIL_SB_EXTEND},
+   {0xA8CE, 2, EAIL_SB_STERM},
+   {0xA8D0, 10, EAIL_SB_NUMERIC},
+   {0xA8E0, 18, EAIL_SB_EXTEND},
+   {0xA8F2, 6, EAIL_SB_OLETTER},
+   {0xA8FB, 1, EAIL_SB_OLETTER},
+   {0xA8FD, 2, EAIL_SB_OLETTER},
+   {0xA8FF, 1, EAIL_SB_EXTEND},
+   {0xA900, 10, EAIL_SB_NUMERIC},
+   {0xA90A, 28, EAIL_SB_OLETTER},
+   {0xA926, 8, EAIL_SB_EXTEND},
+   {0xA92F, 1, EAIL_SB_STERM},
+   {0xA930, 23, EAIL_SB_OLETTER},
+   {0xA947, 13, EAIL_SB_EXTEND},
+   {0xA960, 29, EAIL_SB_OLETTER},
+   {0xA980, 4, EAIL_SB_EXTEND},
+   {0xA984, 47, EAIL_SB_OLETTER},
+   {0xA9B3, 14, EAIL_SB_EXTEND},
+   {0xA9C8, 2, EAIL_SB_STERM},
+   {0xA9CF, 1, EAIL_SB_OLETTER},
+   {0xA9D0, 10, EAIL_SB_NUMERIC},
+   {0xA9E0, 5, EAIL_SB_OLETTER},
+   {0xA9E5, 1, EAIL_SB_EXTEND},
+   {0xA9E6, 10, EAIL_SB_OLETTER},
+   {0xA9F0, 10, EAIL_SB_NUMERIC},
+   {0xA9FA, 5, EAIL_SB_OLETTER},
+   {0xAA00, 41, EAIL_SB_OLETTER},
+   {0xAA29, 14, EAIL_SB_EXTEND},
+   {0xAA40, 3, EAIL_SB_OLETTER},
+   {0xAA43, 1, EAIL_SB_EXTEND},
+   {0xAA44, 8, EAIL_SB_OLETTER},
+   {0xAA4C, 2, EAIL_SB_EXTEND},
+   {0xAA50, 10, EAIL_SB_NUMERIC},
+   {0xAA5D, 3, EAIL_SB_STERM},
+   {0xAA60, 23, EAIL_SB_OLETTER},
+   {0xAA7A, 1, EAIL_SB_OLETTER},
+   {0xAA7B, 3, EAIL_SB_EXTEND},
+   {0xAA7E, 50, EAIL_SB_OLETTER},
+   {0xAAB0, 1, EAIL_SB_EXTEND},
+   {0xAAB1, 1, EAIL_SB_OLETTER},
+   {0xAAB2, 3, EAIL_SB_EXTEND},
+   {0xAAB5, 2, EAIL_SB_OLETTER},
+   {0xAAB7, 2, EAIL_SB_EXTEND},
+   {0xAAB9, 5, EAIL_SB_OLETTER},
+   {0xAABE, 2, EAIL_SB_EXTEND},
+   {0xAAC0, 1, EAIL_SB_OLETTER},
+   {0xAAC1, 1, EAIL_SB_EXTEND},
+   {0xAAC2, 1, EAIL_SB_OLETTER},
+   {0xAADB, 3, EAIL_SB_OLETTER},
+   {0xAAE0, 11, EAIL_SB_OLETTER},
+   {0xAAEB, 5, EAIL_SB_EXTEND},
+   {0xAAF0, 2, EAIL_SB_STERM},
+   {0xAAF2, 3, EAIL_SB_OLETTER},
+   {0xAAF5, 2, EAIL_SB_EXTEND},
+   {0xAB01, 6, EAIL_SB_OLETTER},
+   {0xAB09, 6, EAIL_SB_OLETTER},
+   {0xAB11, 6, EAIL_SB_OLETTER},
+   {0xAB20, 7, EAIL_SB_OLETTER},
+   {0xAB28, 7, EAIL_SB_OLETTER},
+   {0xAB30, 43, EAIL_SB_LOWER},
+   {0xAB5C, 13, EAIL_SB_LOWER},
+   {0xAB69, 1, EAIL_SB_OLETTER},
+   {0xAB70, 80, EAIL_SB_LOWER},
+   {0xABC0, 35, EAIL_SB_OLETTER},
+   {0xABE3, 8, EAIL_SB_EXTEND},
+   {0xABEB, 1, EAIL_SB_STERM},
+   {0xABEC, 2, EAIL_SB_EXTEND},
+   {0xABF0, 10, EAIL_SB_NUMERIC},
+   {0xAC00, 11172, EAIL_SB_OLETTER},
+   {0xD7B0, 23, EAIL_SB_OLETTER},
+   {0xD7CB, 49, EAIL_SB_OLETTER},
+   {0xF900, 366, EAIL_SB_OLETTER},
+   {0xFA70, 106, EAIL_SB_OLETTER},
+   {0xFB00, 7, EAIL_SB_LOWER},
+   {0xFB13, 5, EAIL_SB_LOWER},
+   {0xFB1D, 1, EAIL_SB_OLETTER},
+   {0xFB1E, 1, EAIL_SB_EXTEND},
+   {0xFB1F, 10, EAIL_SB_OLETTER},
+   {0xFB2A, 13, EAIL_SB_OLETTER},
+   {0xFB38, 5, EAIL_SB_OLETTER},
+   {0xFB3E, 1, EAIL_SB_OLETTER},
+   {0xFB40, 2, EAIL_SB_OLETTER},
+   {0xFB43, 2, EAIL_SB_OLETTER},
+   {0xFB46, 108, EAIL_SB_OLETTER},
+   {0xFBD3, 363, EAIL_SB_OLETTER},
+   {0xFD3E, 2, EAIL_SB_CLOSE},
+   {0xFD50, 64, EAIL_SB_OLETTER},
+   {0xFD92, 54, EAIL_SB_OLETTER},
+   {0xFDF0, 12, EAIL_SB_OLETTER},
+   {0xFE00, 16, EAIL_SB_EXTEND},
+   {0xFE10, 2, EAIL_SB_SCONTINUE},
+   {0xFE13, 1, EAIL_SB_SCONTINUE},
+   {0xFE17, 2, EAIL_SB_CLOSE},
+   {0xFE20, 16, EAIL_SB_EXTEND},
+   {0xFE31, 2, EAIL_SB_SCONTINUE},
+   {0xFE35, 16, EAIL_SB_CLOSE},
+   {0xFE47, 2, EAIL_SB_CLOSE},
+   {0xFE50, 2, EAIL_SB_SCONTINUE},
+   {0xFE52, 1, EAIL_SB_ATERM},
+   {0xFE55, 1, EAIL_SB_SCONTINUE},
+   {0xFE56, 2, EAIL_SB_STERM},
+   {0xFE58, 1, EAIL_SB_SCONTINUE},
+   {0xFE59, 6, EAIL_SB_CLOSE},
+   {0xFE63, 1, EAIL_SB_SCONTINUE},
+   {0xFE70, 5, EAIL_SB_OLETTER},
+   {0xFE76, 135, EAIL_SB_OLETTER},
+   {0xFEFF, 1, EAIL_SB_FORMAT},
+   {0xFF01, 1, EAIL_SB_STERM},
+   {0xFF08, 2, EAIL_SB_CLOSE},
+   {0xFF0C, 2, EAIL_SB_SCONTINUE},
+   {0xFF0E, 1, EAIL_SB_ATERM},
+   {0xFF10, 10, EAIL_SB_NUMERIC},
+   {0xFF1A, 1, EAIL_SB_SCONTINUE},
+   {0xFF1F, 1, EAIL_SB_STERM},
+   {0xFF21, 26, EAIL_SB_UPPER},
+   {0xFF3B, 1, EAIL_SB_CLOSE},
+   {0xFF3D, 1, EAIL_SB_CLOSE},
+   {0xFF41, 26, EAIL_SB_LOWER},
+   {0xFF5B, 1, EAIL_SB_CLOSE},
+   {0xFF5D, 1, EAIL_SB_CLOSE},
+   {0xFF5F, 2, EAIL_SB_CLOSE},
+   {0xFF61, 1, EAIL_SB_STERM},
+   {0xFF62, 2, EAIL_SB_CLOSE},
+   {0xFF64, 1, EAIL_SB_SCONTINUE},
+   {0xFF66, 56, EAIL_SB_OLETTER},
+   {0xFF9E, 2, EAIL_SB_EXTEND},
+   {0xFFA0, 31, EAIL_SB_OLETTER},
+   {0xFFC2, 6, EAIL_SB_OLETTER},
+   {0xFFCA, 6, EAIL_SB_OLETTER},
+   {0xFFD2, 6, EAIL_SB_OLETTER},
+   {0xFFDA, 3, EAIL_SB_OLETTER},
+   {0xFFF9, 3, EAIL_SB_FORMAT},
+   {0x10000, 12, EAIL_SB_OLETTER},
+   {0x1000D, 26, EAIL_SB_OLETTER},
+   {0x10028, 19, EAIL_SB_OLETTER},
+   {0x1003C, 2, EAIL_SB_OLETTER},
+   {0x1003F, 15, EAIL_SB_OLETTER},
+   {0x10050, 14, EAIL_SB_OLETTER},
+   {0x10080, 123, EAIL_SB_OLETTER},
+   {0x10140, 53, EAIL_SB_OLETTER},
+   {0x101FD, 1, EAIL_SB_EXTEND},
+   {0x10280, 29, EAIL_SB_OLETTER},
+   {0x102A0, 49, EAIL_SB_OLETTER},
+   {0x102E0, 1, EAIL_SB_EXTEND},
+   {0x10300, 32, EAIL_SB_OLETTER},
+   {0x1032D, 30, EAIL_SB_OLETTER},
+   {0x10350, 38, EAIL_SB_OLETTER},
+   {0x10376, 5, EAIL_SB_EXTEND},
+   {0x10380, 30, EAIL_SB_OLETTER},
+   {0x103A0, 36, EAIL_SB_OLETTER},
+   {0x103C8, 8, EAIL_SB_OLETTER},
+   {0x103D1, 5, EAIL_SB_OLETTER},
+   {0x10400, 40, EAIL_SB_UPPER},
+   {0x10428, 40, EAIL_SB_LOWER},
+   {0x10450, 78, EAIL_SB_OLETTER},
+   {0x104A0, 10, EAIL_SB_NUMERIC},
+   {0x104B0, 36, EAIL_SB_UPPER},
+   {0x104D8, 36, EAIL_SB_LOWER},
+   {0x10500, 40, EAIL_SB_OLETTER},
+   {0x10530, 52, EAIL_SB_OLETTER},
+   {0x10570, 11, EAIL_SB_UPPER},
+   {0x1057C, 15, EAIL_SB_UPPER},
+   {0x1058C, 7, EAIL_SB_UPPER},
+   {0x10594, 2, EAIL_SB_UPPER},
+   {0x10597, 11, EAIL_SB_LOWER},
+   {0x105A3, 15, EAIL_SB_LOWER},
+   {0x105B3, 7, EAIL_SB_LOWER},
+   {0x105BB, 2, EAIL_SB_LOWER},
+   {0x10600, 311, EAIL_SB_OLETTER},
+   {0x10740, 22, EAIL_SB_OLETTER},
+   {0x10760, 8, EAIL_SB_OLETTER},
+   {0x10780, 1, EAIL_SB_LOWER},
+   {0x10781, 2, EAIL_SB_OLETTER},
+   {0x10783, 3, EAIL_SB_LOWER},
+   {0x10787, 42, EAIL_SB_LOWER},
+   {0x107B2, 9, EAIL_SB_LOWER},
+   {0x10800, 6, EAIL_SB_OLETTER},
+   {0x10808, 1, EAIL_SB_OLETTER},
+   {0x1080A, 44, EAIL_SB_OLETTER},
+   {0x10837, 2, EAIL_SB_OLETTER},
+   {0x1083C, 1, EAIL_SB_OLETTER},
+   {0x1083F, 23, EAIL_SB_OLETTER},
+   {0x10860, 23, EAIL_SB_OLETTER},
+   {0x10880, 31, EAIL_SB_OLETTER},
+   {0x108E0, 19, EAIL_SB_OLETTER},
+   {0x108F4, 2, EAIL_SB_OLETTER},
+   {0x10900, 22, EAIL_SB_OLETTER},
+   {0x10920, 26, EAIL_SB_OLETTER},
+   {0x10980, 56, EAIL_SB_OLETTER},
+   {0x109BE, 2, EAIL_SB_OLETTER},
+   {0x10A00, 1, EAIL_SB_OLETTER},
+   {0x10A01, 3, EAIL_SB_EXTEND},
+   {0x10A05, 2, EAIL_SB_EXTEND},
+   {0x10A0C, 4, EAIL_SB_EXTEND},
+   {0x10A10, 4, EAIL_SB_OLETTER},
+   {0x10A15, 3, EAIL_SB_OLETTER},
+   {0x10A19, 29, EAIL_SB_OLETTER},
+   {0x10A38, 3, EAIL_SB_EXTEND},
+   {0x10A3F, 1, EAIL_SB_EXTEND},
+   {0x10A56, 2, EAIL_SB_STERM},
+   {0x10A60, 29, EAIL_SB_OLETTER},
+   {0x10A80, 29, EAIL_SB_OLETTER},
+   {0x10AC0, 8, EAIL_SB_OLETTER},
+   {0x10AC9, 28, EAIL_SB_OLETTER},
+   {0x10AE5, 2, EAIL_SB_EXTEND},
+   {0x10B00, 54, EAIL_SB_OLETTER},
+   {0x10B40, 22, EAIL_SB_OLETTER},
+   {0x10B60, 19, EAIL_SB_OLETTER},
+   {0x10B80, 18, EAIL_SB_OLETTER},
+   {0x10C00, 73, EAIL_SB_OLETTER},
+   {0x10C80, 51, EAIL_SB_UPPER},
+   {0x10CC0, 51, EAIL_SB_LOWER},
+   {0x10D00, 36, EAIL_SB_OLETTER},
+   {0x10D24, 4, EAIL_SB_EXTEND},
+   {0x10D30, 10, EAIL_SB_NUMERIC},
+   {0x10E80, 42, EAIL_SB_OLETTER},
+   {0x10EAB, 2, EAIL_SB_EXTEND},
+   {0x10EB0, 2, EAIL_SB_OLETTER},
+   {0x10F00, 29, EAIL_SB_OLETTER},
+   {0x10F27, 1, EAIL_SB_OLETTER},
+   {0x10F30, 22, EAIL_SB_OLETTER},
+   {0x10F46, 11, EAIL_SB_EXTEND},
+   {0x10F55, 5, EAIL_SB_STERM},
+   {0x10F70, 18, EAIL_SB_OLETTER},
+   {0x10F82, 4, EAIL_SB_EXTEND},
+   {0x10F86, 4, EAIL_SB_STERM},
+   {0x10FB0, 21, EAIL_SB_OLETTER},
+   {0x10FE0, 23, EAIL_SB_OLETTER},
+   {0x11000, 3, EAIL_SB_EXTEND},
+   {0x11003, 53, EAIL_SB_OLETTER},
+   {0x11038, 15, EAIL_SB_EXTEND},
+   {0x11047, 2, EAIL_SB_STERM},
+   {0x11066, 10, EAIL_SB_NUMERIC},
+   {0x11070, 1, EAIL_SB_EXTEND},
+   {0x11071, 2, EAIL_SB_OLETTER},
+   {0x11073, 2, EAIL_SB_EXTEND},
+   {0x11075, 1, EAIL_SB_OLETTER},
+   {0x1107F, 4, EAIL_SB_EXTEND},
+   {0x11083, 45, EAIL_SB_OLETTER},
+   {0x110B0, 11, EAIL_SB_EXTEND},
+   {0x110BD, 1, EAIL_SB_FORMAT},
+   {0x110BE, 4, EAIL_SB_STERM},
+   {0x110C2, 1, EAIL_SB_EXTEND},
+   {0x110CD, 1, EAIL_SB_FORMAT},
+   {0x110D0, 25, EAIL_SB_OLETTER},
+   {0x110F0, 10, EAIL_SB_NUMERIC},
+   {0x11100, 3, EAIL_SB_EXTEND},
+   {0x11103, 36, EAIL_SB_OLETTER},
+   {0x11127, 14, EAIL_SB_EXTEND},
+   {0x11136, 10, EAIL_SB_NUMERIC},
+   {0x11141, 3, EAIL_SB_STERM},
+   {0x11144, 1, EAIL_SB_OLETTER},
+   {0x11145, 2, EAIL_SB_EXTEND},
+   {0x11147, 1, EAIL_SB_OLETTER},
+   {0x11150, 35, EAIL_SB_OLETTER},
+   {0x11173, 1, EAIL_SB_EXTEND},
+   {0x11176, 1, EAIL_SB_OLETTER},
+   {0x11180, 3, EAIL_SB_EXTEND},
+   {0x11183, 48, EAIL_SB_OLETTER},
+   {0x111B3, 14, EAIL_SB_EXTEND},
+   {0x111C1, 4, EAIL_SB_OLETTER},
+   {0x111C5, 2, EAIL_SB_STERM},
+   {0x111C9, 4, EAIL_SB_EXTEND},
+   {0x111CD, 1, EAIL_SB_STERM},
+   {0x111CE, 2, EAIL_SB_EXTEND},
+   {0x111D0, 10, EAIL_SB_NUMERIC},
+   {0x111DA, 1, EAIL_SB_OLETTER},
+   {0x111DC, 1, EAIL_SB_OLETTER},
+   {0x111DE, 2, EAIL_SB_STERM},
+   {0x11200, 18, EAIL_SB_OLETTER},
+   {0x11213, 25, EAIL_SB_OLETTER},
+   {0x1122C, 12, EAIL_SB_EXTEND},
+   {0x11238, 2, EAIL_SB_STERM},
+   {0x1123B, 2, EAIL_SB_STERM},
+   {0x1123E, 1, EAIL_SB_EXTEND},
+   {0x11280, 7, EAIL_SB_OLETTER},
+   {0x11288, 1, EAIL_SB_OLETTER},
+   {0x1128A, 4, EAIL_SB_OLETTER},
+   {0x1128F, 15, EAIL_SB_OLETTER},
+   {0x1129F, 10, EAIL_SB_OLETTER},
+   {0x112A9, 1, EAIL_SB_STERM},
+   {0x112B0, 47, EAIL_SB_OLETTER},
+   {0x112DF, 12, EAIL_SB_EXTEND},
+   {0x112F0, 10, EAIL_SB_NUMERIC},
+   {0x11300, 4, EAIL_SB_EXTEND},
+   {0x11305, 8, EAIL_SB_OLETTER},
+   {0x1130F, 2, EAIL_SB_OLETTER},
+   {0x11313, 22, EAIL_SB_OLETTER},
+   {0x1132A, 7, EAIL_SB_OLETTER},
+   {0x11332, 2, EAIL_SB_OLETTER},
+   {0x11335, 5, EAIL_SB_OLETTER},
+   {0x1133B, 2, EAIL_SB_EXTEND},
+   {0x1133D, 1, EAIL_SB_OLETTER},
+   {0x1133E, 7, EAIL_SB_EXTEND},
+   {0x11347, 2, EAIL_SB_EXTEND},
+   {0x1134B, 3, EAIL_SB_EXTEND},
+   {0x11350, 1, EAIL_SB_OLETTER},
+   {0x11357, 1, EAIL_SB_EXTEND},
+   {0x1135D, 5, EAIL_SB_OLETTER},
+   {0x11362, 2, EAIL_SB_EXTEND},
+   {0x11366, 7, EAIL_SB_EXTEND},
+   {0x11370, 5, EAIL_SB_EXTEND},
+   {0x11400, 53, EAIL_SB_OLETTER},
+   {0x11435, 18, EAIL_SB_EXTEND},
+   {0x11447, 4, EAIL_SB_OLETTER},
+   {0x1144B, 2, EAIL_SB_STERM},
+   {0x11450, 10, EAIL_SB_NUMERIC},
+   {0x1145E, 1, EAIL_SB_EXTEND},
+   {0x1145F, 3, EAIL_SB_OLETTER},
+   {0x11480, 48, EAIL_SB_OLETTER},
+   {0x114B0, 20, EAIL_SB_EXTEND},
+   {0x114C4, 2, EAIL_SB_OLETTER},
+   {0x114C7, 1, EAIL_SB_OLETTER},
+   {0x114D0, 10, EAIL_SB_NUMERIC},
+   {0x11580, 47, EAIL_SB_OLETTER},
+   {0x115AF, 7, EAIL_SB_EXTEND},
+   {0x115B8, 9, EAIL_SB_EXTEND},
+   {0x115C2, 2, EAIL_SB_STERM},
+   {0x115C9, 15, EAIL_SB_STERM},
+   {0x115D8, 4, EAIL_SB_OLETTER},
+   {0x115DC, 2, EAIL_SB_EXTEND},
+   {0x11600, 48, EAIL_SB_OLETTER},
+   {0x11630, 17, EAIL_SB_EXTEND},
+   {0x11641, 2, EAIL_SB_STERM},
+   {0x11644, 1, EAIL_SB_OLETTER},
+   {0x11650, 10, EAIL_SB_NUMERIC},
+   {0x11680, 43, EAIL_SB_OLETTER},
+   {0x116AB, 13, EAIL_SB_EXTEND},
+   {0x116B8, 1, EAIL_SB_OLETTER},
+   {0x116C0, 10, EAIL_SB_NUMERIC},
+   {0x11700, 27, EAIL_SB_OLETTER},
+   {0x1171D, 15, EAIL_SB_EXTEND},
+   {0x11730, 10, EAIL_SB_NUMERIC},
+   {0x1173C, 3, EAIL_SB_STERM},
+   {0x11740, 7, EAIL_SB_OLETTER},
+   {0x11800, 44, EAIL_SB_OLETTER},
+   {0x1182C, 15, EAIL_SB_EXTEND},
+   {0x118A0, 32, EAIL_SB_UPPER},
+   {0x118C0, 32, EAIL_SB_LOWER},
+   {0x118E0, 10, EAIL_SB_NUMERIC},
+   {0x118FF, 8, EAIL_SB_OLETTER},
+   {0x11909, 1, EAIL_SB_OLETTER},
+   {0x1190C, 8, EAIL_SB_OLETTER},
+   {0x11915, 2, EAIL_SB_OLETTER},
+   {0x11918, 24, EAIL_SB_OLETTER},
+   {0x11930, 6, EAIL_SB_EXTEND},
+   {0x11937, 2, EAIL_SB_EXTEND},
+   {0x1193B, 4, EAIL_SB_EXTEND},
+   {0x1193F, 1, EAIL_SB_OLETTER},
+   {0x11940, 1, EAIL_SB_EXTEND},
+   {0x11941, 1, EAIL_SB_OLETTER},
+   {0x11942, 2, EAIL_SB_EXTEND},
+   {0x11944, 1, EAIL_SB_STERM},
+   {0x11946, 1, EAIL_SB_STERM},
+   {0x11950, 10, EAIL_SB_NUMERIC},
+   {0x119A0, 8, EAIL_SB_OLETTER},
+   {0x119AA, 39, EAIL_SB_OLETTER},
+   {0x119D1, 7, EAIL_SB_EXTEND},
+   {0x119DA, 7, EAIL_SB_EXTEND},
+   {0x119E1, 1, EAIL_SB_OLETTER},
+   {0x119E3, 1, EAIL_SB_OLETTER},
+   {0x119E4, 1, EAIL_SB_EXTEND},
+   {0x11A00, 1, EAIL_SB_OLETTER},
+   {0x11A01, 10, EAIL_SB_EXTEND},
+   {0x11A0B, 40, EAIL_SB_OLETTER},
+   {0x11A33, 7, EAIL_SB_EXTEND},
+   {0x11A3A, 1, EAIL_SB_OLETTER},
+   {0x11A3B, 4, EAIL_SB_EXTEND},
+   {0x11A42, 2, EAIL_SB_STERM},
+   {0x11A47, 1, EAIL_SB_EXTEND},
+   {0x11A50, 1, EAIL_SB_OLETTER},
+   {0x11A51, 11, EAIL_SB_EXTEND},
+   {0x11A5C, 46, EAIL_SB_OLETTER},
+   {0x11A8A, 16, EAIL_SB_EXTEND},
+   {0x11A9B, 2, EAIL_SB_STERM},
+   {0x11A9D, 1, EAIL_SB_OLETTER},
+   {0x11AB0, 73, EAIL_SB_OLETTER},
+   {0x11C00, 9, EAIL_SB_OLETTER},
+   {0x11C0A, 37, EAIL_SB_OLETTER},
+   {0x11C2F, 8, EAIL_SB_EXTEND},
+   {0x11C38, 8, EAIL_SB_EXTEND},
+   {0x11C40, 1, EAIL_SB_OLETTER},
+   {0x11C41, 2, EAIL_SB_STERM},
+   {0x11C50, 10, EAIL_SB_NUMERIC},
+   {0x11C72, 30, EAIL_SB_OLETTER},
+   {0x11C92, 22, EAIL_SB_EXTEND},
+   {0x11CA9, 14, EAIL_SB_EXTEND},
+   {0x11D00, 7, EAIL_SB_OLETTER},
+   {0x11D08, 2, EAIL_SB_OLETTER},
+   {0x11D0B, 38, EAIL_SB_OLETTER},
+   {0x11D31, 6, EAIL_SB_EXTEND},
+   {0x11D3A, 1, EAIL_SB_EXTEND},
+   {0x11D3C, 2, EAIL_SB_EXTEND},
+   {0x11D3F, 7, EAIL_SB_EXTEND},
+   {0x11D46, 1, EAIL_SB_OLETTER},
+   {0x11D47, 1, EAIL_SB_EXTEND},
+   {0x11D50, 10, EAIL_SB_NUMERIC},
+   {0x11D60, 6, EAIL_SB_OLETTER},
+   {0x11D67, 2, EAIL_SB_OLETTER},
+   {0x11D6A, 32, EAIL_SB_OLETTER},
+   {0x11D8A, 5, EAIL_SB_EXTEND},
+   {0x11D90, 2, EAIL_SB_EXTEND},
+   {0x11D93, 5, EAIL_SB_EXTEND},
+   {0x11D98, 1, EAIL_SB_OLETTER},
+   {0x11DA0, 10, EAIL_SB_NUMERIC},
+   {0x11EE0, 19, EAIL_SB_OLETTER},
+   {0x11EF3, 4, EAIL_SB_EXTEND},
+   {0x11EF7, 2, EAIL_SB_STERM},
+   {0x11FB0, 1, EAIL_SB_OLETTER},
+   {0x12000, 922, EAIL_SB_OLETTER},
+   {0x12400, 111, EAIL_SB_OLETTER},
+   {0x12480, 196, EAIL_SB_OLETTER},
+   {0x12F90, 97, EAIL_SB_OLETTER},
+   {0x13000, 1071, EAIL_SB_OLETTER},
+   {0x13430, 9, EAIL_SB_FORMAT},
+   {0x14400, 583, EAIL_SB_OLETTER},
+   {0x16800, 569, EAIL_SB_OLETTER},
+   {0x16A40, 31, EAIL_SB_OLETTER},
+   {0x16A60, 10, EAIL_SB_NUMERIC},
+   {0x16A6E, 2, EAIL_SB_STERM},
+   {0x16A70, 79, EAIL_SB_OLETTER},
+   {0x16AC0, 10, EAIL_SB_NUMERIC},
+   {0x16AD0, 30, EAIL_SB_OLETTER},
+   {0x16AF0, 5, EAIL_SB_EXTEND},
+   {0x16AF5, 1, EAIL_SB_STERM},
+   {0x16B00, 48, EAIL_SB_OLETTER},
+   {0x16B30, 7, EAIL_SB_EXTEND},
+   {0x16B37, 2, EAIL_SB_STERM},
+   {0x16B40, 4, EAIL_SB_OLETTER},
+   {0x16B44, 1, EAIL_SB_STERM},
+   {0x16B50, 10, EAIL_SB_NUMERIC},
+   {0x16B63, 21, EAIL_SB_OLETTER},
+   {0x16B7D, 19, EAIL_SB_OLETTER},
+   {0x16E40, 32, EAIL_SB_UPPER},
+   {0x16E60, 32, EAIL_SB_LOWER},
+   {0x16E98, 1, EAIL_SB_STERM},
+   {0x16F00, 75, EAIL_SB_OLETTER},
+   {0x16F4F, 1, EAIL_SB_EXTEND},
+   {0x16F50, 1, EAIL_SB_OLETTER},
+   {0x16F51, 55, EAIL_SB_EXTEND},
+   {0x16F8F, 4, EAIL_SB_EXTEND},
+   {0x16F93, 13, EAIL_SB_OLETTER},
+   {0x16FE0, 2, EAIL_SB_OLETTER},
+   {0x16FE3, 1, EAIL_SB_OLETTER},
+   {0x16FE4, 1, EAIL_SB_EXTEND},
+   {0x16FF0, 2, EAIL_SB_EXTEND},
+   {0x17000, 6136, EAIL_SB_OLETTER},
+   {0x18800, 1238, EAIL_SB_OLETTER},
+   {0x18D00, 9, EAIL_SB_OLETTER},
+   {0x1AFF0, 4, EAIL_SB_OLETTER},
+   {0x1AFF5, 7, EAIL_SB_OLETTER},
+   {0x1AFFD, 2, EAIL_SB_OLETTER},
+   {0x1B000, 291, EAIL_SB_OLETTER},
+   {0x1B150, 3, EAIL_SB_OLETTER},
+   {0x1B164, 4, EAIL_SB_OLETTER},
+   {0x1B170, 396, EAIL_SB_OLETTER},
+   {0x1BC00, 107, EAIL_SB_OLETTER},
+   {0x1BC70, 13, EAIL_SB_OLETTER},
+   {0x1BC80, 9, EAIL_SB_OLETTER},
+   {0x1BC90, 10, EAIL_SB_OLETTER},
+   {0x1BC9D, 2, EAIL_SB_EXTEND},
+   {0x1BC9F, 1, EAIL_SB_STERM},
+   {0x1BCA0, 4, EAIL_SB_FORMAT},
+   {0x1CF00, 46, EAIL_SB_EXTEND},
+   {0x1CF30, 23, EAIL_SB_EXTEND},
+   {0x1D165, 5, EAIL_SB_EXTEND},
+   {0x1D16D, 6, EAIL_SB_EXTEND},
+   {0x1D173, 8, EAIL_SB_FORMAT},
+   {0x1D17B, 8, EAIL_SB_EXTEND},
+   {0x1D185, 7, EAIL_SB_EXTEND},
+   {0x1D1AA, 4, EAIL_SB_EXTEND},
+   {0x1D242, 3, EAIL_SB_EXTEND},
+   {0x1D400, 26, EAIL_SB_UPPER},
+   {0x1D41A, 26, EAIL_SB_LOWER},
+   {0x1D434, 26, EAIL_SB_UPPER},
+   {0x1D44E, 7, EAIL_SB_LOWER},
+   {0x1D456, 18, EAIL_SB_LOWER},
+   {0x1D468, 26, EAIL_SB_UPPER},
+   {0x1D482, 26, EAIL_SB_LOWER},
+   {0x1D49C, 1, EAIL_SB_UPPER},
+   {0x1D49E, 2, EAIL_SB_UPPER},
+   {0x1D4A2, 1, EAIL_SB_UPPER},
+   {0x1D4A5, 2, EAIL_SB_UPPER},
+   {0x1D4A9, 4, EAIL_SB_UPPER},
+   {0x1D4AE, 8, EAIL_SB_UPPER},
+   {0x1D4B6, 4, EAIL_SB_LOWER},
+   {0x1D4BB, 1, EAIL_SB_LOWER},
+   {0x1D4BD, 7, EAIL_SB_LOWER},
+   {0x1D4C5, 11, EAIL_SB_LOWER},
+   {0x1D4D0, 26, EAIL_SB_UPPER},
+   {0x1D4EA, 26, EAIL_SB_LOWER},
+   {0x1D504, 2, EAIL_SB_UPPER},
+   {0x1D507, 4, EAIL_SB_UPPER},
+   {0x1D50D, 8, EAIL_SB_UPPER},
+   {0x1D516, 7, EAIL_SB_UPPER},
+   {0x1D51E, 26, EAIL_SB_LOWER},
+   {0x1D538, 2, EAIL_SB_UPPER},
+   {0x1D53B, 4, EAIL_SB_UPPER},
+   {0x1D540, 5, EAIL_SB_UPPER},
+   {0x1D546, 1, EAIL_SB_UPPER},
+   {0x1D54A, 7, EAIL_SB_UPPER},
+   {0x1D552, 26, EAIL_SB_LOWER},
+   {0x1D56C, 26, EAIL_SB_UPPER},
+   {0x1D586, 26, EAIL_SB_LOWER},
+   {0x1D5A0, 26, EAIL_SB_UPPER},
+   {0x1D5BA, 26, EAIL_SB_LOWER},
+   {0x1D5D4, 26, EAIL_SB_UPPER},
+   {0x1D5EE, 26, EAIL_SB_LOWER},
+   {0x1D608, 26, EAIL_SB_UPPER},
+   {0x1D622, 26, EAIL_SB_LOWER},
+   {0x1D63C, 26, EAIL_SB_UPPER},
+   {0x1D656, 26, EAIL_SB_LOWER},
+   {0x1D670, 26, EAIL_SB_UPPER},
+   {0x1D68A, 28, EAIL_SB_LOWER},
+   {0x1D6A8, 25, EAIL_SB_UPPER},
+   {0x1D6C2, 25, EAIL_SB_LOWER},
+   {0x1D6DC, 6, EAIL_SB_LOWER},
+   {0x1D6E2, 25, EAIL_SB_UPPER},
+   {0x1D6FC, 25, EAIL_SB_LOWER},
+   {0x1D716, 6, EAIL_SB_LOWER},
+   {0x1D71C, 25, EAIL_SB_UPPER},
+   {0x1D736, 25, EAIL_SB_LOWER},
+   {0x1D750, 6, EAIL_SB_LOWER},
+   {0x1D756, 25, EAIL_SB_UPPER},
+   {0x1D770, 25, EAIL_SB_LOWER},
+   {0x1D78A, 6, EAIL_SB_LOWER},
+   {0x1D790, 25, EAIL_SB_UPPER},
+   {0x1D7AA, 25, EAIL_SB_LOWER},
+   {0x1D7C4, 6, EAIL_SB_LOWER},
+   {0x1D7CA, 1, EAIL_SB_UPPER},
+   {0x1D7CB, 1, EAIL_SB_LOWER},
+   {0x1D7CE, 50, EAIL_SB_NUMERIC},
+   {0x1DA00, 55, EAIL_SB_EXTEND},
+   {0x1DA3B, 50, EAIL_SB_EXTEND},
+   {0x1DA75, 1, EAIL_SB_EXTEND},
+   {0x1DA84, 1, EAIL_SB_EXTEND},
+   {0x1DA88, 1, EAIL_SB_STERM},
+   {0x1DA9B, 5, EAIL_SB_EXTEND},
+   {0x1DAA1, 15, EAIL_SB_EXTEND},
+   {0x1DF00, 10, EAIL_SB_LOWER},
+   {0x1DF0A, 1, EAIL_SB_OLETTER},
+   {0x1DF0B, 20, EAIL_SB_LOWER},
+   {0x1E000, 7, EAIL_SB_EXTEND},
+   {0x1E008, 17, EAIL_SB_EXTEND},
+   {0x1E01B, 7, EAIL_SB_EXTEND},
+   {0x1E023, 2, EAIL_SB_EXTEND},
+   {0x1E026, 5, EAIL_SB_EXTEND},
+   {0x1E100, 45, EAIL_SB_OLETTER},
+   {0x1E130, 7, EAIL_SB_EXTEND},
+   {0x1E137, 7, EAIL_SB_OLETTER},
+   {0x1E140, 10, EAIL_SB_NUMERIC},
+   {0x1E14E, 1, EAIL_SB_OLETTER},
+   {0x1E290, 30, EAIL_SB_OLETTER},
+   {0x1E2AE, 1, EAIL_SB_EXTEND},
+   {0x1E2C0, 44, EAIL_SB_OLETTER},
+   {0x1E2EC, 4, EAIL_SB_EXTEND},
+   {0x1E2F0, 10, EAIL_SB_NUMERIC},
+   {0x1E7E0, 7, EAIL_SB_OLETTER},
+   {0x1E7E8, 4, EAIL_SB_OLETTER},
+   {0x1E7ED, 2, EAIL_SB_OLETTER},
+   {0x1E7F0, 15, EAIL_SB_OLETTER},
+   {0x1E800, 197, EAIL_SB_OLETTER},
+   {0x1E8D0, 7, EAIL_SB_EXTEND},
+   {0x1E900, 34, EAIL_SB_UPPER},
+   {0x1E922, 34, EAIL_SB_LOWER},
+   {0x1E944, 7, EAIL_SB_EXTEND},
+   {0x1E94B, 1, EAIL_SB_OLETTER},
+   {0x1E950, 10, EAIL_SB_NUMERIC},
+   {0x1EE00, 4, EAIL_SB_OLETTER},
+   {0x1EE05, 27, EAIL_SB_OLETTER},
+   {0x1EE21, 2, EAIL_SB_OLETTER},
+   {0x1EE24, 1, EAIL_SB_OLETTER},
+   {0x1EE27, 1, EAIL_SB_OLETTER},
+   {0x1EE29, 10, EAIL_SB_OLETTER},
+   {0x1EE34, 4, EAIL_SB_OLETTER},
+   {0x1EE39, 1, EAIL_SB_OLETTER},
+   {0x1EE3B, 1, EAIL_SB_OLETTER},
+   {0x1EE42, 1, EAIL_SB_OLETTER},
+   {0x1EE47, 1, EAIL_SB_OLETTER},
+   {0x1EE49, 1, EAIL_SB_OLETTER},
+   {0x1EE4B, 1, EAIL_SB_OLETTER},
+   {0x1EE4D, 3, EAIL_SB_OLETTER},
+   {0x1EE51, 2, EAIL_SB_OLETTER},
+   {0x1EE54, 1, EAIL_SB_OLETTER},
+   {0x1EE57, 1, EAIL_SB_OLETTER},
+   {0x1EE59, 1, EAIL_SB_OLETTER},
+   {0x1EE5B, 1, EAIL_SB_OLETTER},
+   {0x1EE5D, 1, EAIL_SB_OLETTER},
+   {0x1EE5F, 1, EAIL_SB_OLETTER},
+   {0x1EE61, 2, EAIL_SB_OLETTER},
+   {0x1EE64, 1, EAIL_SB_OLETTER},
+   {0x1EE67, 4, EAIL_SB_OLETTER},
+   {0x1EE6C, 7, EAIL_SB_OLETTER},
+   {0x1EE74, 4, EAIL_SB_OLETTER},
+   {0x1EE79, 4, EAIL_SB_OLETTER},
+   {0x1EE7E, 1, EAIL_SB_OLETTER},
+   {0x1EE80, 10, EAIL_SB_OLETTER},
+   {0x1EE8B, 17, EAIL_SB_OLETTER},
+   {0x1EEA1, 3, EAIL_SB_OLETTER},
+   {0x1EEA5, 5, EAIL_SB_OLETTER},
+   {0x1EEAB, 17, EAIL_SB_OLETTER},
+   {0x1F130, 26, EAIL_SB_UPPER},
+   {0x1F150, 26, EAIL_SB_UPPER},
+   {0x1F170, 26, EAIL_SB_UPPER},
+   {0x1F676, 3, EAIL_SB_CLOSE},
+   {0x1FBF0, 10, EAIL_SB_NUMERIC},
+   {0x20000, 42720, EAIL_SB_OLETTER},
+   {0x2A700, 4153, EAIL_SB_OLETTER},
+   {0x2B740, 222, EAIL_SB_OLETTER},
+   {0x2B820, 5762, EAIL_SB_OLETTER},
+   {0x2CEB0, 7473, EAIL_SB_OLETTER},
+   {0x2F800, 542, EAIL_SB_OLETTER},
+   {0x30000, 4939, EAIL_SB_OLETTER},
+   {0xE0001, 1, EAIL_SB_FORMAT},
+   {0xE0020, 96, EAIL_SB_EXTEND},
+   {0xE0100, 240, EAIL_SB_EXTEND},
+};
+
@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2013 Samsung Electronics Co., Ltd.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/**
+ * @file eail_tree_format.h
+ *
+ * @brief Binary layouts of tree snapshot, journal deltas and mirror file
+ *
+ * Header depends on the C library only, so that mirror readers can be
+ * built without glib, see eail_mirror_reader.h.
+ */
+
+#ifndef EAIL_TREE_FORMAT_H
+#define EAIL_TREE_FORMAT_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief Magic number opening binary tree snapshot ("EATS") */
+#define EAIL_TREE_SNAPSHOT_MAGIC 0x53544145
+
+/** @brief Version of tree snapshot layout, both binary and JSON */
+#define EAIL_TREE_SNAPSHOT_VERSION 2
+
+/** @brief Interfaces implemented by accessible, as stored in snapshot */
+typedef enum
+{
+   EAIL_INTERFACE_COMPONENT = 1 << 0,/**< @brief AtkComponent */
+   EAIL_INTERFACE_ACTION = 1 << 1,/**< @brief AtkAction */
+   EAIL_INTERFACE_TEXT = 1 << 2,/**< @brief AtkText */
+   EAIL_INTERFACE_EDITABLE_TEXT = 1 << 3,/**< @brief AtkEditableText */
+   EAIL_INTERFACE_IMAGE = 1 << 4,/**< @brief AtkImage */
+   EAIL_INTERFACE_SELECTION = 1 << 5,/**< @brief AtkSelection */
+   EAIL_INTERFACE_TABLE = 1 << 6,/**< @brief AtkTable */
+   EAIL_INTERFACE_VALUE = 1 << 7,/**< @brief AtkValue */
+   EAIL_INTERFACE_WINDOW = 1 << 8,/**< @brief AtkWindow */
+   EAIL_INTERFACE_STREAMABLE_CONTENT = 1 << 9/**< @brief AtkStreamableContent */
+} EailInterfaceFlags;
+
+/**
+ * @brief Header of binary tree snapshot, followed by n_nodes node records,
+ * all in host byte order
+ */
+typedef struct _EailTreeSnapshotHeader
+{
+   uint32_t magic;/**< @brief EAIL_TREE_SNAPSHOT_MAGIC */
+   uint32_t version;/**< @brief EAIL_TREE_SNAPSHOT_VERSION */
+   uint32_t node_size;/**< @brief sizeof(EailTreeSnapshotNode) */
+   uint32_t n_nodes;/**< @brief number of node records following header */
+   uint64_t sequence;/**< @brief journal sequence the snapshot is taken at */
+} EailTreeSnapshotHeader;
+
+/**
+ * @brief Node record of binary tree snapshot
+ *
+ * Record is followed by name_length bytes of UTF-8 name (not terminated),
+ * padded with zeros to a multiple of 8 bytes. Records are stored in
+ * document order (parent before its children), root first.
+ */
+typedef struct _EailTreeSnapshotNode
+{
+   uint64_t id;/**< @brief address of AtkObject, unique while object is alive */
+   uint64_t states;/**< @brief mask of EAIL_STATE_BIT values */
+   int32_t parent;/**< @brief index of parent record, -1 for root */
+   int32_t index;/**< @brief index of node among children of its parent */
+   uint32_t role;/**< @brief AtkRole of accessible */
+   uint32_t interfaces;/**< @brief mask of EailInterfaceFlags */
+   int32_t x;/**< @brief x coordinate of accessible */
+   int32_t y;/**< @brief y coordinate of accessible */
+   int32_t width;/**< @brief width of accessible */
+   int32_t height;/**< @brief height of accessible */
+   uint32_t n_children;/**< @brief number of children of accessible */
+   uint32_t name_length;/**< @brief length of name in bytes */
+} EailTreeSnapshotNode;
+
+/** @brief Kinds of recorded changes */
+typedef enum
+{
+   EAIL_DELTA_CHILD_ADDED,/**< @brief child added, see index and child */
+   EAIL_DELTA_CHILD_REMOVED,/**< @brief child removed, see index and child */
+   EAIL_DELTA_PROPERTY,/**< @brief property changed, see detail */
+   EAIL_DELTA_STATE,/**< @brief state changed, see detail and value */
+   EAIL_DELTA_BOUNDS/**< @brief extents changed, see x, y, width, height */
+} EailDeltaType;
+
+/** @brief Properties reported by EAIL_DELTA_PROPERTY deltas */
+typedef enum
+{
+   EAIL_DELTA_PROPERTY_OTHER,/**< @brief property not listed below */
+   EAIL_DELTA_PROPERTY_NAME,/**< @brief "accessible-name" */
+   EAIL_DELTA_PROPERTY_DESCRIPTION,/**< @brief "accessible-description" */
+   EAIL_DELTA_PROPERTY_PARENT,/**< @brief "accessible-parent" */
+   EAIL_DELTA_PROPERTY_ROLE,/**< @brief "accessible-role" */
+   EAIL_DELTA_PROPERTY_VALUE/**< @brief "accessible-value" */
+} EailDeltaProperty;
+
+/** @brief Single recorded change of accessible tree, in host byte order */
+typedef struct _EailDelta
+{
+   uint64_t sequence;/**< @brief sequence number, first delta has 1 */
+   uint64_t id;/**< @brief address of changed AtkObject */
+   uint64_t child;/**< @brief address of added or removed child, 0 if unknown */
+   uint32_t type;/**< @brief EailDeltaType */
+   uint32_t detail;/**< @brief AtkStateType or EailDeltaProperty */
+   int32_t index;/**< @brief index of added or removed child */
+   int32_t value;/**< @brief new value of state */
+   int32_t x;/**< @brief new x coordinate */
+   int32_t y;/**< @brief new y coordinate */
+   int32_t width;/**< @brief new width */
+   int32_t height;/**< @brief new height */
+} EailDelta;
+
+/** @brief Magic number opening mirror file ("EAAM") */
+#define EAIL_MIRROR_MAGIC 0x4d414145
+
+/** @brief Version of mirror file layout */
+#define EAIL_MIRROR_VERSION 3
+
+/** @brief Flags of mirror state */
+typedef enum
+{
+   /** @brief last snapshot did not fit in snapshot buffer */
+   EAIL_MIRROR_OVERFLOW = 1 << 0
+} EailMirrorFlags;
+
+/**
+ * @brief Header of mirror file, in host byte order
+ *
+ * Fields below lock and slots of the delta ring change only while lock
+ * is odd; readers copy them and retry if lock changed meanwhile. Each
+ * snapshot buffer has its own generation counter, odd while the buffer is
+ * being written. New snapshots are written to the inactive buffer, so
+ * readers of the active one are not disturbed.
+ */
+typedef struct _EailMirrorHeader
+{
+   uint32_t magic;/**< @brief EAIL_MIRROR_MAGIC */
+   uint32_t version;/**< @brief EAIL_MIRROR_VERSION */
+   uint64_t size;/**< @brief size of whole mirror file */
+   uint64_t snapshot_offset[2];/**< @brief file offsets of snapshot buffers */
+   uint64_t snapshot_capacity;/**< @brief size of each snapshot buffer */
+   uint64_t journal_offset;/**< @brief file offset of delta ring */
+   uint32_t journal_capacity;/**< @brief number of deltas in ring */
+   int32_t lock;/**< @brief seqlock of the fields below */
+   uint64_t snapshot_length[2];/**< @brief length of snapshots, 0 if none */
+   uint64_t journal_head;/**< @brief sequence of last delta in ring */
+   int32_t active;/**< @brief index of current snapshot buffer */
+   uint32_t flags;/**< @brief mask of EailMirrorFlags */
+   int32_t generation[2];/**< @brief seqlocks of snapshot buffers */
+   int32_t pid;/**< @brief id of publishing process */
+} EailMirrorHeader;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,476 @@
+/*
+ * Copyright (c) 2013 Samsung Electronics Co., Ltd.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/**
+ * @file eail_tree_snapshot.c
+ * @brief Implementation of one-pass accessible tree snapshot
+ *
+ * The tree is walked once from the root returned by atk_get_root(). Nodes
+ * are written straight into the buffer given by the caller and the writer
+ * keeps its state on the stack, so the output itself needs no memory.
+ * Reading accessibles still allocates per node: their state set is taken
+ * with atk_object_ref_state_set, as subclasses add states of their own,
+ * and children of widgets come from the Eina_List returned by
+ * eail_widget_get_widget_children. Accessibles are read with the tree walk
+ * helpers shared with the other tree consumers, see
+ * eail_tree_walk_children.
+ */
+
+#include <string.h>
+
+#include <Elementary.h>
+
+#include "eail_tree_snapshot.h"
+#include "eail_journal.h"
+#include "eail_utils.h"
+#include "eail_widget.h"
+#include "eail_item.h"
+#include "eail_priv.h"
+
+/** @brief Size of stack buffer used for formatted JSON values */
+#define EAIL_TREE_SNAPSHOT_NUMBER_SIZE 128
+
+/** @brief Padding of names in binary snapshot */
+#define EAIL_TREE_SNAPSHOT_ALIGN 8
+
+/** @brief Interface flags together with their GType and JSON name */
+static const struct
+{
+   EailInterfaceFlags flag;/**< @brief interface flag */
+   GType (*get_type)(void);/**< @brief getter of interface GType */
+   const gchar *name;/**< @brief name used in JSON snapshot */
+} eail_tree_snapshot_interfaces[] =
+{
+   { EAIL_INTERFACE_COMPONENT, atk_component_get_type, "component" },
+   { EAIL_INTERFACE_ACTION, atk_action_get_type, "action" },
+   { EAIL_INTERFACE_TEXT, atk_text_get_type, "text" },
+   { EAIL_INTERFACE_EDITABLE_TEXT, atk_editable_text_get_type,
+     "editable-text" },
+   { EAIL_INTERFACE_IMAGE, atk_image_get_type, "image" },
+   { EAIL_INTERFACE_SELECTION, atk_selection_get_type, "selection" },
+   { EAIL_INTERFACE_TABLE, atk_table_get_type, "table" },
+   { EAIL_INTERFACE_VALUE, atk_value_get_type, "value" },
+   { EAIL_INTERFACE_WINDOW, atk_window_get_type, "window" },
+   { EAIL_INTERFACE_STREAMABLE_CONTENT, atk_streamable_content_get_type,
+     "streamable-content" }
+};
+
+/** @brief State of single snapshot walk */
+typedef struct _EailTreeSnapshot
+{
+   EailTreeWalk walk;/**< @brief shared walk state */
+   EailTreeSnapshotFormat format;/**< @brief output format */
+   guint8 *buffer;/**< @brief output buffer given by caller */
+   gsize size;/**< @brief size of output buffer */
+   gsize length;/**< @brief bytes produced so far, including those not fitting */
+   guint32 n_nodes;/**< @brief number of nodes written so far */
+   gint32 parent;/**< @brief index of record of currently walked parent */
+} EailTreeSnapshot;
+
+/**
+ * @brief Appends bytes to snapshot
+ *
+ * Once output does not fit in the buffer nothing more is written, only the
+ * required length is counted.
+ *
+ * @param snap EailTreeSnapshot instance
+ * @param data bytes to append
+ * @param len number of bytes
+ */
+static void
+_eail_tree_snapshot_put(EailTreeSnapshot *snap, const void *data, gsize len)
+{
+   /* after the first overflow length stays above size */
+   if (snap->length <= snap->size && len <= snap->size - snap->length)
+     memcpy(snap->buffer + snap->length, data, len);
+
+   snap->length += len;
+}
+
+/**
+ * @brief Appends string to JSON snapshot
+ *
+ * @param snap EailTreeSnapshot instance
+ * @param str string to append
+ */
+static void
+_eail_tree_snapshot_puts(EailTreeSnapshot *snap, const gchar *str)
+{
+   _eail_tree_snapshot_put(snap, str, strlen(str));
+}
+
+/**
+ * @brief Appends formatted text to JSON snapshot
+ *
+ * @param snap EailTreeSnapshot instance
+ * @param format printf-like format, result must fit in
+ * EAIL_TREE_SNAPSHOT_NUMBER_SIZE bytes
+ */
+static void
+_eail_tree_snapshot_printf(EailTreeSnapshot *snap, const gchar *format, ...)
+{
+   gchar buf[EAIL_TREE_SNAPSHOT_NUMBER_SIZE];
+   va_list args;
+   gint len;
+
+   va_start(args, format);
+   len = g_vsnprintf(buf, sizeof(buf), format, args);
+   va_end(args);
+
+   _eail_tree_snapshot_put(snap, buf, MIN(len, (gint)sizeof(buf) - 1));
+}
+
+/**
+ * @brief Appends quoted and escaped JSON string
+ *
+ * @param snap EailTreeSnapshot instance
+ * @param str UTF-8 string, NULL is written as null
+ */
+static void
+_eail_tree_snapshot_put_string(EailTreeSnapshot *snap, const gchar *str)
+{
+   const gchar *p, *run;
+
+   if (!str)
+     {
+        _eail_tree_snapshot_puts(snap, "null");
+        return;
+     }
+
+   _eail_tree_snapshot_puts(snap, "\"");
+
+   for (p = run = str; *p; ++p)
+     {
+        guchar c = *p;
+
+        if (c != '"' && c != '\\' && c >= 0x20) continue;
+
+        _eail_tree_snapshot_put(snap, run, p - run);
+        if (c == '"' || c == '\\')
+          _eail_tree_snapshot_printf(snap, "\\%c", c);
+        else
+          _eail_tree_snapshot_printf(snap, "\\u%04x", c);
+        run = p + 1;
+     }
+
+   _eail_tree_snapshot_put(snap, run, p - run);
+   _eail_tree_snapshot_puts(snap, "\"");
+}
+
+/**
+ * @brief Gets mask of interfaces implemented by accessible
+ *
+ * @param obj AtkObject instance
+ *
+ * @returns mask of EailInterfaceFlags
+ */
+static guint32
+_eail_tree_snapshot_get_interfaces(AtkObject *obj)
+{
+   guint32 interfaces = 0;
+   guint i;
+
+   for (i = 0; i < G_N_ELEMENTS(eail_tree_snapshot_interfaces); ++i)
+     {
+        if (G_TYPE_CHECK_INSTANCE_TYPE
+            (obj, eail_tree_snapshot_interfaces[i].get_type()))
+          interfaces |= eail_tree_snapshot_interfaces[i].flag;
+     }
+
+   return interfaces;
+}
+
+/**
+ * @brief Fills node record with properties of accessible
+ *
+ * @param snap EailTreeSnapshot instance
+ * @param obj AtkObject instance
+ * @param node EailTreeSnapshotNode to fill
+ */
+static void
+_eail_tree_snapshot_fill(EailTreeSnapshot *snap,
+                         AtkObject *obj,
+                         EailTreeSnapshotNode *node)
+{
+   EailObjectRecord record;
+
+   eail_tree_walk_fill(&snap->walk, obj, &record);
+
+   node->id = (guint64)(gsize)obj;
+   node->role = record.role;
+   node->states = record.states;
+   node->interfaces = _eail_tree_snapshot_get_interfaces(obj);
+   node->x = record.x;
+   node->y = record.y;
+   node->width = record.width;
+   node->height = record.height;
+}
+
+/**
+ * @brief Writes JSON object of node, leaving its children array open
+ *
+ * @param snap EailTreeSnapshot instance
+ * @param obj AtkObject instance
+ * @param node filled node record
+ * @param name name of accessible
+ */
+static void
+_eail_tree_snapshot_json_open(EailTreeSnapshot *snap,
+                              AtkObject *obj,
+                              const EailTreeSnapshotNode *node,
+                              const gchar *name)
+{
+   EailAttributes *attrs = NULL;
+   gboolean first = TRUE;
+   guint i;
+
+   if (node->index > 0)
+     _eail_tree_snapshot_puts(snap, ",");
+
+   _eail_tree_snapshot_printf(snap, "{\"id\":%" G_GUINT64_FORMAT
+                              ",\"index\":%d,\"role\":", node->id,
+                              node->index);
+   _eail_tree_snapshot_put_string(snap, atk_role_get_name(node->role));
+   _eail_tree_snapshot_puts(snap, ",\"name\":");
+   _eail_tree_snapshot_put_string(snap, name);
+   _eail_tree_snapshot_printf(snap, ",\"states\":%" G_GUINT64_FORMAT
+                              ",\"extents\":[%d,%d,%d,%d]", node->states,
+                              node->x, node->y, node->width, node->height);
+
+   _eail_tree_snapshot_puts(snap, ",\"interfaces\":[");
+   for (i = 0; i < G_N_ELEMENTS(eail_tree_snapshot_interfaces); ++i)
+     {
+        if (!(node->interfaces & eail_tree_snapshot_interfaces[i].flag))
+          continue;
+
+        if (!first) _eail_tree_snapshot_puts(snap, ",");
+        _eail_tree_snapshot_put_string(snap,
+                                       eail_tree_snapshot_interfaces[i].name);
+        first = FALSE;
+     }
+
+   /* shared sets are read in place, atk_object_get_attributes would copy */
+   if (EAIL_IS_WIDGET(obj))
+     attrs = eail_widget_ref_attributes(EAIL_WIDGET(obj));
+   else if (EAIL_IS_ITEM(obj))
+     attrs = eail_item_ref_attributes(EAIL_ITEM(obj));
+
+   _eail_tree_snapshot_puts(snap, "],\"attributes\":{");
+   for (i = 0; i < eail_attributes_get_n_pairs(attrs); ++i)
+     {
+        if (i > 0) _eail_tree_snapshot_puts(snap, ",");
+        _eail_tree_snapshot_put_string(snap,
+                                       eail_attributes_get_name(attrs, i));
+        _eail_tree_snapshot_puts(snap, ":");
+        _eail_tree_snapshot_put_string(snap,
+                                       eail_attributes_get_value(attrs, i));
+     }
+   eail_attributes_unref(attrs);
+
+   _eail_tree_snapshot_puts(snap, "},\"children\":[");
+}
+
+/**
+ * @brief Writes binary node record followed by padded name
+ *
+ * @param snap EailTreeSnapshot instance
+ * @param node filled node record
+ * @param name name of accessible
+ */
+static void
+_eail_tree_snapshot_binary_put(EailTreeSnapshot *snap,
+                               EailTreeSnapshotNode *node,
+                               const gchar *name)
+{
+   static const guint8 padding[EAIL_TREE_SNAPSHOT_ALIGN] = { 0 };
+   gsize len = name ? strlen(name) : 0;
+
+   node->name_length = len;
+
+   _eail_tree_snapshot_put(snap, node, sizeof(*node));
+   _eail_tree_snapshot_put(snap, name, len);
+   _eail_tree_snapshot_put(snap, padding,
+                           (EAIL_TREE_SNAPSHOT_ALIGN -
+                            len % EAIL_TREE_SNAPSHOT_ALIGN) %
+                           EAIL_TREE_SNAPSHOT_ALIGN);
+}
+
+static guint32 _eail_tree_snapshot_node(EailTreeSnapshot *snap,
+                                        AtkObject *obj,
+                                        gint32 parent,
+                                        gint32 index);
+
+/**
+ * @brief Writes node of child accessible and its subtree
+ *
+ * @param child AtkObject instance
+ * @param index index of child among children of its parent
+ * @param user_data EailTreeSnapshot instance
+ */
+static void
+_eail_tree_snapshot_child(AtkObject *child, gint index, gpointer user_data)
+{
+   EailTreeSnapshot *snap = user_data;
+
+   _eail_tree_snapshot_node(snap, child, snap->parent, index);
+}
+
+/**
+ * @brief Walks children of accessible
+ *
+ * @param snap EailTreeSnapshot instance
+ * @param obj AtkObject instance
+ * @param parent index of obj record
+ *
+ * @returns number of written children
+ */
+static guint32
+_eail_tree_snapshot_children(EailTreeSnapshot *snap,
+                             AtkObject *obj,
+                             gint32 parent)
+{
+   gint32 saved_parent = snap->parent;
+   guint32 n_children;
+
+   snap->parent = parent;
+   n_children = eail_tree_walk_children(&snap->walk, obj,
+                                        _eail_tree_snapshot_child, snap);
+   snap->parent = saved_parent;
+
+   return n_children;
+}
+
+/**
+ * @brief Writes node of accessible and its whole subtree
+ *
+ * In binary format the number of children is patched into the record once
+ * the children are written.
+ *
+ * @param snap EailTreeSnapshot instance
+ * @param obj AtkObject instance
+ * @param parent index of parent record, -1 for root
+ * @param index index of obj among children of its parent
+ *
+ * @returns index of obj record
+ */
+static guint32
+_eail_tree_snapshot_node(EailTreeSnapshot *snap,
+                         AtkObject *obj,
+                         gint32 parent,
+                         gint32 index)
+{
+   EailTreeSnapshotNode node;
+   const gchar *name;
+   gsize offset = snap->length;
+   guint32 node_index = snap->n_nodes++;
+
+   memset(&node, 0, sizeof(node));
+   node.parent = parent;
+   node.index = index;
+   _eail_tree_snapshot_fill(snap, obj, &node);
+   name = atk_object_get_name(obj);
+
+   if (snap->format == EAIL_TREE_SNAPSHOT_JSON)
+     {
+        _eail_tree_snapshot_json_open(snap, obj, &node, name);
+        _eail_tree_snapshot_children(snap, obj, node_index);
+        _eail_tree_snapshot_puts(snap, "]}");
+
+        return node_index;
+     }
+
+   _eail_tree_snapshot_binary_put(snap, &node, name);
+   node.n_children = _eail_tree_snapshot_children(snap, obj, node_index);
+
+   if (snap->length <= snap->size)
+     memcpy(snap->buffer + offset + G_STRUCT_OFFSET(EailTreeSnapshotNode,
+                                                    n_children),
+            &node.n_children, sizeof(node.n_children));
+
+   return node_index;
+}
+
+/**
+ * Binary snapshot starts with EailTreeSnapshotHeader followed by
+ * EailTreeSnapshotNode records. JSON snapshot is a single object with
+ * "version", "sequence" and nested "root" node, it is not NUL-terminated.
+ * Snapshot can be kept up to date by applying journal deltas recorded after
+ * its sequence, see eail_journal_read.
+ *
+ * Returned size is computed even if the buffer is too small; in that case
+ * buffer content is incomplete and the call has to be repeated with a
+ * buffer of at least returned size. Passing NULL buffer with zero size only
+ * measures the snapshot.
+ *
+ * @param format output format
+ * @param coord_type specifies whether extents are relative to the screen or
+ * to the window
+ * @param buffer output buffer
+ * @param size size of output buffer in bytes
+ *
+ * @returns number of bytes the snapshot takes
+ */
+gsize
+eail_tree_snapshot(EailTreeSnapshotFormat format,
+                   AtkCoordType coord_type,
+                   guint8 *buffer,
+                   gsize size)
+{
+   EailTreeSnapshot snap;
+   EailTreeSnapshotHeader header;
+   AtkObject *root;
+
+   g_return_val_if_fail(buffer || !size, 0);
+
+   root = atk_get_root();
+   g_return_val_if_fail(root, 0);
+
+   memset(&snap, 0, sizeof(snap));
+   eail_tree_walk_init(&snap.walk, coord_type);
+   snap.format = format;
+   snap.buffer = buffer;
+   snap.size = size;
+
+   if (format == EAIL_TREE_SNAPSHOT_JSON)
+     {
+        _eail_tree_snapshot_printf(&snap, "{\"version\":%d,\"sequence\":%"
+                                   G_GUINT64_FORMAT ",\"root\":",
+                                   EAIL_TREE_SNAPSHOT_VERSION,
+                                   eail_journal_sequence_get());
+        _eail_tree_snapshot_node(&snap, root, -1, 0);
+        _eail_tree_snapshot_puts(&snap, "}");
+     }
+   else
+     {
+        header.magic = EAIL_TREE_SNAPSHOT_MAGIC;
+        header.version = EAIL_TREE_SNAPSHOT_VERSION;
+        header.node_size = sizeof(EailTreeSnapshotNode);
+        header.n_nodes = 0;
+        header.sequence = eail_journal_sequence_get();
+
+        _eail_tree_snapshot_put(&snap, &header, sizeof(header));
+        _eail_tree_snapshot_node(&snap, root, -1, 0);
+
+        header.n_nodes = snap.n_nodes;
+        if (snap.length <= snap.size)
+          memcpy(buffer, &header, sizeof(header));
+     }
+
+   return snap.length;
+}
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2013 Samsung Electronics Co., Ltd.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; see the file COPYING.LIB.  If not, write to
+ * the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+ */
+
+/**
+ * @file eail_tree_snapshot.h
+ *
+ * @brief Header for one-pass snapshot of the whole accessible tree
+ */
+
+#ifndef EAIL_TREE_SNAPSHOT_H
+#define EAIL_TREE_SNAPSHOT_H
+
+#include <atk/atk.h>
+
+#include "eail_tree_format.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief Output formats of tree snapshot */
+typedef enum
+{
+   EAIL_TREE_SNAPSHOT_BINARY,/**< @brief header followed by node records */
+   EAIL_TREE_SNAPSHOT_JSON/**< @brief nested JSON document */
+} EailTreeSnapshotFormat;
+
+/**
+ * @brief Walks the whole accessible tree once and writes its snapshot to
+ * caller-provided buffer
+ */
+gsize eail_tree_snapshot(EailTreeSnapshotFormat format,
+                         AtkCoordType coord_type,
+                         guint8 *buffer,
+                         gsize size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
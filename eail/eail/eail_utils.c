@@ -36,8 +36,14 @@
 #include <elm_widget.h>
 
 #include "eail_utils.h"
+#include "eail_text_lines.h"
+#include "eail_text_segment.h"
 #include "eail_factory.h"
+#include "eail_window.h"
 #include "eail_dynamic_content.h"
+#include "eail_action_widget.h"
+#include "eail_item.h"
+#include "eail_input_script.h"
 #include "eail_priv.h"
 
 /**
@@ -75,6 +81,309 @@ eail_get_substring(const gchar *string,
    return g_utf8_strncpy(substring, &string[start_offset], sub_len);
 }
 
+/**
+ * Walks the clipper chain of the object, see eail_evas_obj_showing_get.
+ * Accessibles keeping the mask call it when one of the states may change,
+ * not on every query.
+ *
+ * @param widget Evas_Object instance
+ *
+ * @returns mask of EAIL_TRACKED_STATES bits
+ */
+guint64
+eail_evas_obj_tracked_states_get(Evas_Object *widget)
+{
+   guint64 states;
+
+   if (!widget) return 0;
+
+   states = eail_evas_obj_flag_states_get(widget) & EAIL_TRACKED_STATES;
+
+   if (!evas_object_visible_get(widget)) return states;
+
+   states |= EAIL_STATE_BIT(ATK_STATE_VISIBLE);
+   if (eail_evas_obj_showing_get(widget))
+     states |= EAIL_STATE_BIT(ATK_STATE_SHOWING);
+
+   return states;
+}
+
+/**
+ * Object is showing if its geometry intersects the output viewport and all
+ * clippers it is clipped by, so content scrolled out of a scroller is not
+ * showing. Neither the viewport nor clippers of ancestors notify the object
+ * when they change, so callers keeping the result watch the clipper chain
+ * returned by eail_evas_obj_clippers_get. It reads geometry of the clipper
+ * chain only.
+ *
+ * @param widget visible Evas_Object instance
+ *
+ * @returns TRUE if object is showing, FALSE otherwise
+ */
+gboolean
+eail_evas_obj_showing_get(Evas_Object *widget)
+{
+   int x1, y1, x2, y2;
+   int x, y, width, height;
+   Evas_Object *clip;
+
+   if (!widget) return FALSE;
+
+   evas_output_viewport_get(evas_object_evas_get(widget),
+                            &x1, &y1, &width, &height);
+   x2 = x1 + width;
+   y2 = y1 + height;
+
+   for (clip = widget; clip; clip = evas_object_clip_get(clip))
+     {
+        evas_object_geometry_get(clip, &x, &y, &width, &height);
+
+        x1 = MAX(x1, x);
+        y1 = MAX(y1, y);
+        x2 = MIN(x2, x + width);
+        y2 = MIN(y2, y + height);
+
+        if (x2 < x1 || y2 < y1) return FALSE;
+     }
+
+   return TRUE;
+}
+
+/**
+ * Lists clippers of the object and the top widget, whose resize follows
+ * changes of the output viewport. Use eina_list_free() to free the list.
+ *
+ * @param widget Evas_Object instance
+ *
+ * @returns Eina_List of objects whose geometry changes may change showing
+ * state of widget
+ */
+Eina_List *
+eail_evas_obj_clippers_get(Evas_Object *widget)
+{
+   Eina_List *clippers = NULL;
+   Evas_Object *clip, *top;
+
+   if (!widget) return NULL;
+
+   for (clip = evas_object_clip_get(widget); clip;
+        clip = evas_object_clip_get(clip))
+     clippers = eina_list_append(clippers, clip);
+
+   top = elm_object_top_widget_get(widget);
+   if (top && top != widget && !eina_list_data_find(clippers, top))
+     clippers = eina_list_append(clippers, top);
+
+   return clippers;
+}
+
+/**
+ * Disabled and focus flags are stored in widget data by elementary, so
+ * reading them is cheap and they are not cached.
+ *
+ * @param widget Evas_Object instance
+ *
+ * @returns mask of ATK_STATE_SENSITIVE, ATK_STATE_ENABLED,
+ * ATK_STATE_FOCUSABLE and ATK_STATE_FOCUSED bits
+ */
+guint64
+eail_evas_obj_flag_states_get(Evas_Object *widget)
+{
+   guint64 states = 0;
+
+   if (!widget) return 0;
+
+   if (!elm_object_disabled_get(widget))
+     states |= EAIL_STATE_BIT(ATK_STATE_SENSITIVE) |
+        EAIL_STATE_BIT(ATK_STATE_ENABLED);
+
+   if (elm_object_focus_allow_get(widget))
+     {
+        states |= EAIL_STATE_BIT(ATK_STATE_FOCUSABLE);
+
+        if (elm_object_focus_get(widget))
+          states |= EAIL_STATE_BIT(ATK_STATE_FOCUSED);
+     }
+
+   return states;
+}
+
+/**
+ * @param state_set AtkStateSet to add states to
+ * @param states mask of EAIL_STATE_BIT values
+ */
+void
+eail_state_set_add_states(AtkStateSet *state_set, guint64 states)
+{
+   AtkStateType state;
+
+   for (state = 0; states; ++state, states >>= 1)
+     {
+        if (states & 1)
+          atk_state_set_add_state(state_set, state);
+     }
+}
+
+/**
+ * @param state_set AtkStateSet to read states from
+ *
+ * @returns mask of EAIL_STATE_BIT values of states in state_set
+ */
+guint64
+eail_state_set_get_states(AtkStateSet *state_set)
+{
+   AtkStateType state;
+   guint64 states = 0;
+
+   if (!state_set) return 0;
+
+   for (state = ATK_STATE_INVALID + 1;
+        state < ATK_STATE_LAST_DEFINED && state < 64; ++state)
+     {
+        if (atk_state_set_contains_state(state_set, state))
+          states |= EAIL_STATE_BIT(state);
+     }
+
+   return states;
+}
+
+/**
+ * @param walk EailTreeWalk to initialize
+ * @param coord_type specifies whether extents are relative to the screen or
+ * to the window
+ */
+void
+eail_tree_walk_init(EailTreeWalk *walk, AtkCoordType coord_type)
+{
+   AtkObjectClass *widget_class;
+
+   memset(walk, 0, sizeof(*walk));
+   walk->coord_type = coord_type;
+
+   /* class stays alive as long as widgets exist */
+   widget_class = g_type_class_ref(EAIL_TYPE_WIDGET);
+   walk->widget_ref_child = widget_class->ref_child;
+   g_type_class_unref(widget_class);
+}
+
+/**
+ * Widgets are measured directly on canvas, other accessibles go through
+ * AtkComponent. Screen origin is read once per canvas and walk. States
+ * come from atk_object_ref_state_set, which allocates a state set.
+ *
+ * @param walk EailTreeWalk instance
+ * @param obj AtkObject instance
+ * @param record EailObjectRecord to fill
+ */
+void
+eail_tree_walk_fill(EailTreeWalk *walk,
+                    AtkObject *obj,
+                    EailObjectRecord *record)
+{
+   Evas_Object *widget = NULL;
+   AtkStateSet *state_set;
+   gint x = G_MININT, y = G_MININT, w = -1, h = -1;
+
+   record->role = atk_object_get_role(obj);
+
+   state_set = atk_object_ref_state_set(obj);
+   record->states = eail_state_set_get_states(state_set);
+   if (state_set) g_object_unref(state_set);
+
+   if (EAIL_IS_WIDGET(obj))
+     widget = eail_widget_get_widget(EAIL_WIDGET(obj));
+
+   if (widget)
+     {
+        Evas_Coord ex, ey, ew, eh;
+
+        evas_object_geometry_get(widget, &ex, &ey, &ew, &eh);
+        x = ex;
+        y = ey;
+        w = ew;
+        h = eh;
+
+        if (walk->coord_type == ATK_XY_SCREEN)
+          {
+             const Evas *canvas = evas_object_evas_get(widget);
+
+             if (canvas != walk->canvas)
+               {
+                  eail_window_screen_origin_get(widget, &walk->origin_x,
+                                                &walk->origin_y);
+                  walk->canvas = canvas;
+               }
+
+             x += walk->origin_x;
+             y += walk->origin_y;
+          }
+     }
+   else if (ATK_IS_COMPONENT(obj))
+     atk_component_get_extents(ATK_COMPONENT(obj), &x, &y, &w, &h,
+                               walk->coord_type);
+
+   record->x = x;
+   record->y = y;
+   record->width = w;
+   record->height = h;
+}
+
+/**
+ * Children of accessibles using default EailWidget child list are taken
+ * from a single widget children list instead of per-index lookups.
+ *
+ * @param walk EailTreeWalk instance
+ * @param obj AtkObject instance
+ * @param func callback receiving children
+ * @param user_data data passed to func
+ *
+ * @returns number of walked children
+ */
+gint
+eail_tree_walk_children(EailTreeWalk *walk,
+                        AtkObject *obj,
+                        EailTreeWalkFunc func,
+                        gpointer user_data)
+{
+   gint n_children = 0;
+   gint i, n;
+
+   if (EAIL_IS_WIDGET(obj) &&
+       ATK_OBJECT_GET_CLASS(obj)->ref_child == walk->widget_ref_child)
+     {
+        Eina_List *children;
+        Evas_Object *child;
+
+        children = eail_widget_get_widget_children(EAIL_WIDGET(obj));
+        EINA_LIST_FREE(children, child)
+          {
+             AtkObject *child_obj = eail_factory_get_accessible(child);
+
+             if (!child_obj) continue;
+
+             /* callback may drop the last reference held by the factory */
+             g_object_ref(child_obj);
+             func(child_obj, n_children++, user_data);
+             g_object_unref(child_obj);
+          }
+
+        return n_children;
+     }
+
+   n = atk_object_get_n_accessible_children(obj);
+   for (i = 0; i < n; ++i)
+     {
+        AtkObject *child = atk_object_ref_accessible_child(obj, i);
+
+        if (!child) continue;
+
+        func(child, n_children++, user_data);
+        g_object_unref(child);
+     }
+
+   return n_children;
+}
+
 /**
  * @param widget Evas_Object instance for getting state set
  * @param state_set current state set taken from object's parent
@@ -84,39 +393,17 @@ eail_get_substring(const gchar *string,
 AtkStateSet *
 eail_evas_obj_ref_state_set(Evas_Object *widget, AtkStateSet *state_set)
 {
+   guint64 states;
+
    if (!widget) {
        atk_state_set_add_state(state_set, ATK_STATE_DEFUNCT);
        return state_set;
    }
 
-   if (!elm_object_disabled_get(widget)) {
-       atk_state_set_add_state(state_set, ATK_STATE_SENSITIVE);
-       atk_state_set_add_state(state_set, ATK_STATE_ENABLED);
-   }
-
-   if (evas_object_visible_get(widget)) {
-       int x, y, width, height;
-       int vp_x, vp_y, vp_width, vp_height;
-
-       atk_state_set_add_state(state_set, ATK_STATE_VISIBLE);
-
-       evas_object_geometry_get(widget, &x, &y, &width, &height);
-       evas_output_viewport_get(evas_object_evas_get(widget),
-                                &vp_x, &vp_y, &vp_width, &vp_height);
-
-       if ((x + width) >= vp_x && (y + height) >= vp_y &&
-           (vp_x + vp_width) >= x && (vp_y + vp_height) >= y) {
-           atk_state_set_add_state(state_set, ATK_STATE_SHOWING);
-       }
-   }
-
-   if (elm_object_focus_allow_get(widget)) {
-       atk_state_set_add_state(state_set, ATK_STATE_FOCUSABLE);
+   states = eail_evas_obj_tracked_states_get(widget) |
+      eail_evas_obj_flag_states_get(widget);
 
-       if (elm_object_focus_get(widget)) {
-           atk_state_set_add_state(state_set, ATK_STATE_FOCUSED);
-       }
-   }
+   eail_state_set_add_states(state_set, states);
 
    return state_set;
 }
@@ -141,6 +428,40 @@ eail_evas_obj_grab_focus(Evas_Object *widget)
 }
 
 /**
+ * @brief Feeds pointer move to given coordinates followed by button events
+ * as a single input script batch
+ *
+ * @param widget Evas_Object instance whose canvas receives the events
+ * @param x x coordinate
+ * @param y y coordinate
+ * @param press whether to press left mouse button
+ * @param release whether to release left mouse button
+ */
+static void
+_eail_mouse_feed(Evas_Object *widget,
+                 int x,
+                 int y,
+                 gboolean press,
+                 gboolean release)
+{
+   EailInputScript *script = eail_input_script_new(widget);
+
+   if (!script) return;
+
+   eail_input_script_move(script, 0, x, y);
+   if (press)
+     eail_input_script_press(script, 0, 1);
+   if (release)
+     eail_input_script_release(script, 0, 1);
+
+   /* events without delay are fed before returning */
+   eail_input_script_run(script);
+}
+
+/**
+ * Events are fed right away through an input script, see
+ * eail_input_script.h for scripts with delays.
+ *
  * @param widget Evas_Object instance to press on
  * @param x x coordinate
  * @param y y coordinate
@@ -148,11 +469,7 @@ eail_evas_obj_grab_focus(Evas_Object *widget)
 void
 eail_mouse_press_on_coords(Evas_Object *widget, int x, int y)
 {
-   Evas* evas = NULL;
-   evas =  evas_object_evas_get(widget);
-
-   evas_event_feed_mouse_move(evas, x, y, 0, NULL);
-   evas_event_feed_mouse_down(evas, 1, EVAS_BUTTON_NONE, 0, NULL);
+   _eail_mouse_feed(widget, x, y, TRUE, FALSE);
 }
 
 /**
@@ -163,11 +480,7 @@ eail_mouse_press_on_coords(Evas_Object *widget, int x, int y)
 void
 eail_mouse_release_on_coords(Evas_Object *widget, int x, int y)
 {
-   Evas* evas = NULL;
-   evas =  evas_object_evas_get(widget);
-
-   evas_event_feed_mouse_move(evas, x, y, 0, NULL);
-   evas_event_feed_mouse_up(evas, 1, EVAS_BUTTON_NONE, 0, NULL);
+   _eail_mouse_feed(widget, x, y, FALSE, TRUE);
 }
 
 /**
@@ -178,12 +491,7 @@ eail_mouse_release_on_coords(Evas_Object *widget, int x, int y)
 void
 eail_mouse_click_on_coords(Evas_Object *widget, int x, int y)
 {
-   Evas* evas = NULL;
-   evas =  evas_object_evas_get(widget);
-
-   evas_event_feed_mouse_move(evas, x, y, 0, NULL);
-   evas_event_feed_mouse_down(evas, 1, EVAS_BUTTON_NONE, 0, NULL);
-   evas_event_feed_mouse_up(evas, 1, EVAS_BUTTON_NONE, 0, NULL);
+   _eail_mouse_feed(widget, x, y, TRUE, TRUE);
 }
 
 /**
@@ -289,20 +597,16 @@ eail_get_edje_parts_for_item(Elm_Object_Item *item)
 {
    Eina_List *edje_parts = NULL;
    Eina_List *usable_parts = NULL;
-   int i = 0;
+   Evas_Object *obj;
 
    edje_parts = eail_get_raw_evas_obj_list_from_item(item);
-   for (i = 0; i < eina_list_count(edje_parts); ++i)
+   EINA_LIST_FREE(edje_parts, obj)
      {
-        Evas_Object *obj = eina_list_nth(edje_parts, i);
-
         /* adding only parts that can be used by eail_factory later */
         if (elm_object_widget_check(obj))
           usable_parts = eina_list_append(usable_parts, obj);
      }
 
-   eina_list_free(edje_parts);
-
    return usable_parts;
 }
 
@@ -390,6 +694,60 @@ eail_action_scroll_right(Evas_Object *widget,
    return eail_handle_scroll(widget, EAIL_SCROLL_TYPE_RIGHT);
 }
 
+/**
+ * Actions of EailActionWidget and EailItem objects are found through their
+ * name indexes, other AtkAction implementations are scanned by name.
+ *
+ * @param action AtkAction instance
+ * @param action_name name of the action
+ *
+ * @returns index of the action or -1 if there is no such action
+ */
+gint
+eail_action_get_index(AtkAction *action, const gchar *action_name)
+{
+   gint i, n;
+
+   g_return_val_if_fail(ATK_IS_ACTION(action), -1);
+   if (!action_name) return -1;
+
+   if (EAIL_IS_ACTION_WIDGET(action))
+     return eail_action_widget_action_index_get(EAIL_ACTION_WIDGET(action),
+                                                action_name);
+
+   if (EAIL_IS_ITEM(action))
+     return eail_item_action_index_get(EAIL_ITEM(action), action_name);
+
+   n = atk_action_get_n_actions(action);
+   for (i = 0; i < n; ++i)
+     {
+        if (!g_strcmp0(atk_action_get_name(action, i), action_name))
+          return i;
+     }
+
+   return -1;
+}
+
+/**
+ * @param action AtkAction instance
+ * @param action_name name of the action
+ *
+ * @returns TRUE if action was found and launched successfully, FALSE otherwise
+ */
+gboolean
+eail_action_do_by_name(AtkAction *action, const gchar *action_name)
+{
+   gint i = eail_action_get_index(action, action_name);
+
+   if (i < 0)
+     {
+        DBG("Action name not found: %s", action_name);
+        return FALSE;
+     }
+
+   return atk_action_do_action(action, i);
+}
+
 /**
  * @param atk_obj AtkObject instance that emits the signal
  * @param signal_name name of signal
@@ -549,7 +907,7 @@ eail_list_item_handle_unselected_event(void *data,
 static gboolean
 _notifiy_content_holders_by_type(gpointer data)
 {
-   Eina_List *objs = NULL, *l = NULL;
+   Eina_List *objs = NULL;
    AtkObject *atk_obj = NULL;
    AtkRole role = ATK_ROLE_INVALID;
 
@@ -566,15 +924,15 @@ _notifiy_content_holders_by_type(gpointer data)
    else
      {
         objs = eail_factory_find_objects_with_role(role);
-        EINA_LIST_FOREACH(objs, l, atk_obj)
+        EINA_LIST_FREE(objs, atk_obj)
           {
             if (EAIL_IS_DYNAMIC_CONTENT(atk_obj))
               {
                    eail_dynamic_content_update_hierarchy
                                                (EAIL_DYNAMIC_CONTENT(atk_obj));
               }
+            g_object_unref(atk_obj);
           }
-        eina_list_free(objs);
      }
 
    return FALSE;
@@ -647,29 +1005,26 @@ _eail_move_chars(const Evas_Object *textblock,
 }
 
 /**
- * @brief Gets the utf8 character at offset
+ * @brief Checks whether position at offset in textblock has given segment
+ * flag
  *
  * @param textblock Evas textblock
  * @param offset character offset
- * @returns char representing the utf8 character
+ * @param flag one of EAIL_TEXT_SEGMENT_FLAGS
+ * @returns TRUE if flag is set, FALSE otherwise
  */
-static gunichar
-_eail_get_unichar_at_offset(const Evas_Object *textblock,
-                            int offset)
+static gboolean
+_eail_has_segment_flag(const Evas_Object *textblock,
+                       gint offset,
+                       guint8 flag)
 {
-   Evas_Textblock_Cursor *cur;
-   gchar *s;
-   gunichar c;
-
-   cur = evas_object_textblock_cursor_new(textblock);
-   evas_textblock_cursor_pos_set(cur, offset);
-   s = evas_textblock_cursor_content_get(cur);
-   c = g_utf8_get_char(s);
+   const guint8 *breaks;
+   gint len = 0;
 
-   evas_textblock_cursor_free(cur);
-   g_free(s);
+   breaks = eail_text_lines_get_breaks(textblock, &len);
+   if (!breaks || offset < 0 || offset > len) return FALSE;
 
-   return c;
+   return (breaks[offset] & flag) != 0;
 }
 
 /**
@@ -683,15 +1038,7 @@ static gboolean
 _eail_is_word_start(const Evas_Object *textblock,
                     gint offset)
 {
-   /* first character in a word */
-   Evas_Textblock_Cursor *cur = NULL;
-   cur = evas_object_textblock_cursor_new(textblock);
-   evas_textblock_cursor_pos_set(cur, offset);
-   evas_textblock_cursor_word_start(cur);
-   gint pos = evas_textblock_cursor_pos_get(cur);
-   evas_textblock_cursor_free(cur);
-
-   return pos == offset;
+   return _eail_has_segment_flag(textblock, offset, EAIL_TEXT_WORD_START);
 }
 
 /**
@@ -705,15 +1052,7 @@ static gboolean
 _eail_is_word_end(const Evas_Object *textblock,
                   gint offset)
 {
-   /* is first non-word char after a word */
-   Evas_Textblock_Cursor *cur = NULL;
-   cur = evas_object_textblock_cursor_new(textblock);
-   evas_textblock_cursor_pos_set(cur, offset - 2);
-   evas_textblock_cursor_word_end(cur);
-   gint pos = evas_textblock_cursor_pos_get(cur);
-   evas_textblock_cursor_free(cur);
-
-   return (pos + 1 == offset);
+   return _eail_has_segment_flag(textblock, offset, EAIL_TEXT_WORD_END);
 }
 
 /**
@@ -727,17 +1066,7 @@ static gboolean
 _eail_is_inside_word(const Evas_Object *textblock,
                      gint offset)
 {
-   Evas_Textblock_Cursor *cur = NULL;
-   cur = evas_object_textblock_cursor_new(textblock);
-   evas_textblock_cursor_pos_set(cur, offset);
-   evas_textblock_cursor_word_start(cur);
-   gint pos_start = evas_textblock_cursor_pos_get(cur);
-   evas_textblock_cursor_char_prev(cur);
-   evas_textblock_cursor_word_end(cur);
-   gint pos_end = evas_textblock_cursor_pos_get(cur);
-   evas_textblock_cursor_free(cur);
-
-   return (pos_start <= offset && pos_end >= offset);
+   return _eail_has_segment_flag(textblock, offset, EAIL_TEXT_IN_WORD);
 }
 
 /**
@@ -749,16 +1078,7 @@ _eail_is_inside_word(const Evas_Object *textblock,
 static gint
 _eail_get_len(const Evas_Object *textblock)
 {
-   Evas_Textblock_Cursor *cur;
-   int ctr = 0;
-
-   cur = evas_object_textblock_cursor_new(textblock);
-   while (evas_textblock_cursor_char_next(cur))
-     ++ctr;
-
-   evas_textblock_cursor_free(cur);
-
-   return ctr;
+   return eail_text_lines_get_length(textblock);
 }
 
 /**
@@ -799,20 +1119,6 @@ _eail_move_words(const Evas_Object *textblock,
    return offset;
 }
 
-/**
- * @brief Checks whether the character is sentence break
- *
- * @param c character
- * @returns TRUE on success, FALSE otherwise
- */
-static gboolean
-_eail_is_sentence_break(gunichar c)
-{
-   if (c == '.' || c == '?' || c == '!') return TRUE;
-
-   return FALSE;
-}
-
 /**
  * @brief Checks whether the character at offset in textblock is a sentence's start
  *
@@ -824,21 +1130,16 @@ static gboolean
 _eail_is_sentence_start(const Evas_Object *textblock,
                         gint offset)
 {
-   gunichar c;
-   gint len = _eail_get_len(textblock);
-
-   if (offset > len -1 || offset < 0) return FALSE;
-
-   if (0 == offset) return TRUE;
-
-   c = _eail_get_unichar_at_offset(textblock, offset - 1);
-   if (_eail_is_sentence_break(c)) return TRUE;
-
-   return FALSE;
+   return _eail_has_segment_flag(textblock, offset,
+                                 EAIL_TEXT_SENTENCE_START);
 }
 
 /**
- * @brief Checks whether the character at offset in textblock is a sentence's end
+ * @brief Checks whether the position at offset in textblock is a sentence's
+ * end
+ *
+ * The end is the position after the sentence terminator (eg. after '.'),
+ * not the position of the terminator itself.
  *
  * @param textblock Evas textblock
  * @param offset character offset
@@ -848,17 +1149,7 @@ static gboolean
 _eail_is_sentence_end(const Evas_Object *textblock,
                       gint offset)
 {
-   gunichar c;
-   gint len = _eail_get_len(textblock);
-
-   if (offset > len -1 || offset < 0) return FALSE;
-
-   if (offset == len -1) return TRUE;
-
-   c = _eail_get_unichar_at_offset(textblock, offset);
-   if (_eail_is_sentence_break(c)) return TRUE;
-
-   return FALSE;
+   return _eail_has_segment_flag(textblock, offset, EAIL_TEXT_SENTENCE_END);
 }
 
 /**
@@ -872,16 +1163,7 @@ static gboolean
 _eail_is_inside_sentence(const Evas_Object *textblock,
                          gint offset)
 {
-   gunichar c;
-   gint len = _eail_get_len(textblock);
-
-   if ((offset > len -1 || offset < 0)) return FALSE;
-
-   c = _eail_get_unichar_at_offset(textblock, offset);
-
-   if (!_eail_is_sentence_break(c)) return TRUE;
-
-   return FALSE;
+   return _eail_has_segment_flag(textblock, offset, EAIL_TEXT_IN_SENTENCE);
 }
 
 /**
@@ -933,14 +1215,12 @@ static gboolean
 _eail_is_line_start(const Evas_Object *textblock,
                     gint offset)
 {
-   Evas_Textblock_Cursor *cur = NULL;
-   cur = evas_object_textblock_cursor_new(textblock);
-   evas_textblock_cursor_pos_set(cur, offset);
-   evas_textblock_cursor_line_char_first(cur);
-   gint pos = evas_textblock_cursor_pos_get(cur);
-   evas_textblock_cursor_free(cur);
+   gint first;
+
+   if (!eail_text_lines_get_line(textblock, offset, &first, NULL))
+     return FALSE;
 
-   return pos == offset;
+   return first == offset;
 }
 
 /**
@@ -954,15 +1234,12 @@ static gboolean
 _eail_is_line_end(const Evas_Object *textblock,
                   gint offset)
 {
-   /* is first non-word char after a word */
-   Evas_Textblock_Cursor *cur = NULL;
-   cur = evas_object_textblock_cursor_new(textblock);
-   evas_textblock_cursor_pos_set(cur, offset);
-   evas_textblock_cursor_line_char_last(cur);
-   gint pos = evas_textblock_cursor_pos_get(cur);
-   evas_textblock_cursor_free(cur);
+   gint last;
 
-   return (pos == offset);
+   if (!eail_text_lines_get_line(textblock, offset, NULL, &last))
+     return FALSE;
+
+   return last == offset;
 }
 
 /**
@@ -976,13 +1253,12 @@ static gboolean
 _eail_is_inside_line(const Evas_Object *textblock,
                      gint offset)
 {
-   Evas_Textblock_Cursor *cur = NULL;
-   cur = evas_object_textblock_cursor_new(textblock);
-   evas_textblock_cursor_pos_set(cur, offset);
-   evas_textblock_cursor_line_char_last(cur);
-   gint pos_end = evas_textblock_cursor_pos_get(cur);
-   evas_textblock_cursor_free(cur);
-   return pos_end != offset;
+   gint last;
+
+   if (!eail_text_lines_get_line(textblock, offset, NULL, &last))
+     return FALSE;
+
+   return last != offset;
 }
 
 /**
@@ -991,6 +1267,8 @@ _eail_is_inside_line(const Evas_Object *textblock,
  * Count may  be positive or negative. If count is positive, the returned
  * position will be a line end, otherwise it will be a line start.
  *
+ * Each step is a lookup in the line index of the textblock.
+ *
  * @param textblock Evas textblock
  * @param offset a character offset
  * @param count the number of words to move from offset
@@ -1002,20 +1280,33 @@ _eail_move_lines(const Evas_Object *textblock,
                  gint count)
 {
    gint len = _eail_get_len(textblock);
+   gint first, last;
 
    while (count > 0 && offset < len)
      {
-        do
-          offset++;
-        while (offset < len && !_eail_is_line_end(textblock, offset));
+        offset++;
+        if (offset < len)
+          {
+             if (eail_text_lines_get_line(textblock, offset, NULL, &last) &&
+                 last >= offset)
+               offset = last;
+             else
+               offset = len;
+          }
 
         count--;
      }
    while (count < 0 && offset > 0)
      {
-        do
-          offset--;
-        while (offset > 0 && !_eail_is_line_start(textblock, offset));
+        offset--;
+        if (offset > 0)
+          {
+             if (eail_text_lines_get_line(textblock, offset, &first, NULL) &&
+                 first <= offset)
+               offset = first;
+             else
+               offset = 0;
+          }
 
         count++;
      }
@@ -1372,3 +1663,152 @@ eail_utils_text_add_attribute(AtkAttributeSet *attrib_set,
    return_set = g_slist_prepend(attrib_set, at);
    return return_set;
 }
+
+/** @brief Key of EailTextChangeCallbacks on edje objects */
+#define EAIL_TEXT_CHANGE_KEY "eail_text_change"
+
+/**
+ * @brief Callbacks sharing the single text change slot of edje object
+ */
+typedef struct
+{
+   GSList *funcs;/**< @brief Edje_Text_Change_Cb of callbacks */
+   GSList *datas;/**< @brief data of callbacks, in order of funcs */
+   gint walking;/**< @brief nesting level of _eail_edje_text_changed */
+   gboolean deleted;/**< @brief callbacks were removed while walking */
+} EailTextChangeCallbacks;
+
+/**
+ * @brief Drops callbacks marked as removed while they were walked
+ *
+ * @param cbs EailTextChangeCallbacks instance
+ */
+static void
+_eail_edje_text_change_purge(EailTextChangeCallbacks *cbs)
+{
+   while (g_slist_find(cbs->funcs, NULL))
+     {
+        gint i = g_slist_index(cbs->funcs, NULL);
+
+        cbs->funcs = g_slist_delete_link(cbs->funcs,
+                                         g_slist_nth(cbs->funcs, i));
+        cbs->datas = g_slist_delete_link(cbs->datas,
+                                         g_slist_nth(cbs->datas, i));
+     }
+   cbs->deleted = FALSE;
+}
+
+/**
+ * @brief Calls callbacks added for edje object whose part text was set
+ *
+ * @param data unused
+ * @param obj edje object
+ * @param part name of part whose text was set
+ */
+static void
+_eail_edje_text_changed(void *data, Evas_Object *obj, const char *part)
+{
+   EailTextChangeCallbacks *cbs;
+   GSList *f, *d;
+
+   cbs = evas_object_data_get(obj, EAIL_TEXT_CHANGE_KEY);
+   if (!cbs) return;
+
+   cbs->walking++;
+   for (f = cbs->funcs, d = cbs->datas; f; f = f->next, d = d->next)
+     if (f->data)
+       ((Edje_Text_Change_Cb)f->data)(d->data, obj, part);
+   cbs->walking--;
+
+   if (!cbs->walking && cbs->deleted)
+     _eail_edje_text_change_purge(cbs);
+}
+
+/**
+ * @brief Frees callbacks of deleted edje object
+ *
+ * @param data EailTextChangeCallbacks instance
+ * @param e Evas instance
+ * @param obj deleted edje object
+ * @param event_info additional event info
+ */
+static void
+_eail_edje_text_change_on_del(void *data,
+                              Evas *e,
+                              Evas_Object *obj,
+                              void *event_info)
+{
+   EailTextChangeCallbacks *cbs = data;
+
+   evas_object_data_del(obj, EAIL_TEXT_CHANGE_KEY);
+   g_slist_free(cbs->funcs);
+   g_slist_free(cbs->datas);
+   g_free(cbs);
+}
+
+/**
+ * Edje objects have a single text change callback, so callbacks added here
+ * share it. Text set with edje_object_part_text_set or inserted with
+ * edje_object_part_text_insert is reported, edits of entry parts made by
+ * user are not.
+ *
+ * @param edje edje object
+ * @param func function called with data, edje object and name of part
+ * @param data data passed to func
+ */
+void
+eail_edje_text_change_callback_add(Evas_Object *edje,
+                                   Edje_Text_Change_Cb func,
+                                   const void *data)
+{
+   EailTextChangeCallbacks *cbs;
+
+   g_return_if_fail(edje && func);
+
+   cbs = evas_object_data_get(edje, EAIL_TEXT_CHANGE_KEY);
+   if (!cbs)
+     {
+        cbs = g_new0(EailTextChangeCallbacks, 1);
+        evas_object_data_set(edje, EAIL_TEXT_CHANGE_KEY, cbs);
+        evas_object_event_callback_add(edje, EVAS_CALLBACK_DEL,
+                                       _eail_edje_text_change_on_del, cbs);
+        edje_object_text_change_cb_set(edje, _eail_edje_text_changed, NULL);
+     }
+
+   cbs->funcs = g_slist_append(cbs->funcs, func);
+   cbs->datas = g_slist_append(cbs->datas, (gpointer)data);
+}
+
+/**
+ * Removes the first callback added with the same func and data. Does
+ * nothing if edje object is being deleted.
+ *
+ * @param edje edje object
+ * @param func function passed to eail_edje_text_change_callback_add
+ * @param data data passed to eail_edje_text_change_callback_add
+ */
+void
+eail_edje_text_change_callback_del(Evas_Object *edje,
+                                   Edje_Text_Change_Cb func,
+                                   const void *data)
+{
+   EailTextChangeCallbacks *cbs;
+   GSList *f, *d;
+
+   if (!edje) return;
+
+   cbs = evas_object_data_get(edje, EAIL_TEXT_CHANGE_KEY);
+   if (!cbs) return;
+
+   for (f = cbs->funcs, d = cbs->datas; f; f = f->next, d = d->next)
+     {
+        if (f->data != (gpointer)func || d->data != data) continue;
+
+        f->data = NULL;
+        cbs->deleted = TRUE;
+        break;
+     }
+
+   if (!cbs->walking && cbs->deleted)
+     _eail_edje_text_change_purge(cbs);
+}
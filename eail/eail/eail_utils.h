@@ -56,6 +56,21 @@ enum EAIL_SCROLL_TYPE
  */
 gchar *eail_get_substring(const gchar* string, gint start_offset, gint end_offset);
 
+/**
+ * @brief Bit of AtkStateType in a state mask
+ *
+ * @param state AtkStateType value
+ */
+#define EAIL_STATE_BIT(state) (G_GUINT64_CONSTANT(1) << (state))
+
+/**
+ * @brief States kept in a mask and updated from evas and widget events
+ */
+#define EAIL_TRACKED_STATES \
+   (EAIL_STATE_BIT(ATK_STATE_VISIBLE) | EAIL_STATE_BIT(ATK_STATE_SHOWING) | \
+    EAIL_STATE_BIT(ATK_STATE_FOCUSED) | EAIL_STATE_BIT(ATK_STATE_SENSITIVE) | \
+    EAIL_STATE_BIT(ATK_STATE_ENABLED))
+
 /**
  * @brief Generic function for generating ref_state for Evas_Objects stored in
  * ATK objects
@@ -64,6 +79,89 @@ gchar *eail_get_substring(const gchar* string, gint start_offset, gint end_offse
 AtkStateSet *eail_evas_obj_ref_state_set(Evas_Object *widget,
                                          AtkStateSet *state_set);
 
+/**
+ * @brief Computes EAIL_TRACKED_STATES of Evas_Object
+ */
+guint64 eail_evas_obj_tracked_states_get(Evas_Object *widget);
+
+/**
+ * @brief Checks whether Evas_Object is in the visible part of the canvas
+ */
+gboolean eail_evas_obj_showing_get(Evas_Object *widget);
+
+/**
+ * @brief Gets objects whose geometry affects showing state of Evas_Object
+ */
+Eina_List *eail_evas_obj_clippers_get(Evas_Object *widget);
+
+/**
+ * @brief Gets sensitivity and focus states of Evas_Object
+ */
+guint64 eail_evas_obj_flag_states_get(Evas_Object *widget);
+
+/**
+ * @brief Adds states from a mask to AtkStateSet
+ */
+void eail_state_set_add_states(AtkStateSet *state_set, guint64 states);
+
+/**
+ * @brief Gets mask of states present in AtkStateSet
+ */
+guint64 eail_state_set_get_states(AtkStateSet *state_set);
+
+/** @brief Role, states and extents of accessible read by tree walks */
+typedef struct _EailObjectRecord
+{
+   AtkRole role;/**< @brief AtkRole of accessible */
+   guint64 states;/**< @brief mask of EAIL_STATE_BIT values */
+   gint x;/**< @brief x coordinate of accessible */
+   gint y;/**< @brief y coordinate of accessible */
+   gint width;/**< @brief width of accessible */
+   gint height;/**< @brief height of accessible */
+} EailObjectRecord;
+
+/** @brief State of single accessible tree walk */
+typedef struct _EailTreeWalk
+{
+   AtkCoordType coord_type;/**< @brief coordinates type of extents */
+   const Evas *canvas;/**< @brief canvas screen origin was read for */
+   gint origin_x;/**< @brief x coordinate of canvas on the screen */
+   gint origin_y;/**< @brief y coordinate of canvas on the screen */
+   /** @brief default ref_child of EailWidget */
+   AtkObject *(*widget_ref_child)(AtkObject *obj, gint i);
+} EailTreeWalk;
+
+/**
+ * @brief Callback receiving children of accessible in a tree walk
+ *
+ * @param child child accessible, referenced only for the time of the call
+ * @param index index of child among walked children
+ * @param user_data data passed to eail_tree_walk_children
+ */
+typedef void (*EailTreeWalkFunc)(AtkObject *child,
+                                 gint index,
+                                 gpointer user_data);
+
+/**
+ * @brief Prepares tree walk
+ */
+void eail_tree_walk_init(EailTreeWalk *walk, AtkCoordType coord_type);
+
+/**
+ * @brief Reads role, states and extents of accessible
+ */
+void eail_tree_walk_fill(EailTreeWalk *walk,
+                         AtkObject *obj,
+                         EailObjectRecord *record);
+
+/**
+ * @brief Calls callback on every child of accessible
+ */
+gint eail_tree_walk_children(EailTreeWalk *walk,
+                             AtkObject *obj,
+                             EailTreeWalkFunc func,
+                             gpointer user_data);
+
 /**
  * @brief Generic function for grabbing focus on Evas_Object stored in ATK object
  */
@@ -137,6 +235,16 @@ gboolean eail_action_scroll_left(Evas_Object *widget,
 gboolean eail_action_scroll_right(Evas_Object *widget,
                                   void *data);
 
+/**
+ * @brief Gets index of action with given name
+ */
+gint eail_action_get_index(AtkAction *action, const gchar *action_name);
+
+/**
+ * @brief Launches action with given name
+ */
+gboolean eail_action_do_by_name(AtkAction *action, const gchar *action_name);
+
 /**
  * @brief Emits signal for ATK Object
  */
@@ -255,6 +363,21 @@ AtkAttributeSet*
 eail_utils_text_add_attribute(AtkAttributeSet *attrib_set,
                               AtkTextAttribute attr,
                               const gchar     *value);
+
+/**
+ * @brief Adds a callback called when text of a part of edje object is set
+ */
+void eail_edje_text_change_callback_add(Evas_Object *edje,
+                                        Edje_Text_Change_Cb func,
+                                        const void *data);
+
+/**
+ * @brief Removes a callback added by eail_edje_text_change_callback_add
+ */
+void eail_edje_text_change_callback_del(Evas_Object *edje,
+                                        Edje_Text_Change_Cb func,
+                                        const void *data);
+
 #ifdef __cplusplus
 }
 #endif
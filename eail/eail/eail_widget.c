@@ -26,9 +26,16 @@
 #include <Ecore_Evas.h>
 #include <Elementary.h>
 
+/* internal elm_widget api for the edje object emitting state signals */
+#define ELM_INTERNAL_API_ARGESFSDFEFC
+#include <elm_widget.h>
+
 #include "eail_widget.h"
 #include "eail_factory.h"
 #include "eail_utils.h"
+#include "eail_window.h"
+#include "eail_hit_grid.h"
+#include "eail_subscription.h"
 #include "eail_priv.h"
 
 static void atk_component_interface_init(AtkComponentIface *iface);
@@ -71,6 +78,437 @@ eail_widget_get_widget_children(EailWidget *widget)
     return klass->get_widget_children(widget);
 }
 
+/**
+ * @brief Attaches widget callbacks of given subscriptions and detaches the
+ * others
+ *
+ * @param widget EailWidget instance
+ * @param subscriptions mask of EailSubscription values
+ */
+void
+eail_widget_instrument(EailWidget *widget, guint subscriptions)
+{
+    EailWidgetClass *klass;
+    guint attach, detach;
+
+    g_return_if_fail(EAIL_IS_WIDGET(widget));
+
+    if (!widget->widget) return;
+
+    attach = subscriptions & ~widget->instrumented;
+    detach = widget->instrumented & ~subscriptions;
+    if (!attach && !detach) return;
+
+    klass = EAIL_WIDGET_GET_CLASS(widget);
+    if (klass->instrument)
+      klass->instrument(widget, attach, detach);
+
+    widget->instrumented = subscriptions;
+}
+
+/**
+ * @brief Gets shared attribute set of widget
+ *
+ * Widgets of one type reporting the same attribute values share one set,
+ * see eail_attributes_intern. Internal consumers read the set in place
+ * instead of copying it with atk_object_get_attributes.
+ *
+ * @param widget EailWidget instance
+ * @return EailAttributes with a new reference, release it with
+ * eail_attributes_unref, or NULL if widget has no attributes
+ */
+EailAttributes *
+eail_widget_ref_attributes(EailWidget *widget)
+{
+    EailWidgetClass *klass;
+
+    g_return_val_if_fail(EAIL_IS_WIDGET(widget), NULL);
+
+    if (!widget->widget) return NULL;
+
+    klass = EAIL_WIDGET_GET_CLASS(widget);
+    if (!klass->ref_attributes) return NULL;
+
+    return klass->ref_attributes(widget);
+}
+
+/**
+ * @brief Checks whether tracked states and extents are kept up to date by
+ * evas callbacks
+ *
+ * @param widget EailWidget instance
+ * @returns TRUE if show, hide, move and resize callbacks are attached
+ */
+static gboolean
+_eail_widget_geometry_tracked(EailWidget *widget)
+{
+    return (widget->instrumented & EAIL_SUBSCRIPTION_GEOMETRY) ==
+       EAIL_SUBSCRIPTION_GEOMETRY;
+}
+
+/**
+ * @brief Drops cached sub-object when it is deleted
+ *
+ * @param data EailSubobject instance
+ * @param e Evas instance
+ * @param obj deleted sub-object
+ * @param event_info additional event info
+ */
+static void
+_eail_subobject_on_del(void *data, Evas *e, Evas_Object *obj, void *event_info)
+{
+   eail_subobject_clear(data);
+}
+
+/**
+ * @brief Drops cached sub-object when widget content changes
+ *
+ * @param data EailSubobject instance
+ * @param obj widget object
+ * @param event_info removed sub-object
+ */
+static void
+_eail_subobject_on_widget_change(void *data, Evas_Object *obj, void *event_info)
+{
+   eail_subobject_clear(data);
+}
+
+/**
+ * @brief Caches internal sub-object of widget
+ *
+ * Cache is dropped when obj is deleted or when widget removes any of its
+ * sub-objects, e.g. when its content is unset.
+ *
+ * @param cache EailSubobject to fill
+ * @param widget widget the sub-object belongs to
+ * @param obj sub-object to cache, NULL only clears the cache
+ */
+void
+eail_subobject_set(EailSubobject *cache, Evas_Object *widget, Evas_Object *obj)
+{
+   eail_subobject_clear(cache);
+
+   if (!widget || !obj) return;
+
+   cache->widget = widget;
+   cache->obj = obj;
+
+   evas_object_event_callback_add(obj, EVAS_CALLBACK_DEL,
+                                  _eail_subobject_on_del, cache);
+   evas_object_smart_callback_add(widget, "sub-object-del",
+                                  _eail_subobject_on_widget_change, cache);
+}
+
+/**
+ * @brief Drops cached sub-object
+ *
+ * Has to be called before the structure holding the cache is freed.
+ *
+ * @param cache EailSubobject instance
+ */
+void
+eail_subobject_clear(EailSubobject *cache)
+{
+   if (!cache->obj) return;
+
+   evas_object_event_callback_del_full(cache->obj, EVAS_CALLBACK_DEL,
+                                       _eail_subobject_on_del, cache);
+   evas_object_smart_callback_del_full(cache->widget, "sub-object-del",
+                                       _eail_subobject_on_widget_change,
+                                       cache);
+   cache->obj = NULL;
+   cache->widget = NULL;
+}
+
+/** @brief Number of callbacks attached by accessibles to widgets */
+static gint eail_widget_callbacks = 0;
+
+/**
+ * @brief Recomputes tracked states after an event which may change them
+ *
+ * Emits "state-change" for visibility and sensitivity states that changed
+ * if EAIL_SUBSCRIPTION_STATE is attached. FOCUSED is notified by focus
+ * callbacks themselves.
+ *
+ * @param widget EailWidget instance
+ */
+static void
+_eail_widget_states_refresh(EailWidget *widget)
+{
+    guint64 old = widget->states, changed;
+    AtkStateType state;
+
+    widget->states = eail_evas_obj_tracked_states_get(widget->widget);
+
+    if (!(widget->instrumented & EAIL_SUBSCRIPTION_STATE)) return;
+
+    changed = (old ^ widget->states) & ~EAIL_STATE_BIT(ATK_STATE_FOCUSED);
+    for (state = 0; changed; ++state, changed >>= 1)
+      {
+         if (changed & 1)
+           atk_object_notify_state_change
+              (ATK_OBJECT(widget), state,
+               !!(widget->states & EAIL_STATE_BIT(state)));
+      }
+}
+
+/**
+ * @brief Sets or clears a bit of tracked states
+ *
+ * @param widget EailWidget instance
+ * @param state AtkStateType from EAIL_TRACKED_STATES
+ * @param value new value of state
+ */
+static void
+_eail_widget_state_set(EailWidget *widget, AtkStateType state, gboolean value)
+{
+    if (value)
+      widget->states |= EAIL_STATE_BIT(state);
+    else
+      widget->states &= ~EAIL_STATE_BIT(state);
+}
+
+/**
+ * @brief Recomputes tracked states when a watched clipper or the top
+ * widget is moved or resized
+ *
+ * @param data EailWidget instance
+ * @param e Evas instance
+ * @param obj watched object
+ * @param event_info additional event info
+ */
+static void
+_eail_widget_on_clipper_change(void *data,
+                               Evas *e,
+                               Evas_Object *obj,
+                               void *event_info)
+{
+    _eail_widget_states_refresh(EAIL_WIDGET(data));
+}
+
+/**
+ * @brief Forgets deleted clipper
+ *
+ * @param data EailWidget instance
+ * @param e Evas instance
+ * @param obj deleted object
+ * @param event_info additional event info
+ */
+static void
+_eail_widget_on_clipper_del(void *data,
+                            Evas *e,
+                            Evas_Object *obj,
+                            void *event_info)
+{
+    EailWidget *widget = EAIL_WIDGET(data);
+
+    widget->clippers = eina_list_remove(widget->clippers, obj);
+    eail_widget_callbacks -= 3;
+}
+
+/**
+ * @brief Stops watching clippers of widget
+ *
+ * @param widget EailWidget instance
+ */
+static void
+_eail_widget_clippers_unwatch(EailWidget *widget)
+{
+    Evas_Object *clip;
+
+    EINA_LIST_FREE(widget->clippers, clip)
+      {
+         evas_object_event_callback_del_full(clip, EVAS_CALLBACK_MOVE,
+                                             _eail_widget_on_clipper_change,
+                                             widget);
+         evas_object_event_callback_del_full(clip, EVAS_CALLBACK_RESIZE,
+                                             _eail_widget_on_clipper_change,
+                                             widget);
+         evas_object_event_callback_del_full(clip, EVAS_CALLBACK_DEL,
+                                             _eail_widget_on_clipper_del,
+                                             widget);
+         eail_widget_callbacks -= 3;
+      }
+}
+
+/**
+ * @brief Checks whether watched clippers still match the clipper chain
+ *
+ * Clip changes are not notified by evas, so the chain is compared when
+ * the widget is shown, moved or resized. Nothing is allocated.
+ *
+ * @param widget EailWidget instance
+ * @returns TRUE if the chain differs from watched clippers
+ */
+static gboolean
+_eail_widget_clippers_changed(EailWidget *widget)
+{
+    Eina_List *l = widget->clippers;
+    Evas_Object *clip, *top;
+
+    for (clip = evas_object_clip_get(widget->widget); clip;
+         clip = evas_object_clip_get(clip), l = eina_list_next(l))
+      {
+         if (!l || eina_list_data_get(l) != clip) return TRUE;
+      }
+
+    top = elm_object_top_widget_get(widget->widget);
+    if (top && top != widget->widget &&
+        !eina_list_data_find(widget->clippers, top))
+      return TRUE;
+
+    return l && (!top || eina_list_data_get(l) != top || eina_list_next(l));
+}
+
+/**
+ * @brief Watches geometry of clippers and top widget of widget, whose
+ * changes may change SHOWING
+ *
+ * @param widget EailWidget instance
+ */
+static void
+_eail_widget_clippers_watch(EailWidget *widget)
+{
+    Eina_List *l;
+    Evas_Object *clip;
+
+    if (widget->clippers && !_eail_widget_clippers_changed(widget)) return;
+
+    _eail_widget_clippers_unwatch(widget);
+    widget->clippers = eail_evas_obj_clippers_get(widget->widget);
+
+    EINA_LIST_FOREACH(widget->clippers, l, clip)
+      {
+         evas_object_event_callback_add(clip, EVAS_CALLBACK_MOVE,
+                                        _eail_widget_on_clipper_change,
+                                        widget);
+         evas_object_event_callback_add(clip, EVAS_CALLBACK_RESIZE,
+                                        _eail_widget_on_clipper_change,
+                                        widget);
+         evas_object_event_callback_add(clip, EVAS_CALLBACK_DEL,
+                                        _eail_widget_on_clipper_del, widget);
+         eail_widget_callbacks += 3;
+      }
+}
+
+/**
+ * @brief Recomputes tracked states when widget is disabled or enabled
+ *
+ * Elementary does not notify disabled_set, but widgets built on edje
+ * emit "elm,state,disabled" and "elm,state,enabled" to their theme.
+ *
+ * @param data EailWidget instance
+ * @param obj edje object emitting the signal
+ * @param emission emitted signal
+ * @param source source of the signal
+ */
+static void
+_eail_widget_on_disabled_signal(void *data,
+                                Evas_Object *obj,
+                                const char *emission,
+                                const char *source)
+{
+    _eail_widget_states_refresh(EAIL_WIDGET(data));
+}
+
+/**
+ * @brief Notifies name change when text of widget is set
+ *
+ * Names of most widgets are computed from their text, which is not
+ * notified either; layouts emit "elm,state,text,visible" or
+ * "elm,state,text,hidden" to their theme on every text set.
+ *
+ * @param data EailWidget instance
+ * @param obj edje object emitting the signal
+ * @param emission emitted signal
+ * @param source source of the signal
+ */
+static void
+_eail_widget_on_text_signal(void *data,
+                            Evas_Object *obj,
+                            const char *emission,
+                            const char *source)
+{
+    /* name set by the application does not follow text */
+    if (ATK_OBJECT(data)->name) return;
+
+    g_object_notify(G_OBJECT(data), "accessible-name");
+}
+
+/**
+ * @brief Forgets deleted edje object of widget
+ *
+ * @param data EailWidget instance
+ * @param e Evas instance
+ * @param obj deleted object
+ * @param event_info additional event info
+ */
+static void
+_eail_widget_on_state_edje_del(void *data,
+                               Evas *e,
+                               Evas_Object *obj,
+                               void *event_info)
+{
+    EAIL_WIDGET(data)->state_edje = NULL;
+    eail_widget_callbacks -= 5;
+}
+
+/**
+ * @brief Listens to disabled, enabled and text signals of edje object of
+ * widget
+ *
+ * @param widget EailWidget instance
+ */
+static void
+_eail_widget_disabled_watch(EailWidget *widget)
+{
+    Evas_Object *edje = elm_widget_resize_object_get(widget->widget);
+
+    if (!edje || g_strcmp0(evas_object_type_get(edje), "edje")) return;
+
+    edje_object_signal_callback_add(edje, "elm,state,disabled", "*",
+                                    _eail_widget_on_disabled_signal, widget);
+    edje_object_signal_callback_add(edje, "elm,state,enabled", "*",
+                                    _eail_widget_on_disabled_signal, widget);
+    edje_object_signal_callback_add(edje, "elm,state,text,visible", "*",
+                                    _eail_widget_on_text_signal, widget);
+    edje_object_signal_callback_add(edje, "elm,state,text,hidden", "*",
+                                    _eail_widget_on_text_signal, widget);
+    evas_object_event_callback_add(edje, EVAS_CALLBACK_DEL,
+                                   _eail_widget_on_state_edje_del, widget);
+    widget->state_edje = edje;
+    eail_widget_callbacks += 5;
+}
+
+/**
+ * @brief Stops listening to disabled, enabled and text signals
+ *
+ * @param widget EailWidget instance
+ */
+static void
+_eail_widget_disabled_unwatch(EailWidget *widget)
+{
+    Evas_Object *edje = widget->state_edje;
+
+    if (!edje) return;
+
+    edje_object_signal_callback_del_full(edje, "elm,state,disabled", "*",
+                                         _eail_widget_on_disabled_signal,
+                                         widget);
+    edje_object_signal_callback_del_full(edje, "elm,state,enabled", "*",
+                                         _eail_widget_on_disabled_signal,
+                                         widget);
+    edje_object_signal_callback_del_full(edje, "elm,state,text,visible", "*",
+                                         _eail_widget_on_text_signal, widget);
+    edje_object_signal_callback_del_full(edje, "elm,state,text,hidden", "*",
+                                         _eail_widget_on_text_signal, widget);
+    evas_object_event_callback_del_full(edje, EVAS_CALLBACK_DEL,
+                                        _eail_widget_on_state_edje_del,
+                                        widget);
+    widget->state_edje = NULL;
+    eail_widget_callbacks -= 5;
+}
+
 /**
  * @brief Callback used for tracking focus-in changes for widgets
  *
@@ -84,6 +522,7 @@ eail_widget_on_focused_in(void *data, Evas *e, Evas_Object *obj, void *event_inf
 {
    g_return_if_fail(ATK_IS_OBJECT(data));
 
+   _eail_widget_state_set(EAIL_WIDGET(data), ATK_STATE_FOCUSED, TRUE);
    atk_object_notify_state_change(ATK_OBJECT(data), ATK_STATE_FOCUSED, TRUE);
    atk_focus_tracker_notify(ATK_OBJECT(data));
 }
@@ -101,8 +540,11 @@ eail_widget_on_show(void *data, Evas *e, Evas_Object *obj, void *event_info)
 {
    g_return_if_fail(ATK_IS_OBJECT(data));
 
-   atk_object_notify_state_change(ATK_OBJECT(data), ATK_STATE_SHOWING, TRUE);
-   atk_object_notify_state_change(ATK_OBJECT(data), ATK_STATE_VISIBLE, TRUE);
+   if (EAIL_WIDGET(data)->instrumented & EAIL_SUBSCRIPTION_BOUNDS)
+     _eail_widget_clippers_watch(EAIL_WIDGET(data));
+   _eail_widget_states_refresh(EAIL_WIDGET(data));
+   if (_eail_widget_geometry_tracked(EAIL_WIDGET(data)))
+     eail_hit_grid_update(ATK_OBJECT(data), obj);
 }
 
 /**
@@ -118,8 +560,7 @@ eail_widget_on_hide(void *data, Evas *e, Evas_Object *obj, void *event_info)
 {
    g_return_if_fail(ATK_IS_OBJECT(data));
 
-   atk_object_notify_state_change(ATK_OBJECT(data), ATK_STATE_SHOWING, FALSE);
-   atk_object_notify_state_change(ATK_OBJECT(data), ATK_STATE_VISIBLE, FALSE);
+   _eail_widget_states_refresh(EAIL_WIDGET(data));
 }
 
 /**
@@ -136,6 +577,7 @@ eail_widget_on_focused_out(void *data, Evas *e, Evas_Object *obj, void *event_in
    g_return_if_fail(ATK_IS_OBJECT(data));
 
    DBG("><");
+   _eail_widget_state_set(EAIL_WIDGET(data), ATK_STATE_FOCUSED, FALSE);
    atk_object_notify_state_change(ATK_OBJECT(data), ATK_STATE_FOCUSED, FALSE);
    atk_focus_tracker_notify(ATK_OBJECT(data));
    eail_notify_child_focus_changes();
@@ -155,6 +597,14 @@ eail_widget_on_bounds_change(void *data, Evas *e, Evas_Object *obj, void *event_
    g_return_if_fail(ATK_IS_COMPONENT(data));
 
    AtkRectangle rect;
+
+   _eail_widget_clippers_watch(EAIL_WIDGET(data));
+   _eail_widget_states_refresh(EAIL_WIDGET(data));
+   if (_eail_widget_geometry_tracked(EAIL_WIDGET(data)))
+     eail_hit_grid_update(ATK_OBJECT(data), obj);
+
+   if (!(EAIL_WIDGET(data)->instrumented & EAIL_SUBSCRIPTION_BOUNDS)) return;
+
    evas_object_geometry_get(obj, &rect.x, &rect.y, &rect.width, &rect.height);
    g_signal_emit_by_name (ATK_OBJECT(data), "bounds_changed", &rect);
 }
@@ -175,6 +625,7 @@ void eail_widget_on_focused_smart(void *data,
    g_return_if_fail(ATK_IS_OBJECT(data));
 
    DBG("><");
+   _eail_widget_state_set(EAIL_WIDGET(data), ATK_STATE_FOCUSED, TRUE);
    atk_object_notify_state_change(ATK_OBJECT(data), ATK_STATE_FOCUSED, TRUE);
    atk_focus_tracker_notify(ATK_OBJECT(data));
    eail_notify_child_focus_changes();
@@ -195,10 +646,87 @@ void eail_widget_on_focused_out_smart(void *data,
    g_return_if_fail(ATK_IS_OBJECT(data));
 
    DBG("><");
+   _eail_widget_state_set(EAIL_WIDGET(data), ATK_STATE_FOCUSED, FALSE);
    /* Not propagating further, using only for internal eail focus changes*/
    eail_notify_child_focus_changes();
 }
 
+/**
+ * @brief Default instrument callback
+ *
+ * EAIL_SUBSCRIPTION_STATE attaches show/hide callbacks and listens to
+ * disabled, enabled and text signals, EAIL_SUBSCRIPTION_BOUNDS attaches
+ * move/resize callbacks of the widget and of its clippers. Tracked states
+ * and extents in the spatial index of window are kept only while all of
+ * EAIL_SUBSCRIPTION_GEOMETRY is attached; without it, ref_state_set
+ * computes states on demand and the widget is dropped from the index.
+ *
+ * @param widget EailWidget instance
+ * @param attach mask of EailSubscription values to attach
+ * @param detach mask of EailSubscription values to detach
+ */
+static void
+eail_widget_real_instrument(EailWidget *widget, guint attach, guint detach)
+{
+    Evas_Object *obj = widget->widget;
+    guint instrumented = (widget->instrumented | attach) & ~detach;
+
+    if (attach & EAIL_SUBSCRIPTION_STATE)
+      {
+         evas_object_event_callback_add(obj, EVAS_CALLBACK_SHOW,
+                                        eail_widget_on_show, widget);
+         evas_object_event_callback_add(obj, EVAS_CALLBACK_HIDE,
+                                        eail_widget_on_hide, widget);
+         eail_widget_callbacks += 2;
+         _eail_widget_disabled_watch(widget);
+      }
+    else if (detach & EAIL_SUBSCRIPTION_STATE)
+      {
+         evas_object_event_callback_del_full(obj, EVAS_CALLBACK_SHOW,
+                                             eail_widget_on_show, widget);
+         evas_object_event_callback_del_full(obj, EVAS_CALLBACK_HIDE,
+                                             eail_widget_on_hide, widget);
+         eail_widget_callbacks -= 2;
+         _eail_widget_disabled_unwatch(widget);
+      }
+
+    if (attach & EAIL_SUBSCRIPTION_BOUNDS)
+      {
+         evas_object_event_callback_add(obj, EVAS_CALLBACK_RESIZE,
+                                        eail_widget_on_bounds_change, widget);
+         evas_object_event_callback_add(obj, EVAS_CALLBACK_MOVE,
+                                        eail_widget_on_bounds_change, widget);
+         eail_widget_callbacks += 2;
+         _eail_widget_clippers_watch(widget);
+      }
+    else if (detach & EAIL_SUBSCRIPTION_BOUNDS)
+      {
+         evas_object_event_callback_del_full(obj, EVAS_CALLBACK_RESIZE,
+                                             eail_widget_on_bounds_change,
+                                             widget);
+         evas_object_event_callback_del_full(obj, EVAS_CALLBACK_MOVE,
+                                             eail_widget_on_bounds_change,
+                                             widget);
+         eail_widget_callbacks -= 2;
+         _eail_widget_clippers_unwatch(widget);
+      }
+
+    /* baseline for changes notified from now on */
+    if (attach & EAIL_SUBSCRIPTION_GEOMETRY)
+      widget->states = eail_evas_obj_tracked_states_get(obj);
+
+    if ((instrumented & EAIL_SUBSCRIPTION_GEOMETRY) ==
+        EAIL_SUBSCRIPTION_GEOMETRY)
+      {
+         if (attach & EAIL_SUBSCRIPTION_GEOMETRY)
+           eail_hit_grid_update(ATK_OBJECT(widget), obj);
+      }
+    else if (detach & EAIL_SUBSCRIPTION_GEOMETRY)
+      {
+         eail_hit_grid_remove(obj);
+      }
+}
+
 /**
  * @brief EailWidget initializer
  *
@@ -223,20 +751,12 @@ eail_widget_initialize(AtkObject *obj, gpointer data)
         return;
     }
 
+    /* focus tracking backs atk_get_focus_object, always attached */
     evas_object_event_callback_add(widget->widget, EVAS_CALLBACK_FOCUS_IN,
                                        eail_widget_on_focused_in, widget);
     evas_object_event_callback_add(widget->widget, EVAS_CALLBACK_FOCUS_OUT,
                                    eail_widget_on_focused_out, widget);
 
-    evas_object_event_callback_add(widget->widget, EVAS_CALLBACK_SHOW,
-                                   eail_widget_on_show, widget);
-    evas_object_event_callback_add(widget->widget, EVAS_CALLBACK_HIDE,
-                                   eail_widget_on_hide, widget);
-
-    evas_object_event_callback_add(widget->widget, EVAS_CALLBACK_RESIZE,
-                                   eail_widget_on_bounds_change, widget);
-    evas_object_event_callback_add(widget->widget, EVAS_CALLBACK_MOVE,
-                                   eail_widget_on_bounds_change, widget);
     /* for window don't need that event, it would result double generating
      * focus-in event*/
     if (!ATK_IS_WINDOW(obj))
@@ -245,7 +765,11 @@ eail_widget_initialize(AtkObject *obj, gpointer data)
 
     evas_object_smart_callback_add
           (widget->widget, "unfocused", eail_widget_on_focused_out_smart, widget);
+    eail_widget_callbacks += ATK_IS_WINDOW(obj) ? 3 : 4;
 
+    /* state and bounds callbacks are attached only for events somebody
+     * listens to, states are computed on demand otherwise */
+    eail_widget_instrument(widget, eail_subscription_get());
 }
 
 /**
@@ -386,10 +910,27 @@ eail_widget_ref_state_set(AtkObject *obj)
 {
     AtkStateSet *state_set;
     Evas_Object *widget = eail_widget_get_widget(EAIL_WIDGET(obj));
+    guint64 states;
 
     state_set= ATK_OBJECT_CLASS(eail_widget_parent_class)->ref_state_set(obj);
 
-    return eail_evas_obj_ref_state_set(widget, state_set);
+    if (!widget) {
+        atk_state_set_add_state(state_set, ATK_STATE_DEFUNCT);
+        return state_set;
+    }
+
+    /* tracked states are kept by callbacks while they are attached, only
+     * focus_allow is read then */
+    if (_eail_widget_geometry_tracked(EAIL_WIDGET(obj)))
+      states = EAIL_WIDGET(obj)->states;
+    else
+      states = eail_evas_obj_tracked_states_get(widget);
+    if (elm_object_focus_allow_get(widget))
+      states |= EAIL_STATE_BIT(ATK_STATE_FOCUSABLE);
+
+    eail_state_set_add_states(state_set, states);
+
+    return state_set;
 }
 
 /**
@@ -401,23 +942,37 @@ eail_widget_ref_state_set(AtkObject *obj)
 static AtkAttributeSet *
 eail_widget_get_attributes(AtkObject *obj)
 {
-    AtkAttribute *attr;
     AtkAttributeSet *attributes;
-    Evas_Object *widget = eail_widget_get_widget(EAIL_WIDGET(obj));
+    EailAttributes *attrs = eail_widget_ref_attributes(EAIL_WIDGET(obj));
 
-    if (!widget) {
+    if (!attrs) {
         return NULL;
     }
 
-    attr = g_new(AtkAttribute, 1);
-    attr->name = g_strdup("type");
-    attr->value = g_strdup(elm_object_widget_type_get(widget));
-
-    attributes = g_slist_append(NULL, attr);
+    /* the caller frees the set, shared pairs have to be copied */
+    attributes = eail_attributes_add(attrs, NULL);
+    eail_attributes_unref(attrs);
 
     return attributes;
 }
 
+/**
+ * @brief Default ref_attributes callback
+ *
+ * @param widget EailWidget instance
+ * @return EailAttributes with "type" attribute and a new reference
+ */
+static EailAttributes *
+eail_widget_real_ref_attributes(EailWidget *widget)
+{
+    /* widget type never changes, set is shared by all widgets of a type */
+    if (!widget->attributes)
+      widget->attributes = eail_attributes_intern
+         ("type", elm_object_widget_type_get(widget->widget), NULL);
+
+    return eail_attributes_ref(widget->attributes);
+}
+
 /**
  * @brief EailWidget instance initializer
  *
@@ -442,7 +997,14 @@ eail_widget_class_finalize(GObject *obj)
    Evas_Object *evas_widget = eail_widget_get_widget(eail_widget);
 
    if (evas_widget)
-     eail_factory_unregister_wdgt_from_cache(evas_widget);
+     {
+        eail_factory_unregister_wdgt_from_cache(evas_widget);
+        eail_hit_grid_remove(evas_widget);
+     }
+
+   _eail_widget_clippers_unwatch(eail_widget);
+   _eail_widget_disabled_unwatch(eail_widget);
+   eail_attributes_unref(eail_widget->attributes);
 
    G_OBJECT_CLASS(eail_widget_parent_class)->finalize(obj);
 }
@@ -462,6 +1024,8 @@ eail_widget_class_init(EailWidgetClass *klass)
     GObjectClass *g_object_class = G_OBJECT_CLASS(klass);
 
     klass->get_widget_children = eail_widget_get_real_widget_children;
+    klass->instrument = eail_widget_real_instrument;
+    klass->ref_attributes = eail_widget_real_ref_attributes;
 
     atk_class->initialize = eail_widget_initialize;
     atk_class->get_n_children = eail_widget_get_n_children;
@@ -530,9 +1094,8 @@ eail_widget_get_extents(AtkComponent  *component,
 
     if (coord_type == ATK_XY_SCREEN) {
         int ee_x, ee_y;
-        Ecore_Evas *ee= ecore_evas_ecore_evas_get(evas_object_evas_get(widget));
 
-        ecore_evas_geometry_get(ee, &ee_x, &ee_y, NULL, NULL);
+        eail_window_screen_origin_get(widget, &ee_x, &ee_y);
         *x += ee_x;
         *y += ee_y;
     }
@@ -561,9 +1124,8 @@ eail_widget_set_position(AtkComponent *component,
 
     if (coord_type == ATK_XY_SCREEN) {
         int ee_x, ee_y;
-        Ecore_Evas *ee= ecore_evas_ecore_evas_get(evas_object_evas_get(widget));
 
-        ecore_evas_geometry_get(ee, &ee_x, &ee_y, NULL, NULL);
+        eail_window_screen_origin_get(widget, &ee_x, &ee_y);
         x -= ee_x;
         y -= ee_y;
     }
@@ -624,9 +1186,8 @@ eail_widget_set_extents(AtkComponent  *component,
 
     if (coord_type == ATK_XY_SCREEN) {
         int ee_x, ee_y;
-        Ecore_Evas *ee= ecore_evas_ecore_evas_get(evas_object_evas_get(widget));
 
-        ecore_evas_geometry_get(ee, &ee_x, &ee_y, NULL, NULL);
+        eail_window_screen_origin_get(widget, &ee_x, &ee_y);
         x -= ee_x;
         y -= ee_y;
     }
@@ -710,3 +1271,16 @@ atk_component_interface_init(AtkComponentIface *iface)
    iface->add_focus_handler = eail_widget_add_focus_handler;
    iface->get_alpha = eail_widget_get_alpha;
 }
+
+/**
+ * Focus callbacks and callbacks attached for subscriptions are counted,
+ * callbacks of subclasses are not.
+ *
+ * @returns number of callbacks attached by EailWidget to widgets and their
+ * clippers
+ */
+gint
+eail_widget_get_callback_count(void)
+{
+    return eail_widget_callbacks;
+}
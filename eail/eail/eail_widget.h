@@ -31,6 +31,8 @@
 #include <Eina.h>
 #include <Evas.h>
 
+#include "eail_attributes.h"
+
 /**
  * @brief Returns a value corresponding to the type of EailWidget class
  */
@@ -86,6 +88,19 @@ typedef struct _EailWidget      EailWidget;
 /** @brief Definition of object class for Atk EailWidget*/
 typedef struct _EailWidgetClass EailWidgetClass;
 
+/** @brief Definition of cached internal sub-object of a widget*/
+typedef struct _EailSubobject EailSubobject;
+
+/**
+ * @brief Internal sub-object of a widget resolved once and kept until it is
+ * deleted or the widget drops one of its sub-objects
+ */
+struct _EailSubobject
+{
+   Evas_Object *widget;/**< @brief widget the sub-object belongs to */
+   Evas_Object *obj;/**< @brief cached sub-object, NULL if not resolved */
+};
+
 /** @brief Definition of object structure for Atk EailWidget*/
 struct _EailWidget
 {
@@ -93,6 +108,11 @@ struct _EailWidget
 
    Evas_Object *widget;/**< @brief Internal widget that is represented by EailWidget */
    AtkLayer layer;/**< @brief Describes layer of a component (eg. ATK_LAYER_WIDGET) */
+   guint64 states;/**< @brief EAIL_TRACKED_STATES of widget, updated from evas events */
+   Eina_List *clippers;/**< @brief objects watched for changes of SHOWING */
+   Evas_Object *state_edje;/**< @brief edje object emitting disabled, enabled and text signals, NULL if none */
+   guint instrumented;/**< @brief EailSubscription mask of enabled notifications */
+   EailAttributes *attributes;/**< @brief shared "type" attribute set, NULL until requested */
 };
 
 /** @brief Definition of object class for Atk EailWidget*/
@@ -102,6 +122,12 @@ struct _EailWidgetClass
 
    /** @brief callback definition for eail_widget_get_widget_children func*/
    Eina_List * (*get_widget_children)  (EailWidget *widget);
+
+   /** @brief callback definition for eail_widget_instrument func*/
+   void (*instrument) (EailWidget *widget, guint attach, guint detach);
+
+   /** @brief callback definition for eail_widget_ref_attributes func*/
+   EailAttributes * (*ref_attributes) (EailWidget *widget);
 };
 
 /**
@@ -112,6 +138,14 @@ struct _EailWidgetClass
 GType           eail_widget_get_type              (void);
 Evas_Object *   eail_widget_get_widget            (EailWidget *widget);
 Eina_List *     eail_widget_get_widget_children   (EailWidget *widget);
+void            eail_widget_instrument            (EailWidget *widget,
+                                                   guint subscriptions);
+EailAttributes *eail_widget_ref_attributes        (EailWidget *widget);
+void            eail_subobject_set                (EailSubobject *cache,
+                                                   Evas_Object *widget,
+                                                   Evas_Object *obj);
+void            eail_subobject_clear              (EailSubobject *cache);
+gint            eail_widget_get_callback_count    (void);
 
 #ifdef __cplusplus
 }
@@ -22,18 +22,24 @@
  * @brief EailWindow Implementation
  */
 
+#include <string.h>
+
 #include <Elementary.h>
 #include "eail_window.h"
 #include "eail_factory.h"
 #include "eail_utils.h"
+#include "eail_hit_grid.h"
 #include "eail_dynamic_content.h"
 #include "eail_priv.h"
 
-static void eail_window_actions_init(EailActionWidget *widget);
+static void eail_window_actions_init(EailActionWidgetClass *klass);
 static void atk_window_interface_init (AtkWindowIface *iface);
 static void atk_component_interface_init(AtkComponentIface *iface);
 static void eail_dynamic_content_interface_init(EailDynamicContentIface *iface);
 
+/** @brief Windows by their canvas, Evas to EailWindow */
+static GHashTable *eail_window_canvases = NULL;
+
 /**
  * @brief Focus signal name
  */
@@ -98,9 +104,28 @@ eail_window_on_move(void *data, Evas *e, Evas_Object *obj, void *event_info)
 {
    g_return_if_fail(ATK_IS_OBJECT(data));
 
+   EAIL_WINDOW(data)->screen_origin_valid = FALSE;
+
    eail_emit_atk_signal(ATK_OBJECT(data), "move", EAIL_TYPE_WINDOW);
 }
 
+/**
+ * @brief Handler for window moved on the screen
+ *
+ * @param data data passed to callback
+ * @param obj Evas_Object instance that raised event
+ * @param event_info additional event info
+ */
+static void
+_eail_window_handle_moved_event(void *data,
+                                Evas_Object *obj,
+                                void *event_info)
+{
+   g_return_if_fail(EAIL_IS_WINDOW(data));
+
+   EAIL_WINDOW(data)->screen_origin_valid = FALSE;
+}
+
 /**
  * @brief Deactivate event handler
  *
@@ -146,9 +171,116 @@ eail_window_on_resize(void *data, Evas *e, Evas_Object *obj, void *event_info)
 {
    g_return_if_fail(ATK_IS_OBJECT(data));
 
+   /* resizing from top or left edge moves window origin too */
+   EAIL_WINDOW(data)->screen_origin_valid = FALSE;
+
    eail_emit_atk_signal(ATK_OBJECT(data), "resize", EAIL_TYPE_WINDOW);
 }
 
+/**
+ * @brief Size hints change handler, resize objects of window changed
+ *
+ * @param data data passed to callback
+ * @param e Evas instance
+ * @param obj Evas_Object instance that raised event
+ * @param event_info additional event info
+ */
+static void
+_eail_window_on_size_hints_changed(void *data,
+                                   Evas *e,
+                                   Evas_Object *obj,
+                                   void *event_info)
+{
+   g_return_if_fail(EAIL_IS_WINDOW(data));
+
+   EAIL_WINDOW(data)->resizable = -1;
+}
+
+/**
+ * @brief Deletion handler for children whose weights RESIZABLE was read from
+ *
+ * @param data data passed to callback
+ * @param e Evas instance
+ * @param obj Evas_Object instance that raised event
+ * @param event_info additional event info
+ */
+static void
+_eail_window_on_weighted_child_del(void *data,
+                                   Evas *e,
+                                   Evas_Object *obj,
+                                   void *event_info)
+{
+   EailWindow *window = data;
+
+   window->weighted_children = eina_list_remove(window->weighted_children,
+                                                obj);
+   window->resizable = -1;
+}
+
+/**
+ * @brief Stops watching children whose weights RESIZABLE was read from
+ *
+ * @param window EailWindow instance
+ */
+static void
+_eail_window_weighted_children_release(EailWindow *window)
+{
+   Evas_Object *child;
+
+   EINA_LIST_FREE(window->weighted_children, child)
+     {
+        evas_object_event_callback_del_full(child,
+                                            EVAS_CALLBACK_CHANGED_SIZE_HINTS,
+                                            _eail_window_on_size_hints_changed,
+                                            window);
+        evas_object_event_callback_del_full(child, EVAS_CALLBACK_DEL,
+                                            _eail_window_on_weighted_child_del,
+                                            window);
+     }
+}
+
+/**
+ * @brief Computes RESIZABLE state from weights of window children
+ *
+ * Children are watched for size hints changes and deletion, so the result
+ * stays valid until a weight, min or max hint of the window or of one of
+ * its children changes, or children are added.
+ *
+ * @param window EailWindow instance
+ *
+ * @returns TRUE if all children expand in both directions
+ */
+static gboolean
+_eail_window_resizable_update(EailWindow *window)
+{
+   Eina_List *l, *children;
+   Evas_Object *child;
+   gboolean resizable = TRUE;
+   double x, y;
+
+   _eail_window_weighted_children_release(window);
+
+   children = eail_widget_get_widget_children(EAIL_WIDGET(window));
+   EINA_LIST_FOREACH(children, l, child)
+     {
+        evas_object_event_callback_add(child,
+                                       EVAS_CALLBACK_CHANGED_SIZE_HINTS,
+                                       _eail_window_on_size_hints_changed,
+                                       window);
+        evas_object_event_callback_add(child, EVAS_CALLBACK_DEL,
+                                       _eail_window_on_weighted_child_del,
+                                       window);
+
+        evas_object_size_hint_weight_get(child, &x, &y);
+        if (!float_equal(x, EVAS_HINT_EXPAND) ||
+            !float_equal(y, EVAS_HINT_EXPAND))
+          resizable = FALSE;
+     }
+   window->weighted_children = children;
+
+   return resizable;
+}
+
 /**
  * @brief Destroyed event handler for window
  *
@@ -159,6 +291,12 @@ eail_window_on_resize(void *data, Evas *e, Evas_Object *obj, void *event_info)
 void
 _eail_window_handle_delete_event(void *data, Evas *e, Evas_Object *obj, void *event_info)
 {
+   if (eail_window_canvases &&
+       g_hash_table_lookup(eail_window_canvases, e) == data)
+     g_hash_table_remove(eail_window_canvases, e);
+
+   _eail_window_weighted_children_release(EAIL_WINDOW(data));
+
    atk_object_notify_state_change(ATK_OBJECT(data), ATK_STATE_DEFUNCT, TRUE);
    eail_emit_atk_signal(ATK_OBJECT(data), "destroy", EAIL_TYPE_WINDOW);
    eail_factory_unregister_wdgt_from_cache(obj);
@@ -218,6 +356,8 @@ eail_window_init_focus_handler(AtkObject *obj)
                                   _eail_window_handle_restore_event, obj);
    evas_object_smart_callback_add(nested_widget, "normal",
                                   _eail_window_handle_restore_event, obj);
+   evas_object_smart_callback_add(nested_widget, "moved",
+                                  _eail_window_handle_moved_event, obj);
 
    /* evas object events (not smart callbacks) */
    evas_object_event_callback_add(nested_widget, EVAS_CALLBACK_RESIZE,
@@ -232,6 +372,9 @@ eail_window_init_focus_handler(AtkObject *obj)
                                   _eail_window_handle_delete_event, obj);
    evas_object_event_callback_add(nested_widget, EVAS_CALLBACK_SHOW,
                                   _eail_window_handle_create_event, obj);
+   evas_object_event_callback_add(nested_widget,
+                                  EVAS_CALLBACK_CHANGED_SIZE_HINTS,
+                                  _eail_window_on_size_hints_changed, obj);
 }
 
 /**
@@ -254,12 +397,203 @@ eail_window_initialize(AtkObject *obj, gpointer data)
    obj->accessible_parent = atk_get_root();
 
    eail_window_init_focus_handler(obj);
-   eail_window_actions_init(EAIL_ACTION_WIDGET(obj));
 
    eail_win = EAIL_WINDOW(obj);
    /* storing last numbers of children to be for checking if children-changed
     * signal has to be propagated */
    eail_win->child_count_last = atk_object_get_n_accessible_children(obj);
+
+   if (!eail_window_canvases)
+     eail_window_canvases = g_hash_table_new(g_direct_hash, g_direct_equal);
+   g_hash_table_insert(eail_window_canvases,
+                       evas_object_evas_get((Evas_Object *)data), obj);
+}
+
+/**
+ * Screen origin is cached on EailWindow owning the canvas of obj and
+ * refreshed after the window has been moved or resized.
+ *
+ * @param obj Evas_Object instance
+ * @param x location to store x coordinate of canvas origin on the screen
+ * @param y location to store y coordinate of canvas origin on the screen
+ */
+void
+eail_window_screen_origin_get(const Evas_Object *obj, gint *x, gint *y)
+{
+   EailWindow *window = NULL;
+   Evas *evas;
+   int ee_x = 0, ee_y = 0;
+
+   *x = *y = 0;
+   if (!obj) return;
+
+   evas = evas_object_evas_get(obj);
+   if (eail_window_canvases)
+     window = g_hash_table_lookup(eail_window_canvases, evas);
+
+   if (window && window->screen_origin_valid)
+     {
+        *x = window->screen_x;
+        *y = window->screen_y;
+        return;
+     }
+
+   ecore_evas_geometry_get(ecore_evas_ecore_evas_get(evas),
+                           &ee_x, &ee_y, NULL, NULL);
+   *x = ee_x;
+   *y = ee_y;
+
+   if (!window) return;
+
+   window->screen_x = ee_x;
+   window->screen_y = ee_y;
+   window->screen_origin_valid = TRUE;
+}
+
+/** @brief State of single geometry snapshot walk */
+typedef struct _EailGeometryWalk
+{
+   EailTreeWalk tree;/**< @brief shared walk state */
+   EailGeometryFunc func;/**< @brief callback receiving records */
+   gpointer user_data;/**< @brief data passed to func */
+   gint count;/**< @brief number of records emitted so far */
+   gint parent;/**< @brief index of record of currently walked parent */
+} EailGeometryWalk;
+
+static void _eail_window_snapshot_node(AtkObject *obj,
+                                       gint index,
+                                       gpointer user_data);
+
+/**
+ * @brief Emits record of accessible and walks its children
+ *
+ * @param obj AtkObject instance
+ * @param index index of obj among children of its parent, -1 for window
+ * @param user_data EailGeometryWalk instance
+ */
+static void
+_eail_window_snapshot_node(AtkObject *obj, gint index, gpointer user_data)
+{
+   EailGeometryWalk *walk = user_data;
+   EailGeometryRecord record;
+   EailObjectRecord object;
+   gint parent = walk->parent;
+
+   eail_tree_walk_fill(&walk->tree, obj, &object);
+
+   memset(&record, 0, sizeof(record));
+   record.id = (guint64)(gsize)obj;
+   record.index = walk->count;
+   record.parent = parent;
+   record.index_in_parent = index;
+   record.role = object.role;
+   record.states = object.states;
+   record.x = object.x;
+   record.y = object.y;
+   record.width = object.width;
+   record.height = object.height;
+
+   walk->parent = walk->count++;
+   walk->func(obj, &record, walk->user_data);
+
+   eail_tree_walk_children(&walk->tree, obj, _eail_window_snapshot_node, walk);
+   walk->parent = parent;
+}
+
+/**
+ * Records are reported in document order, window first. Screen origin is
+ * read once for the whole walk.
+ *
+ * @param window EailWindow instance
+ * @param coord_type specifies whether coordinates are relative to the
+ * screen or to the window
+ * @param func callback receiving records
+ * @param user_data data passed to func
+ *
+ * @returns number of reported records
+ */
+gint
+eail_window_snapshot_geometry(AtkObject *window,
+                              AtkCoordType coord_type,
+                              EailGeometryFunc func,
+                              gpointer user_data)
+{
+   EailGeometryWalk walk;
+
+   g_return_val_if_fail(EAIL_IS_WINDOW(window), 0);
+   g_return_val_if_fail(func, 0);
+
+   memset(&walk, 0, sizeof(walk));
+   eail_tree_walk_init(&walk.tree, coord_type);
+   walk.func = func;
+   walk.user_data = user_data;
+   walk.parent = -1;
+
+   _eail_window_snapshot_node(window, -1, &walk);
+
+   return walk.count;
+}
+
+/**
+ * @brief Appends geometry record to GArray
+ *
+ * @param obj accessible described by record
+ * @param record geometry record
+ * @param user_data GArray of EailGeometryRecord
+ */
+static void
+_eail_window_snapshot_append(AtkObject *obj,
+                             const EailGeometryRecord *record,
+                             gpointer user_data)
+{
+   g_array_append_val((GArray *)user_data, *record);
+}
+
+/**
+ * Blob starts with EailGeometrySnapshotHeader followed by the records in
+ * document order. Records are linked by index and parent; ids are object
+ * addresses and only meaningful in the calling process.
+ *
+ * @param window EailWindow instance
+ * @param coord_type specifies whether coordinates are relative to the
+ * screen or to the window
+ * @param size location to store blob size in bytes
+ *
+ * @returns newly allocated blob, use g_free() to free it, NULL on failure
+ */
+guint8 *
+eail_window_snapshot_geometry_blob(AtkObject *window,
+                                   AtkCoordType coord_type,
+                                   gsize *size)
+{
+   EailGeometrySnapshotHeader header;
+   GArray *records;
+   guint8 *blob;
+   gsize records_size;
+
+   g_return_val_if_fail(size, NULL);
+   *size = 0;
+   g_return_val_if_fail(EAIL_IS_WINDOW(window), NULL);
+
+   records = g_array_new(FALSE, FALSE, sizeof(EailGeometryRecord));
+   eail_window_snapshot_geometry(window, coord_type,
+                                 _eail_window_snapshot_append, records);
+
+   header.magic = EAIL_GEOMETRY_SNAPSHOT_MAGIC;
+   header.version = EAIL_GEOMETRY_SNAPSHOT_VERSION;
+   header.record_size = sizeof(EailGeometryRecord);
+   header.n_records = records->len;
+
+   records_size = records->len * sizeof(EailGeometryRecord);
+   *size = sizeof(header) + records_size;
+
+   blob = g_malloc(*size);
+   memcpy(blob, &header, sizeof(header));
+   memcpy(blob + sizeof(header), records->data, records_size);
+
+   g_array_free(records, TRUE);
+
+   return blob;
 }
 
 /**
@@ -364,11 +698,9 @@ eail_window_get_widget_children(EailWidget *widget)
 static AtkStateSet *
 eail_window_ref_state_set(AtkObject *obj)
 {
-   double x, y;
    AtkStateSet *state_set;
-   Eina_List *l, *children;
-   Eina_Bool resizable = EINA_TRUE;
-   Evas_Object *child, *widget = eail_widget_get_widget(EAIL_WIDGET(obj));
+   Evas_Object *widget = eail_widget_get_widget(EAIL_WIDGET(obj));
+   EailWindow *win = EAIL_WINDOW(obj);
 
    if (!widget) return NULL;
 
@@ -389,19 +721,11 @@ eail_window_ref_state_set(AtkObject *obj)
         atk_state_set_add_state(state_set, ATK_STATE_MODAL);
      }
 
-   children = eail_widget_get_widget_children(EAIL_WIDGET(obj));
-   EINA_LIST_FOREACH(children, l, child)
-     {
-        evas_object_size_hint_weight_get(child, &x, &y);
-        if (!float_equal(x, EVAS_HINT_EXPAND) || !float_equal(y, EVAS_HINT_EXPAND))
-          {
-             resizable = EINA_FALSE;
-             break;
-          }
-     }
-   eina_list_free(children);
+   /* children are scanned only after size hints or children changed */
+   if (win->resizable < 0)
+     win->resizable = _eail_window_resizable_update(win);
 
-   if (resizable)
+   if (win->resizable)
      {
         atk_state_set_add_state(state_set, ATK_STATE_RESIZABLE);
      }
@@ -450,6 +774,21 @@ eail_window_get_index_in_parent(AtkObject *obj)
 static void
 eail_window_init(EailWindow *window)
 {
+   window->resizable = -1;
+   window->weighted_children = NULL;
+}
+
+/**
+ * @brief Destructor for EailWindow object
+ *
+ * @param object GObject instance
+ */
+static void
+eail_window_finalize(GObject *object)
+{
+   _eail_window_weighted_children_release(EAIL_WINDOW(object));
+
+   G_OBJECT_CLASS(eail_window_parent_class)->finalize(object);
 }
 
 /**
@@ -462,12 +801,16 @@ eail_window_class_init(EailWindowClass *klass)
 {
    AtkObjectClass *atk_class = ATK_OBJECT_CLASS(klass);
    EailWidgetClass *widget_class = EAIL_WIDGET_CLASS(klass);
+   GObjectClass *g_object_class = G_OBJECT_CLASS(klass);
 
    widget_class->get_widget_children = eail_window_get_widget_children;
+   g_object_class->finalize = eail_window_finalize;
 
    atk_class->initialize = eail_window_initialize;
    atk_class->ref_state_set = eail_window_ref_state_set;
    atk_class->get_index_in_parent = eail_window_get_index_in_parent;
+
+   eail_window_actions_init(EAIL_ACTION_WIDGET_CLASS(klass));
 }
 
 /**
@@ -560,20 +903,20 @@ eail_action_restore(AtkAction *action, void *data)
 /**
  * @brief Adds window actions to the actions table
  *
- * @param action_widget widget that implements EailActionWidget interface
+ * @param klass EailActionWidgetClass instance
  */
 static void
-eail_window_actions_init(EailActionWidget *action_widget)
+eail_window_actions_init(EailActionWidgetClass *klass)
 {
-   eail_action_widget_action_append(action_widget,
-                                    EAIL_WIN_ACTION_MAXIMIZE, NULL,
-                                    eail_action_maximize);
-   eail_action_widget_action_append(action_widget,
-                                    EAIL_WIN_ACTION_MINIMIZE, NULL,
-                                    eail_action_minimize);
-   eail_action_widget_action_append(action_widget,
-                                    EAIL_WIN_ACTION_RESTORE, NULL,
-                                    eail_action_restore);
+   static const EailActionDesc eail_window_actions[] =
+     {
+        { EAIL_WIN_ACTION_MAXIMIZE, NULL, eail_action_maximize },
+        { EAIL_WIN_ACTION_MINIMIZE, NULL, eail_action_minimize },
+        { EAIL_WIN_ACTION_RESTORE, NULL, eail_action_restore },
+     };
+
+   eail_action_widget_class_add_actions(klass, eail_window_actions,
+                                        G_N_ELEMENTS(eail_window_actions));
 }
 
 /**
@@ -672,6 +1015,7 @@ eail_window_ref_accessible_at_point(AtkComponent *component,
    Evas_Object *widget = NULL, *evas_obj_at_coords = NULL;
    Evas *wdgt_evas = NULL;
    const char * found_obj_type = NULL;
+   AtkObject *found = NULL;
 
    widget = eail_widget_get_widget(EAIL_WIDGET(component));
 
@@ -679,13 +1023,16 @@ eail_window_ref_accessible_at_point(AtkComponent *component,
 
    if (coord_type == ATK_XY_SCREEN) {
            int ee_x, ee_y;
-           Ecore_Evas *ee= ecore_evas_ecore_evas_get(evas_object_evas_get(widget));
 
-           ecore_evas_geometry_get(ee, &ee_x, &ee_y, NULL, NULL);
+           eail_window_screen_origin_get(widget, &ee_x, &ee_y);
            x -= ee_x;
            y -= ee_y;
        }
 
+   /* deepest accessible known to the spatial index of window */
+   found = eail_hit_grid_lookup(widget, x, y);
+   if (found) return found;
+
    /* NOTE: it is crucial to get object from evas, NOT Evas_Object*/
    wdgt_evas = evas_object_evas_get(widget);
 
@@ -753,6 +1100,7 @@ eail_window_update_descendants(EailDynamicContent *dynamic_content_holder)
      }
 
    window->child_count_last = n_children;
+   window->resizable = -1;
 }
 
 /**
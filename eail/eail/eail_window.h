@@ -88,8 +88,70 @@ struct _EailWindow
 {
     EailActionWidget parent;/*!< @brief Parent widget whose functionality is being extended*/
     gint child_count_last;/**< @brief last reported count of children */
+    gint resizable;/**< @brief cached ATK_STATE_RESIZABLE, -1 if outdated */
+    Eina_List *weighted_children;/**< @brief children watched for size hints changes */
+    gboolean screen_origin_valid;/**< @brief whether screen_x and screen_y are up to date */
+    gint screen_x;/**< @brief cached x coordinate of window on the screen */
+    gint screen_y;/**< @brief cached y coordinate of window on the screen */
 };
 
+/** @brief Magic number opening geometry snapshot blob ("EAGS") */
+#define EAIL_GEOMETRY_SNAPSHOT_MAGIC 0x53474145
+
+/** @brief Version of geometry snapshot blob layout */
+#define EAIL_GEOMETRY_SNAPSHOT_VERSION 2
+
+/**
+ * @brief Geometry of single accessible in window snapshot
+ *
+ * Records are emitted in document order (parent before its children), so
+ * the tree can be rebuilt from parent indexes alone. Records are identified
+ * by their document-order index, which is valid for the snapshot they come
+ * from also outside the process taking it.
+ */
+typedef struct _EailGeometryRecord
+{
+    guint64 id;/**< @brief address of AtkObject, unique while object is
+                 alive and meaningful only in the process taking snapshot */
+    guint64 states;/**< @brief mask of EAIL_STATE_BIT values */
+    gint32 index;/**< @brief document-order index of record, 0 for window */
+    gint32 parent;/**< @brief index of parent record, -1 for window */
+    gint32 index_in_parent;/**< @brief index of accessible among children
+                             of its parent, -1 for window */
+    guint32 role;/**< @brief AtkRole of accessible */
+    gint32 x;/**< @brief x coordinate of accessible */
+    gint32 y;/**< @brief y coordinate of accessible */
+    gint32 width;/**< @brief width of accessible */
+    gint32 height;/**< @brief height of accessible */
+} EailGeometryRecord;
+
+/**
+ * @brief Header of geometry snapshot blob, followed by n_records
+ * EailGeometryRecord structures, all in host byte order
+ *
+ * Records refer to each other by index and parent, so the tree can be
+ * rebuilt from the blob alone; ids are object addresses, usable only by
+ * consumers in the process taking the snapshot.
+ */
+typedef struct _EailGeometrySnapshotHeader
+{
+    guint32 magic;/**< @brief EAIL_GEOMETRY_SNAPSHOT_MAGIC */
+    guint32 version;/**< @brief EAIL_GEOMETRY_SNAPSHOT_VERSION */
+    guint32 record_size;/**< @brief sizeof(EailGeometryRecord) */
+    guint32 n_records;/**< @brief number of records following header */
+} EailGeometrySnapshotHeader;
+
+/**
+ * @brief Callback receiving snapshot records
+ *
+ * @param obj accessible described by record (not referenced)
+ * @param record geometry record of obj
+ * @param user_data data passed to eail_window_snapshot_geometry
+ */
+typedef void (*EailGeometryFunc)(AtkObject *obj,
+                                 const EailGeometryRecord *record,
+                                 gpointer user_data);
+
 /** @brief Definition of object class for Atk EailWindow*/
 struct _EailWindowClass
 {
@@ -100,6 +162,28 @@ struct _EailWindowClass
  * @returns GType for EailWindow implementation*/
 GType   eail_window_get_type  (void);
 
+/**
+ * @brief Gets position on the screen of the canvas holding given object
+ */
+void eail_window_screen_origin_get(const Evas_Object *obj, gint *x, gint *y);
+
+/**
+ * @brief Walks accessible subtree of window once reporting geometry of every
+ * accessible
+ */
+gint eail_window_snapshot_geometry(AtkObject *window,
+                                   AtkCoordType coord_type,
+                                   EailGeometryFunc func,
+                                   gpointer user_data);
+
+/**
+ * @brief Gets geometry snapshot of window subtree as a binary blob for
+ * in-process consumers
+ */
+guint8 *eail_window_snapshot_geometry_blob(AtkObject *window,
+                                           AtkCoordType coord_type,
+                                           gsize *size);
+
 #ifdef __cplusplus
 }
 #endif
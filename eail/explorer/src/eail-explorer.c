@@ -37,10 +37,17 @@
 #include "eail-explorer-ui.h"
 #include "eail-browser.h"
 #include "eail-explorer-tr.h"
+#include "eail_window.h"
 
 #define ENV_EAIL_SERVER	 "EAIL_SERVER"
 
 #define DEFAULT_OPACITY 255
+#define SUBTREE_OPACITY 96
+
+/** @brief type of eail_window_snapshot_geometry_blob, resolved from eail module */
+typedef guint8 *(*geometry_blob_func)(AtkObject *window,
+                                      AtkCoordType coord_type,
+                                      gsize *size);
 
 static int _elm_init_count;
 
@@ -352,6 +359,101 @@ static Eina_Bool highlight_target(void *target)
 	return ECORE_CALLBACK_RENEW;
 }
 
+/**
+ * @brief adds fading highlight rectangle
+ *
+ * @param evas canvas of highlighted window
+ * @param x x coordinate relative to the window
+ * @param y y coordinate relative to the window
+ * @param w width of rectangle
+ * @param h height of rectangle
+ * @param opacity initial opacity of rectangle
+ */
+static void highlight_rect(Evas *evas, int x, int y, int w, int h, int opacity)
+{
+	Evas_Object *bg = evas_object_rectangle_add(evas);
+
+	evas_object_color_set(bg, 120 * opacity / 255, 120 * opacity / 255,
+			120 * opacity / 255, opacity);
+	evas_object_move(bg, x, y);
+	evas_object_resize(bg, w, h);
+	evas_object_show(bg);
+	ecore_animator_add(highlight_target, bg);
+}
+
+/**
+ * @brief highlights object and its whole subtree
+ *
+ * Extents of all accessibles under the window are taken from a single
+ * geometry snapshot blob instead of one extents query per object. The
+ * subtree of a record follows it in document order and ends with the first
+ * record whose parent precedes it.
+ *
+ * @param evas canvas of highlighted window
+ * @param atk_window window holding obj
+ * @param obj highlighted object
+ *
+ * @return EINA_TRUE if obj was highlighted, EINA_FALSE if the snapshot is
+ * not available
+ */
+static Eina_Bool highlight_subtree(Evas *evas, AtkObject *atk_window, AtkObject *obj)
+{
+	static geometry_blob_func geometry_blob = NULL;
+	EailGeometrySnapshotHeader header;
+	const EailGeometryRecord *records;
+	guint8 *blob;
+	gsize size;
+	guint32 i, target;
+
+	if(!geometry_blob)
+		geometry_blob = (geometry_blob_func)dlsym(RTLD_DEFAULT,
+				"eail_window_snapshot_geometry_blob");
+	if(!geometry_blob)
+		return EINA_FALSE;
+
+	blob = geometry_blob(atk_window, ATK_XY_WINDOW, &size);
+	if(!blob)
+		return EINA_FALSE;
+
+	memcpy(&header, blob, sizeof(header));
+	if(header.magic != EAIL_GEOMETRY_SNAPSHOT_MAGIC ||
+	   header.version != EAIL_GEOMETRY_SNAPSHOT_VERSION ||
+	   header.record_size != sizeof(EailGeometryRecord) ||
+	   size != sizeof(header) + header.n_records * sizeof(EailGeometryRecord))
+	{
+		g_free(blob);
+		return EINA_FALSE;
+	}
+
+	records = (const EailGeometryRecord *)(blob + sizeof(header));
+	for(target = 0; target < header.n_records; ++target)
+		if(records[target].id == (guint64)(gsize)obj)
+			break;
+
+	if(target == header.n_records)
+	{
+		g_free(blob);
+		return EINA_FALSE;
+	}
+
+	highlight_rect(evas, records[target].x, records[target].y,
+			records[target].width, records[target].height, DEFAULT_OPACITY);
+
+	for(i = target + 1; i < header.n_records; ++i)
+	{
+		if(records[i].parent < (gint32)target)
+			break;
+		if(records[i].width <= 0 || records[i].height <= 0)
+			continue;
+
+		highlight_rect(evas, records[i].x, records[i].y,
+				records[i].width, records[i].height, SUBTREE_OPACITY);
+	}
+
+	g_free(blob);
+	return EINA_TRUE;
+}
+
 /**
  * @brief check if given object is Eail Explorer
  *
@@ -441,17 +543,12 @@ void highlight_and_refresh(AtkObject *obj, Eina_Bool expand){
 			}
 		eina_list_free(ee_list);
 
-		if(evas){
-			Evas_Object *bg = evas_object_rectangle_add(evas);
+		if(evas && !highlight_subtree(evas, atk_window, obj)){
 			int x, y, w, h;
 			atk_component_get_position(ATK_COMPONENT(obj), &x, &y, ATK_XY_WINDOW);
 			atk_component_get_size(ATK_COMPONENT(obj), &w, &h);
 
-			evas_object_color_set(bg, 120, 120, 120, DEFAULT_OPACITY);
-			evas_object_move(bg, x, y);
-			evas_object_resize(bg, w, h);
-			evas_object_show(bg);
-			ecore_animator_add(highlight_target, bg);
+			highlight_rect(evas, x, y, w, h, DEFAULT_OPACITY);
 		}
 	}
 }
@@ -0,0 +1,196 @@
+/*
+ * Tested interface: AtkAction
+ *
+ * Tested AtkObject: EailButton, EailRadioButton, EailCheck, EailItem
+ *
+ * Description: Test that lookup of actions by name returns the index under
+ * which AtkAction reports the action, also for widgets implementing AtkAction
+ * on their own, and measure lookups by name against a scan of names
+ *
+ * Test input: accessible objects representing EailButton, EailRadioButton,
+ * EailCheck and EailItem of EailList
+ *
+ * Expected test result: test should return 0 (success)
+ */
+
+#include <Elementary.h>
+#include <atk/atk.h>
+#include <gmodule.h>
+
+#include "eail_test_utils.h"
+
+#define EAIL_TEST_LOOKUPS 100000
+
+typedef gint (*EailTestIndexFunc)(AtkAction *action, const gchar *name);
+
+/* eail_action_get_index resolved from the loaded module */
+static EailTestIndexFunc eail_test_action_index = NULL;
+
+/* used to determine if test code has been successfully called */
+static gboolean eail_test_code_called = FALSE;
+
+static void
+_on_done(void *data, Evas_Object *obj, void *event_info)
+{
+   elm_exit();
+}
+
+/* index of the first action with given name, as a client would find it */
+static gint
+_test_scan_index(AtkAction *action, const gchar *name)
+{
+   gint i, n = atk_action_get_n_actions(action);
+
+   for (i = 0; i < n; ++i)
+     {
+        if (!g_strcmp0(atk_action_get_name(action, i), name))
+          return i;
+     }
+
+   return -1;
+}
+
+static void
+_test_indexes(AtkObject *obj)
+{
+   AtkAction *action;
+   gint i, n;
+
+   g_assert(ATK_IS_ACTION(obj));
+   action = ATK_ACTION(obj);
+   n = atk_action_get_n_actions(action);
+   g_assert(n > 0);
+
+   _printf("%s: %d actions\n", G_OBJECT_TYPE_NAME(obj), n);
+
+   for (i = 0; i < n; ++i)
+     {
+        const gchar *name = atk_action_get_name(action, i);
+
+        g_assert(eail_test_action_index(action, name) ==
+                 _test_scan_index(action, name));
+     }
+
+   g_assert(eail_test_action_index(action, "no-such-action") == -1);
+   g_assert(eail_test_action_index(action, NULL) == -1);
+}
+
+static void
+_test_measure(AtkObject *obj)
+{
+   AtkAction *action = ATK_ACTION(obj);
+   gint n = atk_action_get_n_actions(action);
+   const gchar *name = atk_action_get_name(action, n - 1);
+   GTimer *timer;
+   gdouble by_name, by_scan;
+   guint i;
+
+   timer = g_timer_new();
+   for (i = 0; i < EAIL_TEST_LOOKUPS; ++i)
+     eail_test_action_index(action, name);
+   by_name = g_timer_elapsed(timer, NULL);
+
+   g_timer_start(timer);
+   for (i = 0; i < EAIL_TEST_LOOKUPS; ++i)
+     _test_scan_index(action, name);
+   by_scan = g_timer_elapsed(timer, NULL);
+
+   _printf("%s \"%s\": %f us by name, %f us by scan\n",
+           G_OBJECT_TYPE_NAME(obj), name,
+           by_name * G_USEC_PER_SEC / EAIL_TEST_LOOKUPS,
+           by_scan * G_USEC_PER_SEC / EAIL_TEST_LOOKUPS);
+
+   g_timer_destroy(timer);
+}
+
+static void
+_on_focus_in(void *data, Evas_Object *obj, void *event_info)
+{
+   static const char *names[] = { "button", "radio", "check" };
+   static gboolean started = FALSE;
+   GModule *module;
+   gpointer symbol = NULL;
+   AtkObject *aobj, *list, *item;
+   guint i;
+
+   if (started) return;
+   started = TRUE;
+
+   module = g_module_open(NULL, 0);
+   g_assert(module);
+   g_assert(g_module_symbol(module, "eail_action_get_index", &symbol));
+   eail_test_action_index = (EailTestIndexFunc)symbol;
+
+   _printf("Testing action lookup by name....\n");
+
+   for (i = 0; i < G_N_ELEMENTS(names); ++i)
+     {
+        aobj = eailu_find_child_with_name(atk_get_root(), (gchar *)names[i]);
+        g_assert(aobj);
+        _test_indexes(aobj);
+        _test_measure(aobj);
+     }
+
+   list = eailu_find_child_with_name(atk_get_root(), "list");
+   g_assert(list);
+   item = atk_object_ref_accessible_child(list, 0);
+   g_assert(item);
+   _test_indexes(item);
+   _test_measure(item);
+   g_object_unref(item);
+
+   g_module_close(module);
+
+   _printf("DONE. All action index tests passed successfully \n");
+   eail_test_code_called = TRUE;
+
+   g_assert(eail_test_code_called);
+   elm_exit();
+}
+
+EAPI_MAIN int
+elm_main(int argc, char **argv)
+{
+   Evas_Object *win, *box, *widget;
+
+   win = eailu_create_test_window_with_glib_init(_on_done, _on_focus_in);
+
+   box = elm_box_add(win);
+   evas_object_size_hint_weight_set(box, EVAS_HINT_EXPAND, EVAS_HINT_EXPAND);
+   elm_win_resize_object_add(win, box);
+   evas_object_show(box);
+
+   widget = elm_button_add(win);
+   elm_object_text_set(widget, "button");
+   elm_box_pack_end(box, widget);
+   evas_object_show(widget);
+
+   widget = elm_radio_add(win);
+   elm_object_text_set(widget, "radio");
+   elm_box_pack_end(box, widget);
+   evas_object_show(widget);
+
+   widget = elm_check_add(win);
+   elm_object_text_set(widget, "check");
+   elm_box_pack_end(box, widget);
+   evas_object_show(widget);
+
+   widget = elm_list_add(win);
+   evas_object_name_set(widget, "list");
+   evas_object_size_hint_weight_set(widget, EVAS_HINT_EXPAND,
+                                    EVAS_HINT_EXPAND);
+   evas_object_size_hint_align_set(widget, EVAS_HINT_FILL, EVAS_HINT_FILL);
+   elm_list_item_append(widget, "item", NULL, NULL, NULL, NULL);
+   elm_list_go(widget);
+   elm_box_pack_end(box, widget);
+   evas_object_show(widget);
+
+   evas_object_show(win);
+
+   elm_run();
+   elm_shutdown();
+
+   /* exit code */
+   return 0;
+}
+ELM_MAIN()
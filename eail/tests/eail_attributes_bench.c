@@ -0,0 +1,319 @@
+/*
+ * Tested interface: AtkObject, AtkText
+ *
+ * Tested AtkObject: EailButton, EailEntry, EailList, EailItem
+ *
+ * Description: Benchmark of attribute queries over a large tree. Counts
+ * memory allocations per atk_object_get_attributes call, which has to copy
+ * the set for the caller, and per read of the interned set shared by
+ * accessibles with the same attributes, as done by the tree snapshot
+ *
+ * Test input: window with 1000 buttons, a list of 100 items and an entry
+ * with formatted text
+ *
+ * Expected test result: reading shared sets does not allocate, distinct
+ * sets are far fewer than queried accessibles and text runs, test should
+ * return 0 (success)
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include <Elementary.h>
+#include <atk/atk.h>
+#include <gmodule.h>
+
+#include "eail_test_utils.h"
+
+#define EAIL_TEST_WIDGETS 1000
+#define EAIL_TEST_ITEMS 100
+#define EAIL_TEST_ROUNDS 20
+#define EAIL_TEST_MARKUP \
+   "plain <b>bold</b> <font_size=20>big</font_size> " \
+   "<color=#ff0000>red</color> <underline=on>under</underline> plain"
+
+typedef struct _EailAttributes EailAttributes;
+typedef EailAttributes *(*EailTestRefFunc)(gpointer obj);
+typedef void (*EailTestUnrefFunc)(EailAttributes *attrs);
+typedef guint (*EailTestNPairsFunc)(const EailAttributes *attrs);
+typedef const gchar *(*EailTestPairFunc)(const EailAttributes *attrs, guint i);
+typedef guint (*EailTestCountFunc)(void);
+
+/* eail symbols resolved at runtime */
+static EailTestRefFunc eail_test_widget_ref_attributes = NULL;
+static EailTestRefFunc eail_test_item_ref_attributes = NULL;
+static EailTestUnrefFunc eail_test_attributes_unref = NULL;
+static EailTestNPairsFunc eail_test_attributes_get_n_pairs = NULL;
+static EailTestPairFunc eail_test_attributes_get_name = NULL;
+static EailTestPairFunc eail_test_attributes_get_value = NULL;
+static EailTestCountFunc eail_test_attributes_get_count = NULL;
+
+/* calls done, attributes returned and allocations made by a walk */
+static guint eail_test_calls = 0;
+static guint eail_test_attributes = 0;
+static guint eail_test_shared_calls = 0;
+static guint eail_test_shared_attributes = 0;
+static guint eail_test_runs = 0;
+static volatile guint eail_test_allocs = 0;
+static volatile gboolean eail_test_counting = FALSE;
+
+/* used to determine if test code has been successfully called */
+static gboolean eail_test_code_called = FALSE;
+
+extern void *__libc_malloc(size_t size);
+extern void *__libc_calloc(size_t n, size_t size);
+extern void *__libc_realloc(void *ptr, size_t size);
+extern void __libc_free(void *ptr);
+
+/* allocator of the process is routed through the counters below */
+void *
+malloc(size_t size)
+{
+   if (eail_test_counting) eail_test_allocs++;
+   return __libc_malloc(size);
+}
+
+void *
+calloc(size_t n, size_t size)
+{
+   if (eail_test_counting) eail_test_allocs++;
+   return __libc_calloc(n, size);
+}
+
+void *
+realloc(void *ptr, size_t size)
+{
+   if (eail_test_counting) eail_test_allocs++;
+   return __libc_realloc(ptr, size);
+}
+
+void
+free(void *ptr)
+{
+   __libc_free(ptr);
+}
+
+static void
+_on_done(void *data, Evas_Object *obj, void *event_info)
+{
+   elm_exit();
+}
+
+/* copies attributes of obj the way AT-SPI bridge does */
+static void
+_test_copy_attributes(AtkObject *obj)
+{
+   AtkAttributeSet *set;
+
+   eail_test_counting = TRUE;
+   set = atk_object_get_attributes(obj);
+   eail_test_attributes += g_slist_length(set);
+   atk_attribute_set_free(set);
+   eail_test_counting = FALSE;
+
+   eail_test_calls++;
+}
+
+/* reads shared attribute set of obj in place */
+static void
+_test_read_attributes(AtkObject *obj)
+{
+   EailAttributes *attrs = NULL;
+   guint i;
+
+   eail_test_counting = TRUE;
+   if (G_TYPE_CHECK_INSTANCE_TYPE(obj, g_type_from_name("EailWidget")))
+     attrs = eail_test_widget_ref_attributes(obj);
+   else if (G_TYPE_CHECK_INSTANCE_TYPE(obj, g_type_from_name("EailItem")))
+     attrs = eail_test_item_ref_attributes(obj);
+
+   for (i = 0; i < eail_test_attributes_get_n_pairs(attrs); ++i)
+     {
+        g_assert(eail_test_attributes_get_name(attrs, i));
+        g_assert(eail_test_attributes_get_value(attrs, i));
+        eail_test_shared_attributes++;
+     }
+   if (attrs) eail_test_attributes_unref(attrs);
+   eail_test_counting = FALSE;
+
+   eail_test_shared_calls++;
+}
+
+/* walks every accessible, counting allocations of attribute reads only */
+static void
+_test_query_attributes(AtkObject *obj, gboolean shared)
+{
+   gint i, n = atk_object_get_n_accessible_children(obj);
+
+   if (shared)
+     _test_read_attributes(obj);
+   else
+     _test_copy_attributes(obj);
+
+   if (!shared && ATK_IS_TEXT(obj))
+     {
+        gint offset = 0, start, end;
+        gint count = atk_text_get_character_count(ATK_TEXT(obj));
+
+        while (offset < count)
+          {
+             atk_attribute_set_free
+                (atk_text_get_run_attributes(ATK_TEXT(obj), offset,
+                                             &start, &end));
+             eail_test_runs++;
+             offset = end > offset ? end : offset + 1;
+          }
+     }
+
+   for (i = 0; i < n; ++i)
+     {
+        AtkObject *child = atk_object_ref_accessible_child(obj, i);
+
+        if (!child) continue;
+
+        _test_query_attributes(child, shared);
+        g_object_unref(child);
+     }
+}
+
+static void
+_on_focus_in(void *data, Evas_Object *obj, void *event_info)
+{
+   static gboolean started = FALSE;
+   AtkObject *root = atk_get_root();
+   GModule *module;
+   gpointer symbol;
+   GTimer *timer;
+   guint copy_allocs, shared_allocs, n_sets;
+   gdouble copy_time;
+   glong rss;
+   guint i;
+
+   if (started) return;
+   started = TRUE;
+
+   g_assert(root);
+
+   module = g_module_open(NULL, 0);
+   g_assert(module);
+   g_assert(g_module_symbol(module, "eail_widget_ref_attributes", &symbol));
+   eail_test_widget_ref_attributes = (EailTestRefFunc)symbol;
+   g_assert(g_module_symbol(module, "eail_item_ref_attributes", &symbol));
+   eail_test_item_ref_attributes = (EailTestRefFunc)symbol;
+   g_assert(g_module_symbol(module, "eail_attributes_unref", &symbol));
+   eail_test_attributes_unref = (EailTestUnrefFunc)symbol;
+   g_assert(g_module_symbol(module, "eail_attributes_get_n_pairs", &symbol));
+   eail_test_attributes_get_n_pairs = (EailTestNPairsFunc)symbol;
+   g_assert(g_module_symbol(module, "eail_attributes_get_name", &symbol));
+   eail_test_attributes_get_name = (EailTestPairFunc)symbol;
+   g_assert(g_module_symbol(module, "eail_attributes_get_value", &symbol));
+   eail_test_attributes_get_value = (EailTestPairFunc)symbol;
+   g_assert(g_module_symbol(module, "eail_attributes_get_count", &symbol));
+   eail_test_attributes_get_count = (EailTestCountFunc)symbol;
+
+   _printf("Measuring attribute queries....\n");
+
+   /* first walk creates accessibles, interns their sets and parses runs */
+   _test_query_attributes(root, FALSE);
+   _test_query_attributes(root, TRUE);
+   n_sets = eail_test_attributes_get_count();
+   _printf("%u objects and %u text runs share %u attribute sets\n",
+           eail_test_calls, eail_test_runs, n_sets);
+   g_assert(n_sets > 0);
+   g_assert(n_sets * 10 < eail_test_calls + eail_test_runs);
+
+   eail_test_calls = eail_test_attributes = eail_test_allocs = 0;
+   rss = eailu_get_rss();
+
+   timer = g_timer_new();
+   for (i = 0; i < EAIL_TEST_ROUNDS; ++i)
+     _test_query_attributes(root, FALSE);
+   g_timer_stop(timer);
+   copy_time = g_timer_elapsed(timer, NULL);
+   copy_allocs = eail_test_allocs;
+
+   g_assert(eail_test_calls > (EAIL_TEST_WIDGETS + EAIL_TEST_ITEMS) *
+            EAIL_TEST_ROUNDS);
+   g_assert(eail_test_attributes >= eail_test_calls);
+
+   _printf("get_attributes: %u calls, %u attributes, %f us and %f "
+           "allocations per call\n", eail_test_calls, eail_test_attributes,
+           copy_time * G_USEC_PER_SEC / eail_test_calls,
+           (gdouble)copy_allocs / eail_test_calls);
+   _printf("resident memory growth: %ld kB\n", eailu_get_rss() - rss);
+
+   eail_test_shared_calls = eail_test_shared_attributes = 0;
+   eail_test_allocs = 0;
+
+   g_timer_start(timer);
+   for (i = 0; i < EAIL_TEST_ROUNDS; ++i)
+     _test_query_attributes(root, TRUE);
+   g_timer_stop(timer);
+   shared_allocs = eail_test_allocs;
+
+   g_assert(eail_test_shared_calls == eail_test_calls);
+   g_assert(eail_test_shared_attributes == eail_test_attributes);
+
+   _printf("shared sets: %u reads, %f us and %f allocations per read\n",
+           eail_test_shared_calls,
+           g_timer_elapsed(timer, NULL) * G_USEC_PER_SEC /
+           eail_test_shared_calls,
+           (gdouble)shared_allocs / eail_test_shared_calls);
+
+   /* ATK hands the set over to the caller, only the shared read is free */
+   g_assert(copy_allocs > 0);
+   g_assert_cmpuint(shared_allocs, ==, 0);
+
+   g_timer_destroy(timer);
+   g_module_close(module);
+
+   _printf("DONE. Attributes benchmark finished\n");
+   eail_test_code_called = TRUE;
+
+   g_assert(eail_test_code_called);
+   elm_exit();
+}
+
+EAPI_MAIN int
+elm_main(int argc, char **argv)
+{
+   Evas_Object *win, *box, *entry, *list;
+   guint i;
+
+   win = eailu_create_test_window_with_glib_init(_on_done, _on_focus_in);
+
+   box = elm_box_add(win);
+   evas_object_size_hint_weight_set(box, EVAS_HINT_EXPAND, EVAS_HINT_EXPAND);
+   elm_win_resize_object_add(win, box);
+   evas_object_show(box);
+
+   entry = elm_entry_add(win);
+   elm_object_text_set(entry, EAIL_TEST_MARKUP);
+   elm_box_pack_end(box, entry);
+   evas_object_show(entry);
+
+   list = elm_list_add(win);
+   for (i = 0; i < EAIL_TEST_ITEMS; ++i)
+     elm_list_item_append(list, "item", NULL, NULL, NULL, NULL);
+   elm_list_go(list);
+   elm_box_pack_end(box, list);
+   evas_object_show(list);
+
+   for (i = 0; i < EAIL_TEST_WIDGETS; ++i)
+     {
+        Evas_Object *button = elm_button_add(win);
+
+        elm_object_text_set(button, "button");
+        elm_box_pack_end(box, button);
+        evas_object_show(button);
+     }
+
+   evas_object_show(win);
+
+   elm_run();
+   elm_shutdown();
+
+   /* exit code */
+   return 0;
+}
+ELM_MAIN()
@@ -0,0 +1,131 @@
+/*
+ * Tested interface: AtkText
+ *
+ * Tested AtkObject: EailEntry
+ *
+ * Description: Test that run attributes of text with named style tags
+ * (<b>, <em>) are resolved through the style of the entry
+ *
+ * Test input: accessible object representing EailEntry
+ *
+ * Expected test result: test should return 0 (success)
+ */
+
+#include <Elementary.h>
+#include <atk/atk.h>
+
+#include "eail_test_utils.h"
+
+/* "plain " [0, 6), "bold" [6, 10), " plain " [10, 17), "slanted" [17, 24) */
+#define ENTRY_MARKUP "plain <b>bold</b> plain <em>slanted</em> end"
+
+INIT_TEST("EailEntry")
+
+static const gchar *
+_get_run_attribute(AtkObject *obj,
+                   gint offset,
+                   AtkTextAttribute attr,
+                   gint *start_offset,
+                   gint *end_offset)
+{
+   AtkAttributeSet *at_set, *elem;
+   const gchar *name = atk_text_attribute_get_name(attr);
+   const gchar *value = NULL;
+
+   at_set = atk_text_get_run_attributes(ATK_TEXT(obj), offset,
+                                        start_offset, end_offset);
+   g_assert(at_set);
+
+   for (elem = at_set; elem; elem = elem->next)
+     {
+        AtkAttribute *attribute = elem->data;
+
+        if (!g_strcmp0(attribute->name, name))
+          value = g_intern_string(attribute->value);
+     }
+
+   atk_attribute_set_free(at_set);
+
+   return value;
+}
+
+static void
+_do_test(AtkObject *obj)
+{
+   const gchar *value;
+   gint start_offset, end_offset;
+
+   g_assert(ATK_IS_TEXT(obj));
+
+   value = _get_run_attribute(obj, 2, ATK_TEXT_ATTR_WEIGHT,
+                              &start_offset, &end_offset);
+   g_assert(g_strcmp0(value, "700"));
+   g_assert(start_offset == 0);
+   g_assert(end_offset == 6);
+
+   value = _get_run_attribute(obj, 7, ATK_TEXT_ATTR_WEIGHT,
+                              &start_offset, &end_offset);
+   g_assert_cmpstr(value, ==, "700");
+   g_assert(start_offset == 6);
+   g_assert(end_offset == 10);
+
+   value = _get_run_attribute(obj, 12, ATK_TEXT_ATTR_WEIGHT,
+                              &start_offset, &end_offset);
+   g_assert(g_strcmp0(value, "700"));
+   g_assert(start_offset == 10);
+   g_assert(end_offset == 17);
+
+   /* default theme slants <em> with either of the styles */
+   value = _get_run_attribute(obj, 20, ATK_TEXT_ATTR_STYLE,
+                              &start_offset, &end_offset);
+   g_assert(value);
+   g_assert(g_strcmp0(value, atk_text_attribute_get_value
+                      (ATK_TEXT_ATTR_STYLE, 0)));
+   g_assert(start_offset == 17);
+   g_assert(end_offset == 24);
+
+   value = _get_run_attribute(obj, 25, ATK_TEXT_ATTR_STYLE,
+                              &start_offset, &end_offset);
+   g_assert(value == NULL || !g_strcmp0(value, atk_text_attribute_get_value
+                                        (ATK_TEXT_ATTR_STYLE, 0)));
+   g_assert(start_offset == 24);
+   g_assert(end_offset == atk_text_get_character_count(ATK_TEXT(obj)));
+
+   eailu_test_code_called = 1;
+}
+
+static void
+_init_entry(Evas_Object *win)
+{
+   Evas_Object *box, *en;
+
+   box = elm_box_add(win);
+   evas_object_size_hint_weight_set(box, EVAS_HINT_EXPAND, EVAS_HINT_EXPAND);
+   elm_win_resize_object_add(win, box);
+   evas_object_show(box);
+
+   en = elm_entry_add(win);
+   elm_entry_autosave_set(en, EINA_FALSE);
+   elm_entry_entry_set(en, ENTRY_MARKUP);
+   evas_object_size_hint_weight_set(en, EVAS_HINT_EXPAND, EVAS_HINT_EXPAND);
+   evas_object_size_hint_align_set(en, EVAS_HINT_FILL, EVAS_HINT_FILL);
+   elm_box_pack_end(box, en);
+   evas_object_show(en);
+
+   evas_object_resize(win, 200, 100);
+}
+
+EAPI_MAIN int
+elm_main(int argc, char *argv[])
+{
+   Evas_Object *win;
+
+   win = eailu_create_test_window_with_glib_init(_on_done, _on_focus_in);
+   _init_entry(win);
+   evas_object_show(win);
+   elm_run();
+   elm_shutdown();
+
+   return 0;
+}
+ELM_MAIN()
@@ -0,0 +1,173 @@
+/*
+ * Tested interface: AtkText
+ *
+ * Tested AtkObject: EailEntry
+ *
+ * Description: Test line boundaries after edits reported with "changed,user",
+ * both when "changed" comes before "changed,user" and when it comes after.
+ * Line index must be updated for the edits, not built again
+ *
+ * Test input: accessible object representing EailEntry
+ *
+ * Expected test result: test should return 0 (success)
+ */
+
+#include <Elementary.h>
+#include <atk/atk.h>
+#include <gmodule.h>
+
+#include "eail_test_utils.h"
+
+#define ENTRY_TEXT "alpha<br>beta<br>gamma"
+#define ENTRY_INSERT "new<br>"
+/* offset of "beta" in ENTRY_TEXT, where ENTRY_INSERT goes */
+#define ENTRY_INSERT_POS 6
+/* number of characters of ENTRY_INSERT */
+#define ENTRY_INSERT_LEN 4
+
+typedef guint (*EailTestBuildCountFunc)(void);
+
+static Evas_Object *glob_entry = NULL;
+static EailTestBuildCountFunc eail_test_build_count = NULL;
+
+INIT_TEST("EailEntry")
+
+static void
+_check_line(AtkObject *obj, gint offset, const gchar *expected)
+{
+   gchar *text;
+   gint start_offset, end_offset;
+
+   text = atk_text_get_text_at_offset(ATK_TEXT(obj), offset,
+                                      ATK_TEXT_BOUNDARY_LINE_START,
+                                      &start_offset, &end_offset);
+   g_assert_cmpstr(text, ==, expected);
+   g_assert(end_offset - start_offset == (gint)g_utf8_strlen(expected, -1));
+   g_free(text);
+}
+
+/* textblock is edited directly, "changed" comes before "changed,user" */
+static void
+_insert_changed_first(void)
+{
+   Evas_Object *textblock = elm_entry_textblock_get(glob_entry);
+   Evas_Textblock_Cursor *cur;
+   Elm_Entry_Change_Info info;
+
+   cur = evas_object_textblock_cursor_new(textblock);
+   evas_textblock_cursor_pos_set(cur, ENTRY_INSERT_POS);
+   evas_object_textblock_text_markup_prepend(cur, ENTRY_INSERT);
+   evas_textblock_cursor_free(cur);
+
+   evas_object_smart_callback_call(glob_entry, "changed", NULL);
+
+   memset(&info, 0, sizeof(info));
+   info.insert = EINA_TRUE;
+   info.change.insert.content = ENTRY_INSERT;
+   info.change.insert.pos = ENTRY_INSERT_POS;
+   info.change.insert.plain_length = ENTRY_INSERT_LEN;
+   evas_object_smart_callback_call(glob_entry, "changed,user", &info);
+}
+
+/* textblock is edited directly, "changed,user" comes before "changed" */
+static void
+_delete_changed_last(void)
+{
+   Evas_Object *textblock = elm_entry_textblock_get(glob_entry);
+   Evas_Textblock_Cursor *cur1, *cur2;
+   Elm_Entry_Change_Info info;
+
+   cur1 = evas_object_textblock_cursor_new(textblock);
+   cur2 = evas_object_textblock_cursor_new(textblock);
+   evas_textblock_cursor_pos_set(cur1, ENTRY_INSERT_POS);
+   evas_textblock_cursor_pos_set(cur2, ENTRY_INSERT_POS + ENTRY_INSERT_LEN);
+   evas_textblock_cursor_range_delete(cur1, cur2);
+   evas_textblock_cursor_free(cur1);
+   evas_textblock_cursor_free(cur2);
+
+   memset(&info, 0, sizeof(info));
+   info.insert = EINA_FALSE;
+   info.change.del.content = ENTRY_INSERT;
+   info.change.del.start = ENTRY_INSERT_POS;
+   info.change.del.end = ENTRY_INSERT_POS + ENTRY_INSERT_LEN;
+   evas_object_smart_callback_call(glob_entry, "changed,user", &info);
+   evas_object_smart_callback_call(glob_entry, "changed", NULL);
+}
+
+static void
+_do_test(AtkObject *obj)
+{
+   GModule *module;
+   gpointer symbol = NULL;
+   guint builds;
+
+   g_assert(ATK_IS_TEXT(obj));
+
+   module = g_module_open(NULL, 0);
+   g_assert(module);
+   g_assert(g_module_symbol(module, "eail_text_lines_get_build_count",
+                            &symbol));
+   eail_test_build_count = (EailTestBuildCountFunc)symbol;
+
+   /* builds line index before the edits */
+   _check_line(obj, 0, "alpha\n");
+   _check_line(obj, 7, "beta\n");
+   _check_line(obj, 12, "gamma");
+   builds = eail_test_build_count();
+
+   _insert_changed_first();
+   _check_line(obj, 0, "alpha\n");
+   _check_line(obj, 7, "new\n");
+   _check_line(obj, 11, "beta\n");
+   _check_line(obj, 16, "gamma");
+   g_assert_cmpuint(eail_test_build_count(), ==, builds);
+
+   _delete_changed_last();
+   _check_line(obj, 0, "alpha\n");
+   _check_line(obj, 7, "beta\n");
+   _check_line(obj, 12, "gamma");
+   g_assert_cmpuint(eail_test_build_count(), ==, builds);
+
+   g_module_close(module);
+
+   eailu_test_code_called = 1;
+}
+
+static void
+_init_entry(Evas_Object *win)
+{
+   Evas_Object *box;
+
+   box = elm_box_add(win);
+   evas_object_size_hint_weight_set(box, EVAS_HINT_EXPAND, EVAS_HINT_EXPAND);
+   elm_win_resize_object_add(win, box);
+   evas_object_show(box);
+
+   glob_entry = elm_entry_add(win);
+   elm_entry_autosave_set(glob_entry, EINA_FALSE);
+   elm_entry_line_wrap_set(glob_entry, ELM_WRAP_NONE);
+   elm_entry_entry_set(glob_entry, ENTRY_TEXT);
+   evas_object_size_hint_weight_set(glob_entry, EVAS_HINT_EXPAND,
+                                    EVAS_HINT_EXPAND);
+   evas_object_size_hint_align_set(glob_entry, EVAS_HINT_FILL,
+                                   EVAS_HINT_FILL);
+   elm_box_pack_end(box, glob_entry);
+   evas_object_show(glob_entry);
+
+   evas_object_resize(win, 300, 200);
+}
+
+EAPI_MAIN int
+elm_main(int argc, char *argv[])
+{
+   Evas_Object *win;
+
+   win = eailu_create_test_window_with_glib_init(_on_done, _on_focus_in);
+   _init_entry(win);
+   evas_object_show(win);
+   elm_run();
+   elm_shutdown();
+
+   return 0;
+}
+ELM_MAIN()
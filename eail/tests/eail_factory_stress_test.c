@@ -0,0 +1,215 @@
+/*
+ * Tested interface: eail_factory_ref_accessible
+ *
+ * Tested AtkObject: EailButton
+ *
+ * Description: Stress test of factory lookups from threads. Workers look
+ * accessibles up while the main loop creates them, then the same total
+ * number of lookups is timed with 1, 4 and 8 threads
+ *
+ * Test input: 2000 buttons
+ *
+ * Expected test result: every thread sees the accessible created by the
+ * main loop for each widget, test should return 0 (success)
+ */
+
+#include <Elementary.h>
+#include <atk/atk.h>
+#include <gmodule.h>
+
+#include "eail_test_utils.h"
+
+#define EAIL_TEST_THREADS 8
+#define EAIL_TEST_WIDGETS 2000
+#define EAIL_TEST_ROUNDS 56
+
+typedef AtkObject *(*EailTestRefFunc)(Evas_Object *widget);
+
+/* eail_factory_ref_accessible resolved from the loaded module */
+static EailTestRefFunc eail_test_ref_accessible = NULL;
+
+static Evas_Object *eail_test_widgets[EAIL_TEST_WIDGETS];
+
+/* accessibles created by the main loop */
+static AtkObject *eail_test_expected[EAIL_TEST_WIDGETS];
+
+/* first accessible seen by any worker for every widget */
+static gpointer eail_test_seen[EAIL_TEST_WIDGETS];
+
+/* set once the main loop created all accessibles */
+static volatile gint eail_test_created = 0;
+
+/* lookups that did not match accessible seen first */
+static volatile gint eail_test_mismatches = 0;
+
+/* used to determine if test code has been successfully called */
+static gboolean eail_test_code_called = FALSE;
+
+static void
+_on_done(void *data, Evas_Object *obj, void *event_info)
+{
+   elm_exit();
+}
+
+static void
+_test_lookup_all(void)
+{
+   guint i;
+
+   for (i = 0; i < EAIL_TEST_WIDGETS; ++i)
+     {
+        AtkObject *obj = eail_test_ref_accessible(eail_test_widgets[i]);
+
+        if (!obj) continue;
+
+        if (!g_atomic_pointer_compare_and_exchange(&eail_test_seen[i],
+                                                   NULL, obj) &&
+            g_atomic_pointer_get(&eail_test_seen[i]) != obj)
+          g_atomic_int_inc(&eail_test_mismatches);
+
+        g_object_unref(obj);
+     }
+}
+
+/* looks accessibles up while main loop keeps creating them */
+static gpointer
+_test_lookup_while_inserting(gpointer data)
+{
+   while (!g_atomic_int_get(&eail_test_created))
+     _test_lookup_all();
+
+   /* one more pass, now every widget has its accessible */
+   _test_lookup_all();
+
+   return NULL;
+}
+
+static gpointer
+_test_lookup_rounds(gpointer data)
+{
+   guint rounds = GPOINTER_TO_UINT(data);
+   guint i, j;
+
+   for (j = 0; j < rounds; ++j)
+     for (i = 0; i < EAIL_TEST_WIDGETS; ++i)
+       {
+          AtkObject *obj = eail_test_ref_accessible(eail_test_widgets[i]);
+
+          if (obj != eail_test_expected[i])
+            g_atomic_int_inc(&eail_test_mismatches);
+          if (obj)
+            g_object_unref(obj);
+       }
+
+   return NULL;
+}
+
+static void
+_test_insert_with_lookups(void)
+{
+   GThread *threads[EAIL_TEST_THREADS];
+   guint i;
+
+   for (i = 0; i < EAIL_TEST_THREADS; ++i)
+     threads[i] = g_thread_new("eail-test", _test_lookup_while_inserting,
+                               NULL);
+
+   for (i = 0; i < EAIL_TEST_WIDGETS; ++i)
+     {
+        eail_test_expected[i] = eail_test_ref_accessible(eail_test_widgets[i]);
+        g_assert(eail_test_expected[i]);
+        /* cache keeps accessible alive as long as the widget lives */
+        g_object_unref(eail_test_expected[i]);
+     }
+
+   g_atomic_int_set(&eail_test_created, 1);
+
+   for (i = 0; i < EAIL_TEST_THREADS; ++i)
+     g_thread_join(threads[i]);
+
+   g_assert(eail_test_mismatches == 0);
+   for (i = 0; i < EAIL_TEST_WIDGETS; ++i)
+     g_assert(eail_test_seen[i] == eail_test_expected[i]);
+}
+
+/* performs the same total number of lookups with n_workers */
+static void
+_test_lookups_with_threads(guint n_workers)
+{
+   GThread *threads[EAIL_TEST_THREADS];
+   GTimer *timer = g_timer_new();
+   guint total = EAIL_TEST_WIDGETS * EAIL_TEST_ROUNDS;
+   guint i;
+
+   for (i = 0; i < n_workers; ++i)
+     threads[i] = g_thread_new("eail-test", _test_lookup_rounds,
+                               GUINT_TO_POINTER(EAIL_TEST_ROUNDS / n_workers));
+
+   for (i = 0; i < n_workers; ++i)
+     g_thread_join(threads[i]);
+
+   g_assert(eail_test_mismatches == 0);
+
+   _printf("%u threads: %u lookups in %f s\n",
+           n_workers, total, g_timer_elapsed(timer, NULL));
+
+   g_timer_destroy(timer);
+}
+
+static void
+_on_focus_in(void *data, Evas_Object *obj, void *event_info)
+{
+   GModule *module;
+   gpointer symbol = NULL;
+
+   module = g_module_open(NULL, 0);
+   g_assert(module);
+   g_assert(g_module_symbol(module, "eail_factory_ref_accessible", &symbol));
+   eail_test_ref_accessible = (EailTestRefFunc)symbol;
+
+   _printf("Testing factory lookups from threads....\n");
+
+   _test_insert_with_lookups();
+
+   _test_lookups_with_threads(1);
+   _test_lookups_with_threads(EAIL_TEST_THREADS / 2);
+   _test_lookups_with_threads(EAIL_TEST_THREADS);
+
+   g_module_close(module);
+
+   _printf("DONE. All factory stress tests passed successfully \n");
+   eail_test_code_called = TRUE;
+
+   g_assert(eail_test_code_called);
+   elm_exit();
+}
+
+EAPI_MAIN int
+elm_main(int argc, char **argv)
+{
+   Evas_Object *win, *box;
+   guint i;
+
+   win = eailu_create_test_window_with_glib_init(_on_done, _on_focus_in);
+
+   box = elm_box_add(win);
+   evas_object_size_hint_weight_set(box, EVAS_HINT_EXPAND, EVAS_HINT_EXPAND);
+   elm_win_resize_object_add(win, box);
+   evas_object_show(box);
+
+   for (i = 0; i < EAIL_TEST_WIDGETS; ++i)
+     {
+        eail_test_widgets[i] = elm_button_add(win);
+        elm_object_text_set(eail_test_widgets[i], "button");
+        elm_box_pack_end(box, eail_test_widgets[i]);
+     }
+
+   evas_object_show(win);
+
+   elm_run();
+   elm_shutdown();
+
+   /* exit code */
+   return 0;
+}
+ELM_MAIN()
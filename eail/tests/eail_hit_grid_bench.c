@@ -0,0 +1,183 @@
+/*
+ * Tested interface: AtkComponent
+ *
+ * Tested AtkObject: EailWindow
+ *
+ * Description: Measure ref_accessible_at_point of a window holding 1000
+ * widgets, check that found accessibles cover the point and that the
+ * spatial index releases its geometry subscription once it is not used
+ *
+ * Test input: accessible object representing EailWindow
+ *
+ * Expected test result: test should return 0 (success)
+ */
+
+#include <Elementary.h>
+#include <atk/atk.h>
+#include <gmodule.h>
+
+#include "eail_test_utils.h"
+
+#define EAIL_TEST_COLUMNS 40
+#define EAIL_TEST_ROWS 25
+#define EAIL_TEST_CELL 20
+#define EAIL_TEST_LOOKUPS 100000
+/* longer than twice the idle time of spatial index */
+#define EAIL_TEST_IDLE_WAIT 5.0
+
+typedef guint (*EailTestSubscriptionFunc)(void);
+
+/* eail_subscription_get resolved from the loaded module */
+static EailTestSubscriptionFunc eail_test_subscription_get = NULL;
+
+/* subscriptions applied before the first lookup */
+static guint eail_test_subscriptions = 0;
+
+static Evas_Object *glob_win = NULL;
+static Evas_Object *glob_buttons[EAIL_TEST_COLUMNS * EAIL_TEST_ROWS];
+
+/* used to determine if test code has been successfully called */
+static gboolean eail_test_code_called = FALSE;
+
+static void
+_on_done(void *data, Evas_Object *obj, void *event_info)
+{
+   elm_exit();
+}
+
+static AtkObject *
+_test_lookup(AtkComponent *window, gint x, gint y)
+{
+   AtkObject *found;
+
+   found = atk_component_ref_accessible_at_point(window, x, y,
+                                                 ATK_XY_WINDOW);
+   if (found) g_object_unref(found);
+
+   return found;
+}
+
+/* accessible found at the center of every button is that button */
+static void
+_test_hits(AtkComponent *window)
+{
+   Evas_Coord x, y, w, h;
+   guint i;
+
+   for (i = 0; i < G_N_ELEMENTS(glob_buttons); ++i)
+     {
+        AtkObject *found;
+        gchar *name;
+
+        evas_object_geometry_get(glob_buttons[i], &x, &y, &w, &h);
+        found = _test_lookup(window, x + w / 2, y + h / 2);
+        g_assert(found);
+
+        name = g_strdup_printf("%u", i);
+        g_assert_cmpstr(atk_object_get_name(found), ==, name);
+        g_free(name);
+     }
+}
+
+static Eina_Bool
+_test_check_released(void *data)
+{
+   g_assert(eail_test_subscription_get() == eail_test_subscriptions);
+
+   _printf("DONE. Hit grid benchmark finished\n");
+   eail_test_code_called = TRUE;
+
+   g_assert(eail_test_code_called);
+   elm_exit();
+
+   return ECORE_CALLBACK_CANCEL;
+}
+
+static void
+_on_focus_in(void *data, Evas_Object *obj, void *event_info)
+{
+   static gboolean started = FALSE;
+   AtkObject *window;
+   GModule *module;
+   gpointer symbol = NULL;
+   GTimer *timer;
+   Evas_Coord w, h;
+   guint i;
+
+   if (started) return;
+   started = TRUE;
+
+   module = g_module_open(NULL, 0);
+   g_assert(module);
+   g_assert(g_module_symbol(module, "eail_subscription_get", &symbol));
+   eail_test_subscription_get = (EailTestSubscriptionFunc)symbol;
+   g_module_close(module);
+
+   window = atk_object_ref_accessible_child(atk_get_root(), 0);
+   g_assert(ATK_IS_COMPONENT(window));
+
+   _printf("Measuring lookups at point....\n");
+   eail_test_subscriptions = eail_test_subscription_get();
+
+   /* first lookup indexes all widgets */
+   timer = g_timer_new();
+   _test_lookup(ATK_COMPONENT(window), 0, 0);
+   _printf("first lookup: %f s\n", g_timer_elapsed(timer, NULL));
+
+   _test_hits(ATK_COMPONENT(window));
+
+   evas_object_geometry_get(glob_win, NULL, NULL, &w, &h);
+   g_random_set_seed(0);
+   g_timer_start(timer);
+   for (i = 0; i < EAIL_TEST_LOOKUPS; ++i)
+     _test_lookup(ATK_COMPONENT(window), g_random_int_range(0, w),
+                  g_random_int_range(0, h));
+   _printf("%d widgets: %f us per lookup\n", (int)G_N_ELEMENTS(glob_buttons),
+           g_timer_elapsed(timer, NULL) * G_USEC_PER_SEC / EAIL_TEST_LOOKUPS);
+   g_timer_destroy(timer);
+   g_object_unref(window);
+
+   ecore_timer_add(EAIL_TEST_IDLE_WAIT, _test_check_released, NULL);
+}
+
+EAPI_MAIN int
+elm_main(int argc, char **argv)
+{
+   Evas_Object *table;
+   guint i;
+
+   glob_win = eailu_create_test_window_with_glib_init(_on_done, _on_focus_in);
+
+   table = elm_table_add(glob_win);
+   evas_object_size_hint_weight_set(table, EVAS_HINT_EXPAND, EVAS_HINT_EXPAND);
+   elm_table_homogeneous_set(table, EINA_TRUE);
+   elm_win_resize_object_add(glob_win, table);
+   evas_object_show(table);
+
+   for (i = 0; i < G_N_ELEMENTS(glob_buttons); ++i)
+     {
+        gchar *label = g_strdup_printf("%u", i);
+
+        glob_buttons[i] = elm_button_add(glob_win);
+        elm_object_text_set(glob_buttons[i], label);
+        evas_object_size_hint_weight_set(glob_buttons[i], EVAS_HINT_EXPAND,
+                                         EVAS_HINT_EXPAND);
+        evas_object_size_hint_align_set(glob_buttons[i], EVAS_HINT_FILL,
+                                        EVAS_HINT_FILL);
+        elm_table_pack(table, glob_buttons[i], i % EAIL_TEST_COLUMNS,
+                       i / EAIL_TEST_COLUMNS, 1, 1);
+        evas_object_show(glob_buttons[i]);
+        g_free(label);
+     }
+
+   evas_object_resize(glob_win, EAIL_TEST_COLUMNS * EAIL_TEST_CELL * 2,
+                      EAIL_TEST_ROWS * EAIL_TEST_CELL * 2);
+   evas_object_show(glob_win);
+
+   elm_run();
+   elm_shutdown();
+
+   /* exit code */
+   return 0;
+}
+ELM_MAIN()
@@ -0,0 +1,281 @@
+/*
+ * Tested interface: eail_input_script
+ *
+ * Tested AtkObject: none (evas objects of test window)
+ *
+ * Description: Test that scripted input feeds batches without delay right
+ * away and delayed events at their time with matching timestamps, feeds
+ * keys, and stops when its target is deleted. Measure a click fed directly
+ * and through a script.
+ *
+ * Test input: rectangles on canvas of test window
+ *
+ * Expected test result: test should return 0 (success)
+ */
+
+#include <Elementary.h>
+#include <atk/atk.h>
+#include <gmodule.h>
+
+#include "eail_test_utils.h"
+
+#define EAIL_TEST_DELAY 300
+#define EAIL_TEST_SIZE 100
+#define EAIL_TEST_CLICKS 10000
+
+typedef struct _EailInputScript EailInputScript;
+
+typedef EailInputScript *(*EailTestNewFunc)(Evas_Object *target);
+typedef void (*EailTestPointerFunc)(EailInputScript *script, guint delay,
+                                    gint x, gint y);
+typedef void (*EailTestButtonFunc)(EailInputScript *script, guint delay,
+                                   gint button);
+typedef void (*EailTestKeyFunc)(EailInputScript *script, guint delay,
+                                const gchar *keyname);
+typedef void (*EailTestRunFunc)(EailInputScript *script);
+typedef void (*EailTestClickFunc)(Evas_Object *widget, int x, int y);
+
+static EailTestNewFunc eail_test_script_new = NULL;
+static EailTestPointerFunc eail_test_script_move = NULL;
+static EailTestButtonFunc eail_test_script_press = NULL;
+static EailTestButtonFunc eail_test_script_release = NULL;
+static EailTestKeyFunc eail_test_script_key = NULL;
+static EailTestRunFunc eail_test_script_run = NULL;
+static EailTestClickFunc eail_test_mouse_click = NULL;
+
+/* rectangle receiving all pointer and key events */
+static Evas_Object *glob_catcher = NULL;
+
+/* received events and their timestamps */
+static guint eail_test_downs = 0;
+static guint eail_test_ups = 0;
+static unsigned int eail_test_down_time = 0;
+static unsigned int eail_test_up_time = 0;
+static gdouble eail_test_down_loop_time = 0.0;
+static gdouble eail_test_up_loop_time = 0.0;
+static gchar *eail_test_key = NULL;
+
+/* used to determine if test code has been successfully called */
+static gboolean eail_test_code_called = FALSE;
+
+static void
+_on_done(void *data, Evas_Object *obj, void *event_info)
+{
+   elm_exit();
+}
+
+static void
+_on_mouse_down(void *data, Evas *e, Evas_Object *obj, void *event_info)
+{
+   Evas_Event_Mouse_Down *ev = event_info;
+
+   eail_test_downs++;
+   eail_test_down_time = ev->timestamp;
+   eail_test_down_loop_time = ecore_time_get();
+}
+
+static void
+_on_mouse_up(void *data, Evas *e, Evas_Object *obj, void *event_info)
+{
+   Evas_Event_Mouse_Up *ev = event_info;
+
+   eail_test_ups++;
+   eail_test_up_time = ev->timestamp;
+   eail_test_up_loop_time = ecore_time_get();
+}
+
+static void
+_on_key_down(void *data, Evas *e, Evas_Object *obj, void *event_info)
+{
+   Evas_Event_Key_Down *ev = event_info;
+
+   g_free(eail_test_key);
+   eail_test_key = g_strdup(ev->keyname);
+}
+
+static void
+_test_resolve(void)
+{
+   GModule *module = g_module_open(NULL, 0);
+   gpointer symbol = NULL;
+
+   g_assert(module);
+   g_assert(g_module_symbol(module, "eail_input_script_new", &symbol));
+   eail_test_script_new = (EailTestNewFunc)symbol;
+   g_assert(g_module_symbol(module, "eail_input_script_move", &symbol));
+   eail_test_script_move = (EailTestPointerFunc)symbol;
+   g_assert(g_module_symbol(module, "eail_input_script_press", &symbol));
+   eail_test_script_press = (EailTestButtonFunc)symbol;
+   g_assert(g_module_symbol(module, "eail_input_script_release", &symbol));
+   eail_test_script_release = (EailTestButtonFunc)symbol;
+   g_assert(g_module_symbol(module, "eail_input_script_key", &symbol));
+   eail_test_script_key = (EailTestKeyFunc)symbol;
+   g_assert(g_module_symbol(module, "eail_input_script_run", &symbol));
+   eail_test_script_run = (EailTestRunFunc)symbol;
+   g_assert(g_module_symbol(module, "eail_mouse_click_on_coords", &symbol));
+   eail_test_mouse_click = (EailTestClickFunc)symbol;
+   g_module_close(module);
+}
+
+static Eina_Bool
+_test_check_deleted_target(void *data)
+{
+   /* release queued after deleted target is never fed */
+   g_assert(eail_test_downs == 1 && eail_test_ups == 0);
+   evas_event_feed_mouse_up(evas_object_evas_get(glob_catcher), 1,
+                            EVAS_BUTTON_NONE, 0, NULL);
+
+   _printf("DONE. All input script tests passed successfully \n");
+   eail_test_code_called = TRUE;
+
+   g_assert(eail_test_code_called);
+   elm_exit();
+
+   return ECORE_CALLBACK_CANCEL;
+}
+
+static void
+_test_deleted_target(void)
+{
+   Evas_Object *target;
+   EailInputScript *script;
+
+   target = evas_object_rectangle_add(evas_object_evas_get(glob_catcher));
+   script = eail_test_script_new(target);
+
+   eail_test_downs = eail_test_ups = 0;
+   eail_test_script_move(script, 0, EAIL_TEST_SIZE / 2, EAIL_TEST_SIZE / 2);
+   eail_test_script_press(script, 0, 1);
+   eail_test_script_release(script, EAIL_TEST_DELAY, 1);
+   eail_test_script_run(script);
+   g_assert(eail_test_downs == 1);
+
+   evas_object_del(target);
+
+   ecore_timer_add(2 * EAIL_TEST_DELAY / 1000.0, _test_check_deleted_target,
+                   NULL);
+}
+
+static Eina_Bool
+_test_check_timing(void *data)
+{
+   gdouble elapsed;
+
+   g_assert(eail_test_ups == 1);
+
+   /* timestamps advance by the queued delay exactly */
+   g_assert(eail_test_up_time - eail_test_down_time == EAIL_TEST_DELAY);
+
+   /* release was fed from the main loop, not before its delay */
+   elapsed = eail_test_up_loop_time - eail_test_down_loop_time;
+   _printf("release fed after %f s\n", elapsed);
+   g_assert(elapsed >= EAIL_TEST_DELAY / 1000.0 - 0.01);
+
+   g_assert_cmpstr(eail_test_key, ==, "Return");
+
+   _test_deleted_target();
+
+   return ECORE_CALLBACK_CANCEL;
+}
+
+static void
+_test_timing(void)
+{
+   EailInputScript *script = eail_test_script_new(glob_catcher);
+
+   eail_test_downs = eail_test_ups = 0;
+   eail_test_script_move(script, 0, EAIL_TEST_SIZE / 2, EAIL_TEST_SIZE / 2);
+   eail_test_script_press(script, 0, 1);
+   eail_test_script_release(script, EAIL_TEST_DELAY, 1);
+   eail_test_script_key(script, EAIL_TEST_DELAY, "Return");
+   eail_test_script_run(script);
+
+   /* batch without delay is fed before run returns */
+   g_assert(eail_test_downs == 1 && eail_test_ups == 0);
+
+   ecore_timer_add(3 * EAIL_TEST_DELAY / 1000.0, _test_check_timing, NULL);
+}
+
+static void
+_test_measure(void)
+{
+   GTimer *timer = g_timer_new();
+   gdouble direct;
+   guint i;
+
+   for (i = 0; i < EAIL_TEST_CLICKS; ++i)
+     eail_test_mouse_click(glob_catcher, EAIL_TEST_SIZE / 2,
+                           EAIL_TEST_SIZE / 2);
+   direct = g_timer_elapsed(timer, NULL);
+
+   g_timer_start(timer);
+   for (i = 0; i < EAIL_TEST_CLICKS; ++i)
+     {
+        EailInputScript *script = eail_test_script_new(glob_catcher);
+
+        eail_test_script_move(script, 0, EAIL_TEST_SIZE / 2,
+                              EAIL_TEST_SIZE / 2);
+        eail_test_script_press(script, 0, 1);
+        eail_test_script_release(script, 0, 1);
+        eail_test_script_run(script);
+     }
+
+   _printf("click: %f us fed directly, %f us through script\n",
+           direct * G_USEC_PER_SEC / EAIL_TEST_CLICKS,
+           g_timer_elapsed(timer, NULL) * G_USEC_PER_SEC / EAIL_TEST_CLICKS);
+
+   g_assert(eail_test_downs == 2 * EAIL_TEST_CLICKS);
+   g_assert(eail_test_ups == 2 * EAIL_TEST_CLICKS);
+
+   g_timer_destroy(timer);
+}
+
+static void
+_on_focus_in(void *data, Evas_Object *obj, void *event_info)
+{
+   static gboolean started = FALSE;
+
+   if (started) return;
+   started = TRUE;
+
+   _test_resolve();
+
+   _printf("Testing input scripts....\n");
+
+   evas_object_focus_set(glob_catcher, EINA_TRUE);
+
+   _test_measure();
+   _test_timing();
+}
+
+EAPI_MAIN int
+elm_main(int argc, char **argv)
+{
+   Evas_Object *win;
+
+   win = eailu_create_test_window_with_glib_init(_on_done, _on_focus_in);
+
+   glob_catcher = evas_object_rectangle_add(evas_object_evas_get(win));
+   evas_object_move(glob_catcher, 0, 0);
+   evas_object_resize(glob_catcher, EAIL_TEST_SIZE, EAIL_TEST_SIZE);
+   evas_object_layer_set(glob_catcher, EVAS_LAYER_MAX);
+   evas_object_show(glob_catcher);
+
+   evas_object_event_callback_add(glob_catcher, EVAS_CALLBACK_MOUSE_DOWN,
+                                  _on_mouse_down, NULL);
+   evas_object_event_callback_add(glob_catcher, EVAS_CALLBACK_MOUSE_UP,
+                                  _on_mouse_up, NULL);
+   evas_object_event_callback_add(glob_catcher, EVAS_CALLBACK_KEY_DOWN,
+                                  _on_key_down, NULL);
+
+   evas_object_show(win);
+
+   elm_run();
+   elm_shutdown();
+
+   g_free(eail_test_key);
+
+   /* exit code */
+   return 0;
+}
+ELM_MAIN()
@@ -0,0 +1,225 @@
+/*
+ * Tested interface: AtkObject
+ *
+ * Tested AtkObject: EailButton, EailEntry
+ *
+ * Description: Benchmark of accessible creation over a large window, run in
+ * child processes without global event listeners and with listeners of
+ * state, bounds and caret events. Compares creation time, resident memory
+ * growth and number of callbacks accessibles attach to widgets
+ *
+ * Test input: window with 800 buttons and 200 entries
+ *
+ * Expected test result: accessibles of the whole tree are created in every
+ * run, test should return 0 (success)
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include <Elementary.h>
+#include <atk/atk.h>
+#include <gmodule.h>
+
+#include "eail_test_utils.h"
+
+#define EAIL_TEST_CHILD_ARG "--child"
+#define EAIL_TEST_RESULT "RESULT"
+#define EAIL_TEST_RUNS 3
+#define EAIL_TEST_BUTTONS 800
+#define EAIL_TEST_ENTRIES 200
+#define EAIL_TEST_WINDOW_TITLE "Eail instrumentation benchmark"
+#define EAIL_TEST_WINDOW_SIZE 400
+
+/* listener modes compared, child adds listeners in "listeners" mode */
+static const char * const eail_test_modes[] = { "none", "listeners" };
+
+/* events making accessibles emit notifications from widget callbacks */
+static const char * const eail_test_events[] = {
+   "Atk:AtkObject:state-change",
+   "Atk:AtkComponent:bounds-changed",
+   "Atk:AtkText:text-caret-moved"
+};
+
+static gboolean
+_test_hook(GSignalInvocationHint *ihint,
+           guint n_param_values,
+           const GValue *param_values,
+           gpointer data)
+{
+   return TRUE;
+}
+
+/* creates accessibles of the whole tree, keeping them referenced */
+static void
+_test_create_accessibles(AtkObject *obj, GPtrArray *refs)
+{
+   gint i, n = atk_object_get_n_accessible_children(obj);
+
+   for (i = 0; i < n; ++i)
+     {
+        AtkObject *child = atk_object_ref_accessible_child(obj, i);
+
+        if (!child) continue;
+
+        g_ptr_array_add(refs, child);
+        _test_create_accessibles(child, refs);
+     }
+}
+
+/* number of callbacks attached by accessibles, from the loaded module */
+static gint
+_test_callbacks_get(void)
+{
+   GModule *module = g_module_open(NULL, 0);
+   gpointer symbol = NULL;
+   gint count;
+
+   g_assert(module);
+   g_assert(g_module_symbol(module, "eail_widget_get_callback_count",
+                            &symbol));
+   count = ((gint (*)(void))symbol)();
+   g_module_close(module);
+
+   return count;
+}
+
+static Eina_Bool
+_on_shown(void *data)
+{
+   GPtrArray *refs = g_ptr_array_new_with_free_func(g_object_unref);
+   glong rss = eailu_get_rss();
+   gint64 start = g_get_monotonic_time();
+
+   _test_create_accessibles(atk_get_root(), refs);
+
+   printf("%s %u %f %ld %d\n", EAIL_TEST_RESULT, refs->len,
+          (g_get_monotonic_time() - start) / (gdouble)G_USEC_PER_SEC,
+          eailu_get_rss() - rss, _test_callbacks_get());
+
+   g_ptr_array_free(refs, TRUE);
+   elm_exit();
+
+   return ECORE_CALLBACK_CANCEL;
+}
+
+/* builds a large window and measures creation of its accessibles */
+static int
+_run_child(const char *mode)
+{
+   Evas_Object *win, *box, *widget;
+   guint i;
+
+   if (!ecore_main_loop_glib_integrate())
+     return 1;
+
+   if (!strcmp(mode, "listeners"))
+     for (i = 0; i < G_N_ELEMENTS(eail_test_events); ++i)
+       atk_add_global_event_listener(_test_hook, eail_test_events[i]);
+
+   win = elm_win_add(NULL, EAIL_TEST_WINDOW_TITLE, ELM_WIN_BASIC);
+   box = elm_box_add(win);
+   evas_object_size_hint_weight_set(box, EVAS_HINT_EXPAND, EVAS_HINT_EXPAND);
+   elm_win_resize_object_add(win, box);
+   evas_object_show(box);
+
+   for (i = 0; i < EAIL_TEST_BUTTONS; ++i)
+     {
+        widget = elm_button_add(win);
+        elm_object_text_set(widget, "button");
+        elm_box_pack_end(box, widget);
+        evas_object_show(widget);
+     }
+
+   for (i = 0; i < EAIL_TEST_ENTRIES; ++i)
+     {
+        widget = elm_entry_add(win);
+        elm_entry_single_line_set(widget, EINA_TRUE);
+        elm_object_text_set(widget, "entry");
+        elm_box_pack_end(box, widget);
+        evas_object_show(widget);
+     }
+
+   evas_object_resize(win, EAIL_TEST_WINDOW_SIZE, EAIL_TEST_WINDOW_SIZE);
+   evas_object_show(win);
+
+   ecore_idler_add(_on_shown, NULL);
+   elm_run();
+
+   return 0;
+}
+
+/* runs child in given mode, printing mean creation time, memory and number
+ * of attached callbacks, which is returned */
+static gint
+_measure_mode(const char *self, const char *mode)
+{
+   gchar *argv[] = { (gchar *)self, EAIL_TEST_CHILD_ARG, (gchar *)mode, NULL };
+   gchar **envp = g_get_environ();
+   gdouble total_time = 0;
+   glong total_rss = 0;
+   guint n_objects = 0;
+   gint callbacks = 0;
+   int i;
+
+   /* bridge would add listeners of its own */
+   envp = g_environ_setenv(envp, "EAIL_BRIDGE", "lazy", TRUE);
+
+   for (i = 0; i < EAIL_TEST_RUNS; ++i)
+     {
+        gchar *output = NULL, *line;
+        gdouble time = 0;
+        glong rss = 0;
+        gint status = -1;
+        gboolean success;
+        int n_parsed;
+
+        success = g_spawn_sync(NULL, argv, envp, 0, NULL, NULL, &output, NULL,
+                               &status, NULL);
+        g_assert(success);
+        g_assert(status == 0);
+
+        line = strstr(output, EAIL_TEST_RESULT);
+        g_assert(line);
+        n_parsed = sscanf(line, EAIL_TEST_RESULT " %u %lf %ld %d",
+                          &n_objects, &time, &rss, &callbacks);
+        g_assert(n_parsed == 4);
+        g_assert(n_objects >= EAIL_TEST_BUTTONS + EAIL_TEST_ENTRIES);
+        g_free(output);
+
+        total_time += time;
+        total_rss += rss;
+     }
+
+   g_strfreev(envp);
+
+   _printf("%s: %u accessibles created in %f s, %ld kB, %d callbacks "
+           "(%d runs)\n", mode, n_objects, total_time / EAIL_TEST_RUNS,
+           total_rss / EAIL_TEST_RUNS, callbacks, EAIL_TEST_RUNS);
+
+   return callbacks;
+}
+
+EAPI_MAIN int
+elm_main(int argc, char **argv)
+{
+   gint callbacks[G_N_ELEMENTS(eail_test_modes)];
+   guint i;
+
+   if (argc > 2 && !strcmp(argv[1], EAIL_TEST_CHILD_ARG))
+     return _run_child(argv[2]);
+
+   _printf("Measuring creation of accessibles....\n");
+
+   for (i = 0; i < G_N_ELEMENTS(eail_test_modes); ++i)
+     callbacks[i] = _measure_mode(argv[0], eail_test_modes[i]);
+
+   /* without listeners only focus callbacks are attached */
+   g_assert(callbacks[0] < callbacks[1]);
+
+   _printf("DONE. Instrumentation benchmark finished\n");
+
+   /* exit code */
+   return 0;
+}
+ELM_MAIN()
@@ -0,0 +1,187 @@
+/*
+ * Tested interface: eail_journal
+ *
+ * Tested AtkObject: EailButton
+ *
+ * Description: Test reading journal deltas directly - deltas are returned
+ * with continuous sequence numbers, also when read in chunks, and reading
+ * from a sequence the journal has wrapped past returns -1
+ *
+ * Test input: state changes notified on accessible representing EailButton,
+ * more than EAIL_JOURNAL_SIZE of them
+ *
+ * Expected test result: test should return 0 (success)
+ */
+
+#include <Elementary.h>
+#include <atk/atk.h>
+#include <gmodule.h>
+
+#include "eail_test_utils.h"
+#include "eail_journal.h"
+
+#define EAIL_TEST_BUTTON_NAME "journal button"
+#define EAIL_TEST_DELTAS 100
+#define EAIL_TEST_CHUNK 30
+
+typedef void (*EailTestReaderFunc)(void);
+typedef guint64 (*EailTestSequenceFunc)(void);
+typedef gint (*EailTestReadFunc)(guint64 since,
+                                 EailDelta *deltas,
+                                 gint max_deltas);
+
+static EailTestReaderFunc eail_test_reader_add = NULL;
+static EailTestReaderFunc eail_test_reader_remove = NULL;
+static EailTestSequenceFunc eail_test_sequence_get = NULL;
+static EailTestReadFunc eail_test_read = NULL;
+
+/* used to determine if test code has been successfully called */
+static gboolean eail_test_code_called = FALSE;
+
+static void
+_on_done(void *data, Evas_Object *obj, void *event_info)
+{
+   elm_exit();
+}
+
+/* notifies n state changes of button, recording n deltas */
+static void
+_test_record(AtkObject *button, gint n)
+{
+   gint i;
+
+   for (i = 0; i < n; ++i)
+     atk_object_notify_state_change(button, ATK_STATE_CHECKED, i % 2 == 0);
+}
+
+/*
+ * reads all deltas after since in chunks, checking their sequence numbers
+ * follow each other, returns number of read deltas of button
+ */
+static gint
+_test_read_all(AtkObject *button, guint64 since, guint64 *last)
+{
+   EailDelta deltas[EAIL_TEST_CHUNK];
+   gint n, i, found = 0;
+
+   while ((n = eail_test_read(since, deltas, EAIL_TEST_CHUNK)) > 0)
+     {
+        g_assert(n <= EAIL_TEST_CHUNK);
+
+        for (i = 0; i < n; ++i)
+          {
+             g_assert(deltas[i].sequence == since + 1);
+             since = deltas[i].sequence;
+
+             if (deltas[i].id != (guint64)(gsize)button) continue;
+
+             g_assert(deltas[i].type == EAIL_DELTA_STATE);
+             g_assert(deltas[i].detail == ATK_STATE_CHECKED);
+             found++;
+          }
+     }
+
+   g_assert(n == 0);
+   g_assert(since == eail_test_sequence_get());
+   *last = since;
+
+   return found;
+}
+
+static void
+_test_journal(AtkObject *button)
+{
+   EailDelta delta;
+   guint64 start, last, oldest;
+
+   eail_test_reader_add();
+
+   /* deltas recorded after start are read in chunks without gaps */
+   start = eail_test_sequence_get();
+   _test_record(button, EAIL_TEST_DELTAS);
+   g_assert(eail_test_sequence_get() >= start + EAIL_TEST_DELTAS);
+   g_assert(_test_read_all(button, start, &last) == EAIL_TEST_DELTAS);
+
+   /* nothing new after the last delta */
+   g_assert(eail_test_read(last, &delta, 1) == 0);
+
+   /* journal wraps past start, which can no longer be read from */
+   _test_record(button, EAIL_JOURNAL_SIZE + EAIL_TEST_DELTAS);
+   g_assert(eail_test_read(start, &delta, 1) == -1);
+   g_assert(eail_test_read(last, &delta, 1) == -1);
+
+   /* the oldest kept delta follows sequence - EAIL_JOURNAL_SIZE */
+   oldest = eail_test_sequence_get() - EAIL_JOURNAL_SIZE + 1;
+   g_assert(eail_test_read(oldest - 2, &delta, 1) == -1);
+   g_assert(eail_test_read(oldest - 1, &delta, 1) == 1);
+   g_assert(delta.sequence == oldest);
+
+   /* everything kept is still continuous up to the last delta */
+   g_assert(_test_read_all(button, oldest - 1, &last) <= EAIL_JOURNAL_SIZE);
+   g_assert(last == eail_test_sequence_get());
+
+   eail_test_reader_remove();
+}
+
+static void
+_on_focus_in(void *data, Evas_Object *obj, void *event_info)
+{
+   static gboolean started = FALSE;
+   GModule *module;
+   gpointer symbol = NULL;
+   AtkObject *button;
+
+   if (started) return;
+   started = TRUE;
+
+   module = g_module_open(NULL, 0);
+   g_assert(module);
+   g_assert(g_module_symbol(module, "eail_journal_reader_add", &symbol));
+   eail_test_reader_add = (EailTestReaderFunc)symbol;
+   g_assert(g_module_symbol(module, "eail_journal_reader_remove", &symbol));
+   eail_test_reader_remove = (EailTestReaderFunc)symbol;
+   g_assert(g_module_symbol(module, "eail_journal_sequence_get", &symbol));
+   eail_test_sequence_get = (EailTestSequenceFunc)symbol;
+   g_assert(g_module_symbol(module, "eail_journal_read", &symbol));
+   eail_test_read = (EailTestReadFunc)symbol;
+
+   button = eailu_find_child_with_name(atk_get_root(), EAIL_TEST_BUTTON_NAME);
+   g_assert(button);
+
+   _test_journal(button);
+
+   g_module_close(module);
+
+   _printf("DONE. All journal tests passed successfully \n");
+   eail_test_code_called = TRUE;
+
+   g_assert(eail_test_code_called);
+   elm_exit();
+}
+
+EAPI_MAIN int
+elm_main(int argc, char **argv)
+{
+   Evas_Object *win, *box, *button;
+
+   win = eailu_create_test_window_with_glib_init(_on_done, _on_focus_in);
+
+   box = elm_box_add(win);
+   evas_object_size_hint_weight_set(box, EVAS_HINT_EXPAND, EVAS_HINT_EXPAND);
+   elm_win_resize_object_add(win, box);
+   evas_object_show(box);
+
+   button = elm_button_add(win);
+   elm_object_text_set(button, EAIL_TEST_BUTTON_NAME);
+   elm_box_pack_end(box, button);
+   evas_object_show(button);
+
+   evas_object_show(win);
+
+   elm_run();
+   elm_shutdown();
+
+   /* exit code */
+   return 0;
+}
+ELM_MAIN()
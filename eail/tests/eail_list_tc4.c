@@ -0,0 +1,121 @@
+/*
+ * Tested interface: AtkText
+ *
+ * Tested AtkObject: EailList
+ *
+ * Description: Test that text and name of list items follow label changes
+ *
+ * Test input: accessible object representing EailList
+ *
+ * Expected test result: test should return 0 (success)
+ */
+
+#include <Elementary.h>
+#include <atk/atk.h>
+
+#include "eail_test_utils.h"
+
+static Evas_Object *glob_elm_list = NULL;
+static Elm_Object_Item *glob_elm_item = NULL;
+
+INIT_TEST("EailList")
+
+static void
+_check_item_text(AtkObject *item_object, const char *expected)
+{
+   gchar *text;
+
+   /* text objects of item view are updated on recalculation */
+   evas_smart_objects_calculate(evas_object_evas_get(glob_elm_list));
+
+   text = atk_text_get_text(ATK_TEXT(item_object), 0, -1);
+   g_assert(text);
+   g_assert_cmpstr(text, ==, expected);
+   g_free(text);
+
+   g_assert(atk_text_get_character_count(ATK_TEXT(item_object)) ==
+            g_utf8_strlen(expected, -1));
+   g_assert_cmpstr(atk_object_get_name(item_object), ==, expected);
+}
+
+static void
+_do_test(AtkObject *aobj)
+{
+   AtkObject *item_object;
+
+   item_object = atk_object_ref_accessible_child(aobj, 0);
+   g_assert(item_object);
+   g_assert(ATK_IS_TEXT(item_object));
+
+   _check_item_text(item_object, "Sunday");
+
+   elm_object_item_text_set(glob_elm_item, "Sonntag");
+   _check_item_text(item_object, "Sonntag");
+
+   elm_object_item_part_text_set(glob_elm_item, NULL, "Niedziela");
+   _check_item_text(item_object, "Niedziela");
+
+   /* same length, different content */
+   elm_object_item_text_set(glob_elm_item, "Niedzielb");
+   _check_item_text(item_object, "Niedzielb");
+
+   g_object_unref(item_object);
+
+   eailu_test_code_called = 1;
+}
+
+static void
+_init_list(Evas_Object *win)
+{
+   Evas_Object *box;
+   unsigned int i;
+
+   static const char *lbl[] =
+     {
+        "Sunday",
+        "Monday",
+        "Tuesday"
+     };
+
+   box = elm_box_add(win);
+   evas_object_size_hint_weight_set(box, EVAS_HINT_EXPAND, EVAS_HINT_EXPAND);
+   elm_win_resize_object_add(win, box);
+   evas_object_show(box);
+
+   glob_elm_list = elm_list_add(win);
+   evas_object_size_hint_weight_set(glob_elm_list, EVAS_HINT_EXPAND, EVAS_HINT_EXPAND);
+   evas_object_size_hint_align_set(glob_elm_list, EVAS_HINT_FILL, EVAS_HINT_FILL);
+
+   for (i = 0; i < sizeof(lbl) / sizeof(lbl[0]); i++)
+     {
+        Elm_Object_Item *it;
+
+        it = elm_list_item_append(glob_elm_list, lbl[i], NULL, NULL,
+                                  NULL, NULL);
+        if (!glob_elm_item) glob_elm_item = it;
+     }
+
+   elm_box_pack_end(box, glob_elm_list);
+
+   elm_list_go(glob_elm_list);
+   evas_object_show(glob_elm_list);
+}
+
+EAPI_MAIN int
+elm_main(int argc, char **argv)
+{
+   Evas_Object *win;
+
+   win = eailu_create_test_window_with_glib_init(_on_done, _on_focus_in);
+   _init_list(win);
+
+   /* and show the window */
+   evas_object_show(win);
+
+   elm_run();
+   elm_shutdown();
+
+   /* exit code */
+   return 0;
+}
+ELM_MAIN()
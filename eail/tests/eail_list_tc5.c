@@ -0,0 +1,151 @@
+/*
+ * Tested interface: AtkObject
+ *
+ * Tested AtkObject: EailList
+ *
+ * Description: Test that children of list items follow content set on and
+ * unset from items after their content has been listed
+ *
+ * Test input: accessible object representing EailList
+ *
+ * Expected test result: test should return 0 (success)
+ */
+
+#include <Elementary.h>
+#include <atk/atk.h>
+
+#include "eail_test_utils.h"
+
+static Evas_Object *glob_elm_list = NULL;
+static Elm_Object_Item *glob_elm_item = NULL;
+
+INIT_TEST("EailList")
+
+static Evas_Object *
+_content_add(const char *name)
+{
+   Evas_Object *button = elm_button_add(glob_elm_list);
+
+   elm_object_text_set(button, name);
+   evas_object_show(button);
+
+   return button;
+}
+
+static void
+_check_content(AtkObject *item_object, const char *name)
+{
+   AtkObject *child;
+   gint i, n_children = atk_object_get_n_accessible_children(item_object);
+   gboolean found = FALSE;
+
+   for (i = 0; i < n_children && !found; ++i)
+     {
+        child = atk_object_ref_accessible_child(item_object, i);
+        g_assert(child);
+        found = !g_strcmp0(atk_object_get_name(child), name);
+        g_object_unref(child);
+     }
+
+   g_assert(found);
+}
+
+static void
+_do_test(AtkObject *aobj)
+{
+   AtkObject *item_object;
+   Evas_Object *content;
+   gint n_children;
+
+   item_object = atk_object_ref_accessible_child(aobj, 0);
+   g_assert(item_object);
+
+   /* lists content of item, so that it gets cached */
+   n_children = atk_object_get_n_accessible_children(item_object);
+
+   elm_object_item_part_content_set(glob_elm_item, "start",
+                                    _content_add("first"));
+   g_assert(atk_object_get_n_accessible_children(item_object) ==
+            n_children + 1);
+   _check_content(item_object, "first");
+
+   elm_object_item_part_content_set(glob_elm_item, "end",
+                                    _content_add("second"));
+   g_assert(atk_object_get_n_accessible_children(item_object) ==
+            n_children + 2);
+   _check_content(item_object, "second");
+
+   /* replaced content is deleted by list */
+   elm_object_item_part_content_set(glob_elm_item, "start",
+                                    _content_add("third"));
+   g_assert(atk_object_get_n_accessible_children(item_object) ==
+            n_children + 2);
+   _check_content(item_object, "third");
+
+   /* unset content is not deleted, item keeps the same view */
+   content = elm_object_item_part_content_unset(glob_elm_item, "end");
+   g_assert(content);
+   g_assert(atk_object_get_n_accessible_children(item_object) ==
+            n_children + 1);
+   evas_object_del(content);
+
+   g_object_unref(item_object);
+
+   eailu_test_code_called = 1;
+}
+
+static void
+_init_list(Evas_Object *win)
+{
+   Evas_Object *box;
+   unsigned int i;
+
+   static const char *lbl[] =
+     {
+        "Sunday",
+        "Monday",
+        "Tuesday"
+     };
+
+   box = elm_box_add(win);
+   evas_object_size_hint_weight_set(box, EVAS_HINT_EXPAND, EVAS_HINT_EXPAND);
+   elm_win_resize_object_add(win, box);
+   evas_object_show(box);
+
+   glob_elm_list = elm_list_add(win);
+   evas_object_size_hint_weight_set(glob_elm_list, EVAS_HINT_EXPAND, EVAS_HINT_EXPAND);
+   evas_object_size_hint_align_set(glob_elm_list, EVAS_HINT_FILL, EVAS_HINT_FILL);
+
+   for (i = 0; i < sizeof(lbl) / sizeof(lbl[0]); i++)
+     {
+        Elm_Object_Item *it;
+
+        it = elm_list_item_append(glob_elm_list, lbl[i], NULL, NULL,
+                                  NULL, NULL);
+        if (!glob_elm_item) glob_elm_item = it;
+     }
+
+   elm_box_pack_end(box, glob_elm_list);
+
+   elm_list_go(glob_elm_list);
+   evas_object_show(glob_elm_list);
+}
+
+EAPI_MAIN int
+elm_main(int argc, char **argv)
+{
+   Evas_Object *win;
+
+   win = eailu_create_test_window_with_glib_init(_on_done, _on_focus_in);
+   _init_list(win);
+
+   /* and show the window */
+   evas_object_show(win);
+
+   elm_run();
+   elm_shutdown();
+
+   /* exit code */
+   return 0;
+}
+ELM_MAIN()
@@ -0,0 +1,179 @@
+/*
+ * Tested interface: atk_add_global_event_listener,
+ * atk_remove_global_event_listener
+ *
+ * Tested AtkObject: EailApp
+ *
+ * Description: Stress test of global event listener registry. The same
+ * total number of state-change listeners is added and removed by 1, 4 and
+ * 8 threads
+ *
+ * Test input: 4000 state-change listeners, events emitted on root accessible
+ *
+ * Expected test result: every listener gets its own id and is called once
+ * per emission until removed, test should return 0 (success)
+ */
+
+#include <Elementary.h>
+#include <atk/atk.h>
+
+#include "eail_test_utils.h"
+
+#define EAIL_TEST_THREADS 8
+#define EAIL_TEST_LISTENERS_PER_THREAD 500
+#define EAIL_TEST_EVENT_TYPE "Atk:AtkObject:state-change"
+
+typedef struct
+{
+   guint n_listeners;
+   guint ids[EAIL_TEST_LISTENERS_PER_THREAD * EAIL_TEST_THREADS];
+} EailTestWorker;
+
+/* number of emissions received by listeners added by the test */
+static volatile gint eail_test_hook_calls = 0;
+
+/* used to determine if test code has been successfully called */
+static gboolean eail_test_code_called = FALSE;
+
+static void
+_on_done(void *data, Evas_Object *obj, void *event_info)
+{
+   elm_exit();
+}
+
+static gboolean
+_test_hook(GSignalInvocationHint *ihint,
+           guint n_param_values,
+           const GValue *param_values,
+           gpointer data)
+{
+   g_atomic_int_inc(&eail_test_hook_calls);
+
+   return TRUE;
+}
+
+static gpointer
+_test_add_listeners(gpointer data)
+{
+   EailTestWorker *worker = data;
+   guint i;
+
+   for (i = 0; i < worker->n_listeners; ++i)
+     worker->ids[i] = atk_add_global_event_listener(_test_hook,
+                                                    EAIL_TEST_EVENT_TYPE);
+
+   return NULL;
+}
+
+static gpointer
+_test_remove_listeners(gpointer data)
+{
+   EailTestWorker *worker = data;
+   guint i;
+
+   for (i = 0; i < worker->n_listeners; ++i)
+     atk_remove_global_event_listener(worker->ids[i]);
+
+   return NULL;
+}
+
+static gdouble
+_test_run_workers(EailTestWorker *workers, guint n_workers, GThreadFunc func)
+{
+   GThread *threads[EAIL_TEST_THREADS];
+   GTimer *timer = g_timer_new();
+   gdouble elapsed;
+   guint i;
+
+   for (i = 0; i < n_workers; ++i)
+     threads[i] = g_thread_new("eail-test", func, &workers[i]);
+
+   for (i = 0; i < n_workers; ++i)
+     g_thread_join(threads[i]);
+
+   elapsed = g_timer_elapsed(timer, NULL);
+   g_timer_destroy(timer);
+
+   return elapsed;
+}
+
+/* adds and removes the same total number of listeners with n_workers */
+static void
+_test_listeners_with_threads(AtkObject *root, guint n_workers)
+{
+   EailTestWorker *workers = g_new0(EailTestWorker, n_workers);
+   GHashTable *ids = g_hash_table_new(g_direct_hash, g_direct_equal);
+   guint total = EAIL_TEST_LISTENERS_PER_THREAD * EAIL_TEST_THREADS;
+   gdouble add_time, remove_time;
+   guint i, j;
+
+   for (i = 0; i < n_workers; ++i)
+     workers[i].n_listeners = total / n_workers;
+
+   add_time = _test_run_workers(workers, n_workers, _test_add_listeners);
+
+   /* every listener got its own id */
+   for (i = 0; i < n_workers; ++i)
+     for (j = 0; j < workers[i].n_listeners; ++j)
+       {
+          g_assert(workers[i].ids[j] > 0);
+          g_assert(!g_hash_table_lookup(ids,
+                                        GUINT_TO_POINTER(workers[i].ids[j])));
+          g_hash_table_insert(ids, GUINT_TO_POINTER(workers[i].ids[j]),
+                              GUINT_TO_POINTER(TRUE));
+       }
+   g_assert(g_hash_table_size(ids) == total);
+
+   /* and every listener is registered */
+   eail_test_hook_calls = 0;
+   atk_object_notify_state_change(root, ATK_STATE_BUSY, TRUE);
+   g_assert(eail_test_hook_calls == (gint)total);
+
+   remove_time = _test_run_workers(workers, n_workers,
+                                   _test_remove_listeners);
+
+   eail_test_hook_calls = 0;
+   atk_object_notify_state_change(root, ATK_STATE_BUSY, FALSE);
+   g_assert(eail_test_hook_calls == 0);
+
+   _printf("%u threads: %u listeners added in %f s, removed in %f s\n",
+           n_workers, total, add_time, remove_time);
+
+   g_hash_table_destroy(ids);
+   g_free(workers);
+}
+
+static void
+_on_focus_in(void *data, Evas_Object *obj, void *event_info)
+{
+   AtkObject *root = atk_get_root();
+   g_assert(root);
+
+   _printf("Testing listener registry from threads....\n");
+
+   _test_listeners_with_threads(root, 1);
+   _test_listeners_with_threads(root, EAIL_TEST_THREADS / 2);
+   _test_listeners_with_threads(root, EAIL_TEST_THREADS);
+
+   _printf("DONE. All listener stress tests passed successfully \n");
+   eail_test_code_called = TRUE;
+
+   g_assert(eail_test_code_called);
+   elm_exit();
+}
+
+EAPI_MAIN int
+elm_main(int argc, char **argv)
+{
+   Evas_Object *win;
+
+   win = eailu_create_test_window_with_glib_init(_on_done, _on_focus_in);
+   evas_object_show(win);
+
+   elm_run();
+   elm_shutdown();
+
+   /* exit code */
+   return 0;
+}
+ELM_MAIN()
@@ -0,0 +1,164 @@
+/*
+ * Tested interface: eail module loading
+ *
+ * Tested AtkObject: EailButton
+ *
+ * Description: Benchmark of module load, run in child processes with
+ * ELM_MODULES unset and set to load eail. Compares run time and resident
+ * memory of a minimal application walking its accessible tree
+ *
+ * Test input: window with a single button
+ *
+ * Expected test result: every child reports its resident memory, test
+ * should return 0 (success)
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include <Elementary.h>
+#include <atk/atk.h>
+
+#include "eail_test_utils.h"
+
+#define EAIL_TEST_CHILD_ARG "--child"
+#define EAIL_TEST_RESULT "RESULT"
+#define EAIL_TEST_RUNS 5
+#define EAIL_TEST_MODULES "eail>eail/api"
+#define EAIL_TEST_WINDOW_TITLE "Eail load benchmark"
+#define EAIL_TEST_WINDOW_SIZE 200
+
+/* module modes compared, value of ELM_MODULES or NULL to unset it */
+static const struct
+{
+   const char *name;
+   const char *modules;
+} eail_test_modes[] = {
+   { "without eail", NULL },
+   { "with eail", EAIL_TEST_MODULES }
+};
+
+/* touches accessibles of the whole tree, as an AT client would */
+static void
+_test_walk_accessibles(AtkObject *obj)
+{
+   gint i, n = atk_object_get_n_accessible_children(obj);
+
+   for (i = 0; i < n; ++i)
+     {
+        AtkObject *child = atk_object_ref_accessible_child(obj, i);
+
+        if (!child) continue;
+
+        atk_object_get_role(child);
+        _test_walk_accessibles(child);
+        g_object_unref(child);
+     }
+}
+
+static Eina_Bool
+_on_shown(void *data)
+{
+   AtkObject *root = atk_get_root();
+
+   if (root)
+     _test_walk_accessibles(root);
+
+   printf("%s %ld\n", EAIL_TEST_RESULT, eailu_get_rss());
+   elm_exit();
+
+   return ECORE_CALLBACK_CANCEL;
+}
+
+/* starts a minimal application and quits once it is shown */
+static int
+_run_child(void)
+{
+   Evas_Object *win, *button;
+
+   if (!ecore_main_loop_glib_integrate())
+     return 1;
+
+   win = elm_win_add(NULL, EAIL_TEST_WINDOW_TITLE, ELM_WIN_BASIC);
+
+   button = elm_button_add(win);
+   elm_object_text_set(button, "button");
+   elm_win_resize_object_add(win, button);
+   evas_object_show(button);
+
+   evas_object_resize(win, EAIL_TEST_WINDOW_SIZE, EAIL_TEST_WINDOW_SIZE);
+   evas_object_show(win);
+
+   ecore_idler_add(_on_shown, NULL);
+   elm_run();
+
+   return 0;
+}
+
+/* measures mean run time and resident memory of child application */
+static void
+_measure_mode(const char *self, guint mode)
+{
+   gchar *argv[] = { (gchar *)self, EAIL_TEST_CHILD_ARG, NULL };
+   gchar **envp = g_get_environ();
+   gint64 total_time = 0;
+   glong total_rss = 0;
+   int i;
+
+   if (eail_test_modes[mode].modules)
+     envp = g_environ_setenv(envp, "ELM_MODULES",
+                             eail_test_modes[mode].modules, TRUE);
+   else
+     envp = g_environ_unsetenv(envp, "ELM_MODULES");
+
+   for (i = 0; i < EAIL_TEST_RUNS; ++i)
+     {
+        gint64 start = g_get_monotonic_time();
+        gchar *output = NULL, *line;
+        glong rss = 0;
+        gint status = -1, n_parsed;
+        gboolean success;
+
+        success = g_spawn_sync(NULL, argv, envp, 0, NULL, NULL, &output, NULL,
+                               &status, NULL);
+        g_assert(success);
+        g_assert(status == 0);
+
+        total_time += g_get_monotonic_time() - start;
+
+        line = strstr(output, EAIL_TEST_RESULT);
+        g_assert(line);
+        n_parsed = sscanf(line, EAIL_TEST_RESULT " %ld", &rss);
+        g_assert(n_parsed == 1);
+        g_free(output);
+
+        total_rss += rss;
+     }
+
+   g_strfreev(envp);
+
+   _printf("%s: %f s per run, %ld kB resident (%d runs)\n",
+           eail_test_modes[mode].name,
+           total_time / (gdouble)EAIL_TEST_RUNS / G_USEC_PER_SEC,
+           total_rss / EAIL_TEST_RUNS, EAIL_TEST_RUNS);
+}
+
+EAPI_MAIN int
+elm_main(int argc, char **argv)
+{
+   guint i;
+
+   if (argc > 1 && !strcmp(argv[1], EAIL_TEST_CHILD_ARG))
+     return _run_child();
+
+   _printf("Measuring module load....\n");
+
+   for (i = 0; i < G_N_ELEMENTS(eail_test_modes); ++i)
+     _measure_mode(argv[0], i);
+
+   _printf("DONE. Load benchmark finished\n");
+
+   /* exit code */
+   return 0;
+}
+ELM_MAIN()
@@ -0,0 +1,225 @@
+/*
+ * Tested interface: eail_mirror_reader
+ *
+ * Tested AtkObject: EailButton
+ *
+ * Description: Test reading shared-memory mirror of a child application
+ * from another process: snapshot and deltas with a mirror big enough for
+ * the tree, overflow flag with a mirror too small for it
+ *
+ * Test input: mirror file published by child application with buttons
+ *
+ * Expected test result: test should return 0 (success)
+ */
+
+#include <signal.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+
+#include <Elementary.h>
+#include <atk/atk.h>
+
+#include "eail_test_utils.h"
+#include "eail_mirror_reader.h"
+
+#define EAIL_TEST_CHILD_ARG "--child"
+#define EAIL_TEST_BUTTONS 10
+#define EAIL_TEST_WINDOW_TITLE "Eail mirror reader test"
+#define EAIL_TEST_WINDOW_SIZE 400
+/* child quits by itself if parent does not stop it */
+#define EAIL_TEST_CHILD_TIMEOUT 60.0
+/* time given to child to publish its first snapshot */
+#define EAIL_TEST_PUBLISH_TIMEOUT (30 * G_USEC_PER_SEC)
+#define EAIL_TEST_POLL_INTERVAL (10 * 1000)
+#define EAIL_TEST_BUFFER_SIZE (4 * 1024 * 1024)
+#define EAIL_TEST_MAX_DELTAS 64
+/* smaller than snapshot header followed by a single node */
+#define EAIL_TEST_TOO_SMALL "8"
+
+static Eina_Bool
+_on_child_timeout(void *data)
+{
+   elm_exit();
+
+   return ECORE_CALLBACK_CANCEL;
+}
+
+/* shows a few buttons, publishing them to the mirror set in environment */
+static int
+_run_child(void)
+{
+   Evas_Object *win, *box, *button;
+   int i;
+
+   if (!ecore_main_loop_glib_integrate())
+     return 1;
+
+   win = elm_win_add(NULL, EAIL_TEST_WINDOW_TITLE, ELM_WIN_BASIC);
+   box = elm_box_add(win);
+   evas_object_size_hint_weight_set(box, EVAS_HINT_EXPAND, EVAS_HINT_EXPAND);
+   elm_win_resize_object_add(win, box);
+   evas_object_show(box);
+
+   for (i = 0; i < EAIL_TEST_BUTTONS; ++i)
+     {
+        button = elm_button_add(win);
+        elm_object_text_set(button, "button");
+        elm_box_pack_end(box, button);
+        evas_object_show(button);
+     }
+
+   evas_object_resize(win, EAIL_TEST_WINDOW_SIZE, EAIL_TEST_WINDOW_SIZE);
+   evas_object_show(win);
+
+   ecore_timer_add(EAIL_TEST_CHILD_TIMEOUT, _on_child_timeout, NULL);
+   elm_run();
+
+   return 0;
+}
+
+/* starts child application publishing to path with snapshot buffers of size */
+static GPid
+_spawn_child(const char *self, const char *path, const char *size)
+{
+   gchar *argv[] = { (gchar *)self, EAIL_TEST_CHILD_ARG, NULL };
+   gchar **envp = g_get_environ();
+   GPid pid = 0;
+   gboolean success;
+
+   envp = g_environ_setenv(envp, "EAIL_MIRROR", path, TRUE);
+   if (size)
+     envp = g_environ_setenv(envp, "EAIL_MIRROR_SIZE", size, TRUE);
+   else
+     envp = g_environ_unsetenv(envp, "EAIL_MIRROR_SIZE");
+
+   success = g_spawn_async(NULL, argv, envp, G_SPAWN_DO_NOT_REAP_CHILD,
+                           NULL, NULL, &pid, NULL);
+   g_assert(success);
+
+   g_strfreev(envp);
+
+   return pid;
+}
+
+static void
+_stop_child(GPid pid, const char *path)
+{
+   kill(pid, SIGTERM);
+   waitpid(pid, NULL, 0);
+   g_spawn_close_pid(pid);
+
+   /* mirror file is removed only on clean shutdown */
+   unlink(path);
+}
+
+/* maps mirror and waits until child publishes a snapshot or an overflow */
+static size_t
+_read_first_snapshot(EailMirrorReader *reader,
+                     const char *path,
+                     uint8_t *buffer)
+{
+   gint64 end = g_get_monotonic_time() + EAIL_TEST_PUBLISH_TIMEOUT;
+   size_t length = 0;
+
+   while (eail_mirror_reader_open(reader, path) < 0)
+     {
+        g_assert(g_get_monotonic_time() < end);
+        g_usleep(EAIL_TEST_POLL_INTERVAL);
+     }
+
+   while (!(length = eail_mirror_reader_snapshot(reader, buffer,
+                                                 EAIL_TEST_BUFFER_SIZE)))
+     {
+        g_assert(g_get_monotonic_time() < end);
+        g_usleep(EAIL_TEST_POLL_INTERVAL);
+     }
+
+   return length;
+}
+
+static void
+_test_snapshot(const char *self, const char *path, uint8_t *buffer)
+{
+   EailMirrorReader reader;
+   EailTreeSnapshotHeader header;
+   EailTreeSnapshotNode node;
+   EailDelta deltas[EAIL_TEST_MAX_DELTAS];
+   size_t length;
+   GPid pid;
+   int i, n;
+
+   pid = _spawn_child(self, path, NULL);
+   length = _read_first_snapshot(&reader, path, buffer);
+
+   _printf("snapshot of %u bytes\n", (unsigned)length);
+   g_assert(length != EAIL_MIRROR_READER_OVERFLOW);
+   g_assert(length <= EAIL_TEST_BUFFER_SIZE);
+   g_assert(length >= sizeof(header) + sizeof(node));
+
+   memcpy(&header, buffer, sizeof(header));
+   g_assert(header.magic == EAIL_TREE_SNAPSHOT_MAGIC);
+   g_assert(header.version == EAIL_TREE_SNAPSHOT_VERSION);
+   g_assert(header.node_size == sizeof(node));
+   /* root, window and buttons at least */
+   g_assert(header.n_nodes >= EAIL_TEST_BUTTONS + 2);
+
+   memcpy(&node, buffer + sizeof(header), sizeof(node));
+   g_assert(node.parent == -1);
+   g_assert(node.role == ATK_ROLE_APPLICATION);
+
+   n = eail_mirror_reader_deltas(&reader, header.sequence, deltas,
+                                 EAIL_TEST_MAX_DELTAS);
+   g_assert(n >= 0);
+   for (i = 0; i < n; ++i)
+     g_assert(deltas[i].sequence == header.sequence + i + 1);
+
+   eail_mirror_reader_close(&reader);
+   _stop_child(pid, path);
+}
+
+static void
+_test_overflow(const char *self, const char *path, uint8_t *buffer)
+{
+   EailMirrorReader reader;
+   size_t length;
+   GPid pid;
+
+   pid = _spawn_child(self, path, EAIL_TEST_TOO_SMALL);
+
+   length = _read_first_snapshot(&reader, path, buffer);
+   g_assert(length == EAIL_MIRROR_READER_OVERFLOW);
+
+   eail_mirror_reader_close(&reader);
+   _stop_child(pid, path);
+}
+
+EAPI_MAIN int
+elm_main(int argc, char **argv)
+{
+   uint8_t *buffer;
+   gchar *name, *path;
+
+   if (argc > 1 && !strcmp(argv[1], EAIL_TEST_CHILD_ARG))
+     return _run_child();
+
+   name = g_strdup_printf("eail-mirror-test-%d", (int)getpid());
+   path = g_build_filename(g_get_tmp_dir(), name, NULL);
+   buffer = g_malloc(EAIL_TEST_BUFFER_SIZE);
+
+   _printf("Testing mirror reader....\n");
+
+   _test_snapshot(argv[0], path, buffer);
+   _test_overflow(argv[0], path, buffer);
+
+   _printf("DONE. All mirror reader tests passed successfully \n");
+
+   g_free(buffer);
+   g_free(path);
+   g_free(name);
+
+   /* exit code */
+   return 0;
+}
+ELM_MAIN()
@@ -0,0 +1,158 @@
+/*
+ * Tested interface: eail_property_cache
+ *
+ * Tested AtkObject: EailButton, EailTable
+ *
+ * Description: Test that cached records follow label text and disabled flag,
+ * notified through theme signals, and children of table, which are taken
+ * from the walk
+ *
+ * Test input: accessible objects representing EailButton and EailTable
+ *
+ * Expected test result: test should return 0 (success)
+ */
+
+#include <Elementary.h>
+#include <atk/atk.h>
+#include <gmodule.h>
+
+#include "eail_test_utils.h"
+#include "eail_property_cache.h"
+
+#define EAIL_TEST_MAX_RECORDS 16
+
+typedef gboolean (*EailTestGetFunc)(AtkObject *obj, EailPropertyRecord *record);
+typedef gint (*EailTestFetchFunc)(AtkObject *root,
+                                  EailPropertyRecord *records,
+                                  gint max_records);
+
+static Evas_Object *glob_button = NULL;
+static Evas_Object *glob_table = NULL;
+
+static EailTestGetFunc eail_test_cache_get = NULL;
+static EailTestFetchFunc eail_test_cache_fetch = NULL;
+
+/* used to determine if test code has been successfully called */
+static gboolean eail_test_code_called = FALSE;
+
+static void
+_on_done(void *data, Evas_Object *obj, void *event_info)
+{
+   elm_exit();
+}
+
+static void
+_test_button(AtkObject *button)
+{
+   EailPropertyRecord record;
+
+   g_assert(eail_test_cache_get(button, &record));
+   g_assert_cmpstr(record.name, ==, "first");
+   g_assert(record.states & (G_GUINT64_CONSTANT(1) << ATK_STATE_ENABLED));
+
+   /* name and state changes come with signals processed by edje */
+   elm_object_text_set(glob_button, "second");
+   edje_message_signal_process();
+   g_assert(eail_test_cache_get(button, &record));
+   g_assert_cmpstr(record.name, ==, "second");
+
+   elm_object_disabled_set(glob_button, EINA_TRUE);
+   edje_message_signal_process();
+   g_assert(eail_test_cache_get(button, &record));
+   g_assert(!(record.states & (G_GUINT64_CONSTANT(1) << ATK_STATE_ENABLED)));
+
+   elm_object_disabled_set(glob_button, EINA_FALSE);
+   edje_message_signal_process();
+   g_assert(eail_test_cache_get(button, &record));
+   g_assert(record.states & (G_GUINT64_CONSTANT(1) << ATK_STATE_ENABLED));
+}
+
+static void
+_test_table(AtkObject *table)
+{
+   EailPropertyRecord records[EAIL_TEST_MAX_RECORDS];
+   Evas_Object *label;
+   gint count, new_count;
+
+   count = eail_test_cache_fetch(table, records, EAIL_TEST_MAX_RECORDS);
+   g_assert(count > 0 && count < EAIL_TEST_MAX_RECORDS);
+   g_assert(records[0].id == (guint64)(gsize)table);
+
+   /* table does not emit children-changed */
+   label = elm_label_add(glob_table);
+   elm_object_text_set(label, "added");
+   elm_table_pack(glob_table, label, 1, 1, 1, 1);
+   evas_object_show(label);
+
+   new_count = eail_test_cache_fetch(table, records, EAIL_TEST_MAX_RECORDS);
+   g_assert(new_count == count + 1);
+   g_assert(records[0].n_children == (guint32)count);
+}
+
+static void
+_on_focus_in(void *data, Evas_Object *obj, void *event_info)
+{
+   GModule *module;
+   gpointer symbol = NULL;
+   AtkObject *button, *table;
+
+   module = g_module_open(NULL, 0);
+   g_assert(module);
+   g_assert(g_module_symbol(module, "eail_property_cache_get", &symbol));
+   eail_test_cache_get = (EailTestGetFunc)symbol;
+   g_assert(g_module_symbol(module, "eail_property_cache_fetch", &symbol));
+   eail_test_cache_fetch = (EailTestFetchFunc)symbol;
+
+   button = eailu_find_child_with_name(atk_get_root(), "first");
+   g_assert(button);
+   _test_button(button);
+
+   table = eailu_find_child_with_name(atk_get_root(), "table");
+   g_assert(table);
+   _test_table(table);
+
+   g_module_close(module);
+
+   _printf("DONE. All property cache tests passed successfully \n");
+   eail_test_code_called = TRUE;
+
+   g_assert(eail_test_code_called);
+   elm_exit();
+}
+
+EAPI_MAIN int
+elm_main(int argc, char **argv)
+{
+   Evas_Object *win, *box, *label;
+
+   win = eailu_create_test_window_with_glib_init(_on_done, _on_focus_in);
+
+   box = elm_box_add(win);
+   evas_object_size_hint_weight_set(box, EVAS_HINT_EXPAND, EVAS_HINT_EXPAND);
+   elm_win_resize_object_add(win, box);
+   evas_object_show(box);
+
+   glob_button = elm_button_add(win);
+   elm_object_text_set(glob_button, "first");
+   elm_box_pack_end(box, glob_button);
+   evas_object_show(glob_button);
+
+   glob_table = elm_table_add(win);
+   evas_object_name_set(glob_table, "table");
+   elm_box_pack_end(box, glob_table);
+   evas_object_show(glob_table);
+
+   label = elm_label_add(win);
+   elm_object_text_set(label, "cell");
+   elm_table_pack(glob_table, label, 0, 0, 1, 1);
+   evas_object_show(label);
+
+   evas_object_show(win);
+
+   elm_run();
+   elm_shutdown();
+
+   /* exit code */
+   return 0;
+}
+ELM_MAIN()
@@ -0,0 +1,281 @@
+/*
+ * Tested interface: eail_shared_tree
+ *
+ * Tested AtkObject: EailButton
+ *
+ * Description: Test readers of shared tree running in threads while the
+ * main loop publishes new trees, then check that the published tree
+ * catches up with journaled changes of box and, after
+ * eail_shared_tree_refresh, with changes of table that are not journaled
+ *
+ * Test input: accessible objects representing EailButton, EailBox and
+ * EailTable
+ *
+ * Expected test result: test should return 0 (success)
+ */
+
+#include <Elementary.h>
+#include <atk/atk.h>
+#include <gmodule.h>
+
+#include "eail_test_utils.h"
+#include "eail_shared_tree.h"
+
+#define EAIL_TEST_THREADS 4
+#define EAIL_TEST_CHANGES 100
+#define EAIL_TEST_CHANGE_INTERVAL 0.01
+/* time given to the main loop to publish rebuilt tree */
+#define EAIL_TEST_SETTLE_TIME 0.2
+
+typedef void (*EailTestInitFunc)(void);
+typedef EailSharedTree *(*EailTestGetFunc)(void);
+typedef void (*EailTestUnrefFunc)(EailSharedTree *tree);
+typedef void (*EailTestCountFunc)(const EailSharedTree *tree,
+                                  guint *counts,
+                                  guint n_counts);
+
+static EailTestInitFunc eail_test_tree_init = NULL;
+static EailTestInitFunc eail_test_tree_refresh = NULL;
+static EailTestGetFunc eail_test_tree_get = NULL;
+static EailTestUnrefFunc eail_test_tree_unref = NULL;
+static EailTestCountFunc eail_test_tree_count_roles = NULL;
+
+static Evas_Object *glob_box = NULL;
+static Evas_Object *glob_table = NULL;
+static GPtrArray *glob_buttons = NULL;
+static GThread *eail_test_threads[EAIL_TEST_THREADS];
+static guint eail_test_changes = 0;
+
+/* set when readers have to stop */
+static volatile gint eail_test_stop = 0;
+
+/* number of trees read and of broken invariants seen by readers */
+static volatile gint eail_test_reads = 0;
+static volatile gint eail_test_errors = 0;
+
+/* used to determine if test code has been successfully called */
+static gboolean eail_test_code_called = FALSE;
+
+static void
+_on_done(void *data, Evas_Object *obj, void *event_info)
+{
+   elm_exit();
+}
+
+/* checks node invariants, returns number of nodes in subtree */
+static guint
+_test_check_node(const EailSharedNode *node)
+{
+   guint i, n_nodes = 1;
+
+   if (g_atomic_int_get((gint *)&node->ref_count) <= 0)
+     g_atomic_int_inc(&eail_test_errors);
+
+   for (i = 0; i < node->n_children; ++i)
+     {
+        if (node->children[i]->index != (gint32)i)
+          g_atomic_int_inc(&eail_test_errors);
+
+        n_nodes += _test_check_node(node->children[i]);
+     }
+
+   if (n_nodes != node->n_descendants + 1)
+     g_atomic_int_inc(&eail_test_errors);
+
+   /* touch name, it has to stay valid while tree is referenced */
+   if (node->name)
+     (void)strlen(node->name);
+
+   return n_nodes;
+}
+
+static gpointer
+_test_read_trees(gpointer data)
+{
+   while (!g_atomic_int_get(&eail_test_stop))
+     {
+        EailSharedTree *tree = eail_test_tree_get();
+
+        if (!tree) continue;
+
+        if (_test_check_node(tree->root) != tree->n_nodes)
+          g_atomic_int_inc(&eail_test_errors);
+
+        g_atomic_int_inc(&eail_test_reads);
+        eail_test_tree_unref(tree);
+     }
+
+   return NULL;
+}
+
+/* counts push buttons in the current tree */
+static guint
+_test_count_buttons(void)
+{
+   EailSharedTree *tree;
+   guint counts[ATK_ROLE_LAST_DEFINED];
+
+   memset(counts, 0, sizeof(counts));
+
+   tree = eail_test_tree_get();
+   g_assert(tree);
+   eail_test_tree_count_roles(tree, counts, ATK_ROLE_LAST_DEFINED);
+   eail_test_tree_unref(tree);
+
+   _printf("%u push buttons in tree, %u alive\n",
+           counts[ATK_ROLE_PUSH_BUTTON], glob_buttons->len);
+
+   return counts[ATK_ROLE_PUSH_BUTTON];
+}
+
+static Eina_Bool
+_test_check_refreshed(void *data)
+{
+   /* full rebuild picks up the button packed into table */
+   g_assert(_test_count_buttons() == glob_buttons->len);
+
+   _printf("DONE. All shared tree tests passed successfully \n");
+   eail_test_code_called = TRUE;
+
+   g_assert(eail_test_code_called);
+   elm_exit();
+
+   return ECORE_CALLBACK_CANCEL;
+}
+
+static Eina_Bool
+_test_check_settled(void *data)
+{
+   Evas_Object *button;
+
+   /* children of box are journaled, no full rebuild is needed */
+   g_assert(_test_count_buttons() == glob_buttons->len);
+
+   /* table does not emit children-changed */
+   button = elm_button_add(glob_table);
+   elm_object_text_set(button, "packed");
+   elm_table_pack(glob_table, button, 0, 0, 1, 1);
+   evas_object_show(button);
+   g_ptr_array_add(glob_buttons, button);
+
+   eail_test_tree_refresh();
+   ecore_timer_add(EAIL_TEST_SETTLE_TIME, _test_check_refreshed, NULL);
+
+   return ECORE_CALLBACK_CANCEL;
+}
+
+static Eina_Bool
+_test_change_tree(void *data)
+{
+   guint i;
+
+   if (eail_test_changes++ < EAIL_TEST_CHANGES)
+     {
+        Evas_Object *button;
+
+        if (eail_test_changes % 3 && glob_buttons->len)
+          {
+             button = g_ptr_array_index(glob_buttons, 0);
+             g_ptr_array_remove_index(glob_buttons, 0);
+             evas_object_del(button);
+          }
+        else
+          {
+             button = elm_button_add(glob_box);
+             elm_object_text_set(button, "added");
+             elm_box_pack_end(glob_box, button);
+             evas_object_show(button);
+             g_ptr_array_add(glob_buttons, button);
+          }
+
+        return ECORE_CALLBACK_RENEW;
+     }
+
+   g_atomic_int_set(&eail_test_stop, 1);
+   for (i = 0; i < EAIL_TEST_THREADS; ++i)
+     g_thread_join(eail_test_threads[i]);
+
+   _printf("%d trees read by %d threads\n", eail_test_reads,
+           EAIL_TEST_THREADS);
+   g_assert(eail_test_reads > 0);
+   g_assert(eail_test_errors == 0);
+
+   ecore_timer_add(EAIL_TEST_SETTLE_TIME, _test_check_settled, NULL);
+
+   return ECORE_CALLBACK_CANCEL;
+}
+
+static void
+_on_focus_in(void *data, Evas_Object *obj, void *event_info)
+{
+   static gboolean started = FALSE;
+   GModule *module;
+   gpointer symbol = NULL;
+   guint i;
+
+   if (started) return;
+   started = TRUE;
+
+   module = g_module_open(NULL, 0);
+   g_assert(module);
+   g_assert(g_module_symbol(module, "eail_shared_tree_init", &symbol));
+   eail_test_tree_init = (EailTestInitFunc)symbol;
+   g_assert(g_module_symbol(module, "eail_shared_tree_refresh", &symbol));
+   eail_test_tree_refresh = (EailTestInitFunc)symbol;
+   g_assert(g_module_symbol(module, "eail_shared_tree_get", &symbol));
+   eail_test_tree_get = (EailTestGetFunc)symbol;
+   g_assert(g_module_symbol(module, "eail_shared_tree_unref", &symbol));
+   eail_test_tree_unref = (EailTestUnrefFunc)symbol;
+   g_assert(g_module_symbol(module, "eail_shared_tree_count_roles", &symbol));
+   eail_test_tree_count_roles = (EailTestCountFunc)symbol;
+
+   _printf("Testing shared tree readers....\n");
+
+   eail_test_tree_init();
+
+   for (i = 0; i < EAIL_TEST_THREADS; ++i)
+     eail_test_threads[i] = g_thread_new("eail-test", _test_read_trees, NULL);
+
+   ecore_timer_add(EAIL_TEST_CHANGE_INTERVAL, _test_change_tree, NULL);
+}
+
+EAPI_MAIN int
+elm_main(int argc, char **argv)
+{
+   Evas_Object *win;
+   guint i;
+
+   win = eailu_create_test_window_with_glib_init(_on_done, _on_focus_in);
+
+   glob_box = elm_box_add(win);
+   evas_object_size_hint_weight_set(glob_box, EVAS_HINT_EXPAND,
+                                    EVAS_HINT_EXPAND);
+   elm_win_resize_object_add(win, glob_box);
+   evas_object_show(glob_box);
+
+   glob_table = elm_table_add(win);
+   elm_box_pack_end(glob_box, glob_table);
+   evas_object_show(glob_table);
+
+   glob_buttons = g_ptr_array_new();
+   for (i = 0; i < 20; ++i)
+     {
+        Evas_Object *button = elm_button_add(win);
+
+        elm_object_text_set(button, "button");
+        elm_box_pack_end(glob_box, button);
+        evas_object_show(button);
+        g_ptr_array_add(glob_buttons, button);
+     }
+
+   evas_object_show(win);
+
+   elm_run();
+   elm_shutdown();
+
+   g_ptr_array_free(glob_buttons, TRUE);
+
+   /* exit code */
+   return 0;
+}
+ELM_MAIN()
@@ -0,0 +1,158 @@
+/*
+ * Tested interface: eail bridge start-up (EAIL_BRIDGE)
+ *
+ * Tested AtkObject: EailButton
+ *
+ * Description: Benchmark of application start-up, run in child processes
+ * with eager and lazy bridge. Lazy bridge must not be started before
+ * accessibility gets enabled, eager one must be running once the window is
+ * shown
+ *
+ * Test input: window with 200 buttons
+ *
+ * Expected test result: bridge state matches its mode in every run, test
+ * should return 0 (success)
+ */
+
+#include <string.h>
+
+#include <Elementary.h>
+#include <atk/atk.h>
+#include <gmodule.h>
+
+#include "eail_test_utils.h"
+
+#define EAIL_TEST_CHILD_ARG "--child"
+#define EAIL_TEST_RUNS 5
+#define EAIL_TEST_BUTTONS 200
+#define EAIL_TEST_WINDOW_TITLE "Eail start-up benchmark"
+#define EAIL_TEST_WINDOW_SIZE 400
+/* session bus without accessibility enabled on it */
+#define EAIL_TEST_NO_BUS "unix:path=/nonexistent"
+
+typedef gboolean (*EailTestStartedFunc)(void);
+
+/* bridge modes compared, see EAIL_BRIDGE in eail.h */
+static const char * const eail_test_modes[] = { "eager", "lazy" };
+
+/* checks that lazy mode did not start anything before accessibility is on */
+static void
+_check_bridge(void)
+{
+   gboolean lazy = !g_strcmp0(g_getenv("EAIL_BRIDGE"), "lazy");
+   GModule *module;
+   gpointer symbol = NULL;
+
+   module = g_module_open(NULL, 0);
+   g_assert(module);
+   g_assert(g_module_symbol(module, "eail_bridge_is_started", &symbol));
+
+   if (lazy)
+     {
+        g_assert(!((EailTestStartedFunc)symbol)());
+        g_assert(!atk_misc_instance);
+     }
+   else
+     g_assert(((EailTestStartedFunc)symbol)());
+
+   g_module_close(module);
+}
+
+static Eina_Bool
+_on_shown(void *data)
+{
+   _check_bridge();
+   elm_exit();
+
+   return ECORE_CALLBACK_CANCEL;
+}
+
+/* starts a small application and quits once its first frame is shown */
+static int
+_run_child(void)
+{
+   Evas_Object *win, *box, *button;
+   int i;
+
+   if (!ecore_main_loop_glib_integrate())
+     return 1;
+
+   win = elm_win_add(NULL, EAIL_TEST_WINDOW_TITLE, ELM_WIN_BASIC);
+   box = elm_box_add(win);
+   evas_object_size_hint_weight_set(box, EVAS_HINT_EXPAND, EVAS_HINT_EXPAND);
+   elm_win_resize_object_add(win, box);
+   evas_object_show(box);
+
+   for (i = 0; i < EAIL_TEST_BUTTONS; ++i)
+     {
+        button = elm_button_add(win);
+        elm_object_text_set(button, "button");
+        elm_box_pack_end(box, button);
+        evas_object_show(button);
+     }
+
+   evas_object_resize(win, EAIL_TEST_WINDOW_SIZE, EAIL_TEST_WINDOW_SIZE);
+   evas_object_show(win);
+
+   ecore_idler_add(_on_shown, NULL);
+   elm_run();
+
+   return 0;
+}
+
+/* measures mean start-up time of child application in given bridge mode */
+static gdouble
+_measure_mode(const char *self, const char *mode)
+{
+   gchar *argv[] = { (gchar *)self, EAIL_TEST_CHILD_ARG, NULL };
+   gchar **envp = g_get_environ();
+   gint64 total = 0;
+   int i;
+
+   envp = g_environ_setenv(envp, "EAIL_BRIDGE", mode, TRUE);
+   /* accessibility cannot get enabled, lazy bridge must stay stopped */
+   if (!strcmp(mode, "lazy"))
+     envp = g_environ_setenv(envp, "DBUS_SESSION_BUS_ADDRESS",
+                             EAIL_TEST_NO_BUS, TRUE);
+
+   for (i = 0; i < EAIL_TEST_RUNS; ++i)
+     {
+        gint64 start = g_get_monotonic_time();
+        gint status = -1;
+        gboolean success;
+
+        success = g_spawn_sync(NULL, argv, envp, 0, NULL, NULL, NULL, NULL,
+                               &status, NULL);
+        g_assert(success);
+        g_assert(status == 0);
+
+        total += g_get_monotonic_time() - start;
+     }
+
+   g_strfreev(envp);
+
+   return total / (gdouble)EAIL_TEST_RUNS / G_USEC_PER_SEC;
+}
+
+EAPI_MAIN int
+elm_main(int argc, char **argv)
+{
+   guint i;
+
+   if (argc > 1 && !strcmp(argv[1], EAIL_TEST_CHILD_ARG))
+     return _run_child();
+
+   _printf("Measuring start-up time....\n");
+
+   for (i = 0; i < G_N_ELEMENTS(eail_test_modes); ++i)
+     _printf("%s bridge: %f s per start-up (%d runs, %d buttons)\n",
+             eail_test_modes[i],
+             _measure_mode(argv[0], eail_test_modes[i]),
+             EAIL_TEST_RUNS, EAIL_TEST_BUTTONS);
+
+   _printf("DONE. Start-up benchmark finished\n");
+
+   /* exit code */
+   return 0;
+}
+ELM_MAIN()
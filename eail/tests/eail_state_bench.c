@@ -0,0 +1,278 @@
+/*
+ * Tested interface: AtkObject
+ *
+ * Tested AtkObject: EailWindow, EailButton
+ *
+ * Description: Measure ref_state_set of many widgets and check that SHOWING
+ * follows scroller viewport and RESIZABLE follows weights of window content.
+ * Query time must not grow with clip depth nor with number of widgets while
+ * states are tracked, that is while EAIL_SUBSCRIPTION_GEOMETRY is taken
+ *
+ * Test input: accessible objects representing EailWindow and EailButton
+ *
+ * Expected test result: test should return 0 (success)
+ */
+
+#include <Elementary.h>
+#include <atk/atk.h>
+#include <gmodule.h>
+
+#include "eail_test_utils.h"
+#include "eail_subscription.h"
+
+#define EAIL_TEST_WIDGETS 1000
+#define EAIL_TEST_FEW_WIDGETS 100
+#define EAIL_TEST_CLIP_DEPTH 64
+#define EAIL_TEST_ROUNDS 20
+#define EAIL_TEST_WINDOW_SIZE 200
+/* allowed ratio of query times, leaves room for timing noise */
+#define EAIL_TEST_MAX_RATIO 3.0
+
+typedef AtkObject *(*EailTestGetFunc)(Evas_Object *widget);
+typedef void (*EailTestSubscribeFunc)(guint subscriptions);
+
+/* eail_factory_get_accessible resolved from the loaded module */
+static EailTestGetFunc eail_test_get_accessible = NULL;
+static EailTestSubscribeFunc eail_test_subscription_add = NULL;
+static EailTestSubscribeFunc eail_test_subscription_remove = NULL;
+
+static Evas_Object *glob_win = NULL;
+static Evas_Object *glob_scroller = NULL;
+static Evas_Object *glob_buttons[EAIL_TEST_WIDGETS];
+static Evas_Object *glob_clipped[EAIL_TEST_FEW_WIDGETS];
+
+/* used to determine if test code has been successfully called */
+static gboolean eail_test_code_called = FALSE;
+
+static void
+_on_done(void *data, Evas_Object *obj, void *event_info)
+{
+   elm_exit();
+}
+
+static gboolean
+_test_has_state(AtkObject *obj, AtkStateType state)
+{
+   AtkStateSet *state_set = atk_object_ref_state_set(obj);
+   gboolean result = atk_state_set_contains_state(state_set, state);
+
+   g_object_unref(state_set);
+
+   return result;
+}
+
+static AtkObject *
+_test_button_accessible(guint i)
+{
+   AtkObject *obj = eail_test_get_accessible(glob_buttons[i]);
+
+   g_assert(obj);
+
+   return obj;
+}
+
+static void
+_test_scroll_to(Evas_Coord y)
+{
+   elm_scroller_region_show(glob_scroller, 0, y, EAIL_TEST_WINDOW_SIZE,
+                            EAIL_TEST_WINDOW_SIZE);
+   evas_smart_objects_calculate(evas_object_evas_get(glob_win));
+}
+
+static void
+_test_showing(void)
+{
+   AtkObject *first = _test_button_accessible(0);
+   AtkObject *last = _test_button_accessible(EAIL_TEST_WIDGETS - 1);
+   Evas_Coord h;
+
+   g_assert(_test_has_state(first, ATK_STATE_SHOWING));
+   g_assert(_test_has_state(last, ATK_STATE_VISIBLE));
+   g_assert(!_test_has_state(last, ATK_STATE_SHOWING));
+
+   elm_scroller_child_size_get(glob_scroller, NULL, &h);
+   _test_scroll_to(h - EAIL_TEST_WINDOW_SIZE);
+
+   g_assert(!_test_has_state(first, ATK_STATE_SHOWING));
+   g_assert(_test_has_state(last, ATK_STATE_SHOWING));
+
+   _test_scroll_to(0);
+   g_assert(_test_has_state(first, ATK_STATE_SHOWING));
+}
+
+static void
+_test_resizable(void)
+{
+   AtkObject *win = eail_test_get_accessible(glob_win);
+
+   g_assert(win);
+   g_assert(_test_has_state(win, ATK_STATE_RESIZABLE));
+
+   evas_object_size_hint_weight_set(glob_scroller, 0.0, 0.0);
+   g_assert(!_test_has_state(win, ATK_STATE_RESIZABLE));
+
+   evas_object_size_hint_weight_set(glob_scroller, EVAS_HINT_EXPAND,
+                                    EVAS_HINT_EXPAND);
+   g_assert(_test_has_state(win, ATK_STATE_RESIZABLE));
+}
+
+/* mean time of a state set query in us */
+static gdouble
+_test_query_time(const char *label, Evas_Object **widgets, guint n)
+{
+   AtkObject **objs = g_new(AtkObject *, n);
+   GTimer *timer;
+   gdouble time;
+   guint i, j;
+
+   for (i = 0; i < n; ++i)
+     {
+        objs[i] = eail_test_get_accessible(widgets[i]);
+        g_assert(objs[i]);
+     }
+
+   timer = g_timer_new();
+   for (j = 0; j < EAIL_TEST_ROUNDS; ++j)
+     for (i = 0; i < n; ++i)
+       g_object_unref(atk_object_ref_state_set(objs[i]));
+   g_timer_stop(timer);
+
+   time = g_timer_elapsed(timer, NULL) * G_USEC_PER_SEC /
+      (n * EAIL_TEST_ROUNDS);
+   _printf("%s: %u state set queries, %f us per query\n",
+           label, n * EAIL_TEST_ROUNDS, time);
+
+   g_timer_destroy(timer);
+   g_free(objs);
+
+   return time;
+}
+
+static void
+_test_measure(void)
+{
+   gdouble few, all, clipped;
+
+   /* states are computed on demand without subscribers */
+   _test_query_time("not tracked, deep clip chain", glob_clipped,
+                    EAIL_TEST_FEW_WIDGETS);
+
+   eail_test_subscription_add(EAIL_SUBSCRIPTION_GEOMETRY);
+
+   few = _test_query_time("few widgets", glob_buttons,
+                          EAIL_TEST_FEW_WIDGETS);
+   all = _test_query_time("all widgets", glob_buttons, EAIL_TEST_WIDGETS);
+   clipped = _test_query_time("deep clip chain", glob_clipped,
+                              EAIL_TEST_FEW_WIDGETS);
+
+   g_assert(all < few * EAIL_TEST_MAX_RATIO);
+   g_assert(clipped < few * EAIL_TEST_MAX_RATIO);
+
+   /* states of deeply clipped widgets are still right */
+   g_assert(_test_has_state(eail_test_get_accessible(glob_clipped[0]),
+                            ATK_STATE_SHOWING));
+
+   eail_test_subscription_remove(EAIL_SUBSCRIPTION_GEOMETRY);
+}
+
+/* widgets clipped by a chain of EAIL_TEST_CLIP_DEPTH rectangles */
+static void
+_init_clipped(void)
+{
+   Evas *evas = evas_object_evas_get(glob_win);
+   Evas_Object *clip = NULL, *rect;
+   guint i;
+
+   for (i = 0; i < EAIL_TEST_CLIP_DEPTH; ++i)
+     {
+        rect = evas_object_rectangle_add(evas);
+        evas_object_resize(rect, EAIL_TEST_WINDOW_SIZE, EAIL_TEST_WINDOW_SIZE);
+        if (clip) evas_object_clip_set(rect, clip);
+        evas_object_show(rect);
+        clip = rect;
+     }
+
+   for (i = 0; i < EAIL_TEST_FEW_WIDGETS; ++i)
+     {
+        glob_clipped[i] = elm_button_add(glob_win);
+        elm_object_text_set(glob_clipped[i], "clipped");
+        evas_object_resize(glob_clipped[i], EAIL_TEST_WINDOW_SIZE / 2,
+                           EAIL_TEST_WINDOW_SIZE / 2);
+        evas_object_clip_set(glob_clipped[i], clip);
+        evas_object_show(glob_clipped[i]);
+     }
+}
+
+static void
+_on_focus_in(void *data, Evas_Object *obj, void *event_info)
+{
+   static gboolean started = FALSE;
+   GModule *module;
+   gpointer symbol = NULL;
+
+   if (started) return;
+   started = TRUE;
+
+   module = g_module_open(NULL, 0);
+   g_assert(module);
+   g_assert(g_module_symbol(module, "eail_factory_get_accessible", &symbol));
+   eail_test_get_accessible = (EailTestGetFunc)symbol;
+   g_assert(g_module_symbol(module, "eail_subscription_add", &symbol));
+   eail_test_subscription_add = (EailTestSubscribeFunc)symbol;
+   g_assert(g_module_symbol(module, "eail_subscription_remove", &symbol));
+   eail_test_subscription_remove = (EailTestSubscribeFunc)symbol;
+
+   _printf("Measuring state set queries....\n");
+
+   _test_showing();
+   _test_resizable();
+   _test_measure();
+
+   g_module_close(module);
+
+   _printf("DONE. State benchmark finished\n");
+   eail_test_code_called = TRUE;
+
+   g_assert(eail_test_code_called);
+   elm_exit();
+}
+
+EAPI_MAIN int
+elm_main(int argc, char **argv)
+{
+   Evas_Object *box;
+   guint i;
+
+   glob_win = eailu_create_test_window_with_glib_init(_on_done, _on_focus_in);
+
+   glob_scroller = elm_scroller_add(glob_win);
+   evas_object_size_hint_weight_set(glob_scroller, EVAS_HINT_EXPAND,
+                                    EVAS_HINT_EXPAND);
+   elm_win_resize_object_add(glob_win, glob_scroller);
+   evas_object_show(glob_scroller);
+
+   box = elm_box_add(glob_win);
+   evas_object_size_hint_weight_set(box, EVAS_HINT_EXPAND, 0.0);
+   elm_object_content_set(glob_scroller, box);
+   evas_object_show(box);
+
+   for (i = 0; i < EAIL_TEST_WIDGETS; ++i)
+     {
+        glob_buttons[i] = elm_button_add(glob_win);
+        elm_object_text_set(glob_buttons[i], "button");
+        elm_box_pack_end(box, glob_buttons[i]);
+        evas_object_show(glob_buttons[i]);
+     }
+
+   _init_clipped();
+
+   evas_object_resize(glob_win, EAIL_TEST_WINDOW_SIZE, EAIL_TEST_WINDOW_SIZE);
+   evas_object_show(glob_win);
+
+   elm_run();
+   elm_shutdown();
+
+   /* exit code */
+   return 0;
+}
+ELM_MAIN()
@@ -1,5 +1,6 @@
 #include <atk/atk.h>
 #include <Elementary.h>
+#include <stdio.h>
 #include <string.h>
 
 #include "eail_test_utils.h"
@@ -268,3 +269,20 @@ eailu_test_action_description_all(AtkAction *action_obj)
    g_assert(FALSE == atk_action_set_description(action_obj, actions_num, desc_set));
    g_assert(NULL == atk_action_get_description(action_obj, actions_num));
 }
+
+glong
+eailu_get_rss(void)
+{
+   gchar *status = NULL, *line;
+   glong rss = 0;
+
+   if (!g_file_get_contents("/proc/self/status", &status, NULL, NULL))
+     return 0;
+
+   line = strstr(status, "VmRSS:");
+   if (line)
+     sscanf(line, "VmRSS: %ld", &rss);
+   g_free(status);
+
+   return rss;
+}
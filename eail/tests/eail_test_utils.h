@@ -109,6 +109,11 @@ void eailu_test_action_description_all(AtkAction *action_obj);
  */
 void eailu_test_atk_focus(AtkObject *obj, gboolean focusable);
 
+/**
+ * Gets resident set size of current process in kB, 0 if it is unknown
+ */
+glong eailu_get_rss(void);
+
 /**
  * Printf for debug
  */
@@ -0,0 +1,176 @@
+/*
+ * Tested interface: eail_text_segment
+ *
+ * Tested AtkObject: none
+ *
+ * Description: Test word and sentence boundaries found by the segmenter,
+ * covering property tables (letters, numbers, Katakana, Thai, Han) and the
+ * boundary walk (sentence terminators, abbreviations, paragraph separators)
+ *
+ * Test input: UTF-8 strings
+ *
+ * Expected test result: test should return 0 (success)
+ */
+
+#include <Elementary.h>
+#include <atk/atk.h>
+#include <gmodule.h>
+
+#include "eail_test_utils.h"
+#include "eail_text_segment.h"
+
+/* terminates lists of expected positions */
+#define EAIL_TEST_END -1
+
+typedef guint8 *(*EailTestSegmentFunc)(const gchar *text, gint *length);
+
+static EailTestSegmentFunc eail_test_segment = NULL;
+
+/* used to determine if test code has been successfully called */
+static gboolean eail_test_code_called = FALSE;
+
+static void
+_on_done(void *data, Evas_Object *obj, void *event_info)
+{
+   elm_exit();
+}
+
+/* checks that flag is set exactly at expected positions */
+static void
+_test_positions(const gchar *text, guint8 flag, const gint *expected)
+{
+   guint8 *flags;
+   gint length = 0, i, j = 0;
+
+   flags = eail_test_segment(text, &length);
+   g_assert(length == g_utf8_strlen(text, -1));
+
+   for (i = 0; i <= length; ++i)
+     {
+        gboolean is_expected = expected[j] == i;
+
+        if (!!(flags[i] & flag) != is_expected)
+          {
+             _printf("\"%s\": flag %u %s at %d\n", text, flag,
+                     is_expected ? "missing" : "unexpected", i);
+             g_assert_not_reached();
+          }
+
+        if (is_expected) j++;
+     }
+   g_assert(expected[j] == EAIL_TEST_END);
+
+   g_free(flags);
+}
+
+static void
+_test_words(const gchar *text, const gint *starts, const gint *ends)
+{
+   _test_positions(text, EAIL_TEXT_WORD_START, starts);
+   _test_positions(text, EAIL_TEXT_WORD_END, ends);
+}
+
+static void
+_test_sentences(const gchar *text, const gint *starts, const gint *ends)
+{
+   _test_positions(text, EAIL_TEXT_SENTENCE_START, starts);
+   _test_positions(text, EAIL_TEXT_SENTENCE_END, ends);
+}
+
+static void
+_test_word_tables(void)
+{
+   static const gint latin_starts[] = { 0, 8, 14, EAIL_TEST_END };
+   static const gint latin_ends[] = { 5, 12, 21, EAIL_TEST_END };
+   static const gint kana_starts[] = { 0, 4, EAIL_TEST_END };
+   static const gint kana_ends[] = { 4, 5, EAIL_TEST_END };
+   static const gint thai_starts[] = { 0, 8, EAIL_TEST_END };
+   static const gint thai_ends[] = { 7, 12, EAIL_TEST_END };
+   static const gint han_starts[] = { 0, 1, 2, EAIL_TEST_END };
+   static const gint han_ends[] = { 1, 2, 3, EAIL_TEST_END };
+   static const gint tab_starts[] = { 0, 4, 10, EAIL_TEST_END };
+   static const gint tab_ends[] = { 3, 7, 15, EAIL_TEST_END };
+   static const gint empty[] = { EAIL_TEST_END };
+
+   /* apostrophe (WB6, WB7), decimal point (WB11, WB12), underscore (WB13a,
+    * WB13b); punctuation and spaces do not form words */
+   _test_words("can't, (3.14) foo_bar!", latin_starts, latin_ends);
+   /* Katakana run (WB13), Hiragana letter forms a word of its own */
+   _test_words("カタカナの", kana_starts, kana_ends);
+   /* Thai runs are kept together, combining vowels and tones included */
+   _test_words("ภาษาไทย ง่าย", thai_starts, thai_ends);
+   /* ideographs are one-character words */
+   _test_words("中文字", han_starts, han_ends);
+   /* tab is not a space separator (WSegSpace), but still separates words */
+   _test_words("one\ttwo \t three", tab_starts, tab_ends);
+   _test_words("", empty, empty);
+   _test_words(" ... ", empty, empty);
+}
+
+static void
+_test_sentence_walk(void)
+{
+   static const gint simple_starts[] = { 0, 13, 27, EAIL_TEST_END };
+   static const gint simple_ends[] = { 12, 25, 32, EAIL_TEST_END };
+   static const gint abbrev_starts[] = { 0, 20, EAIL_TEST_END };
+   static const gint abbrev_ends[] = { 19, 28, EAIL_TEST_END };
+   static const gint quote_starts[] = { 0, 8, EAIL_TEST_END };
+   static const gint quote_ends[] = { 7, 11, EAIL_TEST_END };
+   static const gint para_starts[] = { 0, 4, EAIL_TEST_END };
+   static const gint para_ends[] = { 3, 7, EAIL_TEST_END };
+
+   /* end follows terminator, trailing spaces belong to no sentence */
+   _test_sentences("Hello world. How are you?  Fine.", simple_starts,
+                   simple_ends);
+   /* full stop followed by lowercase (SB8) or digit (SB6) does not end
+    * sentence */
+   _test_sentences("See e.g. the 3.5 s. Next one", abbrev_starts,
+                   abbrev_ends);
+   /* closing punctuation stays in sentence (SB9) */
+   _test_sentences("\"Stop!\" Now", quote_starts, quote_ends);
+   /* paragraph separator ends sentence without terminator (SB4) */
+   _test_sentences("one\ntwo", para_starts, para_ends);
+}
+
+static void
+_on_focus_in(void *data, Evas_Object *obj, void *event_info)
+{
+   static gboolean started = FALSE;
+   GModule *module;
+   gpointer symbol = NULL;
+
+   if (started) return;
+   started = TRUE;
+
+   module = g_module_open(NULL, 0);
+   g_assert(module);
+   g_assert(g_module_symbol(module, "eail_text_segment", &symbol));
+   eail_test_segment = (EailTestSegmentFunc)symbol;
+
+   _test_word_tables();
+   _test_sentence_walk();
+
+   g_module_close(module);
+
+   _printf("DONE. All text segment tests passed successfully \n");
+   eail_test_code_called = TRUE;
+
+   g_assert(eail_test_code_called);
+   elm_exit();
+}
+
+EAPI_MAIN int
+elm_main(int argc, char **argv)
+{
+   Evas_Object *win;
+
+   win = eailu_create_test_window_with_glib_init(_on_done, _on_focus_in);
+   evas_object_show(win);
+
+   elm_run();
+   elm_shutdown();
+
+   /* exit code */
+   return 0;
+}
+ELM_MAIN()
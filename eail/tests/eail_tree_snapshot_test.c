@@ -0,0 +1,247 @@
+/*
+ * Tested interface: eail_tree_snapshot
+ *
+ * Tested AtkObject: EailButton
+ *
+ * Description: Test binary and JSON tree snapshots and their snprintf-like
+ * size contract (measuring, too small buffer, exact buffer)
+ *
+ * Test input: accessible objects representing EailButton
+ *
+ * Expected test result: test should return 0 (success)
+ */
+
+#include <string.h>
+
+#include <Elementary.h>
+#include <atk/atk.h>
+#include <gmodule.h>
+
+#include "eail_test_utils.h"
+#include "eail_tree_snapshot.h"
+
+#define EAIL_TEST_BUTTON_NAME "snapshot button"
+#define EAIL_TEST_QUOTED_NAME "say \"hi\""
+#define EAIL_TEST_QUOTED_JSON "\"say \\\"hi\\\"\""
+/* filler of guard bytes, snapshot never writes past given size */
+#define EAIL_TEST_GUARD 0xa5
+#define EAIL_TEST_GUARD_SIZE 64
+
+typedef gsize (*EailTestSnapshotFunc)(EailTreeSnapshotFormat format,
+                                      AtkCoordType coord_type,
+                                      guint8 *buffer,
+                                      gsize size);
+
+static EailTestSnapshotFunc eail_test_snapshot = NULL;
+
+/* used to determine if test code has been successfully called */
+static gboolean eail_test_code_called = FALSE;
+
+static void
+_on_done(void *data, Evas_Object *obj, void *event_info)
+{
+   elm_exit();
+}
+
+/* takes snapshot checking the size contract, free with g_free */
+static guint8 *
+_test_take_snapshot(EailTreeSnapshotFormat format, gsize *size)
+{
+   guint8 *buffer;
+   gsize needed, i;
+
+   needed = eail_test_snapshot(format, ATK_XY_WINDOW, NULL, 0);
+   g_assert(needed > 0);
+
+   /* too small buffer gets the same size and is not overrun */
+   buffer = g_malloc(needed + EAIL_TEST_GUARD_SIZE);
+   memset(buffer, EAIL_TEST_GUARD, needed + EAIL_TEST_GUARD_SIZE);
+   g_assert(eail_test_snapshot(format, ATK_XY_WINDOW, buffer, needed / 2) ==
+            needed);
+   for (i = needed / 2; i < needed + EAIL_TEST_GUARD_SIZE; ++i)
+     g_assert(buffer[i] == EAIL_TEST_GUARD);
+
+   /* exact buffer is filled completely */
+   g_assert(eail_test_snapshot(format, ATK_XY_WINDOW, buffer, needed) ==
+            needed);
+   for (i = needed; i < needed + EAIL_TEST_GUARD_SIZE; ++i)
+     g_assert(buffer[i] == EAIL_TEST_GUARD);
+
+   *size = needed;
+   return buffer;
+}
+
+static void
+_test_binary(AtkObject *button, guint32 *n_nodes)
+{
+   EailTreeSnapshotHeader header;
+   EailTreeSnapshotNode node;
+   guint8 *buffer;
+   gsize size, offset;
+   guint32 i, n_children = 0;
+   gboolean found = FALSE;
+   gint x, y, w, h;
+
+   buffer = _test_take_snapshot(EAIL_TREE_SNAPSHOT_BINARY, &size);
+   g_assert(size >= sizeof(header));
+
+   memcpy(&header, buffer, sizeof(header));
+   g_assert(header.magic == EAIL_TREE_SNAPSHOT_MAGIC);
+   g_assert(header.version == EAIL_TREE_SNAPSHOT_VERSION);
+   g_assert(header.node_size == sizeof(EailTreeSnapshotNode));
+   g_assert(header.n_nodes > 1);
+
+   atk_component_get_extents(ATK_COMPONENT(button), &x, &y, &w, &h,
+                             ATK_XY_WINDOW);
+
+   offset = sizeof(header);
+   for (i = 0; i < header.n_nodes; ++i)
+     {
+        g_assert(offset + sizeof(node) <= size);
+        memcpy(&node, buffer + offset, sizeof(node));
+        offset += sizeof(node);
+
+        /* parents are written before their children */
+        if (i == 0)
+          g_assert(node.parent == -1);
+        else
+          g_assert(node.parent >= 0 && (guint32)node.parent < i);
+
+        n_children += node.n_children;
+
+        g_assert(offset + node.name_length <= size);
+        if (node.id == (guint64)(gsize)button)
+          {
+             g_assert(node.name_length == strlen(EAIL_TEST_BUTTON_NAME));
+             g_assert(!memcmp(buffer + offset, EAIL_TEST_BUTTON_NAME,
+                              node.name_length));
+             g_assert(node.role == ATK_ROLE_PUSH_BUTTON);
+             g_assert(node.interfaces & EAIL_INTERFACE_ACTION);
+             g_assert(node.x == x && node.y == y);
+             g_assert(node.width == w && node.height == h);
+             found = TRUE;
+          }
+
+        offset += (node.name_length + 7) / 8 * 8;
+     }
+
+   g_assert(offset == size);
+   g_assert(n_children == header.n_nodes - 1);
+   g_assert(found);
+
+   *n_nodes = header.n_nodes;
+   g_free(buffer);
+}
+
+static void
+_test_json(guint32 n_nodes)
+{
+   guint8 *buffer;
+   gchar *json, *p;
+   gsize size;
+   guint32 n_ids = 0;
+   gint depth = 0;
+   gboolean in_string = FALSE;
+
+   buffer = _test_take_snapshot(EAIL_TREE_SNAPSHOT_JSON, &size);
+
+   /* JSON snapshot is not NUL-terminated */
+   json = g_strndup((const gchar *)buffer, size);
+   g_free(buffer);
+
+   g_assert(g_str_has_prefix(json, "{\"version\":"));
+   g_assert(json[size - 1] == '}');
+   g_assert(strstr(json, "\"name\":\"" EAIL_TEST_BUTTON_NAME "\""));
+   g_assert(strstr(json, "\"name\":" EAIL_TEST_QUOTED_JSON));
+   g_assert(strstr(json, "\"attributes\":{\"type\":\"elm_button\"}"));
+
+   for (p = json; *p; ++p)
+     {
+        if (in_string)
+          {
+             if (*p == '\\') p++;
+             else if (*p == '"') in_string = FALSE;
+             continue;
+          }
+
+        if (*p == '"')
+          {
+             in_string = TRUE;
+             if (g_str_has_prefix(p, "\"id\":")) n_ids++;
+          }
+        else if (*p == '{' || *p == '[')
+          depth++;
+        else if (*p == '}' || *p == ']')
+          g_assert(--depth >= 0);
+     }
+
+   g_assert(!in_string);
+   g_assert(depth == 0);
+   g_assert(n_ids == n_nodes);
+
+   g_free(json);
+}
+
+static void
+_on_focus_in(void *data, Evas_Object *obj, void *event_info)
+{
+   static gboolean started = FALSE;
+   GModule *module;
+   gpointer symbol = NULL;
+   AtkObject *button;
+   guint32 n_nodes = 0;
+
+   if (started) return;
+   started = TRUE;
+
+   module = g_module_open(NULL, 0);
+   g_assert(module);
+   g_assert(g_module_symbol(module, "eail_tree_snapshot", &symbol));
+   eail_test_snapshot = (EailTestSnapshotFunc)symbol;
+
+   button = eailu_find_child_with_name(atk_get_root(), EAIL_TEST_BUTTON_NAME);
+   g_assert(button);
+
+   _test_binary(button, &n_nodes);
+   _test_json(n_nodes);
+
+   g_module_close(module);
+
+   _printf("DONE. All tree snapshot tests passed successfully \n");
+   eail_test_code_called = TRUE;
+
+   g_assert(eail_test_code_called);
+   elm_exit();
+}
+
+EAPI_MAIN int
+elm_main(int argc, char **argv)
+{
+   Evas_Object *win, *box, *button;
+
+   win = eailu_create_test_window_with_glib_init(_on_done, _on_focus_in);
+
+   box = elm_box_add(win);
+   evas_object_size_hint_weight_set(box, EVAS_HINT_EXPAND, EVAS_HINT_EXPAND);
+   elm_win_resize_object_add(win, box);
+   evas_object_show(box);
+
+   button = elm_button_add(win);
+   elm_object_text_set(button, EAIL_TEST_BUTTON_NAME);
+   elm_box_pack_end(box, button);
+   evas_object_show(button);
+
+   button = elm_button_add(win);
+   elm_object_text_set(button, EAIL_TEST_QUOTED_NAME);
+   elm_box_pack_end(box, button);
+   evas_object_show(button);
+
+   evas_object_show(win);
+
+   elm_run();
+   elm_shutdown();
+
+   /* exit code */
+   return 0;
+}
+ELM_MAIN()
@@ -0,0 +1,98 @@
+/*
+ * Tested interface: AtkObject
+ *
+ * Tested AtkObject: EailWindow
+ *
+ * Description: Test that windows listed as children of application follow
+ * a window being deleted while another one is added
+ *
+ * Test input: accessible objects representing EailWindow
+ *
+ * Expected test result: test should return 0 (success)
+ */
+
+#include <Elementary.h>
+#include <atk/atk.h>
+
+#include "eail_test_utils.h"
+
+#define EAIL_TEST_DYING_TITLE "dying window"
+#define EAIL_TEST_NEW_TITLE "new window"
+
+/* used to determine if test code has been successfully called */
+static gboolean eail_test_code_called = FALSE;
+
+static void
+_on_done(void *data, Evas_Object *obj, void *event_info)
+{
+   elm_exit();
+}
+
+static Evas_Object *
+_test_window_add(const char *title)
+{
+   Evas_Object *win = elm_win_add(NULL, title, ELM_WIN_BASIC);
+
+   elm_win_title_set(win, title);
+   evas_object_show(win);
+
+   return win;
+}
+
+static void
+_check_last_window(AtkObject *root, const char *title)
+{
+   gint n_children = atk_object_get_n_accessible_children(root);
+   AtkObject *window;
+
+   g_assert(n_children > 0);
+   window = atk_object_ref_accessible_child(root, n_children - 1);
+   g_assert(window);
+   g_assert_cmpstr(atk_object_get_name(window), ==, title);
+   g_object_unref(window);
+}
+
+static void
+_on_focus_in(void *data, Evas_Object *obj, void *event_info)
+{
+   static gboolean started = FALSE;
+   AtkObject *root = atk_get_root();
+   Evas_Object *dying;
+   gint n_children;
+
+   if (started) return;
+   started = TRUE;
+
+   dying = _test_window_add(EAIL_TEST_DYING_TITLE);
+   _check_last_window(root, EAIL_TEST_DYING_TITLE);
+   n_children = atk_object_get_n_accessible_children(root);
+
+   /* number of windows stays the same */
+   evas_object_del(dying);
+   _test_window_add(EAIL_TEST_NEW_TITLE);
+
+   g_assert(atk_object_get_n_accessible_children(root) == n_children);
+   _check_last_window(root, EAIL_TEST_NEW_TITLE);
+
+   _printf("DONE. All application window tests passed successfully \n");
+   eail_test_code_called = TRUE;
+
+   g_assert(eail_test_code_called);
+   elm_exit();
+}
+
+EAPI_MAIN int
+elm_main(int argc, char **argv)
+{
+   Evas_Object *win;
+
+   win = eailu_create_test_window_with_glib_init(_on_done, _on_focus_in);
+   evas_object_show(win);
+
+   elm_run();
+   elm_shutdown();
+
+   /* exit code */
+   return 0;
+}
+ELM_MAIN()
@@ -0,0 +1,200 @@
+/*
+ * Tested interface: eail_window_snapshot_geometry_blob
+ *
+ * Tested AtkObject: EailWindow
+ *
+ * Description: Test geometry snapshot blob of window subtree - records
+ * come in document order with index, parent and index in parent matching
+ * the accessible tree, and rectangles equal to atk_component_get_extents
+ *
+ * Test input: window with buttons and a list with items
+ *
+ * Expected test result: test should return 0 (success)
+ */
+
+#include <string.h>
+
+#include <Elementary.h>
+#include <atk/atk.h>
+#include <gmodule.h>
+
+#include "eail_test_utils.h"
+#include "eail_window.h"
+
+#define EAIL_TEST_BUTTON_NAME "geometry button"
+#define EAIL_TEST_BUTTONS 5
+#define EAIL_TEST_ITEMS 5
+
+typedef guint8 *(*EailTestBlobFunc)(AtkObject *window,
+                                    AtkCoordType coord_type,
+                                    gsize *size);
+
+/* accessible expected at given record, in document order */
+typedef struct _EailTestNode
+{
+   AtkObject *obj;
+   gint parent;
+   gint index_in_parent;
+} EailTestNode;
+
+/* used to determine if test code has been successfully called */
+static gboolean eail_test_code_called = FALSE;
+
+static void
+_on_done(void *data, Evas_Object *obj, void *event_info)
+{
+   elm_exit();
+}
+
+/* lists obj and its subtree in document order, objects are referenced */
+static void
+_test_collect(GArray *nodes, AtkObject *obj, gint parent, gint index)
+{
+   EailTestNode node;
+   gint i, n, self = nodes->len;
+
+   node.obj = g_object_ref(obj);
+   node.parent = parent;
+   node.index_in_parent = index;
+   g_array_append_val(nodes, node);
+
+   n = atk_object_get_n_accessible_children(obj);
+   for (i = 0; i < n; ++i)
+     {
+        AtkObject *child = atk_object_ref_accessible_child(obj, i);
+
+        g_assert(child);
+        _test_collect(nodes, child, self, i);
+        g_object_unref(child);
+     }
+}
+
+static void
+_test_blob(EailTestBlobFunc blob_func, AtkObject *window)
+{
+   EailGeometrySnapshotHeader header;
+   EailGeometryRecord record;
+   GArray *nodes;
+   guint8 *blob;
+   gsize size;
+   guint32 i;
+
+   nodes = g_array_new(FALSE, FALSE, sizeof(EailTestNode));
+   _test_collect(nodes, window, -1, -1);
+   g_assert(nodes->len > EAIL_TEST_BUTTONS + EAIL_TEST_ITEMS);
+
+   blob = blob_func(window, ATK_XY_WINDOW, &size);
+   g_assert(blob);
+   g_assert(size >= sizeof(header));
+
+   memcpy(&header, blob, sizeof(header));
+   g_assert(header.magic == EAIL_GEOMETRY_SNAPSHOT_MAGIC);
+   g_assert(header.version == EAIL_GEOMETRY_SNAPSHOT_VERSION);
+   g_assert(header.record_size == sizeof(EailGeometryRecord));
+   g_assert_cmpuint(header.n_records, ==, nodes->len);
+   g_assert(size == sizeof(header) +
+            header.n_records * sizeof(EailGeometryRecord));
+
+   for (i = 0; i < header.n_records; ++i)
+     {
+        EailTestNode *node = &g_array_index(nodes, EailTestNode, i);
+        gint x, y, w, h;
+
+        memcpy(&record, blob + sizeof(header) + i * sizeof(record),
+               sizeof(record));
+
+        /* same order as the accessible tree walked from the window */
+        g_assert(record.id == (guint64)(gsize)node->obj);
+        g_assert_cmpint(record.index, ==, i);
+        g_assert_cmpint(record.parent, ==, node->parent);
+        g_assert_cmpint(record.index_in_parent, ==, node->index_in_parent);
+        g_assert(record.parent < record.index);
+        g_assert(record.role == atk_object_get_role(node->obj));
+
+        if (!ATK_IS_COMPONENT(node->obj)) continue;
+
+        atk_component_get_extents(ATK_COMPONENT(node->obj), &x, &y, &w, &h,
+                                  ATK_XY_WINDOW);
+        g_assert_cmpint(record.x, ==, x);
+        g_assert_cmpint(record.y, ==, y);
+        g_assert_cmpint(record.width, ==, w);
+        g_assert_cmpint(record.height, ==, h);
+     }
+
+   for (i = 0; i < nodes->len; ++i)
+     g_object_unref(g_array_index(nodes, EailTestNode, i).obj);
+   g_array_free(nodes, TRUE);
+   g_free(blob);
+}
+
+static void
+_on_focus_in(void *data, Evas_Object *obj, void *event_info)
+{
+   static gboolean started = FALSE;
+   GModule *module;
+   gpointer symbol = NULL;
+   AtkObject *window;
+
+   if (started) return;
+   started = TRUE;
+
+   module = g_module_open(NULL, 0);
+   g_assert(module);
+   g_assert(g_module_symbol(module, "eail_window_snapshot_geometry_blob",
+                            &symbol));
+
+   window = eailu_find_child_with_name(atk_get_root(), EAIL_TEST_BUTTON_NAME);
+   while (window && atk_object_get_role(window) != ATK_ROLE_WINDOW)
+     window = atk_object_get_parent(window);
+   g_assert(window);
+
+   _test_blob((EailTestBlobFunc)symbol, window);
+
+   g_module_close(module);
+
+   _printf("DONE. All window geometry tests passed successfully \n");
+   eail_test_code_called = TRUE;
+
+   g_assert(eail_test_code_called);
+   elm_exit();
+}
+
+EAPI_MAIN int
+elm_main(int argc, char **argv)
+{
+   Evas_Object *win, *box, *button, *list;
+   guint i;
+
+   win = eailu_create_test_window_with_glib_init(_on_done, _on_focus_in);
+
+   box = elm_box_add(win);
+   evas_object_size_hint_weight_set(box, EVAS_HINT_EXPAND, EVAS_HINT_EXPAND);
+   elm_win_resize_object_add(win, box);
+   evas_object_show(box);
+
+   for (i = 0; i < EAIL_TEST_BUTTONS; ++i)
+     {
+        button = elm_button_add(win);
+        elm_object_text_set(button, EAIL_TEST_BUTTON_NAME);
+        elm_box_pack_end(box, button);
+        evas_object_show(button);
+     }
+
+   list = elm_list_add(win);
+   evas_object_size_hint_weight_set(list, EVAS_HINT_EXPAND, EVAS_HINT_EXPAND);
+   evas_object_size_hint_align_set(list, EVAS_HINT_FILL, EVAS_HINT_FILL);
+   for (i = 0; i < EAIL_TEST_ITEMS; ++i)
+     elm_list_item_append(list, "item", NULL, NULL, NULL, NULL);
+   elm_list_go(list);
+   elm_box_pack_end(box, list);
+   evas_object_show(list);
+
+   evas_object_show(win);
+
+   elm_run();
+   elm_shutdown();
+
+   /* exit code */
+   return 0;
+}
+ELM_MAIN()